@@ -5,6 +5,7 @@
  */
 #include <stdio.h>
 #include <zephyr/types.h>
+#include <zephyr/sys/ring_buffer.h>
 #include <zephyr/drivers/uart.h>
 #include <zephyr/usb/usb_device.h>
 
@@ -28,6 +29,12 @@ static const struct device *devices[] = {
 #define USB_CDC_RX_BLOCK_SIZE CONFIG_BRIDGE_BUF_SIZE
 #define USB_CDC_RX_BLOCK_COUNT (CDC_DEVICE_COUNT * 3)
 #define USB_CDC_SLAB_ALIGNMENT 4
+#define USB_CDC_TX_BUF_SIZE CONFIG_BRIDGE_BUF_SIZE
+
+struct cdc_tx_buf {
+	struct ring_buf rb;
+	uint8_t buf[USB_CDC_TX_BUF_SIZE];
+};
 
 static void cdc_dtr_timer_handler(struct k_timer *timer);
 static void cdc_dtr_work_handler(struct k_work *work);
@@ -37,6 +44,11 @@ static K_WORK_DEFINE(cdc_dtr_work, cdc_dtr_work_handler);
 /* Incoming data from any CDC instance is copied into a block from this slab */
 K_MEM_SLAB_DEFINE(cdc_rx_slab, USB_CDC_RX_BLOCK_SIZE, USB_CDC_RX_BLOCK_COUNT, USB_CDC_SLAB_ALIGNMENT);
 
+/* TX has individual ringbuffers per CDC instance: */
+/* the event handler thread only moves the put index, */
+/* the TX interrupt only moves the get index. */
+static struct cdc_tx_buf cdc_tx_ringbufs[CDC_DEVICE_COUNT];
+
 static uint32_t cdc_ready[CDC_DEVICE_COUNT];
 static uint32_t cdc_baudrate[CDC_DEVICE_COUNT];
 
@@ -95,11 +107,42 @@ static void cdc_dtr_work_handler(struct k_work *work)
 	poll_dtr();
 }
 
+static void cdc_tx_irq_handler(const struct device *dev, int dev_idx)
+{
+	uint8_t *tx_buf;
+	int tx_length;
+	int tx_written;
+	int err;
+
+	tx_length = ring_buf_get_claim(
+			&cdc_tx_ringbufs[dev_idx].rb,
+			&tx_buf,
+			USB_CDC_TX_BUF_SIZE);
+	if (tx_length == 0) {
+		uart_irq_tx_disable(dev);
+		return;
+	}
+
+	/* Fill the endpoint directly from the ring buffer: */
+	/* bytes that do not fit are kept and sent on the next TX interrupt. */
+	tx_written = uart_fifo_fill(dev, tx_buf, tx_length);
+
+	err = ring_buf_get_finish(&cdc_tx_ringbufs[dev_idx].rb, MAX(tx_written, 0));
+	if (err) {
+		LOG_ERR("ring_buf_get_finish: %d", err);
+	}
+}
+
 static void cdc_uart_interrupt_handler(const struct device *dev, void *user_data)
 {
 	int dev_idx = (int) user_data;
 
 	uart_irq_update(dev);
+
+	if (uart_irq_tx_ready(dev)) {
+		cdc_tx_irq_handler(dev, dev_idx);
+	}
+
 	if (!uart_irq_rx_ready(dev)) {
 		return;
 	}
@@ -188,7 +231,7 @@ static bool app_event_handler(const struct app_event_header *aeh)
 	if (is_uart_data_event(aeh)) {
 		const struct uart_data_event *event =
 			cast_uart_data_event(aeh);
-		int tx_written;
+		uint32_t written;
 
 		if (event->dev_idx >= CDC_DEVICE_COUNT) {
 			return false;
@@ -198,17 +241,21 @@ static bool app_event_handler(const struct app_event_header *aeh)
 			return false;
 		}
 
-		tx_written = uart_fifo_fill(
-			devices[event->dev_idx],
+		written = ring_buf_put(
+			&cdc_tx_ringbufs[event->dev_idx].rb,
 			event->buf,
 			event->len);
 
-		if (tx_written != event->len) {
+		if (written != event->len) {
 			LOG_DBG("UART_%d->CDC_%d overflow",
 				event->dev_idx,
 				event->dev_idx);
 		}
 
+		if (written > 0) {
+			uart_irq_tx_enable(devices[event->dev_idx]);
+		}
+
 		return false;
 	}
 
@@ -250,6 +297,10 @@ static bool app_event_handler(const struct app_event_header *aeh)
 			}
 			for (int i = 0; i < CDC_DEVICE_COUNT; ++i) {
 				cdc_ready[i] = 0;
+				ring_buf_init(
+					&cdc_tx_ringbufs[i].rb,
+					sizeof(cdc_tx_ringbufs[i].buf),
+					cdc_tx_ringbufs[i].buf);
 				if (device_is_ready(devices[i])) {
 					enable_rx_irq(i);
 					LOG_DBG("%s available", devices[i]->name);
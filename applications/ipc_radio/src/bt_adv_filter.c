@@ -0,0 +1,221 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/net_buf.h>
+
+#include <zephyr/bluetooth/bluetooth.h>
+#include <zephyr/bluetooth/gap.h>
+#include <zephyr/bluetooth/hci.h>
+
+#include <zephyr/logging/log.h>
+
+#include "bt_adv_filter.h"
+
+LOG_MODULE_DECLARE(ipc_radio, CONFIG_IPC_RADIO_LOG_LEVEL);
+
+#define H4_TYPE_EVT 0x04
+
+#define FILTER_COMPANY_ID CONFIG_IPC_RADIO_BT_ADV_FILTER_COMPANY_ID
+#define FILTER_UUID16     CONFIG_IPC_RADIO_BT_ADV_FILTER_UUID16
+
+#define FILTER_COMPANY_ID_ENABLED (FILTER_COMPANY_ID != 0xFFFF)
+#define FILTER_UUID16_ENABLED     (FILTER_UUID16 != 0x0000)
+
+static uint32_t dropped_reports;
+
+static bool ad_field_matches(uint8_t type, const uint8_t *payload, uint8_t payload_len)
+{
+	switch (type) {
+	case BT_DATA_MANUFACTURER_DATA:
+		if (FILTER_COMPANY_ID_ENABLED && (payload_len >= 2) &&
+		    (sys_get_le16(payload) == FILTER_COMPANY_ID)) {
+			return true;
+		}
+		break;
+
+	case BT_DATA_UUID16_SOME:
+	case BT_DATA_UUID16_ALL:
+		if (FILTER_UUID16_ENABLED) {
+			for (uint8_t i = 0; (i + 1) < payload_len; i += 2) {
+				if (sys_get_le16(&payload[i]) == FILTER_UUID16) {
+					return true;
+				}
+			}
+		}
+		break;
+
+	case BT_DATA_SVC_DATA16:
+		if (FILTER_UUID16_ENABLED && (payload_len >= 2) &&
+		    (sys_get_le16(payload) == FILTER_UUID16)) {
+			return true;
+		}
+		break;
+
+	default:
+		break;
+	}
+
+	return false;
+}
+
+static bool ad_data_matches(const uint8_t *data, size_t len)
+{
+	while (len > 1) {
+		uint8_t field_len = data[0];
+
+		if ((field_len == 0) || (field_len >= len)) {
+			break;
+		}
+
+		if (ad_field_matches(data[1], &data[2], field_len - 1)) {
+			return true;
+		}
+
+		data += field_len + 1;
+		len -= field_len + 1;
+	}
+
+	return false;
+}
+
+static bool legacy_reports_match(const uint8_t *params, size_t len)
+{
+	uint8_t num_reports;
+
+	if (len < 1) {
+		return true;
+	}
+
+	num_reports = *params++;
+	len--;
+
+	for (uint8_t i = 0; i < num_reports; i++) {
+		const struct bt_hci_evt_le_advertising_info *info =
+			(const struct bt_hci_evt_le_advertising_info *)params;
+
+		/* Forward malformed events unchanged; the host deals with them. */
+		if ((len < sizeof(*info)) || (len < (sizeof(*info) + info->length + 1))) {
+			return true;
+		}
+
+		if (ad_data_matches(info->data, info->length)) {
+			return true;
+		}
+
+		params += sizeof(*info) + info->length + 1;
+		len -= sizeof(*info) + info->length + 1;
+	}
+
+	return false;
+}
+
+static bool ext_reports_match(const uint8_t *params, size_t len)
+{
+	uint8_t num_reports;
+
+	if (len < 1) {
+		return true;
+	}
+
+	num_reports = *params++;
+	len--;
+
+	for (uint8_t i = 0; i < num_reports; i++) {
+		const struct bt_hci_evt_le_ext_advertising_info *info =
+			(const struct bt_hci_evt_le_ext_advertising_info *)params;
+
+		if ((len < sizeof(*info)) || (len < (sizeof(*info) + info->length))) {
+			return true;
+		}
+
+		/* Always forward scan responses and chained report fragments so
+		 * that reassembly in the host is not left incomplete.
+		 */
+		uint16_t evt_type = sys_le16_to_cpu(info->evt_type);
+
+		if (((evt_type & BT_HCI_LE_ADV_EVT_TYPE_SCAN_RSP) != 0U) ||
+		    (BT_HCI_LE_ADV_EVT_TYPE_DATA_STATUS(evt_type) != 0U)) {
+			return true;
+		}
+
+		if (ad_data_matches(info->data, info->length)) {
+			return true;
+		}
+
+		params += sizeof(*info) + info->length;
+		len -= sizeof(*info) + info->length;
+	}
+
+	return false;
+}
+
+bool bt_adv_filter_drop(const struct net_buf *buf)
+{
+	const uint8_t *data = buf->data;
+	size_t len = buf->len;
+	const struct bt_hci_evt_hdr *hdr;
+	const struct bt_hci_evt_le_meta_event *me;
+	bool match;
+
+	if (!FILTER_COMPANY_ID_ENABLED && !FILTER_UUID16_ENABLED) {
+		return false;
+	}
+
+	if ((len < 1) || (data[0] != H4_TYPE_EVT)) {
+		return false;
+	}
+
+	data++;
+	len--;
+
+	if (len < sizeof(*hdr)) {
+		return false;
+	}
+
+	hdr = (const struct bt_hci_evt_hdr *)data;
+	if ((hdr->evt != BT_HCI_EVT_LE_META_EVENT) || (len < (sizeof(*hdr) + hdr->len))) {
+		return false;
+	}
+
+	data += sizeof(*hdr);
+	len = hdr->len;
+
+	if (len < sizeof(*me)) {
+		return false;
+	}
+
+	me = (const struct bt_hci_evt_le_meta_event *)data;
+	data += sizeof(*me);
+	len -= sizeof(*me);
+
+	switch (me->subevent) {
+	case BT_HCI_EVT_LE_ADVERTISING_REPORT:
+		match = legacy_reports_match(data, len);
+		break;
+
+	case BT_HCI_EVT_LE_EXT_ADVERTISING_REPORT:
+		match = ext_reports_match(data, len);
+		break;
+
+	default:
+		return false;
+	}
+
+	if (match) {
+		return false;
+	}
+
+	dropped_reports++;
+	if ((dropped_reports % 1024) == 0) {
+		LOG_INF("Dropped %u non-matching advertising reports.", dropped_reports);
+	}
+
+	return true;
+}
@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef BT_ADV_FILTER_H_
+#define BT_ADV_FILTER_H_
+
+#include <stdbool.h>
+#include <zephyr/net_buf.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Check if an HCI packet is an advertising report that should be dropped.
+ *
+ * Inspects the packet and, if it is an LE advertising report event (legacy or
+ * extended), matches the advertising data of each report against the
+ * configured filters. Packets other than advertising report events and events
+ * with at least one matching report are never dropped.
+ *
+ * @param buf HCI packet from the controller, starting with the H4 packet type.
+ *
+ * @retval true The packet contains only non-matching advertising reports
+ *              and should not be forwarded to the application core.
+ * @retval false The packet should be forwarded.
+ */
+bool bt_adv_filter_drop(const struct net_buf *buf);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BT_ADV_FILTER_H_ */
@@ -31,6 +31,10 @@
 
 #include "ipc_bt.h"
 
+#if defined(CONFIG_IPC_RADIO_BT_ADV_FILTER)
+#include "bt_adv_filter.h"
+#endif
+
 #if DT_NODE_HAS_COMPAT(DT_CHOSEN(zephyr_bt_hci_ipc), zephyr_ipc_openamp_static_vrings)
 #include <openamp/rpmsg_virtio.h>
 #define IPC_BUF_SIZE DT_PROP_OR(DT_CHOSEN(zephyr_bt_hci_ipc), zephyr_buffer_size, RPMSG_BUFFER_SIZE)
@@ -400,6 +404,14 @@ int ipc_bt_process(void)
 
 	while (1) {
 		buf = k_fifo_get(&rx_queue, K_FOREVER);
+
+#if defined(CONFIG_IPC_RADIO_BT_ADV_FILTER)
+		if (bt_adv_filter_drop(buf)) {
+			net_buf_unref(buf);
+			continue;
+		}
+#endif
+
 		send(buf, HCI_REGULAR_MSG);
 	}
 
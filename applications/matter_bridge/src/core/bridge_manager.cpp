@@ -470,12 +470,65 @@ void BridgeManager::HandleUpdate(BridgedDeviceDataProvider &dataProvider, Cluste
 			 * report. */
 			auto *device = item.value.mDevice;
 			if (CHIP_NO_ERROR == device->HandleAttributeChange(clusterId, attributeId, data, dataSize)) {
+#ifdef CONFIG_BRIDGE_REPORT_COALESCING
+				Instance().ScheduleReport(device->GetEndpointId(), clusterId, attributeId);
+#else
 				MatterReportingAttributeChangeCallback(device->GetEndpointId(), clusterId, attributeId);
+#endif
 			}
 		}
 	}
 }
 
+#ifdef CONFIG_BRIDGE_REPORT_COALESCING
+void BridgeManager::ScheduleReport(EndpointId endpointId, ClusterId clusterId, AttributeId attributeId)
+{
+	/* Coalesce repeated updates of the same attribute into a single report. */
+	for (size_t i = 0; i < mDirtyAttributesCounter; i++) {
+		if (mDirtyAttributes[i].mEndpointId == endpointId && mDirtyAttributes[i].mClusterId == clusterId &&
+		    mDirtyAttributes[i].mAttributeId == attributeId) {
+			return;
+		}
+	}
+
+	/* The batch is full, so flush it prematurely to make room for the new entry. */
+	if (mDirtyAttributesCounter >= kMaxDirtyAttributes) {
+		FlushReports();
+	}
+
+	mDirtyAttributes[mDirtyAttributesCounter++] = { endpointId, clusterId, attributeId };
+
+	if (!mReportTimerActive) {
+		CHIP_ERROR err = DeviceLayer::SystemLayer().StartTimer(
+			System::Clock::Milliseconds32(CONFIG_BRIDGE_REPORT_COALESCING_INTERVAL_MS),
+			FlushReportsTimerHandler, this);
+		if (err == CHIP_NO_ERROR) {
+			mReportTimerActive = true;
+		} else {
+			/* Without the timer the batched reports would never be sent. */
+			FlushReports();
+		}
+	}
+}
+
+void BridgeManager::FlushReports()
+{
+	for (size_t i = 0; i < mDirtyAttributesCounter; i++) {
+		MatterReportingAttributeChangeCallback(mDirtyAttributes[i].mEndpointId, mDirtyAttributes[i].mClusterId,
+						       mDirtyAttributes[i].mAttributeId);
+	}
+	mDirtyAttributesCounter = 0;
+}
+
+void BridgeManager::FlushReportsTimerHandler(System::Layer * /* layer */, void *context)
+{
+	auto *bridgeManager = reinterpret_cast<BridgeManager *>(context);
+
+	bridgeManager->mReportTimerActive = false;
+	bridgeManager->FlushReports();
+}
+#endif /* CONFIG_BRIDGE_REPORT_COALESCING */
+
 void BridgeManager::HandleCommand(BridgedDeviceDataProvider &dataProvider, ClusterId clusterId, CommandId commandId,
 				  Nrf::Matter::BindingHandler::InvokeCommand invokeCommand)
 {
@@ -256,6 +256,30 @@ private:
 	 */
 	CHIP_ERROR CreateEndpoint(uint8_t index, uint16_t endpointId);
 
+#ifdef CONFIG_BRIDGE_REPORT_COALESCING
+	static constexpr size_t kMaxDirtyAttributes = 4 * kMaxBridgedDevices;
+
+	struct DirtyAttribute {
+		chip::EndpointId mEndpointId;
+		chip::ClusterId mClusterId;
+		chip::AttributeId mAttributeId;
+	};
+
+	/**
+	 * @brief Mark an attribute dirty and schedule flushing the batched reports.
+	 *
+	 * Repeated updates of the same attribute within the coalescing interval are merged into a
+	 * single entry, so the reporting engine is notified only once per attribute per interval.
+	 *
+	 * @param endpointId endpoint of the updated attribute
+	 * @param clusterId cluster of the updated attribute
+	 * @param attributeId id of the updated attribute
+	 */
+	void ScheduleReport(chip::EndpointId endpointId, chip::ClusterId clusterId, chip::AttributeId attributeId);
+	void FlushReports();
+	static void FlushReportsTimerHandler(chip::System::Layer *layer, void *context);
+#endif
+
 	DeviceMap mDevicesMap;
 	uint16_t mNumberOfProviders{ 0 };
 	uint8_t mDevicesIndexes[BridgeManager::kMaxBridgedDevices] = { 0 };
@@ -264,6 +288,12 @@ private:
 	chip::EndpointId mFirstDynamicEndpointId;
 	chip::EndpointId mCurrentDynamicEndpointId;
 	bool mIsInitialized = false;
+
+#ifdef CONFIG_BRIDGE_REPORT_COALESCING
+	DirtyAttribute mDirtyAttributes[kMaxDirtyAttributes];
+	size_t mDirtyAttributesCounter{ 0 };
+	bool mReportTimerActive = false;
+#endif
 };
 
 } /* namespace Nrf */
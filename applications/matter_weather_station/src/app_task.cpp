@@ -126,6 +126,24 @@ public:
 	bool IsTriggerEffectEnabled() const override { return false; }
 };
 
+#ifdef CONFIG_MATTER_WEATHER_STATION_MEASUREMENT_DEADBAND
+/* Check whether the new value differs from the last reported one at least by the configured
+ * delta and update the last reported value if so. Invalid values are always reported, so that
+ * the clusters reflect sensor failures without delay.
+ */
+template <typename T> bool SignificantChange(T newValue, T invalidValue, T delta, chip::Optional<T> &lastValue)
+{
+	if (newValue != invalidValue && lastValue.HasValue() && lastValue.Value() != invalidValue) {
+		T diff = newValue > lastValue.Value() ? newValue - lastValue.Value() : lastValue.Value() - newValue;
+		if (diff < delta) {
+			return false;
+		}
+	}
+	lastValue.SetValue(newValue);
+	return true;
+}
+#endif
+
 IdentifyDelegateImplWeatherStation sIdentifyDelegateImplWeatherStation;
 DefaultTimerDelegate sTimerDelegate;
 
@@ -169,6 +187,14 @@ void AppTask::UpdateTemperatureClusterState()
 		}
 		LOG_DBG("New temperature measurement %d.%d *C", temperature.val1, temperature.val2);
 
+#ifdef CONFIG_MATTER_WEATHER_STATION_MEASUREMENT_DEADBAND
+		static chip::Optional<int16_t> lastReportedValue;
+		if (!SignificantChange<int16_t>(newValue, kTemperatureMeasurementAttributeInvalidValue,
+						CONFIG_MATTER_WEATHER_STATION_TEMPERATURE_DELTA, lastReportedValue)) {
+			return;
+		}
+#endif
+
 		status = Clusters::TemperatureMeasurement::Attributes::MeasuredValue::Set(
 			kTemperatureMeasurementEndpointId, newValue);
 		if (status != Protocols::InteractionModel::Status::Success) {
@@ -197,6 +223,14 @@ void AppTask::UpdatePressureClusterState()
 		}
 		LOG_DBG("New pressure measurement %d.%d kPa", pressure.val1, pressure.val2);
 
+#ifdef CONFIG_MATTER_WEATHER_STATION_MEASUREMENT_DEADBAND
+		static chip::Optional<int16_t> lastReportedValue;
+		if (!SignificantChange<int16_t>(newValue, kPressureMeasurementAttributeInvalidValue,
+						CONFIG_MATTER_WEATHER_STATION_PRESSURE_DELTA, lastReportedValue)) {
+			return;
+		}
+#endif
+
 		status = Clusters::PressureMeasurement::Attributes::MeasuredValue::Set(kPressureMeasurementEndpointId,
 										       newValue);
 		if (status != Protocols::InteractionModel::Status::Success) {
@@ -225,6 +259,14 @@ void AppTask::UpdateRelativeHumidityClusterState()
 		}
 		LOG_DBG("New humidity measurement %d.%d %%", humidity.val1, humidity.val2);
 
+#ifdef CONFIG_MATTER_WEATHER_STATION_MEASUREMENT_DEADBAND
+		static chip::Optional<uint16_t> lastReportedValue;
+		if (!SignificantChange<uint16_t>(newValue, kHumidityMeasurementAttributeInvalidValue,
+						 CONFIG_MATTER_WEATHER_STATION_HUMIDITY_DELTA, lastReportedValue)) {
+			return;
+		}
+#endif
+
 		status = Clusters::RelativeHumidityMeasurement::Attributes::MeasuredValue::Set(
 			kHumidityMeasurementEndpointId, newValue);
 		if (status != Protocols::InteractionModel::Status::Success) {
@@ -284,19 +326,33 @@ void AppTask::UpdatePowerSourceClusterState()
 		batteryCharged = Clusters::PowerSource::BatChargeStateEnum::kIsNotCharging;
 	}
 
-	status = Clusters::PowerSource::Attributes::BatVoltage::Set(kPowerSourceEndpointId, voltage);
-	if (status != Protocols::InteractionModel::Status::Success) {
-		LOG_ERR("Updating battery voltage failed %x", to_underlying(status));
-	}
+#ifdef CONFIG_MATTER_WEATHER_STATION_MEASUREMENT_DEADBAND
+	/* Battery percentage cannot exceed 200, so 0xff is safe to use as the invalid value marker. */
+	static chip::Optional<uint8_t> lastReportedPercentage;
+	bool reportBatteryLevel =
+		SignificantChange<uint8_t>(batteryPercentage, 0xff, CONFIG_MATTER_WEATHER_STATION_BATTERY_DELTA,
+					   lastReportedPercentage);
+#else
+	bool reportBatteryLevel = true;
+#endif
 
-	status = Clusters::PowerSource::Attributes::BatPercentRemaining::Set(kPowerSourceEndpointId, batteryPercentage);
-	if (status != Protocols::InteractionModel::Status::Success) {
-		LOG_ERR("Updating battery percentage failed %x", to_underlying(status));
-	}
+	if (reportBatteryLevel) {
+		status = Clusters::PowerSource::Attributes::BatVoltage::Set(kPowerSourceEndpointId, voltage);
+		if (status != Protocols::InteractionModel::Status::Success) {
+			LOG_ERR("Updating battery voltage failed %x", to_underlying(status));
+		}
 
-	status = Clusters::PowerSource::Attributes::BatTimeRemaining::Set(kPowerSourceEndpointId, batteryTimeRemaining);
-	if (status != Protocols::InteractionModel::Status::Success) {
-		LOG_ERR("Updating battery time remaining failed %x", to_underlying(status));
+		status = Clusters::PowerSource::Attributes::BatPercentRemaining::Set(kPowerSourceEndpointId,
+										     batteryPercentage);
+		if (status != Protocols::InteractionModel::Status::Success) {
+			LOG_ERR("Updating battery percentage failed %x", to_underlying(status));
+		}
+
+		status = Clusters::PowerSource::Attributes::BatTimeRemaining::Set(kPowerSourceEndpointId,
+										  batteryTimeRemaining);
+		if (status != Protocols::InteractionModel::Status::Success) {
+			LOG_ERR("Updating battery time remaining failed %x", to_underlying(status));
+		}
 	}
 
 	status = Clusters::PowerSource::Attributes::BatChargeLevel::Set(kPowerSourceEndpointId, batteryChargeLevel);
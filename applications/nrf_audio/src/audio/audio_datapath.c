@@ -89,6 +89,10 @@ LOG_MODULE_REGISTER(audio_datapath, CONFIG_AUDIO_DATAPATH_LOG_LEVEL);
 #define DRIFT_ERR_THRESH_UNLOCK	   32
 /* To get smaller corrections */
 #define DRIFT_REGULATOR_DIV_FACTOR 2
+/* Accumulated error in microseconds needed before the integral term nudges the
+ * center frequency
+ */
+#define DRIFT_REGULATOR_I_DIV_FACTOR 8
 
 /* How often to print under-run warning */
 #define LOG_INTERVAL_BLKS 5000
@@ -160,6 +164,7 @@ static struct {
 		uint16_t ctr; /* Count func calls. Used for waiting */
 		uint32_t meas_start_time_us;
 		uint32_t center_freq;
+		int32_t err_integ_us; /* Accumulated residual error for the integral term */
 		bool enabled;
 	} drift_comp;
 
@@ -170,6 +175,18 @@ static struct {
 		uint32_t pres_delay_us;
 		bool enabled;
 	} pres_comp;
+
+	/* Continuous measurement of the presentation margin, i.e. how much of the
+	 * configured buffering the observed reception jitter actually requires.
+	 */
+	struct {
+		bool valid;
+		uint32_t min_pres_dly_us;
+		uint32_t max_pres_dly_us;
+		uint16_t min_fill_blks;
+		uint32_t rx_dly_min_us;
+		uint32_t rx_dly_max_us;
+	} margin_meas;
 } ctrl_blk;
 
 /**
@@ -186,6 +203,42 @@ static int filled_blocks_get(void)
 	}
 }
 
+/**
+ * @brief	Reset the presentation margin measurements.
+ */
+static void pres_margin_meas_reset(void)
+{
+	ctrl_blk.margin_meas.valid = false;
+	ctrl_blk.margin_meas.min_pres_dly_us = UINT32_MAX;
+	ctrl_blk.margin_meas.max_pres_dly_us = 0;
+	ctrl_blk.margin_meas.min_fill_blks = UINT16_MAX;
+	ctrl_blk.margin_meas.rx_dly_min_us = UINT32_MAX;
+	ctrl_blk.margin_meas.rx_dly_max_us = 0;
+}
+
+/**
+ * @brief	Record the measured presentation delay and output FIFO fill level.
+ *
+ * @note	Called for every I2S block while the stream is running, so only cheap
+ *		compare-and-store operations are done here.
+ */
+static void pres_margin_meas_update(void)
+{
+	uint32_t fill_blks = filled_blocks_get();
+
+	if (ctrl_blk.drift_comp.state != DRIFT_STATE_LOCKED) {
+		/* The measurements are not meaningful until the audio clock is locked. */
+		return;
+	}
+
+	ctrl_blk.margin_meas.min_pres_dly_us =
+		MIN(ctrl_blk.margin_meas.min_pres_dly_us, ctrl_blk.current_pres_dly_us);
+	ctrl_blk.margin_meas.max_pres_dly_us =
+		MAX(ctrl_blk.margin_meas.max_pres_dly_us, ctrl_blk.current_pres_dly_us);
+	ctrl_blk.margin_meas.min_fill_blks = MIN(ctrl_blk.margin_meas.min_fill_blks, fill_blks);
+	ctrl_blk.margin_meas.valid = true;
+}
+
 static struct audio_metadata i2s_meta = {.data_coding = PCM,
 					 .data_len_us = BLK_PERIOD_US,
 					 .sample_rate_hz = CONFIG_AUDIO_SAMPLE_RATE_HZ,
@@ -339,6 +392,7 @@ static inline void audio_datapath_drift_compensation(uint32_t frame_start_ts_us)
 		}
 
 		if ((err_us < DRIFT_ERR_THRESH_LOCK) && (err_us > -DRIFT_ERR_THRESH_LOCK)) {
+			ctrl_blk.drift_comp.err_integ_us = 0;
 			drift_comp_state_set(DRIFT_STATE_LOCKED);
 		}
 
@@ -358,6 +412,26 @@ static inline void audio_datapath_drift_compensation(uint32_t frame_start_ts_us)
 		err_us /= DRIFT_REGULATOR_DIV_FACTOR;
 		int32_t freq_adj = APLL_FREQ_ADJ(err_us);
 
+		/* Integrate the residual error into the center frequency, so a constant
+		 * drift is held by the center frequency itself instead of a standing
+		 * phase error. The integration is kept much slower than the
+		 * proportional term, and the center frequency stays clamped to the
+		 * APLL range to avoid wind-up.
+		 */
+		ctrl_blk.drift_comp.err_integ_us += err_us;
+
+		int32_t integ_steps = ctrl_blk.drift_comp.err_integ_us / DRIFT_REGULATOR_I_DIV_FACTOR;
+
+		if (integ_steps != 0) {
+			ctrl_blk.drift_comp.err_integ_us -=
+				integ_steps * DRIFT_REGULATOR_I_DIV_FACTOR;
+
+			ctrl_blk.drift_comp.center_freq =
+				CLAMP((int32_t)ctrl_blk.drift_comp.center_freq +
+					      APLL_FREQ_ADJ(integ_steps),
+				      APLL_FREQ_MIN, APLL_FREQ_MAX);
+		}
+
 		ret = audio_clock_set(ctrl_blk.drift_comp.center_freq + freq_adj);
 		if (ret) {
 			LOG_ERR("Failed to set audio clock frequency");
@@ -729,6 +803,8 @@ static void audio_datapath_i2s_blk_complete(uint32_t frame_start_ts_us, uint32_t
 		if (tone_active) {
 			tone_mix(tx_buf);
 		}
+
+		pres_margin_meas_update();
 	}
 
 	/********** I2S RX **********/
@@ -1047,6 +1123,14 @@ void audio_datapath_stream_out(struct net_buf *audio_frame_in)
 		 */
 		ctrl_blk.prev_pres_sdu_ref_us = meta_in->ref_ts_us;
 		consec_invalid_ts_deltas = 0;
+
+		/* Record the anchor-to-receive delay to measure the reception jitter. */
+		uint32_t rx_dly_us = meta_in->data_rx_ts_us - meta_in->ref_ts_us;
+
+		ctrl_blk.margin_meas.rx_dly_min_us =
+			MIN(ctrl_blk.margin_meas.rx_dly_min_us, rx_dly_us);
+		ctrl_blk.margin_meas.rx_dly_max_us =
+			MAX(ctrl_blk.margin_meas.rx_dly_max_us, rx_dly_us);
 	}
 
 	/*** Presentation compensation ***/
@@ -1147,6 +1231,8 @@ int audio_datapath_start(struct k_msgq *audio_q_rx)
 		/* Clear counters and mute initial audio */
 		memset(&ctrl_blk.out, 0, sizeof(ctrl_blk.out));
 
+		pres_margin_meas_reset();
+
 		audio_datapath_i2s_start();
 		ctrl_blk.stream_started = true;
 
@@ -1194,6 +1280,8 @@ int audio_datapath_init(void)
 
 	ctrl_blk.pres_comp.pres_delay_us = CONFIG_BT_AUDIO_PRESENTATION_DELAY_US;
 
+	pres_margin_meas_reset();
+
 	return 0;
 }
 
@@ -1321,6 +1409,47 @@ static int cmd_audio_pres_comp_disable(const struct shell *shell, size_t argc, c
 	return 0;
 }
 
+static int cmd_audio_pres_margin_print(const struct shell *shell, size_t argc, const char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	if (!ctrl_blk.margin_meas.valid) {
+		shell_print(shell, "No presentation margin measurements recorded");
+		return 0;
+	}
+
+	uint32_t headroom_us = ctrl_blk.margin_meas.min_fill_blks * BLK_PERIOD_US;
+	uint32_t rx_jitter_us =
+		ctrl_blk.margin_meas.rx_dly_max_us - ctrl_blk.margin_meas.rx_dly_min_us;
+	int32_t reclaimable_us =
+		(int32_t)headroom_us - rx_jitter_us - CONFIG_AUDIO_FRAME_DURATION_US;
+
+	shell_print(shell, "Presentation delay setting: %u us", ctrl_blk.pres_comp.pres_delay_us);
+	shell_print(shell, "Measured presentation delay: min %u us, max %u us",
+		    ctrl_blk.margin_meas.min_pres_dly_us, ctrl_blk.margin_meas.max_pres_dly_us);
+	shell_print(shell, "Minimum output FIFO fill: %u blocks (%u us)",
+		    ctrl_blk.margin_meas.min_fill_blks, headroom_us);
+	shell_print(shell, "Anchor-to-receive delay: min %u us, max %u us (jitter %u us)",
+		    ctrl_blk.margin_meas.rx_dly_min_us, ctrl_blk.margin_meas.rx_dly_max_us,
+		    rx_jitter_us);
+	shell_print(shell, "Estimated reclaimable margin: %d us", MAX(reclaimable_us, 0));
+
+	return 0;
+}
+
+static int cmd_audio_pres_margin_reset(const struct shell *shell, size_t argc, const char **argv)
+{
+	ARG_UNUSED(argc);
+	ARG_UNUSED(argv);
+
+	pres_margin_meas_reset();
+
+	shell_print(shell, "Presentation margin measurements reset");
+
+	return 0;
+}
+
 SHELL_STATIC_SUBCMD_SET_CREATE(test_cmd,
 			       SHELL_COND_CMD(CONFIG_SHELL, nrf_tone_start, NULL,
 					      "Start local tone from nRF5340", cmd_i2s_tone_play),
@@ -1338,6 +1467,12 @@ SHELL_STATIC_SUBCMD_SET_CREATE(test_cmd,
 			       SHELL_COND_CMD(CONFIG_SHELL, pll_pres_comp_disable, NULL,
 					      "Disable audio presentation compensation",
 					      cmd_audio_pres_comp_disable),
+			       SHELL_COND_CMD(CONFIG_SHELL, pres_margin_print, NULL,
+					      "Print measured presentation margin",
+					      cmd_audio_pres_margin_print),
+			       SHELL_COND_CMD(CONFIG_SHELL, pres_margin_reset, NULL,
+					      "Reset presentation margin measurements",
+					      cmd_audio_pres_margin_reset),
 			       SHELL_SUBCMD_SET_END);
 
 SHELL_CMD_REGISTER(test, &test_cmd, "Test mode commands", NULL);
@@ -92,6 +92,48 @@ static const uint8_t input_reports[] = {
 #endif
 };
 
+/** @brief Map from a HID report ID to the corresponding index in the input reports map
+ *         increased by one. Zero marks a report ID that is not part of the input reports map.
+ *
+ * The map allows to find the index of an input report in constant time instead of iterating
+ * over the input reports map.
+ */
+static const uint8_t input_report_idx_map[REPORT_ID_COUNT] = {
+#if CONFIG_DESKTOP_HID_REPORT_MOUSE_SUPPORT
+	[REPORT_ID_MOUSE] = 1,
+#endif
+#if CONFIG_DESKTOP_HID_REPORT_KEYBOARD_SUPPORT
+	[REPORT_ID_KEYBOARD_KEYS] = 1 +
+		IS_ENABLED(CONFIG_DESKTOP_HID_REPORT_MOUSE_SUPPORT),
+#endif
+#if CONFIG_DESKTOP_HID_REPORT_SYSTEM_CTRL_SUPPORT
+	[REPORT_ID_SYSTEM_CTRL] = 1 +
+		IS_ENABLED(CONFIG_DESKTOP_HID_REPORT_MOUSE_SUPPORT) +
+		IS_ENABLED(CONFIG_DESKTOP_HID_REPORT_KEYBOARD_SUPPORT),
+#endif
+#if CONFIG_DESKTOP_HID_REPORT_CONSUMER_CTRL_SUPPORT
+	[REPORT_ID_CONSUMER_CTRL] = 1 +
+		IS_ENABLED(CONFIG_DESKTOP_HID_REPORT_MOUSE_SUPPORT) +
+		IS_ENABLED(CONFIG_DESKTOP_HID_REPORT_KEYBOARD_SUPPORT) +
+		IS_ENABLED(CONFIG_DESKTOP_HID_REPORT_SYSTEM_CTRL_SUPPORT),
+#endif
+#if CONFIG_DESKTOP_HID_BOOT_INTERFACE_MOUSE
+	[REPORT_ID_BOOT_MOUSE] = 1 +
+		IS_ENABLED(CONFIG_DESKTOP_HID_REPORT_MOUSE_SUPPORT) +
+		IS_ENABLED(CONFIG_DESKTOP_HID_REPORT_KEYBOARD_SUPPORT) +
+		IS_ENABLED(CONFIG_DESKTOP_HID_REPORT_SYSTEM_CTRL_SUPPORT) +
+		IS_ENABLED(CONFIG_DESKTOP_HID_REPORT_CONSUMER_CTRL_SUPPORT),
+#endif
+#if CONFIG_DESKTOP_HID_BOOT_INTERFACE_KEYBOARD
+	[REPORT_ID_BOOT_KEYBOARD] = 1 +
+		IS_ENABLED(CONFIG_DESKTOP_HID_REPORT_MOUSE_SUPPORT) +
+		IS_ENABLED(CONFIG_DESKTOP_HID_REPORT_KEYBOARD_SUPPORT) +
+		IS_ENABLED(CONFIG_DESKTOP_HID_REPORT_SYSTEM_CTRL_SUPPORT) +
+		IS_ENABLED(CONFIG_DESKTOP_HID_REPORT_CONSUMER_CTRL_SUPPORT) +
+		IS_ENABLED(CONFIG_DESKTOP_HID_BOOT_INTERFACE_MOUSE),
+#endif
+};
+
 /** @brief Output reports map. */
 static const uint8_t output_reports[] = {
 #if CONFIG_DESKTOP_HID_REPORT_KEYBOARD_SUPPORT
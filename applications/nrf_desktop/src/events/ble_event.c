@@ -46,4 +46,19 @@ APP_EVENT_TYPE_DEFINE(ble_qos_event,
 		  APP_EVENT_FLAGS_CREATE(
 			IF_ENABLED(CONFIG_DESKTOP_INIT_LOG_BLE_QOS_EVENT,
 				(APP_EVENT_TYPE_FLAGS_INIT_LOG_ENABLE))));
+
+static void log_ble_qos_link_event(const struct app_event_header *aeh)
+{
+	const struct ble_qos_link_event *event = cast_ble_qos_link_event(aeh);
+
+	APP_EVENT_MANAGER_LOG(aeh, "crc ok: %" PRIu32 " crc error: %" PRIu32,
+			      event->crc_ok_count, event->crc_error_count);
+}
+
+APP_EVENT_TYPE_DEFINE(ble_qos_link_event,
+		  log_ble_qos_link_event,
+		  NULL,
+		  APP_EVENT_FLAGS_CREATE(
+			IF_ENABLED(CONFIG_DESKTOP_INIT_LOG_BLE_QOS_LINK_EVENT,
+				(APP_EVENT_TYPE_FLAGS_INIT_LOG_ENABLE))));
 #endif
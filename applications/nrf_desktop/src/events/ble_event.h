@@ -56,6 +56,19 @@ struct ble_qos_event {
 	uint8_t chmap[CHMAP_BLE_BITMASK_SIZE];
 };
 APP_EVENT_TYPE_DECLARE(ble_qos_event);
+
+/** @brief BLE QoS link quality event.
+ *
+ * The event carries packet CRC statistics accumulated over one QoS processing
+ * interval, summed over all data channels.
+ */
+struct ble_qos_link_event {
+	struct app_event_header header;
+
+	uint32_t crc_ok_count;
+	uint32_t crc_error_count;
+};
+APP_EVENT_TYPE_DECLARE(ble_qos_link_event);
 #endif
 
 #ifdef __cplusplus
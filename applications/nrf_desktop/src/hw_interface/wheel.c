@@ -28,6 +28,7 @@ LOG_MODULE_REGISTER(MODULE, CONFIG_DESKTOP_WHEEL_LOG_LEVEL);
 #define PINS_PER_GPIO_PORT	32
 #define SENSOR_IDLE_TIMEOUT \
 	(CONFIG_DESKTOP_WHEEL_SENSOR_IDLE_TIMEOUT * MSEC_PER_SEC) /* ms */
+#define WHEEL_COALESCE_INTERVAL	CONFIG_DESKTOP_WHEEL_COALESCE_INTERVAL_MS /* ms */
 
 
 enum state {
@@ -65,6 +66,8 @@ static const struct device *qdec_dev = DEVICE_DT_GET(QDEC_DT_NODE_ID);
 static struct gpio_callback gpio_cbs[ARRAY_SIZE(qdec_pin)];
 static struct k_spinlock lock;
 static struct k_work_delayable idle_timeout;
+static struct k_work_delayable wheel_flush;
+static atomic_t wheel_acc;
 static bool qdec_triggered;
 static enum state state;
 
@@ -104,6 +107,38 @@ static gpio_pin_t map_gpio_pin(int pin_number)
 	return pin_number % PINS_PER_GPIO_PORT;
 }
 
+static void submit_wheel_event(int32_t wheel)
+{
+	struct wheel_event *event = new_wheel_event();
+
+	event->wheel = MAX(MIN(wheel, SCHAR_MAX), SCHAR_MIN);
+
+	APP_EVENT_SUBMIT(event);
+}
+
+static void wheel_flush_fn(struct k_work *work)
+{
+	int32_t wheel = (int32_t)atomic_set(&wheel_acc, 0);
+
+	if (wheel == 0) {
+		return;
+	}
+
+	int32_t clamped = MAX(MIN(wheel, SCHAR_MAX), SCHAR_MIN);
+
+	if (clamped != wheel) {
+		/* Keep the remainder for the next flush. */
+		atomic_add(&wheel_acc, wheel - clamped);
+	}
+
+	submit_wheel_event(clamped);
+
+	/* Keep coalescing while the wheel is spinning. The chain stops at the first flush
+	 * with no accumulated delta.
+	 */
+	k_work_reschedule(&wheel_flush, K_MSEC(WHEEL_COALESCE_INTERVAL));
+}
+
 static void data_ready_handler(const struct device *dev, const struct sensor_trigger *trig)
 {
 	if (IS_ENABLED(CONFIG_ASSERT)) {
@@ -129,8 +164,6 @@ static void data_ready_handler(const struct device *dev, const struct sensor_tri
 		return;
 	}
 
-	struct wheel_event *event = new_wheel_event();
-
 	int32_t wheel = value.val1;
 
 	if (!IS_ENABLED(CONFIG_DESKTOP_WHEEL_INVERT_AXIS)) {
@@ -143,9 +176,18 @@ static void data_ready_handler(const struct device *dev, const struct sensor_tri
 		wheel /= CONFIG_DESKTOP_WHEEL_SENSOR_VALUE_DIVIDER;
 	}
 
-	event->wheel = MAX(MIN(wheel, SCHAR_MAX), SCHAR_MIN);
+	if (WHEEL_COALESCE_INTERVAL > 0) {
+		atomic_add(&wheel_acc, wheel);
 
-	APP_EVENT_SUBMIT(event);
+		/* The flush work runs immediately for the first sample after an idle
+		 * period and then once per the coalescing interval.
+		 */
+		if (!k_work_delayable_is_pending(&wheel_flush)) {
+			k_work_reschedule(&wheel_flush, K_NO_WAIT);
+		}
+	} else {
+		submit_wheel_event(wheel);
+	}
 
 	qdec_triggered = true;
 }
@@ -314,6 +356,10 @@ static int disable_qdec(enum state next_state)
 				/* Cancel cannot fail if executed from another work's context. */
 				(void)k_work_cancel_delayable(&idle_timeout);
 			}
+			if (WHEEL_COALESCE_INTERVAL > 0) {
+				(void)k_work_cancel_delayable(&wheel_flush);
+				atomic_set(&wheel_acc, 0);
+			}
 			state = next_state;
 		}
 	}
@@ -350,6 +396,10 @@ static int init(void)
 		k_work_init_delayable(&idle_timeout, idle_timeout_fn);
 	}
 
+	if (WHEEL_COALESCE_INTERVAL > 0) {
+		k_work_init_delayable(&wheel_flush, wheel_flush_fn);
+	}
+
 	if (!device_is_ready(qdec_dev)) {
 		LOG_ERR("QDEC device not ready");
 		return -ENODEV;
@@ -49,6 +49,9 @@ struct connected_peer {
 static struct connected_peer peers[CONFIG_BT_MAX_CONN];
 static bool usb_suspended;
 
+/* Peripheral latency override applied while the link quality is degraded. */
+static bool qos_latency_override;
+
 static void conn_params_update_fn(struct k_work *work);
 static K_WORK_DELAYABLE_DEFINE(conn_params_update, conn_params_update_fn);
 
@@ -110,6 +113,15 @@ static int set_llpm_conn_param(struct bt_conn *conn, uint16_t latency)
 #endif /* CONFIG_CAF_BLE_USE_LLPM */
 }
 
+static uint16_t get_peer_latency(const struct connected_peer *peer)
+{
+	if (IS_ENABLED(CONFIG_DESKTOP_BLE_QOS_MANAGED_LATENCY) && qos_latency_override) {
+		return 0;
+	}
+
+	return peer->requested_latency;
+}
+
 static int set_conn_params(struct connected_peer *peer)
 {
 	int err;
@@ -134,14 +146,14 @@ static int set_conn_params(struct connected_peer *peer)
 		if (curr_ci_us > CONN_INTERVAL_PRE_LLPM_MAX_US) {
 			err = set_le_conn_param(peer->conn,
 						BT_GAP_US_TO_CONN_INTERVAL(CONN_INTERVAL_BLE_US),
-						peer->requested_latency);
+						get_peer_latency(peer));
 		} else {
-			err = set_llpm_conn_param(peer->conn, peer->requested_latency);
+			err = set_llpm_conn_param(peer->conn, get_peer_latency(peer));
 		}
 	} else {
 		err = set_le_conn_param(peer->conn,
 					BT_GAP_US_TO_CONN_INTERVAL(CONN_INTERVAL_BLE_US),
-					peer->requested_latency);
+					get_peer_latency(peer));
 	}
 
 	if (!err) {
@@ -204,7 +216,7 @@ static bool conn_params_update_required(struct connected_peer *peer)
 		}
 	} else if ((peer->use_llpm && (interval_us != CONN_INTERVAL_LLPM_US)) ||
 		   (!peer->use_llpm && (interval_us != CONN_INTERVAL_BLE_US)) ||
-		   (info.le.latency != peer->requested_latency)) {
+		   (info.le.latency != get_peer_latency(peer))) {
 		return true;
 	}
 
@@ -260,6 +272,47 @@ static void usb_state_event_handler(enum usb_state new_state)
 	k_work_reschedule(&conn_params_update, K_NO_WAIT);
 }
 
+#ifdef CONFIG_DESKTOP_BLE_QOS_MANAGED_LATENCY
+static uint8_t qos_recovery_interval_cnt;
+
+static void ble_qos_link_event_handler(const struct ble_qos_link_event *event)
+{
+	uint32_t total = event->crc_ok_count + event->crc_error_count;
+
+	if (total == 0) {
+		return;
+	}
+
+	uint32_t error_permille = (event->crc_error_count * 1000) / total;
+
+	if (error_permille >= CONFIG_DESKTOP_BLE_QOS_MANAGED_LATENCY_ERROR_THRESHOLD) {
+		qos_recovery_interval_cnt = 0;
+		if (!qos_latency_override) {
+			qos_latency_override = true;
+			LOG_INF("Link degraded (error rate: %" PRIu32
+				" permille), overriding peripheral latency", error_permille);
+			k_work_reschedule(&conn_params_update, K_NO_WAIT);
+		}
+	} else if (qos_latency_override &&
+		   (error_permille <= CONFIG_DESKTOP_BLE_QOS_MANAGED_LATENCY_RECOVERY_THRESHOLD)) {
+		qos_recovery_interval_cnt++;
+		if (qos_recovery_interval_cnt >=
+		    CONFIG_DESKTOP_BLE_QOS_MANAGED_LATENCY_RECOVERY_INTERVALS) {
+			qos_latency_override = false;
+			qos_recovery_interval_cnt = 0;
+			LOG_INF("Link recovered (error rate: %" PRIu32
+				" permille), restoring requested latency", error_permille);
+			k_work_reschedule(&conn_params_update, K_NO_WAIT);
+		}
+	} else {
+		/* Error rate between the recovery and error thresholds. Reset the recovery
+		 * counter to keep the current parameters (hysteresis).
+		 */
+		qos_recovery_interval_cnt = 0;
+	}
+}
+#endif /* CONFIG_DESKTOP_BLE_QOS_MANAGED_LATENCY */
+
 static void peer_connected(struct bt_conn *conn)
 {
 	struct connected_peer *new_peer = NULL;
@@ -355,6 +408,14 @@ static bool app_event_handler(const struct app_event_header *aeh)
 		return false;
 	}
 
+#ifdef CONFIG_DESKTOP_BLE_QOS_MANAGED_LATENCY
+	if (is_ble_qos_link_event(aeh)) {
+		ble_qos_link_event_handler(cast_ble_qos_link_event(aeh));
+
+		return false;
+	}
+#endif /* CONFIG_DESKTOP_BLE_QOS_MANAGED_LATENCY */
+
 	/* If event is unhandled, unsubscribe. */
 	__ASSERT_NO_MSG(false);
 
@@ -369,3 +430,6 @@ APP_EVENT_SUBSCRIBE(MODULE, ble_peer_conn_params_event);
 #ifdef CONFIG_DESKTOP_BLE_USB_MANAGED_CI
 APP_EVENT_SUBSCRIBE(MODULE, usb_state_event);
 #endif
+#ifdef CONFIG_DESKTOP_BLE_QOS_MANAGED_LATENCY
+APP_EVENT_SUBSCRIBE(MODULE, ble_qos_link_event);
+#endif
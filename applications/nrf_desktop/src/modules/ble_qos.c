@@ -89,6 +89,8 @@ static uint8_t current_chmap[CHMAP_BLE_BITMASK_SIZE] = CHMAP_BLE_BITMASK_DEFAULT
 static atomic_t processing;
 static atomic_t new_blacklist;
 static atomic_t params_updated;
+static atomic_t crc_ok_count;
+static atomic_t crc_error_count;
 static struct chmap_filter_params filter_params;
 static struct k_mutex data_access_mutex;
 
@@ -417,6 +419,9 @@ static bool on_vs_evt(struct net_buf_simple *buf)
 
 		evt = (void *)buf->data;
 
+		atomic_add(&crc_ok_count, evt->crc_ok_count);
+		atomic_add(&crc_error_count, evt->crc_error_count);
+
 		chmap_filter_crc_update(
 			chmap_inst,
 			evt->channel_index,
@@ -750,6 +755,15 @@ static void ble_qos_thread_fn(void)
 			}
 		}
 
+		/* Broadcast link quality statistics gathered since the previous
+		 * processing interval.
+		 */
+		struct ble_qos_link_event *link_event = new_ble_qos_link_event();
+
+		link_event->crc_ok_count = (uint32_t)atomic_set(&crc_ok_count, 0);
+		link_event->crc_error_count = (uint32_t)atomic_set(&crc_error_count, 0);
+		APP_EVENT_SUBMIT(link_event);
+
 		/* Run processing function. */
 		/* Atomic variable is used as data busy flag */
 		/* (this thread runs at the lowest priority) */
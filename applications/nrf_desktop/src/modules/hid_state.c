@@ -76,16 +76,17 @@ static struct hid_state state;
 
 static size_t get_input_report_idx(uint8_t report_id)
 {
-	for (size_t i = 0; i < ARRAY_SIZE(input_reports); i++) {
-		if (input_reports[i] == report_id) {
-			return i;
-		}
+	uint8_t idx = (report_id < ARRAY_SIZE(input_report_idx_map)) ?
+		      input_report_idx_map[report_id] : 0;
+
+	if (idx == 0) {
+		/* Should not happen. */
+		LOG_ERR("No index for input report ID:0x%" PRIx8, report_id);
+		__ASSERT_NO_MSG(false);
+		return 0;
 	}
 
-	/* Should not happen. */
-	LOG_ERR("No index for input report ID:0x%" PRIx8, report_id);
-	__ASSERT_NO_MSG(false);
-	return 0;
+	return idx - 1;
 }
 
 static size_t get_output_report_idx(uint8_t report_id)
@@ -702,6 +703,15 @@ static bool handle_module_state_event(const struct module_state_event *event)
 		__ASSERT_NO_MSG(!initialized);
 		initialized = true;
 
+		if (IS_ENABLED(CONFIG_ASSERT)) {
+			/* Validate that the input report index map is consistent with the
+			 * input reports map.
+			 */
+			for (size_t i = 0; i < ARRAY_SIZE(input_reports); i++) {
+				__ASSERT_NO_MSG(input_report_idx_map[input_reports[i]] == i + 1);
+			}
+		}
+
 		LOG_INF("Init HID state!");
 	}
 
@@ -42,6 +42,13 @@ static struct hid_reportq queues[CONFIG_DESKTOP_HID_REPORTQ_QUEUE_COUNT];
 /* Ensure that enabled_report_idx_bm can handle all of the report indexes. */
 BUILD_ASSERT(ARRAY_SIZE(input_reports) <= 16);
 
+/* The slab is sized for the worst case (every report list of every queue full), so allocation
+ * of an enqueued report never fails and does not involve the heap on the HID report path.
+ */
+K_MEM_SLAB_DEFINE_STATIC(enqueued_report_slab, sizeof(struct enqueued_report),
+			 CONFIG_DESKTOP_HID_REPORTQ_QUEUE_COUNT * ARRAY_SIZE(input_reports) *
+			 MAX_ENQUEUED_REPORTS, __alignof__(struct enqueued_report));
+
 static struct enqueued_report *get_enqueued_report(struct counted_list *cnt_list)
 {
 	sys_snode_t *node = sys_slist_get(&cnt_list->list);
@@ -74,7 +81,7 @@ static struct hid_report_event *get_enqueued_event(struct counted_list *cnt_list
 
 	struct hid_report_event *event = report->event;
 
-	k_free(report);
+	k_mem_slab_free(&enqueued_report_slab, report);
 
 	return event;
 }
@@ -96,7 +103,9 @@ static void enqueue_event(struct counted_list *cnt_list, struct hid_report_event
 	struct enqueued_report *report;
 
 	if (cnt_list->node_count < MAX_ENQUEUED_REPORTS) {
-		report = k_malloc(sizeof(*report));
+		if (k_mem_slab_alloc(&enqueued_report_slab, (void **)&report, K_NO_WAIT)) {
+			report = NULL;
+		}
 	} else {
 		LOG_WRN("Enqueue dropped the oldest report");
 
@@ -183,14 +192,15 @@ static uint8_t get_input_report_idx(uint8_t rep_id)
 {
 	BUILD_ASSERT(ARRAY_SIZE(input_reports) <= REPORT_IDX_UNSUPPORTED);
 
-	for (size_t i = 0; i < ARRAY_SIZE(input_reports); i++) {
-		if (input_reports[i] == rep_id) {
-			return i;
-		}
+	uint8_t idx = (rep_id < ARRAY_SIZE(input_report_idx_map)) ?
+		      input_report_idx_map[rep_id] : 0;
+
+	if (idx == 0) {
+		/* Not supported. */
+		return REPORT_IDX_UNSUPPORTED;
 	}
 
-	/* Not supported. */
-	return REPORT_IDX_UNSUPPORTED;
+	return idx - 1;
 }
 
 int hid_reportq_report_add(struct hid_reportq *q, const void *src_id, uint8_t rep_id,
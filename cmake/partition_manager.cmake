@@ -5,7 +5,7 @@
 #
 
 macro(add_region)
-  set(oneValueArgs NAME SIZE BASE PLACEMENT DEVICE DEFAULT_DRIVER_KCONFIG DYNAMIC_PARTITION)
+  set(oneValueArgs NAME SIZE BASE PLACEMENT DEVICE DEFAULT_DRIVER_KCONFIG DYNAMIC_PARTITION ALIGN)
   cmake_parse_arguments(REGION "" "${oneValueArgs}" "" ${ARGN})
   list(APPEND regions ${REGION_NAME})
   list(APPEND region_arguments "--${REGION_NAME}-size;${REGION_SIZE}")
@@ -21,6 +21,10 @@ macro(add_region)
     list(APPEND region_arguments
       "--${REGION_NAME}-dynamic-partition;${REGION_DYNAMIC_PARTITION}")
   endif()
+  if(REGION_ALIGN)
+    list(APPEND region_arguments
+      "--${REGION_NAME}-default-align;${REGION_ALIGN}")
+  endif()
 endmacro()
 
 # Load static configuration if found.
@@ -9,7 +9,7 @@
 # finally file from board directory.
 
 macro(add_region)
-  set(oneValueArgs NAME SIZE BASE PLACEMENT DEVICE DEFAULT_DRIVER_KCONFIG DYNAMIC_PARTITION DOMAIN)
+  set(oneValueArgs NAME SIZE BASE PLACEMENT DEVICE DEFAULT_DRIVER_KCONFIG DYNAMIC_PARTITION DOMAIN ALIGN)
   cmake_parse_arguments(REGION "" "${oneValueArgs}" "" ${ARGN})
   if(DEFINED REGION_DOMAIN)
     set(underscore_domain ${REGION_DOMAIN}_)
@@ -31,6 +31,10 @@ macro(add_region)
     list(APPEND ${underscore_domain}region_arguments
       "--${REGION_NAME}-dynamic-partition;${REGION_DYNAMIC_PARTITION}")
   endif()
+  if(REGION_ALIGN)
+    list(APPEND ${underscore_domain}region_arguments
+      "--${REGION_NAME}-default-align;${REGION_ALIGN}")
+  endif()
 endmacro()
 
 function(partition_manager)
@@ -307,17 +311,38 @@ function(partition_manager)
       set(${container}overlap_arg --overlap=replace)
     endif()
 
+    set(${container}merge_command
+      ${PYTHON_EXECUTABLE}
+      ${ZEPHYR_BASE}/scripts/build/mergehex.py
+      -o ${CMAKE_BINARY_DIR}/${container}.hex
+      ${${container}overlap_arg}
+      ${${container}hex_files}
+      )
+
+    # Optionally route the merge through a content-hash cache, so that relinked
+    # but unchanged input hex files do not trigger a re-merge.
+    if(SB_CONFIG_PM_MERGE_CONTENT_CACHE)
+      set(${container}cache_command
+        ${PYTHON_EXECUTABLE}
+        ${ZEPHYR_NRF_MODULE_DIR}/scripts/content_cached_command.py
+        --stamp ${CMAKE_BINARY_DIR}/${container}.hex.stamp
+        --output ${CMAKE_BINARY_DIR}/${container}.hex
+        )
+      foreach(hex_file ${${container}hex_files})
+        list(APPEND ${container}cache_command --input ${hex_file})
+      endforeach()
+      set(${container}merge_command
+        ${${container}cache_command} -- ${${container}merge_command}
+        )
+    endif()
+
     # Should all files still be merged ?
     # And under which circumstances.
     # Add command to merge files.
     add_custom_command(
       OUTPUT ${CMAKE_BINARY_DIR}/${container}.hex
       COMMAND
-      ${PYTHON_EXECUTABLE}
-      ${ZEPHYR_BASE}/scripts/build/mergehex.py
-      -o ${CMAKE_BINARY_DIR}/${container}.hex
-      ${${container}overlap_arg}
-      ${${container}hex_files}
+      ${${container}merge_command}
       DEPENDS
       ${${container}targets}
       ${${container}hex_files}
@@ -580,6 +605,7 @@ foreach(d APP ${PM_DOMAINS})
       )
   endif()
   sysbuild_get(${image_name}_CONFIG_FLASH_BASE_ADDRESS IMAGE ${image_name} VAR CONFIG_FLASH_BASE_ADDRESS KCONFIG)
+  sysbuild_get(${image_name}_CONFIG_PM_FLASH_PRIMARY_ALIGN IMAGE ${image_name} VAR CONFIG_PM_FLASH_PRIMARY_ALIGN KCONFIG)
   add_region(
     NAME flash_primary
     SIZE ${flash_size}
@@ -588,6 +614,7 @@ foreach(d APP ${PM_DOMAINS})
     DEVICE ${soc_nvs_controller}
     DEFAULT_DRIVER_KCONFIG ${soc_nvs_controller_driver_kc}
     DOMAIN ${d}
+    ALIGN ${${image_name}_CONFIG_PM_FLASH_PRIMARY_ALIGN}
     )
 endforeach()
 
@@ -834,14 +834,19 @@ static int send_packet(struct mspi_xfer_packet *packet, uint32_t timeout)
 	hpf_mspi_opcode_t opcode = (packet->dir == MSPI_RX) ? HPF_MSPI_TXRX : HPF_MSPI_TX;
 
 #ifdef CONFIG_MSPI_HPF_IPC_NO_COPY
-	/* In case of buffer alignment problems: create correctly aligned temporary buffer. */
+	/* In case of buffer alignment problems: use the correctly aligned message buffer. */
 	uint32_t len = ((uint32_t)packet->data_buf) % sizeof(uint32_t) != 0
 			       ? sizeof(hpf_mspi_xfer_packet_msg_t) + packet->num_bytes
 			       : sizeof(hpf_mspi_xfer_packet_msg_t);
 #else
 	uint32_t len = sizeof(hpf_mspi_xfer_packet_msg_t) + packet->num_bytes;
 #endif
-	uint8_t buffer[len];
+	/* Transfers are synchronous with a single job outstanding, so one
+	 * preallocated message buffer is reused for every packet instead of
+	 * building the message on the caller's stack.
+	 */
+	static uint8_t buffer[sizeof(hpf_mspi_xfer_packet_msg_t) + MAX_TX_MSG_SIZE]
+		__aligned(sizeof(uint32_t));
 	hpf_mspi_xfer_packet_msg_t *xfer_packet = (hpf_mspi_xfer_packet_msg_t *)buffer;
 
 	xfer_packet->opcode = opcode;
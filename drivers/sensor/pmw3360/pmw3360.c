@@ -89,12 +89,19 @@ LOG_MODULE_REGISTER(pmw3360, CONFIG_PMW3360_LOG_LEVEL);
 #define PMW3360_MAX_BURST_SIZE			12
 
 /* Register count used for reading a single motion burst */
+#if defined(CONFIG_PMW3360_SQUAL)
+#define PMW3360_BURST_SIZE			7
+#else
 #define PMW3360_BURST_SIZE			6
+#endif
 
 /* Position of X in motion burst data */
 #define PMW3360_DX_POS				2
 #define PMW3360_DY_POS				4
 
+/* Position of SQUAL in motion burst data */
+#define PMW3360_SQUAL_POS			6
+
 /* Rest_En position in Config2 register. */
 #define PMW3360_REST_EN_POS			5
 
@@ -130,6 +137,9 @@ struct pmw3360_data {
 	struct k_spinlock            lock;
 	int16_t                      x;
 	int16_t                      y;
+#if defined(CONFIG_PMW3360_SQUAL)
+	uint8_t                      squal;
+#endif
 	sensor_trigger_handler_t     data_ready_handler;
 	struct k_work                trigger_handler_work;
 	struct k_work_delayable      init_work;
@@ -888,6 +898,10 @@ static int pmw3360_sample_fetch(const struct device *dev, enum sensor_channel ch
 			data->x = -y;
 			data->y = -x;
 		}
+
+#if defined(CONFIG_PMW3360_SQUAL)
+		data->squal = buf[PMW3360_SQUAL_POS];
+#endif
 	}
 
 	return err;
@@ -914,6 +928,13 @@ static int pmw3360_channel_get(const struct device *dev, enum sensor_channel cha
 		val->val2 = 0;
 		break;
 
+#if defined(CONFIG_PMW3360_SQUAL)
+	case PMW3360_CHAN_SQUAL:
+		val->val1 = data->squal;
+		val->val2 = 0;
+		break;
+#endif
+
 	default:
 		return -ENOTSUP;
 	}
@@ -498,17 +498,59 @@ void *net_pkt_to_nbuf(struct net_pkt *pkt)
 	return nbuff;
 }
 
+#ifdef CONFIG_NRF_WIFI_ZERO_COPY_RX
+static void zep_shim_rx_buf_destroy(struct net_buf *buf)
+{
+	struct nwb *nwb = *(struct nwb **)net_buf_user_data(buf);
+
+	net_buf_destroy(buf);
+
+	/* The network stack is done with the data: return the driver buffer */
+	zep_shim_nbuf_free(nwb);
+}
+
+/* Wrappers around the driver receive buffers, no data of their own */
+NET_BUF_POOL_FIXED_DEFINE(zep_shim_rx_pool, CONFIG_NRF71_RX_NUM_BUFS, 0,
+			  sizeof(struct nwb *), zep_shim_rx_buf_destroy);
+#endif /* CONFIG_NRF_WIFI_ZERO_COPY_RX */
+
 void *net_pkt_from_nbuf(void *iface, void *frm)
 {
 	struct net_pkt *pkt = NULL;
-	unsigned char *data;
-	unsigned int len;
 	struct nwb *nwb = frm;
 
 	if (!nwb) {
 		return NULL;
 	}
 
+#ifdef CONFIG_NRF_WIFI_ZERO_COPY_RX
+	struct net_buf *buf;
+
+	/* Zero-copy: hand the driver buffer to the network stack and keep it
+	 * allocated until the stack releases the packet.
+	 */
+	buf = net_buf_alloc_with_data(&zep_shim_rx_pool,
+				      zep_shim_nbuf_data_get(nwb),
+				      zep_shim_nbuf_data_size(nwb),
+				      K_MSEC(100));
+	if (!buf) {
+		zep_shim_nbuf_free(nwb);
+		return NULL;
+	}
+
+	*(struct nwb **)net_buf_user_data(buf) = nwb;
+
+	pkt = net_pkt_rx_alloc_on_iface(iface, K_MSEC(100));
+	if (!pkt) {
+		net_buf_unref(buf);
+		return NULL;
+	}
+
+	net_pkt_append_buffer(pkt, buf);
+#else
+	unsigned char *data;
+	unsigned int len;
+
 	len = zep_shim_nbuf_data_size(nwb);
 
 	data = zep_shim_nbuf_data_get(nwb);
@@ -527,6 +569,7 @@ void *net_pkt_from_nbuf(void *iface, void *frm)
 
 out:
 	zep_shim_nbuf_free(nwb);
+#endif /* CONFIG_NRF_WIFI_ZERO_COPY_RX */
 	return pkt;
 }
 
@@ -197,6 +197,19 @@ static inline bool app_event_get_type_flag(const struct event_type *et,
  */
 #define APP_EVENT_SUBMIT(event) _event_submit(&event->header)
 
+/** @brief Submit a batch of events.
+ *
+ * All events are added to the processing queue under a single lock operation
+ * and the event processor is woken up only once, which reduces the submission
+ * overhead for bursts of events compared to submitting them one by one.
+ * The events are processed in array order.
+ *
+ * @param aehs  Array of pointers to the application event headers of the
+ *              events to submit.
+ * @param cnt   Number of events in the array.
+ */
+void app_event_manager_submit_batch(struct app_event_header *aehs[], size_t cnt);
+
 /**
  * @brief Register event hook after the Application Event Manager is initialized.
  *
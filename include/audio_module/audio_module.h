@@ -240,6 +240,14 @@ struct audio_module_description {
 	/* The module type. */
 	enum audio_module_type type;
 
+	/* Flag to indicate the module's data process function supports in-place processing,
+	 * that is, it may be handed the same buffer as both input and output. For a fused
+	 * module of the in/out type with a single connection, the audio data buffer is then
+	 * threaded through the module instead of allocating a separate output buffer and
+	 * copying.
+	 */
+	bool in_place;
+
 	/* A pointer to the functions in the module. */
 	const struct audio_module_functions *functions;
 };
@@ -248,10 +256,20 @@ struct audio_module_description {
  * @brief Module's thread configuration structure.
  */
 struct audio_module_thread_configuration {
-	/* Thread stack. */
+	/* Thread stack.
+	 *
+	 * Set to NULL to open the module in fused mode. A fused module has no thread
+	 * of its own and processes audio data by direct function call within the
+	 * thread of the module it is connected from, removing the context switch and
+	 * queue operations between the two modules. A fused module must be of type
+	 * @ref AUDIO_MODULE_TYPE_OUTPUT or @ref AUDIO_MODULE_TYPE_IN_OUT, must have
+	 * no RX FIFO and cannot be sent audio data with audio_module_data_tx(). The
+	 * thread stack of the module a fused chain is connected from must be sized to
+	 * accommodate the data processing of all the fused modules in the chain.
+	 */
 	k_thread_stack_t *stack;
 
-	/* Thread stack size. */
+	/* Thread stack size. Must be zero for a fused module. */
 	size_t stack_size;
 
 	/* Thread priority. */
@@ -305,6 +323,11 @@ struct audio_module_handle {
 	/* Flag to indicate if the module should put its output audio data onto its TX FIFO. */
 	bool use_tx_queue;
 
+	/* Flag to indicate the module has no thread of its own and processes audio data by
+	 * direct function call within the thread of the module it is connected from.
+	 */
+	bool fused;
+
 	/* List node (pointer to next audio module). */
 	sys_snode_t node;
 
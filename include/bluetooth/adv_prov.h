@@ -167,6 +167,27 @@ int bt_le_adv_prov_get_sd(struct bt_data *sd, size_t *sd_len,
 			  const struct bt_le_adv_prov_adv_state *state,
 			  struct bt_le_adv_prov_feedback *fb);
 
+/** Invalidate cached provider data.
+ *
+ * If @kconfig{CONFIG_BT_ADV_PROV_DATA_CACHE} is enabled, the subsystem caches data returned by
+ * providers and subsequent data updates rerun only providers whose data was invalidated. A provider
+ * must call this function whenever an input of its data changes (for example, a reported battery
+ * level).
+ *
+ * The function can be called from any context. It has no effect if the provider data cache is
+ * disabled.
+ *
+ * @param prov	Provider whose data changed. Pass NULL to invalidate data of all providers.
+ */
+#ifdef CONFIG_BT_ADV_PROV_DATA_CACHE
+void bt_le_adv_prov_data_invalidate(const struct bt_le_adv_prov_provider *prov);
+#else
+static inline void bt_le_adv_prov_data_invalidate(const struct bt_le_adv_prov_provider *prov)
+{
+	ARG_UNUSED(prov);
+}
+#endif
+
 #ifdef __cplusplus
 }
 #endif
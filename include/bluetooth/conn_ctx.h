@@ -34,10 +34,12 @@ extern "C" {
 			  (_max_clients),                                      \
 			  CONFIG_BT_CONN_CTX_MEM_BUF_ALIGN);                   \
 	static K_MUTEX_DEFINE(_name##_mutex);                                  \
+	static struct k_mutex _name##_slot_locks[CONFIG_BT_MAX_CONN];          \
 	static struct bt_conn_ctx_lib _CONCAT(_name, _ctx_lib) =                \
 	{                                                                      \
 		.mem_slab = &_CONCAT(_name, _mem_slab),                         \
-		.mutex = &_name##_mutex                                        \
+		.mutex = &_name##_mutex,                                       \
+		.slot_locks = _name##_slot_locks                               \
 	}
 
 /** @brief Context data for a connection. */
@@ -54,10 +56,18 @@ struct bt_conn_ctx_lib {
 	/** Connection contexts. */
 	struct bt_conn_ctx ctx[CONFIG_BT_MAX_CONN];
 
-	/** Context data mutex that ensures that only one connection context is
-	  * manipulated at a time. */
+	/** Mutex guarding the one-time initialization of the per-slot
+	  * locks. */
 	struct k_mutex * const mutex;
 
+	/** Per-slot locks. Each connection context is locked independently,
+	  * so operations on different connections do not serialize on
+	  * each other. Initialized on first use, guarded by the mutex. */
+	struct k_mutex * const slot_locks;
+
+	/** Set once the per-slot locks have been initialized. */
+	atomic_t slot_locks_initialized;
+
 	/** Memory slab instance where the memory is allocated. */
 	struct k_mem_slab * const mem_slab;
 };
@@ -317,6 +317,28 @@ int bt_gatt_dm_continue(struct bt_gatt_dm *dm, void *context);
  */
 int bt_gatt_dm_data_release(struct bt_gatt_dm *dm);
 
+/** @brief Invalidate cached discovery results.
+ *
+ * Removes discovery results stored by the discovery result cache
+ * (@kconfig{CONFIG_BT_GATT_DM_CACHE}). Call it when the attribute
+ * database of a peer may have changed, for example on a Service Changed
+ * indication or after the bond with the peer is removed.
+ *
+ * @param[in] peer Peer address, or NULL to invalidate all cached results.
+ *
+ * @return Number of cache entries invalidated.
+ */
+#ifdef CONFIG_BT_GATT_DM_CACHE
+int bt_gatt_dm_cache_invalidate(const bt_addr_le_t *peer);
+#else
+static inline int bt_gatt_dm_cache_invalidate(const bt_addr_le_t *peer)
+{
+	ARG_UNUSED(peer);
+
+	return 0;
+}
+#endif
+
 /** @brief Print service discovery data.
  *
  * This function prints GATT attributes that belong to the discovered service.
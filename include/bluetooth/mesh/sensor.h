@@ -625,6 +625,12 @@ struct bt_mesh_sensor {
 
 		/** Flag indicating whether the sensor cadence state has been configured. */
 		uint8_t configured : 1;
+
+		/** Flag indicating that the series columns are sorted by
+		 *  ascending start value, allowing binary search in query
+		 *  handling.
+		 */
+		uint8_t columns_sorted : 1;
 	} state;
 };
 
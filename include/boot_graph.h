@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef BOOT_GRAPH_H__
+#define BOOT_GRAPH_H__
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/iterable_sections.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup boot_graph Boot graph
+ * @{
+ * @brief Dependency-ordered, concurrent execution of boot steps.
+ *
+ * Boot steps are declared with @ref BOOT_GRAPH_STEP_DEFINE together with the
+ * names of the steps they depend on. The executor runs every step whose
+ * dependencies have completed, using a small pool of worker threads, so
+ * independent branches of the graph run concurrently. This shortens boot
+ * when slow steps are dominated by waiting, for example modem library
+ * initialization running in parallel with settings loading and display
+ * bring-up.
+ *
+ * The graph complements, but does not replace, SYS_INIT: steps are ordinary
+ * functions run from the worker threads after the kernel is up, either when
+ * the application calls boot_graph_run() or automatically at the
+ * APPLICATION init level when @kconfig{CONFIG_NCS_BOOT_GRAPH_AUTO_RUN} is
+ * enabled. Each completed step is also recorded in the boot trace when
+ * @kconfig{CONFIG_NCS_BOOT_TRACE} is enabled.
+ */
+
+/** @brief State of a boot graph step. */
+enum boot_graph_step_state {
+	/** Not started. */
+	BOOT_GRAPH_STEP_IDLE,
+	/** Claimed by a worker thread. */
+	BOOT_GRAPH_STEP_RUNNING,
+	/** Completed successfully. */
+	BOOT_GRAPH_STEP_DONE,
+	/** Failed, or not run because a dependency failed. */
+	BOOT_GRAPH_STEP_FAILED,
+};
+
+/** @brief Boot graph step. Define with @ref BOOT_GRAPH_STEP_DEFINE. */
+struct boot_graph_step {
+	/** Step name, used for dependency references and diagnostics. */
+	const char *name;
+	/** Step function. Returns 0 on success, a negative errno on failure. */
+	int (*init)(void);
+	/** Names of the steps this step depends on, terminated by NULL. */
+	const char *const *deps;
+	/** Current state, one of @ref boot_graph_step_state. */
+	atomic_t state;
+	/** Return value of the step function, or -ECANCELED when skipped. */
+	int result;
+};
+
+/**
+ * @brief Define a boot graph step.
+ *
+ * @param _name Step name, a C identifier. Dependencies refer to the step by
+ *              the stringified name.
+ * @param _init Step function of type @c int @c (*)(void).
+ * @param ...   Zero or more dependency names as string literals.
+ */
+#define BOOT_GRAPH_STEP_DEFINE(_name, _init, ...)                                                  \
+	static const char *const _boot_graph_deps_##_name[] = { __VA_ARGS__ __VA_OPT__(,) NULL };  \
+	static STRUCT_SECTION_ITERABLE(boot_graph_step, _name) = {                                 \
+		.name = STRINGIFY(_name),                                                          \
+		.init = _init,                                                                     \
+		.deps = _boot_graph_deps_##_name,                                                  \
+		.state = ATOMIC_INIT(BOOT_GRAPH_STEP_IDLE),                                        \
+	}
+
+/**
+ * @brief Run the boot graph to completion.
+ *
+ * Starts the worker thread pool and blocks until every step has either
+ * completed or failed. Steps whose dependencies failed, or that are part of
+ * a dependency cycle, are marked failed without being run. Steps already
+ * completed by an earlier call are not run again.
+ *
+ * @retval 0 All steps completed successfully.
+ * @return The result of the first failed step, in declaration order,
+ *         otherwise.
+ */
+int boot_graph_run(void);
+
+/**
+ * @brief Get the state of a boot graph step.
+ *
+ * @param name Step name.
+ * @param result Step result. Can be NULL. Valid only in the
+ *               @ref BOOT_GRAPH_STEP_DONE and @ref BOOT_GRAPH_STEP_FAILED
+ *               states.
+ *
+ * @return The step state, or a negative errno if no step with the given
+ *         name exists.
+ */
+int boot_graph_step_state_get(const char *name, int *result);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BOOT_GRAPH_H__ */
@@ -0,0 +1,54 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef BOOT_TRACE_H__
+#define BOOT_TRACE_H__
+
+#include <zephyr/kernel.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup boot_trace Boot trace
+ * @{
+ * @brief Cycle-counter timestamps for boot phases.
+ *
+ * The boot trace records named cycle-counter captures in a table kept in
+ * uninitialized RAM, so the timeline survives until something can read it
+ * even when logging is not up yet during the phase being measured. The SDK
+ * marks the phases it owns (boot banner, modem library initialization);
+ * applications add their own marks around the steps they are chasing, for
+ * example settings loading or bt_enable(). The table can be printed with the
+ * boot_trace shell command.
+ */
+
+/**
+ * @brief Record a boot phase timestamp.
+ *
+ * Captures the current cycle counter under the given name. Safe to call from
+ * any context. When the table is full or the boot trace is disabled, the call
+ * does nothing.
+ *
+ * @param name Phase name. Truncated to the configured name length.
+ */
+#if defined(CONFIG_NCS_BOOT_TRACE)
+void boot_trace_mark(const char *name);
+#else
+static inline void boot_trace_mark(const char *name)
+{
+	ARG_UNUSED(name);
+}
+#endif
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BOOT_TRACE_H__ */
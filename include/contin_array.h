@@ -111,6 +111,35 @@ int contin_array_buf_create(struct net_buf *pcm_contin, void const *const pcm_fi
 int contin_array_net_buf_create(struct net_buf *pcm_contin, struct net_buf const *const pcm_finite,
 				uint32_t locations, uint16_t *const _finite_pos);
 
+/** @brief Gets the next slice of a finite array looped continuously, without copying.
+ *
+ * @param pcm_finite       Pointer to an array of samples or data.
+ * @param pcm_finite_size  Size of pcm_finite.
+ * @param slice_size       Size of the slice to get.
+ * @param splice_buf       Buffer used to stitch together the end and start of pcm_finite when a
+ * slice straddles the wrap-around. Must hold slice_size bytes.
+ * @param _finite_pos      Variable used internally. Must be set to 0 for the first run and not
+ * changed.
+ * @param slice            Set to point to the next slice_size bytes of the looped array.
+ *
+ * @note  This function serves the same purpose as contin_array_create(), but instead of copying
+ * into a destination buffer it returns a pointer directly into pcm_finite, so that the slice can
+ * be handed to e.g. a DMA-based peripheral driver without a per-block copy. Only when a slice
+ * straddles the end of pcm_finite is it assembled in splice_buf, so looped playback where
+ * slice_size divides pcm_finite_size costs no copying at all.
+ * The function keeps track of the current position in finite_pos,
+ * so that the function can be called multiple times and maintain the correct
+ * position in pcm_finite.
+ *
+ * @retval 0		If the operation was successful.
+ * @retval -ENXIO	On NULL pointer.
+ * @retval -EPERM	If any sizes are zero.
+ * @retval -EINVAL	If slice_size is larger than pcm_finite_size.
+ */
+int contin_array_slice_get(void const *const pcm_finite, uint32_t pcm_finite_size,
+			   uint32_t slice_size, void *const splice_buf,
+			   uint32_t *const _finite_pos, void const **slice);
+
 /**
  * @}
  */
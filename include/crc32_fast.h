@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef CRC32_FAST_H__
+#define CRC32_FAST_H__
+
+/**
+ * @defgroup crc32_fast Fast CRC-32 library
+ * @{
+ * @brief Table-driven slice-by-8 implementation of the IEEE 802.3 CRC-32.
+ *
+ * Produces the same checksums as crc32_ieee() from Zephyr, but processes
+ * eight bytes per table iteration instead of one, trading 8 KiB of lookup
+ * tables in flash for a several-fold speedup. Intended for paths that
+ * checksum large amounts of data, such as firmware image verification.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Update a running CRC-32 with a new block of data.
+ *
+ *  Drop-in replacement for crc32_ieee_update(). Pass 0 as the initial value
+ *  and chain the returned value for subsequent blocks.
+ *
+ *  @param crc Current CRC-32 value, 0 for the first block.
+ *  @param data Data over which the CRC is computed.
+ *  @param len Length of the data in bytes.
+ *
+ *  @return Updated CRC-32 value.
+ */
+uint32_t crc32_fast_update(uint32_t crc, const void *data, size_t len);
+
+/** @brief Compute the CRC-32 of a block of data.
+ *
+ *  @param data Data over which the CRC is computed.
+ *  @param len Length of the data in bytes.
+ *
+ *  @return CRC-32 value.
+ */
+uint32_t crc32_fast(const void *data, size_t len);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ *@}
+ */
+
+#endif /* CRC32_FAST_H__ */
@@ -31,6 +31,41 @@ struct data_fifo_msgq {
 	size_t size;
 };
 
+/**
+ * @brief Callback invoked when the last reference to an external block is freed.
+ *
+ * @param data Pointer to the externally owned buffer.
+ * @param user_data User data given when the block was put.
+ */
+typedef void (*data_fifo_ext_release_cb_t)(void *data, void *user_data);
+
+#if defined(CONFIG_DATA_FIFO_ZERO_COPY) || defined(__DOXYGEN__)
+/* Descriptor for an externally owned buffer enqueued by reference. */
+struct data_fifo_ext_block {
+	void *data;
+	data_fifo_ext_release_cb_t release_cb;
+	void *user_data;
+	atomic_t ref_count;
+};
+#endif /* CONFIG_DATA_FIFO_ZERO_COPY */
+
+#if defined(CONFIG_DATA_FIFO_SPSC) || defined(__DOXYGEN__)
+/* Lock-free single-producer single-consumer ring state.
+ * The indices are free-running and wrap naturally. Entry i is stored at
+ * ring position i % elements_max.
+ */
+struct data_fifo_spsc {
+	/* Blocks claimed by the producer */
+	atomic_t alloc_idx;
+	/* Blocks published to the consumer */
+	atomic_t write_idx;
+	/* Blocks fetched by the consumer */
+	atomic_t read_idx;
+	/* Blocks returned to the pool */
+	atomic_t free_idx;
+};
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
 struct data_fifo {
 	char *msgq_buffer;
 	char *slab_buffer;
@@ -39,6 +74,14 @@ struct data_fifo {
 	uint32_t elements_max;
 	size_t block_size_max;
 	bool initialized;
+#if defined(CONFIG_DATA_FIFO_ZERO_COPY) || defined(__DOXYGEN__)
+	struct data_fifo_ext_block ext_blocks[CONFIG_DATA_FIFO_ZERO_COPY_BLOCKS_MAX];
+	atomic_t ext_in_flight;
+#endif /* CONFIG_DATA_FIFO_ZERO_COPY */
+#if defined(CONFIG_DATA_FIFO_SPSC) || defined(__DOXYGEN__)
+	bool spsc;
+	struct data_fifo_spsc spsc_state;
+#endif /* CONFIG_DATA_FIFO_SPSC */
 };
 
 #define DATA_FIFO_DEFINE(name, elements_max_in, block_size_max_in)                                 \
@@ -52,6 +95,34 @@ struct data_fifo {
 				 .elements_max = elements_max_in,                                  \
 				 .initialized = false}
 
+#if defined(CONFIG_DATA_FIFO_SPSC) || defined(__DOXYGEN__)
+/**
+ * @brief Define a lock-free single-producer single-consumer data_fifo.
+ *
+ * The instance has the same API surface as a regular data_fifo, but head and
+ * tail indices are updated with atomic operations only, without kernel calls
+ * or IRQ locks. This makes it suitable for ISR-to-thread handoff on hot
+ * paths, at the cost of the following restrictions:
+ *
+ * - Exactly one producer and one consumer context.
+ * - Blocks must be locked in the order they were claimed, and freed in the
+ *   order they were fetched.
+ * - All operations are non-blocking. Timeout arguments are ignored and
+ *   treated as K_NO_WAIT.
+ */
+#define DATA_FIFO_SPSC_DEFINE(name, elements_max_in, block_size_max_in)                            \
+	char __aligned(WB_UP(                                                                      \
+		1)) _msgq_buffer_##name[(elements_max_in) * sizeof(struct data_fifo_msgq)] = {0};  \
+	char __aligned(WB_UP(1)) _slab_buffer_##name[(elements_max_in) * (block_size_max_in)] = {  \
+		0};                                                                                \
+	struct data_fifo name = {.msgq_buffer = _msgq_buffer_##name,                               \
+				 .slab_buffer = _slab_buffer_##name,                               \
+				 .block_size_max = block_size_max_in,                              \
+				 .elements_max = elements_max_in,                                  \
+				 .initialized = false,                                             \
+				 .spsc = true}
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
 /**
  * @brief Get pointer to the first vacant block in slab.
  *
@@ -116,10 +187,55 @@ int data_fifo_block_lock(struct data_fifo *data_fifo, void **data, size_t size);
 int data_fifo_pointer_last_filled_get(struct data_fifo *data_fifo, void **data, size_t *size,
 				      k_timeout_t timeout);
 
+#if defined(CONFIG_DATA_FIFO_ZERO_COPY) || defined(__DOXYGEN__)
+/**
+ * @brief Put an externally owned buffer into the FIFO by reference.
+ *
+ * The buffer is not copied into a slab block. Instead, a reference to it is
+ * put into the message queue, and the buffer must stay valid and unmodified
+ * until the release callback is called. This avoids copying large buffers,
+ * such as DMA regions, on the data path.
+ *
+ * The block is created with a reference count of one. The reference count is
+ * decremented by data_fifo_block_free, and the release callback is called
+ * when it reaches zero.
+ *
+ * @param data_fifo Pointer to the data_fifo structure.
+ * @param data Pointer to the externally owned buffer.
+ * @param size Number of valid bytes in the buffer.
+ * @param release_cb Callback called when the last reference is freed.
+ *	May be NULL if no notification is needed.
+ * @param user_data User data passed to the release callback.
+ *
+ * @retval 0		Block has been submitted to the message queue.
+ * @retval -EINVAL	The supplied data pointer is NULL or size is zero.
+ * @retval -ENOMEM	No free external block descriptors.
+ * @retval -ENOMSG	The message queue is full.
+ */
+int data_fifo_ext_block_put(struct data_fifo *data_fifo, void *data, size_t size,
+			    data_fifo_ext_release_cb_t release_cb, void *user_data);
+
+/**
+ * @brief Take an additional reference to an external block.
+ *
+ * Used when the same buffer is consumed by more than one reader. Each
+ * reference must be released with data_fifo_block_free.
+ *
+ * @param data_fifo Pointer to the data_fifo structure.
+ * @param data Pointer to the externally owned buffer.
+ *
+ * @retval 0		Reference taken.
+ * @retval -ENODEV	The pointer does not match an in-flight external block.
+ */
+int data_fifo_ext_block_ref(struct data_fifo *data_fifo, void *data);
+#endif /* CONFIG_DATA_FIFO_ZERO_COPY */
+
 /**
  * @brief Free the data block after reading.
  *
- * Read has finished in the given data block.
+ * Read has finished in the given data block. If the block is an external
+ * block put with data_fifo_ext_block_put, its reference count is decremented
+ * instead, and the release callback is called when it reaches zero.
  *
  * @param data_fifo Pointer to the data_fifo structure.
  * @param data Pointer to the memory area which is to be freed.
@@ -9,6 +9,7 @@
 
 #include <zephyr/types.h>
 #include <zephyr/toolchain.h>
+#include <zephyr/kernel.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -50,6 +51,42 @@ void cpu_load_reset(void);
  */
 int cpu_load_get(void);
 
+#if defined(CONFIG_NRF_CPU_LOAD_SAMPLE_THREADS) || defined(__DOXYGEN__)
+/** @brief Tag a thread with a group name for CPU load attribution.
+ *
+ * Samples taken while the thread is running are attributed to the given
+ * group in addition to the thread itself. Threads are tracked automatically
+ * when first sampled; tagging only assigns the group label.
+ *
+ * @param thread Thread to tag.
+ * @param group Group name. The string must remain valid, so use a string
+ *		literal or a static buffer.
+ *
+ * @retval 0 The thread was tagged.
+ * @retval -ENOMEM No free thread tracking slot is available.
+ */
+int cpu_load_sample_thread_tag(k_tid_t thread, const char *group);
+
+/** @brief Reset the collected thread samples.
+ *
+ * Thread tracking slots and group tags are kept, only the sample counters
+ * are cleared.
+ */
+void cpu_load_sample_reset(void);
+
+/** @brief Get the CPU load of a thread group.
+ *
+ * The load is the share of samples attributed to threads tagged with the
+ * given group since the last reset, represented in 0,001% units like
+ * @ref cpu_load_get.
+ *
+ * @param group Group name as passed to @ref cpu_load_sample_thread_tag.
+ *
+ * @return The group CPU load value.
+ */
+int cpu_load_sample_group_get(const char *group);
+#endif /* CONFIG_NRF_CPU_LOAD_SAMPLE_THREADS */
+
 /** @} */
 
 #ifdef __cplusplus
@@ -48,6 +48,9 @@
 extern "C" {
 #endif
 
+/** Size of the optional per-image SHA-256 hash included in the package header. */
+#define DFU_MULTI_IMAGE_HASH_SIZE 32
+
 typedef int (*dfu_image_open_t)(int image_id, size_t image_size);
 typedef int (*dfu_image_write_t)(const uint8_t *chunk, size_t chunk_size);
 typedef int (*dfu_image_close_t)(bool success);
@@ -201,6 +204,29 @@ size_t dfu_multi_image_offset(void);
  */
 int dfu_multi_image_done(bool success);
 
+/**
+ * @brief Get the expected SHA-256 hash of an image included in the package.
+ *
+ * Packages built with per-image hashes (see the '--hash' option of
+ * 'scripts/bootloader/dfu_multi_image_tool.py') carry the SHA-256 of each image
+ * in the package header. The hash covers the image as stored in the package,
+ * including any alignment padding, and can be used to verify a written image
+ * without re-hashing it from the package, for example when resuming an
+ * interrupted update.
+ *
+ * The returned pointer is valid until the next @c dfu_multi_image_init or
+ * @c dfu_multi_image_reset call.
+ *
+ * @param[in] image_id Identifier of the image as used in the package header.
+ * @param[out] hash Location to store the pointer to the @c DFU_MULTI_IMAGE_HASH_SIZE
+ *                  byte hash.
+ *
+ * @return -ENOENT If the package header has not been parsed yet, the image is not
+ *                 included in the package, or the package was built without hashes.
+ * @return 0       On success.
+ */
+int dfu_multi_image_hash_get(int image_id, const uint8_t **hash);
+
 /**
  * @brief Release the resources that were needed for DFU multi image
  *        and resets all the underlying image writers.
@@ -36,17 +36,21 @@ enum dfu_target_image_type {
 	DFU_TARGET_IMAGE_TYPE_FULL_MODEM = 4,
 	/** SMP external MCU */
 	DFU_TARGET_IMAGE_TYPE_SMP = 8,
+	/** Application delta patch */
+	DFU_TARGET_IMAGE_TYPE_APP_DELTA = 16,
 	/** Custom update implementation */
 	DFU_TARGET_IMAGE_TYPE_CUSTOM = 128,
 	/** Any application image type */
-	DFU_TARGET_IMAGE_TYPE_ANY_APPLICATION = DFU_TARGET_IMAGE_TYPE_MCUBOOT,
+	DFU_TARGET_IMAGE_TYPE_ANY_APPLICATION =
+		(DFU_TARGET_IMAGE_TYPE_MCUBOOT | DFU_TARGET_IMAGE_TYPE_APP_DELTA),
 	/** Any modem image */
 	DFU_TARGET_IMAGE_TYPE_ANY_MODEM =
 		(DFU_TARGET_IMAGE_TYPE_MODEM_DELTA | DFU_TARGET_IMAGE_TYPE_FULL_MODEM),
 	/** Any DFU image type */
 	DFU_TARGET_IMAGE_TYPE_ANY =
 		(DFU_TARGET_IMAGE_TYPE_MCUBOOT | DFU_TARGET_IMAGE_TYPE_MODEM_DELTA |
-		 DFU_TARGET_IMAGE_TYPE_FULL_MODEM | DFU_TARGET_IMAGE_TYPE_CUSTOM),
+		 DFU_TARGET_IMAGE_TYPE_FULL_MODEM | DFU_TARGET_IMAGE_TYPE_APP_DELTA |
+		 DFU_TARGET_IMAGE_TYPE_CUSTOM),
 };
 
 enum dfu_target_evt_id {
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/** @file dfu_target_app_delta.h
+ *
+ * @defgroup dfu_target_app_delta Application delta DFU Target
+ * @{
+ * @brief DFU Target for application delta upgrades
+ *
+ * Applies a binary patch stream against the currently-running MCUboot
+ * primary slot into the secondary slot, so that only the difference
+ * between two application releases needs to be downloaded.
+ */
+
+#ifndef DFU_TARGET_APP_DELTA_H__
+#define DFU_TARGET_APP_DELTA_H__
+
+#include <stddef.h>
+#include <dfu/dfu_target.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief See if data in buf indicates an application delta patch.
+ *
+ * @retval true if data matches, false otherwise.
+ */
+bool dfu_target_app_delta_identify(const void *const buf);
+
+/**
+ * @brief Set buffer to use for the patch output stream.
+ *
+ * @param[in] buf Buffer to use for the output stream, must be able to hold
+ *		  a write-block-size aligned chunk of data.
+ * @param[in] len Length of the buffer.
+ *
+ * @retval 0 If successful, negative errno otherwise.
+ */
+int dfu_target_app_delta_set_buf(uint8_t *buf, size_t len);
+
+/**
+ * @brief Initialize dfu target, perform steps necessary to receive patch.
+ *
+ * @param[in] file_size Size of the patch file being downloaded.
+ * @param[in] img_num Image pair index. Only image 0 is supported currently.
+ * @param[in] cb Callback for signaling events (unused).
+ *
+ * @retval 0 If successful, negative errno otherwise.
+ */
+int dfu_target_app_delta_init(size_t file_size, int img_num, dfu_target_callback_t cb);
+
+/**
+ * @brief Get offset of the patch stream.
+ *
+ * @param[out] offset Returns the number of patch bytes consumed.
+ *
+ * @retval 0 If successful, negative errno otherwise.
+ */
+int dfu_target_app_delta_offset_get(size_t *offset);
+
+/**
+ * @brief Write patch data.
+ *
+ * @param[in] buf Pointer to data that should be written.
+ * @param[in] len Length of data to write.
+ *
+ * @retval 0 on success, negative errno otherwise.
+ */
+int dfu_target_app_delta_write(const void *const buf, size_t len);
+
+/**
+ * @brief Deinitialize resources and finalize patch application if successful.
+ *
+ * Verifies the size and CRC of the patched image against the values carried
+ * in the patch header.
+ *
+ * @param[in] successful Indicate whether the patch was successfully received.
+ *
+ * @retval 0 If successful, negative errno otherwise.
+ */
+int dfu_target_app_delta_done(bool successful);
+
+/**
+ * @brief Schedule update of the patched image.
+ *
+ * This call requests an image swap to the patched image on the next reboot.
+ *
+ * @param[in] img_num Image pair index. Only image 0 is supported currently.
+ *
+ * @retval 0 If successful, negative errno otherwise.
+ */
+int dfu_target_app_delta_schedule_update(int img_num);
+
+/**
+ * @brief Release resources and erase the download area.
+ *
+ * Cancels any ongoing updates.
+ *
+ * @retval 0 If successful, negative errno otherwise.
+ */
+int dfu_target_app_delta_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DFU_TARGET_APP_DELTA_H__ */
+
+/**@} */
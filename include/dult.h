@@ -315,6 +315,11 @@ struct dult_motion_detector_cb {
 	 *
 	 *  @return true to indicate detected motion in the last period,
 	 *  otherwise false.
+	 *
+	 *  @note This callback is optional when the
+	 *  @kconfig{CONFIG_DULT_MOTION_DETECTOR_EVENT_REPORTING} Kconfig option
+	 *  is enabled and motion is reported asynchronously with the
+	 *  @ref dult_motion_detector_motion_reported API.
 	 */
 	bool (*period_expired)(void);
 
@@ -345,6 +350,26 @@ struct dult_motion_detector_cb {
 int dult_motion_detector_cb_register(const struct dult_user *user,
 				     const struct dult_motion_detector_cb *cb);
 
+#if defined(CONFIG_DULT_MOTION_DETECTOR_EVENT_REPORTING) || defined(__DOXYGEN__)
+/** @brief Report detected motion to the DULT module.
+ *
+ *  This function latches a motion report that is consumed at the next motion
+ *  detector sampling period. It is typically called from the motion engine or
+ *  FIFO interrupt handler of an accelerometer that detects motion in hardware,
+ *  in which case the CPU only wakes up at the DULT protocol decision points
+ *  and the @ref dult_motion_detector_cb.period_expired callback can be left
+ *  unpopulated. This API can only be used when the
+ *  @kconfig{CONFIG_DULT_MOTION_DETECTOR_EVENT_REPORTING} Kconfig option is
+ *  enabled. Reports made while the motion detector is not running are ignored.
+ *  This function can be called from an interrupt context.
+ *
+ *  @param user User structure used to authenticate the user.
+ *
+ *  @return 0 if the operation was successful. Otherwise, a (negative) error code is returned.
+ */
+int dult_motion_detector_motion_reported(const struct dult_user *user);
+#endif
+
 /** Modes of the DULT near-owner state. */
 enum dult_near_owner_state_mode {
 	/** Separated mode of the near-owner state. */
@@ -406,6 +406,51 @@ bool esb_is_idle(void);
  */
 int esb_write_payload(const struct esb_payload *payload);
 
+/** @brief TX descriptor referencing an application buffer.
+ *
+ *  Used with @ref esb_write_desc for zero-copy transmission. The descriptor
+ *  and the referenced buffer must remain valid and unmodified until the
+ *  @ref esb_tx_desc.complete callback has been called.
+ */
+struct esb_tx_desc {
+	/** Application data to transmit. */
+	const uint8_t *data;
+	/** Length of the data. */
+	uint8_t length;
+	/** Pipe used for this payload. */
+	uint8_t pipe;
+	/** Flag indicating that this packet will not be acknowledged.
+	 *  Flag is ignored when selective auto ack is disabled.
+	 */
+	bool noack;
+	/** Called when the descriptor has completed and the buffer can be reused.
+	 *  Called from interrupt context, so it must be short. Can be NULL.
+	 *
+	 *  @param desc   The completed descriptor.
+	 *  @param result 0 when the payload was transmitted, -ECANCELED when it
+	 *                was removed from the queue without transmission.
+	 */
+	void (*complete)(struct esb_tx_desc *desc, int result);
+};
+
+/** @brief Queue a payload for transmission without copying it.
+ *
+ *  This function queues a descriptor that references the application buffer
+ *  directly, instead of copying the payload into the TX FIFO as
+ *  @ref esb_write_payload does. The data is copied once, into the radio PDU,
+ *  when the transmission starts. Descriptors share the TX FIFO and its
+ *  ordering with payloads queued with @ref esb_write_payload.
+ *
+ *  Only supported in PTX mode and requires @kconfig{CONFIG_ESB_TX_DESCRIPTORS}.
+ *
+ *  @param[in] desc The descriptor.
+ *
+ * @retval 0 If successful.
+ * @retval -ENOTSUP If @kconfig{CONFIG_ESB_TX_DESCRIPTORS} is disabled.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int esb_write_desc(struct esb_tx_desc *desc);
+
 /** @brief Read a payload.
  *
  *  @param[in,out] payload	The payload to be received.
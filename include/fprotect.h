@@ -38,6 +38,33 @@ extern "C" {
  */
 int fprotect_area(uint32_t start, size_t length);
 
+/** @brief Flash area to protect as part of a protection map. */
+struct fprotect_region {
+	/** Start of range to protect. */
+	uint32_t start;
+	/** Length in bytes of range to protect. */
+	size_t length;
+};
+
+/**
+ * @brief Protect a set of flash areas against writes.
+ *
+ * The whole protection map is validated before any hardware is configured,
+ * so either the map is rejected as a whole or protection starts to be
+ * applied. On hardware with a shared configuration register set (BPROT/MPU),
+ * the map is applied with a single write per configuration register.
+ *
+ * @param[in]  regions  Protection map to apply.
+ * @param[in]  count    Number of elements in @p regions.
+ *
+ * @retval 0        On success.
+ * @retval -EINVAL  If any region in the map is incorrect.
+ * @retval -EFAULT  If the protection was not applied properly.
+ * @retval -ENOSPC  If the map does not fit in the available configuration
+ *                  registers.
+ */
+int fprotect_area_batch(const struct fprotect_region *regions, size_t count);
+
 /**
  * @brief Protect flash area against reads/writes.
  *
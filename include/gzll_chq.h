@@ -0,0 +1,113 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef __GZLL_CHQ_H
+#define __GZLL_CHQ_H
+
+/**
+ * @file
+ * @brief Gazell Link Layer channel quality monitor
+ *
+ * Tracks per-channel transmission statistics reported by the application
+ * and maintains a reordered, optionally blacklist-filtered channel table.
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup gzll_chq Gazell Link Layer channel quality monitor
+ *
+ * Tracks per-channel transmission statistics reported by the application
+ * and maintains a reordered, optionally blacklist-filtered channel table.
+ *
+ * @{
+ */
+
+/** @brief Quality information for one channel table entry. */
+struct gzll_chq_quality {
+	/** RF channel number of the entry. */
+	uint8_t channel;
+	/** Failure rate estimate in percent (exponential moving average). */
+	uint8_t fail_rate;
+	/** True if the channel is currently excluded from the channel table. */
+	bool blacklisted;
+	/** Number of successful transactions reported for the channel. */
+	uint32_t success_count;
+	/** Number of failed transactions reported for the channel. */
+	uint32_t fail_count;
+};
+
+/**
+ * @brief Channel quality monitor initialization.
+ *
+ * Captures the current Gazell channel table as the monitored channel set
+ * and resets all statistics. Must be called after the channel table has
+ * been configured and again if the application changes it by other means.
+ *
+ * @retval true  if initialization is successful.
+ * @retval false if the channel table could not be read.
+ */
+bool gzll_chq_init(void);
+
+/**
+ * @brief Report the result of a transaction on a channel.
+ *
+ * Typically called from the Gazell Link Layer callbacks. Safe to call
+ * from interrupt context.
+ *
+ * @param channel_index Index into the monitored channel table.
+ * @param success       True if the transaction succeeded without retry,
+ *                      false if it failed or required a retry.
+ */
+void gzll_chq_report(uint8_t channel_index, bool success);
+
+/**
+ * @brief Reorder and filter the channel table based on the statistics.
+ *
+ * Sorts the monitored channels by ascending failure rate and blacklists
+ * channels whose failure rate exceeds
+ * @kconfig{CONFIG_GAZELL_CHANNEL_QUALITY_BLACKLIST_THRESHOLD}, keeping at
+ * least @kconfig{CONFIG_GAZELL_CHANNEL_QUALITY_MIN_CHANNELS} channels.
+ * Blacklisted channels decay towards re-admission over subsequent calls.
+ * If the resulting table differs from the active one, it is written to
+ * the Gazell Link Layer, disabling and re-enabling Gazell if needed.
+ *
+ * Must not be called from interrupt context.
+ *
+ * @retval true  if the evaluation is successful, whether or not the
+ *               channel table changed.
+ * @retval false if the new channel table could not be applied.
+ */
+bool gzll_chq_apply(void);
+
+/**
+ * @brief Read the quality information of a channel table entry.
+ *
+ * Entries are indexed in the order captured by gzll_chq_init(),
+ * regardless of the currently applied channel order.
+ *
+ * @param[in]  channel_index Index into the monitored channel table.
+ * @param[out] quality       Quality information of the entry.
+ *
+ * @retval true  if the entry exists.
+ * @retval false if channel_index is out of range.
+ */
+bool gzll_chq_quality_get(uint8_t channel_index, struct gzll_chq_quality *quality);
+
+/**
+ * @}
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* __GZLL_CHQ_H */
@@ -157,6 +157,40 @@ int hw_unique_key_derive_key(enum hw_unique_key_slot key_slot,
 	uint8_t const *label, size_t label_size,
 	uint8_t *output, uint32_t output_size);
 
+#if defined(CONFIG_HW_UNIQUE_KEY_DERIVATION_CACHE) || defined(__DOXYGEN__)
+/**
+ * @brief Derive a key from the specified HUK, caching the result in RAM.
+ *
+ * Behaves as @ref hw_unique_key_derive_key, but memoizes the derived key by
+ * keyslot, context and label, so that repeated derivations with the same
+ * parameters are served from RAM instead of going through the hardware.
+ * Derivations whose parameters exceed the internal bounds of the cache
+ * bypass it.
+ *
+ * @note The derived keys stay in RAM until evicted or explicitly cleared
+ *       with @ref hw_unique_key_cache_clear.
+ *
+ * @param[in]  key_slot      Keyslot to derive from.
+ * @param[in]  context       Context for key derivation.
+ * @param[in]  context_size  Size of context.
+ * @param[in]  label         Label for key derivation.
+ * @param[in]  label_size    Size of label.
+ * @param[out] output        The derived key.
+ * @param[in]  output_size   Size of output.
+ *
+ * @return HW_UNIQUE_KEY_SUCCESS on success, otherwise a negative hardware unique key error code
+ */
+int hw_unique_key_derive_key_cached(enum hw_unique_key_slot key_slot,
+	const uint8_t *context, size_t context_size,
+	uint8_t const *label, size_t label_size,
+	uint8_t *output, uint32_t output_size);
+
+/**
+ * @brief Zeroize all cached derived keys.
+ */
+void hw_unique_key_cache_clear(void);
+#endif /* CONFIG_HW_UNIQUE_KEY_DERIVATION_CACHE || __DOXYGEN__ */
+
 #ifdef __cplusplus
 }
 #endif
@@ -754,6 +754,27 @@ void location_cloud_location_ext_result_set(
 	enum location_ext_result result,
 	struct location_data *location);
 
+/**
+ * @brief Refresh GNSS assistance data if it has expired or is about to expire.
+ *
+ * @details Checks the GNSS assistance data expiry and requests fresh A-GNSS data and/or a P-GPS
+ * prediction if needed, using the same expiry thresholds as a location request. If the assistance
+ * data is still valid, nothing is downloaded. Depending on the configuration, the data is either
+ * downloaded from nRF Cloud or requested from the application with the
+ * @ref LOCATION_EVT_GNSS_ASSISTANCE_REQUEST and @ref LOCATION_EVT_GNSS_PREDICTION_REQUEST events.
+ *
+ * Calling this function when the application has an LTE connection open for its own traffic anyway
+ * allows the assistance data to be downloaded without a separate connection and to be already
+ * valid when the next location request starts. The check is performed asynchronously in the
+ * library work queue. If a location request is ongoing, the call is ignored, because the request
+ * handles the assistance data need.
+ *
+ * @return 0 on success, or negative error code on failure.
+ * @retval -EPERM Location library not initialized.
+ * @retval -ENOTSUP @kconfig{CONFIG_LOCATION_ASSISTANCE_PREFETCH} is not set.
+ */
+int location_assistance_prefetch(void);
+
 /** @} */
 
 #ifdef __cplusplus
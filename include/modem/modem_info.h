@@ -11,6 +11,7 @@
 #include <cJSON.h>
 #endif
 
+#include <stdbool.h>
 #include <stdint.h>
 
 #ifdef __cplusplus
@@ -503,6 +504,70 @@ int modem_info_get_operator(char *buf, size_t buf_size);
  */
 int modem_info_get_snr(int *val);
 
+/**@brief Snapshot of the current signal quality and cell information. */
+struct modem_info_snapshot {
+	/** RSRP in dBm. Only valid when @c rsrp_valid is true. */
+	int rsrp_dbm;
+	/** RSRQ in dB. Only valid when @c rsrq_valid is true. */
+	float rsrq_db;
+	/** Whether the modem has reported a valid RSRP. */
+	bool rsrp_valid;
+	/** Whether the modem has reported a valid RSRQ. */
+	bool rsrq_valid;
+	/** Registration status, as reported by +CEREG. */
+	uint8_t reg_status;
+	/** Cell ID of the device. Only valid when @c cell_valid is true. */
+	uint32_t cell_id;
+	/** Tracking area code. Only valid when @c cell_valid is true. */
+	uint32_t area_code;
+	/** Whether the modem has reported a valid cell ID and tracking area code. */
+	bool cell_valid;
+	/** Uptime of the last signal quality notification, in milliseconds.
+	 *  Zero if no notification has been received.
+	 */
+	int64_t signal_uptime;
+	/** Uptime of the last registration notification, in milliseconds.
+	 *  Zero if no notification has been received.
+	 */
+	int64_t cell_uptime;
+};
+
+/** @brief Enable the modem data snapshot.
+ *
+ * Subscribe to signal quality notifications and maintain a snapshot of the
+ * current signal quality and cell information in RAM. While the snapshot is
+ * enabled, modem_info_get_rsrp() and modem_info_get_rsrq() are served from
+ * the snapshot instead of querying the modem.
+ *
+ * @note The cell information is updated from the +CEREG notifications, which
+ *       must be subscribed to separately, for example by the link controller
+ *       library.
+ *
+ * @retval 0 If the operation was successful.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int modem_info_snapshot_enable(void);
+
+/** @brief Disable the modem data snapshot.
+ *
+ * @retval 0 If the operation was successful.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int modem_info_snapshot_disable(void);
+
+/** @brief Obtain the current modem data snapshot.
+ *
+ * The snapshot is copied to the provided structure. Use the uptime fields to
+ * judge the age of the values.
+ *
+ * @param snapshot Pointer to the target structure.
+ *
+ * @retval 0 If the operation was successful.
+ * @retval -EINVAL if the provided snapshot was NULL.
+ * @retval -EPERM if the snapshot is not enabled.
+ */
+int modem_info_snapshot_get(struct modem_info_snapshot *snapshot);
+
 /** @} */
 
 #ifdef __cplusplus
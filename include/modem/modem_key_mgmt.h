@@ -35,6 +35,24 @@ enum modem_key_mgmt_cred_type {
 	MODEM_KEY_MGMT_CRED_TYPE_IDENTITY
 };
 
+/** @brief Credential to write in a batch operation. */
+struct modem_key_mgmt_cred {
+	/** Security tag to associate with this credential. */
+	nrf_sec_tag_t sec_tag;
+	/** The credential type. */
+	enum modem_key_mgmt_cred_type cred_type;
+	/** Buffer containing the credential data. */
+	const void *buf;
+	/** Length of the buffer. */
+	size_t len;
+	/** Expected SHA-256 digest of the credential as reported by the modem,
+	 *  or NULL. If given and it matches the digest of the credential
+	 *  already stored with this security tag and type, the write is
+	 *  skipped.
+	 */
+	const uint8_t *digest;
+};
+
 /**
  * @brief Credential list entry handler function prototype.
  *
@@ -71,6 +89,37 @@ int modem_key_mgmt_write(nrf_sec_tag_t sec_tag,
 			 enum modem_key_mgmt_cred_type cred_type,
 			 const void *buf, size_t len);
 
+/**
+ * @brief Write a set of credentials to persistent storage.
+ *
+ * Store each credential and associate it with its security tag.
+ * The whole set is written while holding the AT command state once,
+ * which is considerably faster than a sequence of
+ * @ref modem_key_mgmt_write calls when installing a full TLS
+ * credential set.
+ *
+ * Entries with a matching stored digest are skipped, so an already
+ * provisioned set costs only one digest query per entry.
+ *
+ * Processing stops at the first entry that fails to be written.
+ *
+ * @note If used when the LTE link is active, the function will return
+ *	 an error and the keys will not be written.
+ *
+ * @param[in] creds		Array of credentials to write.
+ * @param[in] count		Number of elements in @p creds.
+ *
+ * @retval 0		On success.
+ * @retval -EINVAL	Invalid parameters.
+ * @retval -ENOMEM	Not enough memory to store a credential.
+ * @retval -ENOENT	A security tag is invalid.
+ * @retval -EACCES	Access to credential not allowed.
+ * @retval -EALREADY	Credential already exists (and can't be overwritten).
+ * @retval -EPERM	Not permitted when the LTE link is active.
+ * @retval -ECANCELED	Canceled because voltage is low (power off warning).
+ */
+int modem_key_mgmt_write_batch(const struct modem_key_mgmt_cred *creds, size_t count);
+
 /**
  * @brief Delete a credential from persistent storage.
  *
@@ -56,6 +56,19 @@ enum sms_data_type {
  */
 #define SMS_MAX_ADDRESS_LEN_CHARS 20
 
+/**
+ * @brief Maximum length of the SMS payload delivered to a listener in number of characters.
+ *
+ * @details Equal to @ref SMS_MAX_PAYLOAD_LEN_CHARS unless reassembly of concatenated
+ * SMS messages is enabled, in which case the payload buffer is sized to hold the
+ * configured maximum number of segments.
+ */
+#if defined(CONFIG_SMS_REASSEMBLY)
+#define SMS_MAX_DATA_LEN_CHARS (SMS_MAX_PAYLOAD_LEN_CHARS * CONFIG_SMS_REASSEMBLY_MAX_SEGMENTS)
+#else
+#define SMS_MAX_DATA_LEN_CHARS SMS_MAX_PAYLOAD_LEN_CHARS
+#endif
+
 /**
  * @brief SMS time information specified in 3GPP TS 23.040 Section 9.2.3.11.
  */
@@ -159,8 +172,11 @@ struct sms_data {
 	 * However, header may contain information that determines it for specific purpose,
 	 * e.g., via application port information, in which case it should be treated as
 	 * specified for that purpose.
+	 *
+	 * When reassembly of concatenated SMS messages is enabled, this holds the payload
+	 * of the complete concatenated message.
 	 */
-	uint8_t payload[SMS_MAX_PAYLOAD_LEN_CHARS + 1];
+	uint8_t payload[SMS_MAX_DATA_LEN_CHARS + 1];
 };
 
 /** @brief SMS listener callback function. */
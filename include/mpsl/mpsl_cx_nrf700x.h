@@ -21,6 +21,47 @@ extern "C" {
 #endif
 
 #include <stdbool.h>
+#include <stdint.h>
+
+#if defined(CONFIG_MPSL_CX_NRF700X_STATS) || defined(__DOXYGEN__)
+
+/** @brief nRF700x Coexistence Interface arbitration statistics. */
+struct mpsl_cx_nrf700x_stats {
+	/** Number of requests including a TX operation. */
+	uint32_t tx_requests;
+	/** Number of requests for RX or idle listening only. */
+	uint32_t rx_requests;
+	/** Number of releases. */
+	uint32_t releases;
+	/** Number of times TX was granted for a pending TX request. */
+	uint32_t tx_grants;
+	/** Number of times TX was revoked while a TX request was pending. */
+	uint32_t tx_denials;
+	/** Time spent with a TX request pending and TX granted, in microseconds. */
+	uint64_t tx_granted_time_us;
+	/** Time spent with a TX request pending and TX denied, in microseconds. */
+	uint64_t tx_denied_time_us;
+	/** Shortest observed request-to-TX-grant latency, in microseconds. */
+	uint32_t tx_grant_latency_min_us;
+	/** Longest observed request-to-TX-grant latency, in microseconds. */
+	uint32_t tx_grant_latency_max_us;
+	/** Sum of all observed request-to-TX-grant latencies, in microseconds. */
+	uint64_t tx_grant_latency_sum_us;
+	/** Number of request-to-TX-grant latency samples. */
+	uint32_t tx_grant_latency_samples;
+};
+
+/**
+ * @brief Reads the nRF700x Coexistence Interface arbitration statistics.
+ *
+ * @param[out] stats Output for the statistics.
+ */
+void mpsl_cx_nrf700x_stats_get(struct mpsl_cx_nrf700x_stats *stats);
+
+/** @brief Resets the nRF700x Coexistence Interface arbitration statistics. */
+void mpsl_cx_nrf700x_stats_reset(void);
+
+#endif /* defined(CONFIG_MPSL_CX_NRF700X_STATS) || defined(__DOXYGEN__) */
 
 /**
  * @brief Enables or disables nRF700x Coexistence Interface.
@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef MPSL_TIMESLOT_TELEMETRY_H__
+#define MPSL_TIMESLOT_TELEMETRY_H__
+
+#include <stdint.h>
+#include <mpsl_timeslot.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup mpsl_timeslot_telemetry MPSL timeslot telemetry
+ * @{
+ * @brief Runtime statistics for MPSL timeslot sessions.
+ *
+ * This module wraps the MPSL timeslot API and records how the requested
+ * timeslots fare against the other protocols sharing the radio: how many
+ * requests were granted, blocked, or cancelled, how extensions went, and how
+ * long it took from a request until the timeslot started. Use the wrappers in
+ * place of the corresponding mpsl_timeslot functions; the signal callback and
+ * return values behave exactly as with the plain API.
+ *
+ * @note Only timeslot sessions opened through this module are observed.
+ *       The internal scheduling of the protocol stacks linked against MPSL
+ *       (Bluetooth LE, 802.15.4) is not visible outside the MPSL library.
+ *       Requests issued from the signal callback with
+ *       MPSL_TIMESLOT_SIGNAL_ACTION_REQUEST are counted when they are granted
+ *       or blocked, but their request-to-start latency is not measured.
+ */
+
+/** @brief Aggregated timeslot statistics across all observed sessions. */
+struct mpsl_timeslot_telemetry_stats {
+	/** Number of timeslot requests issued through the wrapper. */
+	uint32_t requests;
+	/** Number of granted timeslots (MPSL_TIMESLOT_SIGNAL_START). */
+	uint32_t starts;
+	/** Number of blocked requests (MPSL_TIMESLOT_SIGNAL_BLOCKED). */
+	uint32_t blocked;
+	/** Number of cancelled timeslots (MPSL_TIMESLOT_SIGNAL_CANCELLED). */
+	uint32_t cancelled;
+	/** Number of successful timeslot extensions. */
+	uint32_t extend_succeeded;
+	/** Number of failed timeslot extensions. */
+	uint32_t extend_failed;
+	/** Number of overstayed timeslots (MPSL_TIMESLOT_SIGNAL_OVERSTAYED). */
+	uint32_t overstayed;
+	/** Shortest observed request-to-start latency, in microseconds. */
+	uint32_t latency_min_us;
+	/** Longest observed request-to-start latency, in microseconds. */
+	uint32_t latency_max_us;
+	/** Sum of all observed request-to-start latencies, in microseconds. */
+	uint64_t latency_sum_us;
+	/** Number of request-to-start latency samples. */
+	uint32_t latency_samples;
+};
+
+/**
+ * @brief Open an observed timeslot session.
+ *
+ * Drop-in replacement for mpsl_timeslot_session_open().
+ *
+ * @param callback     The signal callback.
+ * @param p_session_id Output for the session id.
+ *
+ * @return 0 on success, or an mpsl_timeslot_session_open() error code.
+ */
+int mpsl_timeslot_telemetry_session_open(mpsl_timeslot_callback_t callback,
+					 mpsl_timeslot_session_id_t *p_session_id);
+
+/**
+ * @brief Request a timeslot in an observed session.
+ *
+ * Drop-in replacement for mpsl_timeslot_request().
+ *
+ * @param session_id Session id from mpsl_timeslot_telemetry_session_open().
+ * @param p_request  The timeslot request.
+ *
+ * @return 0 on success, or an mpsl_timeslot_request() error code.
+ */
+int mpsl_timeslot_telemetry_request(mpsl_timeslot_session_id_t session_id,
+				    const mpsl_timeslot_request_t *p_request);
+
+/**
+ * @brief Close an observed timeslot session.
+ *
+ * Drop-in replacement for mpsl_timeslot_session_close().
+ *
+ * @param session_id Session id from mpsl_timeslot_telemetry_session_open().
+ *
+ * @return 0 on success, or an mpsl_timeslot_session_close() error code.
+ */
+int mpsl_timeslot_telemetry_session_close(mpsl_timeslot_session_id_t session_id);
+
+/**
+ * @brief Read the aggregated timeslot statistics.
+ *
+ * @param stats Output for the statistics.
+ */
+void mpsl_timeslot_telemetry_stats_get(struct mpsl_timeslot_telemetry_stats *stats);
+
+/** @brief Reset the aggregated timeslot statistics. */
+void mpsl_timeslot_telemetry_stats_reset(void);
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MPSL_TIMESLOT_TELEMETRY_H__ */
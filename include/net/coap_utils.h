@@ -40,6 +40,44 @@ int coap_send_request(enum coap_method method, const struct sockaddr *addr,
 		      const char *const *uri_path_options, uint8_t *payload,
 		      uint16_t payload_size, coap_reply_t reply_cb);
 
+/** @brief Callback for data received by @ref coap_block_download.
+ *
+ * Called from the CoAP receive thread once per block, in block order.
+ *
+ * @param[in] err    0 when data is valid, negative errno when the download
+ *                   failed. On failure the download is over and the other
+ *                   parameters carry no data.
+ * @param[in] data   Pointer to the block payload. Only valid during the call.
+ * @param[in] len    Length of the block payload.
+ * @param[in] offset Offset of the block within the resource.
+ * @param[in] last   True for the final callback of the download.
+ */
+typedef void (*coap_block_download_cb_t)(int err, const uint8_t *data,
+					 size_t len, size_t offset, bool last);
+
+/** @brief Download a resource using CoAP blockwise transfers (block2).
+ *
+ * Keeps up to @kconfig{CONFIG_COAP_UTILS_BLOCK_DOWNLOAD_WINDOW} block
+ * requests outstanding at a time. Blocks that arrive out of order are
+ * buffered and delivered to the callback in order. Only one download can be
+ * in progress at a time.
+ *
+ * Requires @kconfig{CONFIG_COAP_UTILS_BLOCK_DOWNLOAD}.
+ *
+ * @param[in] addr             Pointer to the socket address of the server.
+ * @param[in] uri_path_options Pointer to CoAP URI schemes option. Must remain
+ *                             valid until the download completes.
+ * @param[in] cb               Function to call for each downloaded block.
+ *
+ * @retval 0 On success.
+ * @retval -EINVAL If a required parameter is NULL.
+ * @retval -EBUSY If a download is already in progress.
+ * @retval -EIO If the first block request could not be sent.
+ */
+int coap_block_download(const struct sockaddr *addr,
+			const char *const *uri_path_options,
+			coap_block_download_cb_t cb);
+
 #endif /* __COAP_UTILS_H__ */
 
 /**
@@ -1229,6 +1229,37 @@ void dect_net_l2_association_removed(struct net_if *iface, uint32_t long_rd_id,
 void dect_net_l2_parent_ipv6_config_changed(struct net_if *iface, uint32_t parent_long_rd_id,
 					    struct dect_net_ipv6_prefix_config *ipv6_prefix_config);
 
+#if defined(CONFIG_NET_L2_DECT_QOS) || defined(__DOXYGEN__)
+/** @brief QoS TX queue classes. */
+enum dect_net_l2_qos_queue {
+	/** Latency-critical traffic, packet priority NET_PRIORITY_CA or higher. */
+	DECT_NET_L2_QOS_CONTROL = 0,
+	/** Bulk traffic, transmitted only when the control queue is empty. */
+	DECT_NET_L2_QOS_BULK,
+	/** Number of QoS TX queues. */
+	DECT_NET_L2_QOS_QUEUE_COUNT,
+};
+
+/** @brief QoS TX queue statistics, indexed by @ref dect_net_l2_qos_queue. */
+struct dect_net_l2_qos_stats {
+	/** Number of packets currently queued. */
+	uint32_t depth[DECT_NET_L2_QOS_QUEUE_COUNT];
+	/** Highest queue depth seen since boot. */
+	uint32_t max_depth[DECT_NET_L2_QOS_QUEUE_COUNT];
+	/** Total number of packets queued since boot. */
+	uint32_t enqueued[DECT_NET_L2_QOS_QUEUE_COUNT];
+	/** Total number of packets dropped due to a full queue since boot. */
+	uint32_t dropped[DECT_NET_L2_QOS_QUEUE_COUNT];
+};
+
+/**
+ * @brief Read the QoS TX queue statistics.
+ *
+ * @param stats Output for the statistics.
+ */
+void dect_net_l2_qos_stats_get(struct dect_net_l2_qos_stats *stats);
+#endif /* CONFIG_NET_L2_DECT_QOS || __DOXYGEN__ */
+
 /**
  * @}
  */
@@ -24,6 +24,14 @@
 struct downloader_transport_http_cfg {
 	/** Socket receive timeout in milliseconds. The default timeout is 30000 ms. */
 	uint32_t sock_recv_timeo_ms;
+	/**
+	 * Number of range requests to keep in flight on the connection when ranged
+	 * downloads are used. Values above one enable HTTP/1.1 pipelining, which hides
+	 * the request round-trip time on high-latency links. Note that not all servers
+	 * support pipelined requests. The default is
+	 * @kconfig{CONFIG_DOWNLOADER_HTTP_PIPELINE_COUNT}.
+	 */
+	uint8_t pipeline_count;
 };
 
 /**
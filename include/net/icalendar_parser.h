@@ -100,6 +100,18 @@ struct ical_parser_evt {
 typedef int (*icalendar_parser_callback_t)(
 	const struct ical_parser_evt *event);
 
+#if defined(CONFIG_ICAL_PARSER_EVENT_INDEX) || defined(__DOXYGEN__)
+/**
+ * @brief Entry in the parsed event index.
+ */
+struct ical_index_entry {
+	/** DTSTART property value of the indexed Event Component. */
+	char dtstart[CONFIG_ICAL_PARSER_DTSTART_SIZE + 1];
+	/** Byte offset of the component in the calendar stream. */
+	size_t offset;
+};
+#endif
+
 /**
  * @brief iCalendar parser instance.
  */
@@ -112,6 +124,14 @@ struct icalendar_parser {
 	bool icalobject_begin;
 	/** Event handler. */
 	icalendar_parser_callback_t callback;
+#if defined(CONFIG_ICAL_PARSER_EVENT_INDEX)
+	/** Index of parsed Event Components, sorted by DTSTART. */
+	struct ical_index_entry index[CONFIG_ICAL_PARSER_EVENT_INDEX_MAX];
+	/** Number of entries in the event index. */
+	size_t index_count;
+	/** Stream offset of the first unparsed byte in buf. */
+	size_t stream_base;
+#endif
 };
 
 /**
@@ -137,6 +157,34 @@ int ical_parser_init(struct icalendar_parser *ical,
 size_t ical_parser_parse(struct icalendar_parser *ical,
 			const char *data, size_t len);
 
+#if defined(CONFIG_ICAL_PARSER_EVENT_INDEX) || defined(__DOXYGEN__)
+/**
+ * @brief Find the first indexed event starting at or after a given date-time.
+ *
+ * The index is built while the stream is parsed, so lookups need no re-parse.
+ * DTSTART values are compared as strings, which orders correctly for the
+ * date-time format of RFC 5545 within one time zone reference.
+ *
+ * @param[in] ical  iCalendar parser instance.
+ * @param[in] after DTSTART value to search from, or NULL for the earliest
+ *                  indexed event.
+ *
+ * @return The matching index entry, or NULL if no indexed event starts at or
+ *         after the given date-time.
+ */
+const struct ical_index_entry *ical_parser_index_find(
+	const struct icalendar_parser *ical, const char *after);
+
+/**
+ * @brief Get the number of entries in the parsed event index.
+ *
+ * @param[in] ical iCalendar parser instance.
+ *
+ * @return Number of indexed events.
+ */
+size_t ical_parser_index_count(const struct icalendar_parser *ical);
+#endif
+
 /**@} */
 
 #ifdef __cplusplus
@@ -143,6 +143,36 @@ int mqtt_helper_subscribe(struct mqtt_subscription_list *sub_list);
  */
 int mqtt_helper_publish(const struct mqtt_publish_param *param);
 
+/** @brief Queue an MQTT message for batched publishing.
+ *
+ *  The topic and payload are copied into an internal buffer. All queued messages are published
+ *  back to back when the batch window set by CONFIG_MQTT_HELPER_PUBLISH_BATCH_WINDOW_MS expires,
+ *  when a message does not fit in the remaining buffer space, or when mqtt_helper_publish_flush()
+ *  is called. Sending the messages in one burst lets the network stack combine them into fewer
+ *  radio transactions. Only the topic, payload, message ID, QoS, and retain flag of the publish
+ *  parameters are preserved.
+ *
+ *  Queued messages that have not been sent are dropped when the connection is closed.
+ *
+ *  @note Requires CONFIG_MQTT_HELPER_PUBLISH_BATCHING to be enabled.
+ *
+ *  @retval 0 if successful.
+ *  @retval -EINVAL if the message ID is invalid.
+ *  @retval -EMSGSIZE if the message cannot fit in the batch buffer.
+ *  @retval -EOPNOTSUPP if operation is not supported in the current state.
+ *  @return Otherwise a negative error code.
+ */
+int mqtt_helper_publish_buffered(const struct mqtt_publish_param *param);
+
+/** @brief Publish all queued messages without waiting for the batch window to expire.
+ *
+ *  @note Requires CONFIG_MQTT_HELPER_PUBLISH_BATCHING to be enabled.
+ *
+ *  @retval 0 if successful or if no messages were queued.
+ *  @return Otherwise the first error encountered when publishing the queued messages.
+ */
+int mqtt_helper_publish_flush(void);
+
 /** @brief Get a message ID.
  *
  *  @note Will not return 0 as it is reserved for invalid message IDs, see MQTT specification.
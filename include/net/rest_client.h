@@ -168,6 +168,15 @@ int rest_client_request(struct rest_client_req_context *req_ctx,
  */
 void rest_client_request_defaults_set(struct rest_client_req_context *req_ctx);
 
+/**
+ * @brief Close all pooled connections.
+ *
+ * @details Intended to be used before entering power saving mode or when the network
+ *          connection is lost. Has no effect unless CONFIG_REST_CLIENT_CONNECTION_POOL
+ *          is enabled.
+ */
+void rest_client_pool_close_all(void);
+
 #ifdef __cplusplus
 }
 #endif
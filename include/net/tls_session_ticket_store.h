@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef TLS_SESSION_TICKET_STORE_H__
+#define TLS_SESSION_TICKET_STORE_H__
+
+#include <stddef.h>
+#include <zephyr/net/tls_credentials.h>
+
+/**
+ * @defgroup tls_session_ticket_store TLS session ticket store
+ * @{
+ * @brief Store for TLS session tickets, keyed by security tag and hostname.
+ *
+ * The store keeps serialized TLS sessions in RAM, and optionally persists them
+ * across reboots using the settings subsystem
+ * (CONFIG_TLS_SESSION_TICKET_STORE_SETTINGS). Resuming a session instead of
+ * performing a full handshake cuts the connection setup time and saves the
+ * certificate-chain airtime. The tickets are opaque to the store, so it can
+ * hold sessions from any TLS implementation, for example the output of
+ * mbedtls_ssl_session_save().
+ */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Save a session ticket for the given security tag and hostname.
+ *
+ * An existing ticket for the same security tag and hostname is replaced.
+ * When the store is full, the least recently used entry is evicted.
+ *
+ * @param[in] sec_tag    Security tag the session was established with.
+ * @param[in] hostname   Peer hostname the session was established with.
+ * @param[in] ticket     Serialized session to store.
+ * @param[in] ticket_len Size of the serialized session.
+ *
+ * @retval 0        If the ticket was stored.
+ * @retval -EINVAL  If hostname or ticket is NULL, or ticket_len is zero.
+ * @retval -EFBIG   If the ticket or the hostname is too large for the store.
+ */
+int tls_session_ticket_store_save(sec_tag_t sec_tag, const char *hostname, const void *ticket,
+				  size_t ticket_len);
+
+/**
+ * @brief Load the session ticket stored for the given security tag and hostname.
+ *
+ * @param[in]     sec_tag    Security tag to look up.
+ * @param[in]     hostname   Peer hostname to look up.
+ * @param[out]    ticket     Buffer to copy the serialized session into.
+ * @param[in,out] ticket_len Size of the buffer on input, size of the serialized
+ *                           session on output.
+ *
+ * @retval 0        If a ticket was found and copied.
+ * @retval -EINVAL  If hostname, ticket or ticket_len is NULL.
+ * @retval -ENOENT  If no ticket is stored for the security tag and hostname.
+ * @retval -EFBIG   If the buffer is too small for the stored ticket.
+ */
+int tls_session_ticket_store_load(sec_tag_t sec_tag, const char *hostname, void *ticket,
+				  size_t *ticket_len);
+
+/**
+ * @brief Delete the session ticket stored for the given security tag and hostname.
+ *
+ * Use this when a resumption attempt is rejected by the server, so that the
+ * next connection falls back to a full handshake without a stale ticket.
+ *
+ * @param[in] sec_tag  Security tag to look up.
+ * @param[in] hostname Peer hostname to look up.
+ *
+ * @retval 0        If the ticket was deleted.
+ * @retval -EINVAL  If hostname is NULL.
+ * @retval -ENOENT  If no ticket is stored for the security tag and hostname.
+ */
+int tls_session_ticket_store_delete(sec_tag_t sec_tag, const char *hostname);
+
+/**
+ * @brief Delete all stored session tickets, including persisted ones.
+ *
+ * @retval 0 If the store was cleared.
+ */
+int tls_session_ticket_store_clear(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* TLS_SESSION_TICKET_STORE_H__ */
@@ -42,6 +42,22 @@ enum ncm_event_type {
  */
 extern void ncm_net_core_event_handler(enum ncm_event_type event, uint32_t reset_reas);
 
+#ifdef CONFIG_NCM_CPU_LOAD
+/** @brief Get the network core CPU load.
+ *
+ * Returns the CPU load measured by the network core over its last feeding
+ * interval, as published alongside the liveness counter. The value is
+ * refreshed every CONFIG_NCM_FEEDING_INTERVAL_MSEC milliseconds and stays at
+ * its last value if the network core stops responding.
+ *
+ * @param[out] load_percent CPU load in percent, from 0 to 100.
+ *
+ * @retval 0 on success.
+ * @retval -EINVAL if @p load_percent is NULL.
+ */
+int ncm_net_core_cpu_load_get(uint8_t *load_percent);
+#endif /* CONFIG_NCM_CPU_LOAD */
+
 #ifdef __cplusplus
 }
 #endif
@@ -55,6 +55,54 @@ struct nfc_ndef_msg_desc {
 int nfc_ndef_msg_encode(struct nfc_ndef_msg_desc const *ndef_msg_desc, uint8_t *msg_buffer,
 			uint32_t *msg_len);
 
+/**
+ * @brief Encode an NDEF message as a fragment list.
+ *
+ * This function encodes an NDEF message as a gather list of buffer
+ * fragments. Record headers and constructed payloads are encoded into the
+ * provided auxiliary buffer, while binary record payloads are referenced
+ * in the application memory without copying (see @ref
+ * nfc_ndef_record_frags_encode). Use @ref nfc_ndef_msg_frags_copy to
+ * serialize the fragment list into a contiguous buffer, for example the
+ * tag emulation buffer, with a single copy of every payload byte.
+ *
+ * @param ndef_msg_desc Pointer to the message descriptor.
+ * @param aux_buffer Pointer to the auxiliary buffer for record headers and
+ * constructed payloads.
+ * @param aux_len Size of the available auxiliary buffer memory as input.
+ * Size of the used auxiliary buffer memory as output.
+ * @param frag_list Pointer to the fragment list to fill. Every record uses
+ * up to two fragments.
+ * @param frag_count Number of available elements in the fragment list as
+ * input. Number of used elements as output.
+ * @param msg_len Total length of the encoded message as output.
+ *
+ * @retval 0 If the operation was successful.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int nfc_ndef_msg_frags_encode(struct nfc_ndef_msg_desc const *ndef_msg_desc,
+			      uint8_t *aux_buffer, uint32_t *aux_len,
+			      struct nfc_ndef_frag *frag_list, uint32_t *frag_count,
+			      uint32_t *msg_len);
+
+/**
+ * @brief Serialize a fragment list into a contiguous buffer.
+ *
+ * This function copies the fragments created by @ref
+ * nfc_ndef_msg_frags_encode into a contiguous message buffer.
+ *
+ * @param frag_list Pointer to the fragment list.
+ * @param frag_count Number of elements in the fragment list.
+ * @param msg_buffer Pointer to the message destination.
+ * @param msg_len Size of the available memory for the message as input.
+ * Size of the serialized message as output.
+ *
+ * @retval 0 If the operation was successful.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int nfc_ndef_msg_frags_copy(const struct nfc_ndef_frag *frag_list, uint32_t frag_count,
+			    uint8_t *msg_buffer, uint32_t *msg_len);
+
 /**
  * @brief Clear an NDEF message.
  *
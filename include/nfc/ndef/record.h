@@ -236,6 +236,53 @@ int nfc_ndef_record_encode(struct nfc_ndef_record_desc const *ndef_record_desc,
 			   enum nfc_ndef_record_location const record_location,
 			   uint8_t *record_buffer, uint32_t *record_len);
 
+/**
+ * @brief Fragment of an encoded NDEF record or message.
+ *
+ * Fragments describe an encoded record or message as a gather list of
+ * buffers, which allows binary record payloads to be referenced in the
+ * application memory instead of being copied.
+ */
+struct nfc_ndef_frag {
+	/** Pointer to the fragment data. */
+	const uint8_t *data;
+
+	/** Length of the fragment data in bytes. */
+	uint32_t length;
+};
+
+/**
+ * @brief Encode an NDEF record as a fragment list.
+ *
+ * @details This function encodes an NDEF record as a gather list of buffer
+ * fragments. The record header (and, for records with a payload
+ * constructor, the constructed payload) is encoded into the provided
+ * auxiliary buffer. Binary record payloads (see @ref
+ * NFC_NDEF_RECORD_BIN_DATA_DEF) are referenced in place, without copying,
+ * so the referenced payload memory must remain valid and unmodified as
+ * long as the fragment list is in use.
+ *
+ * @param ndef_record_desc Pointer to the record descriptor.
+ * @param record_location Location of the record within the NDEF message.
+ * @param aux_buffer Pointer to the auxiliary buffer for the record header
+ * and constructed payloads.
+ * @param aux_len Size of the available auxiliary buffer memory as input.
+ * Size of the used auxiliary buffer memory as output.
+ * @param frag_list Pointer to the fragment list to fill. A record uses up
+ * to two fragments.
+ * @param frag_count Number of available elements in the fragment list as
+ * input. Number of used elements as output.
+ * @param record_len Total length of the encoded record as output.
+ *
+ * @retval 0 If the operation was successful.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int nfc_ndef_record_frags_encode(struct nfc_ndef_record_desc const *ndef_record_desc,
+				 enum nfc_ndef_record_location const record_location,
+				 uint8_t *aux_buffer, uint32_t *aux_len,
+				 struct nfc_ndef_frag *frag_list, uint32_t *frag_count,
+				 uint32_t *record_len);
+
 /**
  * @brief Construct the payload for an NFC NDEF record from binary data.
  *
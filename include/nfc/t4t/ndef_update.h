@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef NFC_T4T_NDEF_UPDATE_H_
+#define NFC_T4T_NDEF_UPDATE_H_
+
+/**@file
+ *
+ * @defgroup nfc_t4t_ndef_update NFC NDEF File update
+ * @{
+ * @brief Double-buffered update of the NFC Type 4 Tag NDEF File.
+ *
+ * The library keeps two application-provided NDEF file buffers. The front
+ * buffer is emulated by the Type 4 Tag library, while the application can
+ * encode new tag content into the back buffer at any time. A committed
+ * back buffer is swapped in immediately when no reader is in the field,
+ * or deferred until the field is turned off, so a reader always sees a
+ * consistent snapshot of the tag content.
+ */
+
+#include <zephyr/types.h>
+#include <nfc_t4t_lib.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Initialize the NDEF File update library.
+ *
+ * Registers the two NDEF file buffers and sets the first one as the
+ * emulated buffer. Call this function after @em nfc_t4t_setup() and
+ * before @em nfc_t4t_emulation_start(). Both buffers must stay
+ * accessible for the lifetime of the tag emulation.
+ *
+ * @param[in] buf_a First NDEF file buffer. Must contain a valid NDEF
+ *                  file, as it is emulated until the first swap.
+ * @param[in] buf_b Second NDEF file buffer.
+ * @param[in] buf_size Size of each of the two buffers.
+ *
+ * @retval 0 If the operation was successful.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int nfc_t4t_ndef_update_init(uint8_t *buf_a, uint8_t *buf_b, uint32_t buf_size);
+
+/**@brief Get the back buffer for the next tag content update.
+ *
+ * The returned buffer can be filled with a new NDEF file (see @ref
+ * nfc_t4t_ndef_file_encode) and then committed with @ref
+ * nfc_t4t_ndef_update_commit.
+ *
+ * @return Pointer to the back buffer, or NULL if the library is not
+ *         initialized or a committed update has not been swapped in yet.
+ *         In the latter case, skip the update or retry later.
+ */
+uint8_t *nfc_t4t_ndef_update_buf_get(void);
+
+/**@brief Commit the content of the back buffer.
+ *
+ * If no reader is in the field, the back buffer is swapped in
+ * immediately. Otherwise, the swap is performed when the reader leaves
+ * the field. The back buffer must not be modified after this call until
+ * @ref nfc_t4t_ndef_update_buf_get returns a buffer again.
+ *
+ * @retval 0 If the operation was successful.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int nfc_t4t_ndef_update_commit(void);
+
+/**@brief Forward a Type 4 Tag library event to the update library.
+ *
+ * Call this function from the @em nfc_t4t_setup() callback for every
+ * received event. The library uses the field events to track reader
+ * presence and to apply a deferred buffer swap.
+ *
+ * @note A reader may update the emulated file over NFC
+ *       (@em NFC_T4T_EVENT_NDEF_UPDATED). A buffer swap discards such an
+ *       update, so an application that supports reader writes must
+ *       process the received content before committing new content.
+ *
+ * @param[in] event Forwarded Type 4 Tag library event.
+ */
+void nfc_t4t_ndef_update_event_forward(nfc_t4t_event_t event);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* NFC_T4T_NDEF_UPDATE_H_ */
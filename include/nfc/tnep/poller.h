@@ -275,6 +275,50 @@ int nfc_tnep_poller_svc_read(const struct nfc_tnep_buf *svc_buf);
 int nfc_tnep_poller_svc_write(const struct nfc_ndef_msg_desc *msg,
 			      const struct nfc_tnep_buf *resp_buf);
 
+/**@brief TNEP Service data stream descriptor. */
+struct nfc_tnep_poller_stream {
+	/** TNF of the NDEF Records which carry the stream chunks. */
+	enum nfc_ndef_record_tnf tnf;
+
+	/** Pointer to the type field of the NDEF Records which carry
+	 *  the stream chunks.
+	 */
+	const uint8_t *type;
+
+	/** Length of the type field. */
+	uint8_t type_length;
+
+	/** Pointer to the stream data. */
+	const uint8_t *data;
+
+	/** Stream data length. */
+	size_t len;
+};
+
+/**@brief Write the TNEP Service data as a stream.
+ *
+ * Function for writing a large amount of the TNEP Service data. The
+ * stream data is split into single-record NDEF Messages limited by the
+ * Tx buffer size and the Maximum NDEF Message size of the selected
+ * service. After each successful update, the library reads the service
+ * status and immediately writes the next chunk, without involving the
+ * application between the chunks. The Service must be selected first.
+ * This operation is asynchronous.
+ *
+ * The @em svc_sent callback is called once, after the whole stream was
+ * written, or on the first unsuccessful service status or timeout.
+ *
+ * @param[in] stream Pointer to the stream descriptor. The stream data
+ *                   must be kept until this operation is finished.
+ * @param[in] resp_buf Pointer to received data buffer. Buffer must be stored
+ *                     until the stream write procedure is finished.
+ *
+ * @retval 0 If the operation was successful.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int nfc_tnep_poller_svc_stream_write(const struct nfc_tnep_poller_stream *stream,
+				     const struct nfc_tnep_buf *resp_buf);
+
 /**@brief Indicate NDEF data read.
  *
  * This function must be called immediately after NFC Reader/Writer
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/**
+ * @file
+ * @brief Flash-backed LZMA dictionary for the compression/decompression subsystem
+ */
+
+#ifndef NRF_COMPRESS_LZMA_DICT_FLASH_H_
+#define NRF_COMPRESS_LZMA_DICT_FLASH_H_
+
+#include <zephyr/types.h>
+#include <nrf_compress/lzma_types.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Select the flash area backing the LZMA dictionary.
+ *
+ * Must be called before the dictionary is opened through the external dictionary interface.
+ * The flash area, typically a partition on external flash, must be at least as large as the
+ * dictionary size of the compressed stream.
+ *
+ * @param[in]	fa_id	Flash area ID of the partition to use.
+ *
+ * @retval	0	Success.
+ * @retval	-EBUSY	The dictionary is currently open.
+ */
+int nrf_compress_lzma_dict_flash_area_set(uint8_t fa_id);
+
+/**
+ * @brief Open function of the flash-backed dictionary. See @ref lzma_dictionary_open_func_t.
+ */
+int nrf_compress_lzma_dict_flash_open(size_t dict_size, size_t *buff_size);
+
+/**
+ * @brief Close function of the flash-backed dictionary. See @ref lzma_dictionary_close_func_t.
+ */
+int nrf_compress_lzma_dict_flash_close(void);
+
+/**
+ * @brief Write function of the flash-backed dictionary. See @ref lzma_dictionary_write_func_t.
+ */
+size_t nrf_compress_lzma_dict_flash_write(size_t pos, const uint8_t *data, size_t len);
+
+/**
+ * @brief Read function of the flash-backed dictionary. See @ref lzma_dictionary_read_func_t.
+ */
+size_t nrf_compress_lzma_dict_flash_read(size_t pos, uint8_t *data, size_t len);
+
+/**
+ * @brief Initializer for an @ref lzma_codec backed by the selected flash area.
+ *
+ * Dictionary data is staged in a RAM sector buffer and written through to the selected flash
+ * area one erase sector at a time, so only
+ * @kconfig{CONFIG_NRF_COMPRESS_LZMA_DICT_FLASH_SECTOR_SIZE} bytes of RAM are needed regardless
+ * of the dictionary size.
+ */
+#define NRF_COMPRESS_LZMA_DICT_FLASH_CODEC_INIT                                                    \
+	{                                                                                          \
+		.dict_if = {                                                                       \
+			.open = nrf_compress_lzma_dict_flash_open,                                 \
+			.close = nrf_compress_lzma_dict_flash_close,                               \
+			.write = nrf_compress_lzma_dict_flash_write,                               \
+			.read = nrf_compress_lzma_dict_flash_read,                                 \
+		},                                                                                 \
+	}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_COMPRESS_LZMA_DICT_FLASH_H_ */
@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef NRF_HOT_TEXT_H_
+#define NRF_HOT_TEXT_H_
+
+/**
+ * @defgroup nrf_hot_text Hot path code placement
+ * @brief Cache-friendly placement of latency critical functions
+ *
+ * Annotating a function with @ref NRF_HOT_TEXT moves it out of the default
+ * text placement. Depending on the selected placement, the function is
+ * either copied to RAM at boot or grouped with the other annotated
+ * functions into one contiguous flash section. Both placements reduce
+ * instruction fetch latency on the annotated path, which matters most for
+ * interrupt handlers and dispatch loops on builds that execute in place
+ * from external flash.
+ *
+ * Which functions to annotate is an application decision. Use profiling
+ * data, for example from nrf_profiler or the latency probe library, to
+ * identify the paths where fetch latency dominates; annotating cold code
+ * only wastes RAM or cache footprint.
+ *
+ * The annotation compiles to nothing when CONFIG_NRF_HOT_TEXT is disabled.
+ *
+ * @{
+ */
+
+#include <zephyr/toolchain.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Place a function in the hot text region.
+ *
+ * Use on the function definition, in the same position as other attribute
+ * macros such as @c __ramfunc:
+ *
+ * @code
+ * NRF_HOT_TEXT void radio_isr(void)
+ * {
+ *         ...
+ * }
+ * @endcode
+ *
+ * The annotated function is never inlined into callers outside the hot
+ * text region, as that would duplicate it back into the default placement.
+ */
+#if defined(CONFIG_NRF_HOT_TEXT_PLACEMENT_RAM)
+#define NRF_HOT_TEXT __ramfunc
+#elif defined(CONFIG_NRF_HOT_TEXT_PLACEMENT_FLASH)
+#define NRF_HOT_TEXT __noinline __attribute__((__section__(".nrf_hot_text")))
+#else
+#define NRF_HOT_TEXT
+#endif
+
+#ifdef __cplusplus
+}
+#endif
+
+/** @} */
+
+#endif /* NRF_HOT_TEXT_H_ */
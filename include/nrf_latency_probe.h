@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef NRF_LATENCY_PROBE_H_
+#define NRF_LATENCY_PROBE_H_
+
+/**
+ * @defgroup nrf_latency_probe Latency probe library
+ * @brief Lightweight cycle-counter based latency instrumentation
+ *
+ * A latency probe measures the time spent between a begin and an end point
+ * in a hot path and aggregates the measured durations into a log2
+ * histogram. Recording a sample reads the kernel cycle counter and
+ * increments one histogram bucket, so probes are cheap enough to stay
+ * enabled in production. The histograms can be inspected with the
+ * latency_probe shell command or read out by the application.
+ *
+ * All macros compile to nothing when CONFIG_NRF_LATENCY_PROBE is disabled.
+ *
+ * @{
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Number of histogram buckets. Bucket n counts samples with a duration of
+ * [2^(n-1), 2^n) cycles, while bucket 0 counts zero-cycle samples.
+ */
+#define NRF_LATENCY_PROBE_BUCKET_COUNT 33
+
+/** @brief Latency probe.
+ *
+ * Use @ref NRF_LATENCY_PROBE_DEFINE to create an instance.
+ */
+struct nrf_latency_probe {
+	/** Probe name. */
+	const char *name;
+	/** Number of recorded samples. */
+	atomic_t count;
+	/** Longest recorded duration in cycles. */
+	atomic_t max_cycles;
+	/** Log2 histogram of the recorded durations. */
+	atomic_t buckets[NRF_LATENCY_PROBE_BUCKET_COUNT];
+};
+
+/** @brief Record a sample on a latency probe.
+ *
+ * Prefer the @ref NRF_LATENCY_PROBE_BEGIN and @ref NRF_LATENCY_PROBE_END
+ * pair over calling this function directly.
+ *
+ * @param probe Probe instance.
+ * @param cycles Measured duration in cycles.
+ */
+static inline void nrf_latency_probe_record(struct nrf_latency_probe *probe,
+					    uint32_t cycles)
+{
+	atomic_t old_max;
+
+	atomic_inc(&probe->buckets[find_msb_set(cycles)]);
+	atomic_inc(&probe->count);
+
+	old_max = atomic_get(&probe->max_cycles);
+	while ((cycles > old_max) &&
+	       !atomic_cas(&probe->max_cycles, old_max, cycles)) {
+		old_max = atomic_get(&probe->max_cycles);
+	}
+}
+
+#ifdef CONFIG_NRF_LATENCY_PROBE
+
+/** @brief Define a latency probe.
+ *
+ * Place the definition at file scope in the module containing the
+ * instrumented code path.
+ *
+ * @param pname Probe name. Must be a valid C identifier.
+ */
+#define NRF_LATENCY_PROBE_DEFINE(pname)						\
+	STRUCT_SECTION_ITERABLE(nrf_latency_probe,				\
+				_nrf_latency_probe_##pname) = {			\
+		.name = STRINGIFY(pname),					\
+	}
+
+/** @brief Declare a latency probe defined in another module.
+ *
+ * @param pname Probe name.
+ */
+#define NRF_LATENCY_PROBE_DECLARE(pname)					\
+	extern struct nrf_latency_probe _nrf_latency_probe_##pname
+
+/** @brief Start a latency measurement.
+ *
+ * The macro declares a local variable holding the start timestamp. It must
+ * be placed in the same scope as the matching @ref NRF_LATENCY_PROBE_END.
+ *
+ * @param pname Probe name.
+ */
+#define NRF_LATENCY_PROBE_BEGIN(pname)						\
+	uint32_t _nrf_latency_probe_start_##pname = k_cycle_get_32()
+
+/** @brief Finish a latency measurement and record the sample.
+ *
+ * @param pname Probe name.
+ */
+#define NRF_LATENCY_PROBE_END(pname)						\
+	NRF_LATENCY_PROBE_RECORD(pname, _nrf_latency_probe_start_##pname)
+
+/** @brief Read the cycle counter for a latency measurement.
+ *
+ * Use together with @ref NRF_LATENCY_PROBE_RECORD when the begin and end
+ * points are in different scopes, for example in separate interrupt
+ * handlers.
+ */
+#define NRF_LATENCY_PROBE_TIMESTAMP() k_cycle_get_32()
+
+/** @brief Record a sample measured from a stored timestamp.
+ *
+ * @param pname Probe name.
+ * @param start_cycles Timestamp from @ref NRF_LATENCY_PROBE_TIMESTAMP.
+ */
+#define NRF_LATENCY_PROBE_RECORD(pname, start_cycles)				\
+	nrf_latency_probe_record(&_nrf_latency_probe_##pname,			\
+				 k_cycle_get_32() - (start_cycles))
+
+#else
+
+#define NRF_LATENCY_PROBE_DEFINE(pname)						\
+	extern struct nrf_latency_probe _nrf_latency_probe_##pname
+
+#define NRF_LATENCY_PROBE_DECLARE(pname)					\
+	extern struct nrf_latency_probe _nrf_latency_probe_##pname
+
+#define NRF_LATENCY_PROBE_BEGIN(pname) (void)0
+
+#define NRF_LATENCY_PROBE_END(pname) (void)0
+
+#define NRF_LATENCY_PROBE_TIMESTAMP() 0U
+
+#define NRF_LATENCY_PROBE_RECORD(pname, start_cycles) (void)(start_cycles)
+
+#endif /* CONFIG_NRF_LATENCY_PROBE */
+
+/** @brief Reset the histogram of a latency probe.
+ *
+ * @param probe Probe instance.
+ */
+void nrf_latency_probe_reset(struct nrf_latency_probe *probe);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* NRF_LATENCY_PROBE_H_ */
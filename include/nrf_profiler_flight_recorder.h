@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _NRF_PROFILER_FLIGHT_RECORDER_H_
+#define _NRF_PROFILER_FLIGHT_RECORDER_H_
+
+/**
+ * @defgroup nrf_profiler_flight_recorder Profiler flight recorder
+ * @brief Profiler flight recorder
+ *
+ * The flight recorder continuously stores the most recent profiler events
+ * in a circular RAM buffer. The buffer can be persisted to the
+ * nrf_profiler_snapshot flash partition for post-mortem analysis, for
+ * example on fatal error or right before a watchdog fires.
+ *
+ * @{
+ */
+
+#include <errno.h>
+#include <stddef.h>
+#include <zephyr/types.h>
+
+/** @brief Persist the circular event buffer to the snapshot flash partition.
+ *
+ * The previously stored snapshot is erased before the write. The function
+ * can be called from a fatal error handler or a watchdog callback, provided
+ * that the snapshot partition is located in an internal memory that can be
+ * written in this context.
+ *
+ * @retval 0 If the operation was successful.
+ *           Otherwise, a (negative) error code is returned.
+ */
+#ifdef CONFIG_NRF_PROFILER_NORDIC_FLIGHT_RECORDER
+int nrf_profiler_flight_recorder_snapshot(void);
+#else
+static inline int nrf_profiler_flight_recorder_snapshot(void) {return 0; }
+#endif
+
+/** @brief Get the size of the stored snapshot.
+ *
+ * @return Snapshot size in bytes, including the snapshot header, or
+ *         (negative) error code. -ENOENT is returned if the partition
+ *         does not contain a valid snapshot.
+ */
+#ifdef CONFIG_NRF_PROFILER_NORDIC_FLIGHT_RECORDER
+ssize_t nrf_profiler_flight_recorder_snapshot_size_get(void);
+#else
+static inline ssize_t nrf_profiler_flight_recorder_snapshot_size_get(void)
+{
+	return -ENOENT;
+}
+#endif
+
+/** @brief Read part of the stored snapshot.
+ *
+ * The function reads the raw snapshot image, which can be uploaded for
+ * post-mortem analysis, for example over nRF Cloud.
+ *
+ * @param off Offset within the snapshot.
+ * @param data Buffer for the read data.
+ * @param len Number of bytes to read.
+ *
+ * @retval 0 If the operation was successful.
+ *           Otherwise, a (negative) error code is returned.
+ */
+#ifdef CONFIG_NRF_PROFILER_NORDIC_FLIGHT_RECORDER
+int nrf_profiler_flight_recorder_snapshot_read(size_t off, void *data, size_t len);
+#else
+static inline int nrf_profiler_flight_recorder_snapshot_read(size_t off, void *data,
+							      size_t len)
+{
+	return -ENOENT;
+}
+#endif
+
+/** @brief Erase the stored snapshot.
+ *
+ * Call this function after the snapshot is uploaded to avoid processing
+ * it again after the next boot.
+ *
+ * @retval 0 If the operation was successful.
+ *           Otherwise, a (negative) error code is returned.
+ */
+#ifdef CONFIG_NRF_PROFILER_NORDIC_FLIGHT_RECORDER
+int nrf_profiler_flight_recorder_snapshot_erase(void);
+#else
+static inline int nrf_profiler_flight_recorder_snapshot_erase(void) {return 0; }
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* _NRF_PROFILER_FLIGHT_RECORDER_H_ */
@@ -18,6 +18,9 @@
 #include <zephyr/sys/util.h>
 #include <nrf_rpc_cbor.h>
 
+#include <zcbor_decode.h>
+#include <zcbor_encode.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -69,48 +72,69 @@ static inline void *nrf_rpc_scratchpad_add(struct nrf_rpc_scratchpad *scratchpad
  *
  * @param[in,out] ctx Structure used to encode CBOR stream.
  */
-void nrf_rpc_encode_null(struct nrf_rpc_cbor_ctx *ctx);
+static inline void nrf_rpc_encode_null(struct nrf_rpc_cbor_ctx *ctx)
+{
+	zcbor_nil_put(ctx->zs, NULL);
+}
 
 /** @brief Encode an undefined value.
  *
  * @param[in,out] ctx Structure used to encode CBOR stream.
  */
-void nrf_rpc_encode_undefined(struct nrf_rpc_cbor_ctx *ctx);
+static inline void nrf_rpc_encode_undefined(struct nrf_rpc_cbor_ctx *ctx)
+{
+	zcbor_undefined_put(ctx->zs, NULL);
+}
 
 /** @brief Encode a boolean value.
  *
  * @param[in,out] ctx Structure used to encode CBOR stream.
  * @param[in]     value Encoded value.
  */
-void nrf_rpc_encode_bool(struct nrf_rpc_cbor_ctx *ctx, bool value);
+static inline void nrf_rpc_encode_bool(struct nrf_rpc_cbor_ctx *ctx, bool value)
+{
+	zcbor_bool_put(ctx->zs, value);
+}
 
 /** @brief Encode an unsigned integer value.
  *
  * @param[in,out] ctx Structure used to encode CBOR stream.
  * @param[in]     value Encoded value.
  */
-void nrf_rpc_encode_uint(struct nrf_rpc_cbor_ctx *ctx, uint32_t value);
+static inline void nrf_rpc_encode_uint(struct nrf_rpc_cbor_ctx *ctx, uint32_t value)
+{
+	zcbor_uint32_put(ctx->zs, value);
+}
 
 /** @brief Encode an integer value.
  *
  * @param[in,out] ctx Structure used to encode CBOR stream.
  * @param[in]     value Encoded value.
  */
-void nrf_rpc_encode_int(struct nrf_rpc_cbor_ctx *ctx, int32_t value);
+static inline void nrf_rpc_encode_int(struct nrf_rpc_cbor_ctx *ctx, int32_t value)
+{
+	zcbor_int32_put(ctx->zs, value);
+}
 
 /** @brief Encode an 64bits unsigned integer value.
  *
  * @param[in,out] ctx Structure used to encode CBOR stream.
  * @param[in]     value Encoded value.
  */
-void nrf_rpc_encode_uint64(struct nrf_rpc_cbor_ctx *ctx, uint64_t value);
+static inline void nrf_rpc_encode_uint64(struct nrf_rpc_cbor_ctx *ctx, uint64_t value)
+{
+	zcbor_uint64_put(ctx->zs, value);
+}
 
 /** @brief Encode an 64bits integer value.
  *
  * @param[in,out] ctx Structure used to encode CBOR stream.
  * @param[in]     value Encoded value.
  */
-void nrf_rpc_encode_int64(struct nrf_rpc_cbor_ctx *ctx, int64_t value);
+static inline void nrf_rpc_encode_int64(struct nrf_rpc_cbor_ctx *ctx, int64_t value)
+{
+	zcbor_int64_put(ctx->zs, value);
+}
 
 /** @brief Encode a string value.
  *
@@ -159,7 +183,10 @@ void nrf_rpc_encoder_invalid(struct nrf_rpc_cbor_ctx *ctx);
  *
  * @param[in] ctx CBOR decoding context.
  */
-void nrf_rpc_decode_skip(struct nrf_rpc_cbor_ctx *ctx);
+static inline void nrf_rpc_decode_skip(struct nrf_rpc_cbor_ctx *ctx)
+{
+	zcbor_any_skip(ctx->zs, NULL);
+}
 
 /** @brief Check if value is a null. This function will not consume the value.
  *
@@ -185,7 +212,16 @@ bool nrf_rpc_decode_is_undefined(struct nrf_rpc_cbor_ctx *ctx);
  *
  * @retval Decoded boolean value.
  */
-bool nrf_rpc_decode_bool(struct nrf_rpc_cbor_ctx *ctx);
+static inline bool nrf_rpc_decode_bool(struct nrf_rpc_cbor_ctx *ctx)
+{
+	bool result;
+
+	if (zcbor_bool_decode(ctx->zs, &result)) {
+		return result;
+	}
+
+	return false;
+}
 
 /** @brief Decode an unsigned integer value.
  *
@@ -193,7 +229,16 @@ bool nrf_rpc_decode_bool(struct nrf_rpc_cbor_ctx *ctx);
  *
  * @retval Decoded unsigned integer value.
  */
-uint32_t nrf_rpc_decode_uint(struct nrf_rpc_cbor_ctx *ctx);
+static inline uint32_t nrf_rpc_decode_uint(struct nrf_rpc_cbor_ctx *ctx)
+{
+	uint32_t result;
+
+	if (zcbor_uint32_decode(ctx->zs, &result)) {
+		return result;
+	}
+
+	return 0;
+}
 
 /** @brief Decode a integer value.
  *
@@ -201,7 +246,16 @@ uint32_t nrf_rpc_decode_uint(struct nrf_rpc_cbor_ctx *ctx);
  *
  * @retval Decoded integer value.
  */
-int32_t nrf_rpc_decode_int(struct nrf_rpc_cbor_ctx *ctx);
+static inline int32_t nrf_rpc_decode_int(struct nrf_rpc_cbor_ctx *ctx)
+{
+	int32_t result;
+
+	if (zcbor_int32_decode(ctx->zs, &result)) {
+		return result;
+	}
+
+	return 0;
+}
 
 /** @brief Decode a 64bits unsigned integer value.
  *
@@ -209,7 +263,16 @@ int32_t nrf_rpc_decode_int(struct nrf_rpc_cbor_ctx *ctx);
  *
  * @retval Decoded value.
  */
-uint64_t nrf_rpc_decode_uint64(struct nrf_rpc_cbor_ctx *ctx);
+static inline uint64_t nrf_rpc_decode_uint64(struct nrf_rpc_cbor_ctx *ctx)
+{
+	uint64_t result;
+
+	if (zcbor_uint64_decode(ctx->zs, &result)) {
+		return result;
+	}
+
+	return 0;
+}
 
 /** @brief Decode a 64bits integer value.
  *
@@ -217,7 +280,16 @@ uint64_t nrf_rpc_decode_uint64(struct nrf_rpc_cbor_ctx *ctx);
  *
  * @retval Decoded value.
  */
-int64_t nrf_rpc_decode_int64(struct nrf_rpc_cbor_ctx *ctx);
+static inline int64_t nrf_rpc_decode_int64(struct nrf_rpc_cbor_ctx *ctx)
+{
+	int64_t result;
+
+	if (zcbor_int64_decode(ctx->zs, &result)) {
+		return result;
+	}
+
+	return 0;
+}
 
 /** @brief Decode a string value.
  *
@@ -316,7 +388,10 @@ void nrf_rpc_decoder_invalid(struct nrf_rpc_cbor_ctx *ctx, int err);
  * @retval True if decoder is in valid state which means that no error occurred
  *         so far. Otherwise, false will be returned.
  */
-bool nrf_rpc_decode_valid(const struct nrf_rpc_cbor_ctx *ctx);
+static inline bool nrf_rpc_decode_valid(const struct nrf_rpc_cbor_ctx *ctx)
+{
+	return zcbor_check_error(ctx->zs);
+}
 
 /** @brief Signalize that decoding is done. Use this function when you finish decoding of the
  *         received serialized packet.
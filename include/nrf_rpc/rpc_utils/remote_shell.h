@@ -30,6 +30,38 @@ extern "C" {
  */
 char *nrf_rpc_invoke_remote_shell_cmd(size_t argc, char *argv[]);
 
+/** @brief Execute a shell command on the remote server without fetching its output.
+ *
+ *  Unlike @ref nrf_rpc_invoke_remote_shell_cmd, the command output stays in the
+ *  remote shell backend buffer and only its length is returned, so it can be
+ *  retrieved in chunks with @ref nrf_rpc_remote_shell_output_read. Use this for
+ *  commands whose output does not fit in a single RPC packet, for example when
+ *  dumping profiler or trace buffers. The output is retained on the server
+ *  until the next command is executed. The maximum retained output size is
+ *  configured with CONFIG_SHELL_BACKEND_DUMMY_BUF_SIZE on the server.
+ *
+ *  @param[in] argc Number of arguments.
+ *  @param[in] argv Array of arguments.
+ *  @param[out] output_len Length of the command output. Can be NULL.
+ *
+ *  @retval Shell command return code on success.
+ *  @retval -ENOMEM if the command line could not be allocated.
+ *  @retval -EBADMSG if the response could not be decoded.
+ */
+int nrf_rpc_remote_shell_cmd_exec(size_t argc, char *argv[], size_t *output_len);
+
+/** @brief Read a chunk of the output of the last executed remote shell command.
+ *
+ *  @param[in] offset Offset within the command output to read from.
+ *  @param[out] buffer Buffer to copy the output chunk into.
+ *  @param[in] buffer_size Size of the buffer, and the maximum chunk size.
+ *
+ *  @retval Number of bytes copied on success. 0 indicates that the whole
+ *	    output has been read.
+ *  @retval -EBADMSG if the response could not be decoded.
+ */
+int nrf_rpc_remote_shell_output_read(size_t offset, void *buffer, size_t buffer_size);
+
 /**
  * @}
  * @}
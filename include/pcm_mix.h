@@ -52,6 +52,27 @@ enum pcm_mix_mode {
 int pcm_mix(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
 	    enum pcm_mix_mode mix_mode);
 
+/**
+ * @brief Mixes two buffers of signed 32-bit PCM data.
+ *
+ * @note Same semantics as pcm_mix, but for signed 32-bit samples.
+ * Saturating addition is used instead of the 16-bit hard limiter.
+ *
+ * @param pcm_a         [in/out] Pointer to the PCM data buffer A.
+ * @param size_a        [in]     Size of the PCM data buffer A (in bytes).
+ * @param pcm_b         [in]     Pointer to the PCM data buffer B.
+ * @param size_b        [in]     Size of the PCM data buffer B (in bytes).
+ * @param mix_mode      [in]     Mixing mode according to pcm_mix_mode.
+ *
+ * @retval 0            Success. Result stored in pcm_a.
+ * @retval -EINVAL      pcm_a is NULL or size_a = 0.
+ * @retval -EPERM       Either size_b < size_a (for stereo to stereo, mono to mono)
+ *			or size_a/2 < size_b (for mono to stereo mix).
+ * @retval -ESRCH       Invalid mixing mode.
+ */
+int pcm_mix_32(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
+	       enum pcm_mix_mode mix_mode);
+
 /**
  * @}
  */
@@ -73,6 +73,17 @@ enum qos_evt_type {
 	 *  Payload is of type @ref qos_data.
 	 */
 	QOS_EVT_MESSAGE_REMOVED_FROM_LIST,
+
+	/** A message has passed its expiry time and has been removed from the internal list
+	 *  without being acknowledged.
+	 *
+	 *  If the heap_allocated flag is set in the @ref qos_data message structure
+	 *  the corresponding buffer (message.data.buf) must be freed by the caller.
+	 *  Payload is of type @ref qos_data.
+	 *
+	 *  Callbacks of this event type are notified in system workqueue context.
+	 */
+	QOS_EVT_MESSAGE_EXPIRED,
 };
 
 /** @brief Structure used to keep track of unACKed messages. */
@@ -113,6 +124,13 @@ struct qos_data {
 	 *  has been set.
 	 */
 	bool heap_allocated;
+
+	/** Uptime, in milliseconds, after which the message is no longer worth sending.
+	 *  Messages that pass their expiry time are removed from the internal list and
+	 *  notified with the QOS_EVT_MESSAGE_EXPIRED event instead of being retried.
+	 *  Set to 0 to keep retrying the message until the maximum notified count is reached.
+	 */
+	int64_t expiry_uptime_ms;
 };
 
 /** @brief Library callback event structure. */
@@ -40,6 +40,8 @@ void power_up_ram(uintptr_t start_address, uintptr_t end_address);
  * @brief Request powering down unused RAM sections.
  *
  * Power down RAM sections which are not used by the application image.
+ * Memory regions defined in the device tree, such as retention areas and
+ * shared memory, are kept powered even when they lie outside the image.
  *
  * @note
  * Some libc implementations use the memory area following the application
@@ -77,6 +77,39 @@ enum sample_rate_converter_filter {
 #define SAMPLE_RATE_CONVERTER_RINGBUF_SIZE   0
 #endif
 
+#if defined(CONFIG_SAMPLE_RATE_CONVERTER_RATIONAL) || defined(__DOXYGEN__)
+/** Number of taps in each polyphase branch used for rational conversions. */
+#define SAMPLE_RATE_CONVERTER_POLYPHASE_TAPS 4
+
+/** State for rational conversion ratios.
+ *
+ * The interpolation kernels are decomposed per phase when the conversion is configured, and the
+ * filter history and phase position persist between process calls.
+ */
+struct sample_rate_converter_polyphase {
+	/* Interpolation (L) and decimation (M) factors of the reduced ratio. */
+	uint16_t interp_factor;
+	uint16_t decim_factor;
+
+	/* Stream position of the next output sample. next_idx is the integer part relative to the
+	 * start of the next block, next_frac the fractional part in units of 1/interp_factor.
+	 */
+	uint32_t next_idx;
+	uint32_t next_frac;
+
+	/* Per-phase interpolation kernels and filter history. */
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+	q15_t coeffs[CONFIG_SAMPLE_RATE_CONVERTER_MAX_PHASES *
+		     SAMPLE_RATE_CONVERTER_POLYPHASE_TAPS];
+	q15_t history[SAMPLE_RATE_CONVERTER_POLYPHASE_TAPS - 1];
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+	q31_t coeffs[CONFIG_SAMPLE_RATE_CONVERTER_MAX_PHASES *
+		     SAMPLE_RATE_CONVERTER_POLYPHASE_TAPS];
+	q31_t history[SAMPLE_RATE_CONVERTER_POLYPHASE_TAPS - 1];
+#endif
+};
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_RATIONAL */
+
 /** Buffer used for storing input bytes to the sample rate converter */
 struct buf_ctx {
 	uint8_t buf[SAMPLE_RATE_CONVERTER_INPUT_BUF_SIZE];
@@ -123,6 +156,14 @@ struct sample_rate_converter_ctx {
 #elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
 	q31_t state_buf_31[SAMPLE_RATE_CONVERTER_STATE_BUFFER_SIZE];
 #endif
+
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_RATIONAL
+	/* True when the current conversion uses the polyphase engine. */
+	bool rational;
+
+	/* State for the polyphase engine. */
+	struct sample_rate_converter_polyphase polyphase;
+#endif
 };
 
 /**
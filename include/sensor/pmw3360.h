@@ -52,6 +52,14 @@ enum pmw3360_attribute {
 	PMW3360_ATTR_REST3_SAMPLE_TIME,
 };
 
+/** @brief Sensor specific channels of PMW3360. */
+enum pmw3360_channel {
+	/** Surface quality measurement (SQUAL). Available only if the
+	 *  CONFIG_PMW3360_SQUAL Kconfig option is enabled.
+	 */
+	PMW3360_CHAN_SQUAL = SENSOR_CHAN_PRIV_START,
+};
+
 /**
  * @}
  */
@@ -7,6 +7,7 @@
 #ifndef SFLOAT_H_
 #define SFLOAT_H_
 
+#include <stddef.h>
 #include <stdint.h>
 #include <zephyr/types.h>
 
@@ -60,6 +61,37 @@ struct sfloat {
  */
 struct sfloat sfloat_from_float(float float_num);
 
+/**
+ * @brief Convert the SFLOAT type into the standard float type.
+ *
+ * @param[in] sfloat_num Number encoded as SFLOAT type
+ *                       (from the IEEE 11073-20601-2008 specification).
+ *
+ * @return Standard float type (binary32 notation from the IEEE 754-2008 specification).
+ *         The special values NaN, NRES and Reserved are converted to NaN, the infinities
+ *         to the float infinities of matching sign.
+ */
+float sfloat_to_float(struct sfloat sfloat_num);
+
+/**
+ * @brief Convert an array of standard float type into SFLOAT type.
+ *
+ * @param[out] sfloat_nums Array of numbers encoded as SFLOAT type. Must hold @p cnt entries.
+ * @param[in]  float_nums  Array of numbers encoded as a standard float type.
+ * @param[in]  cnt         Number of values to convert.
+ */
+void sfloat_from_float_array(struct sfloat *sfloat_nums, const float *float_nums, size_t cnt);
+
+/**
+ * @brief Convert an array of SFLOAT type into the standard float type.
+ *
+ * @param[out] float_nums  Array of numbers encoded as a standard float type.
+ *                         Must hold @p cnt entries.
+ * @param[in]  sfloat_nums Array of numbers encoded as SFLOAT type.
+ * @param[in]  cnt         Number of values to convert.
+ */
+void sfloat_to_float_array(float *float_nums, const struct sfloat *sfloat_nums, size_t cnt);
+
 #ifdef __cplusplus
 }
 #endif
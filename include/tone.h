@@ -65,6 +65,82 @@ int tone_gen(int16_t *tone, size_t *tone_size, uint16_t tone_freq_hz, uint32_t s
 int tone_gen_size(void *tone, size_t *tone_size, uint16_t tone_freq_hz, uint32_t sample_freq_hz,
 		  uint8_t sample_bits, uint8_t carrier_bits, float amplitude);
 
+/**
+ * @brief Oscillator state for continuous tone generation.
+ *
+ * The fields are internal to the library and must be initialized with tone_osc_init().
+ */
+struct tone_oscillator {
+	/* Current phase, where the full uint32_t range represents one period. */
+	uint32_t phase;
+
+	/* Phase increment per sample. */
+	uint32_t phase_inc;
+
+	/* Amplitude in Q15. */
+	int16_t amplitude_q15;
+};
+
+/**
+ * @brief               Initializes an oscillator for continuous tone generation.
+ *
+ * @note                The oscillator keeps its phase between calls to tone_bank_gen(), so a
+ *                      tone can be generated continuously over any number of buffers without
+ *                      the tone frequency having to divide the sampling frequency.
+ *
+ * @param osc           Oscillator to initialize.
+ * @param tone_freq_hz  The desired tone frequency in the range [100..10000] Hz.
+ * @param smpl_freq_hz  Sampling frequency.
+ * @param amplitude     Amplitude in the range [0..1].
+ *
+ * @retval 0            Oscillator initialized.
+ * @retval -ENXIO       If osc is NULL.
+ * @retval -EINVAL      If smpl_freq_hz == 0 or tone_freq_hz is out of range.
+ * @retval -EPERM       If amplitude is out of range.
+ */
+int tone_osc_init(struct tone_oscillator *osc, uint16_t tone_freq_hz, uint32_t smpl_freq_hz,
+		  float amplitude);
+
+/**
+ * @brief               Generates and mixes a bank of tones into one 16-bit PCM buffer.
+ *
+ * @note                The sine values are produced with a table lookup with interpolation and
+ *                      fixed-point arithmetic, so the routine is suitable for generating
+ *                      multiple simultaneous tones live in the audio datapath. The sum of the
+ *                      mixed tones is saturated to the 16-bit sample range, so the combined
+ *                      amplitude of the oscillators should not exceed 1 to avoid clipping.
+ *
+ * @param pcm           User provided buffer to fill. Must hold smpl_cnt samples.
+ * @param smpl_cnt      Number of samples to generate.
+ * @param osc           Array of oscillators to generate and mix. The phase of each oscillator
+ *                      is advanced by the call.
+ * @param osc_cnt       Number of oscillators.
+ *
+ * @retval 0            Buffer generated.
+ * @retval -ENXIO       If pcm or osc is NULL.
+ * @retval -EINVAL      If smpl_cnt == 0 or osc_cnt == 0.
+ */
+int tone_bank_gen(int16_t *pcm, size_t smpl_cnt, struct tone_oscillator *osc, size_t osc_cnt);
+
+/**
+ * @brief               Applies a linear amplitude envelope to a 16-bit PCM buffer.
+ *
+ * @note                The gain is ramped linearly from gain_start at the first sample towards
+ *                      gain_end over the buffer. Use it to fade stimuli in and out without
+ *                      audible clicks.
+ *
+ * @param pcm           Buffer with samples to scale.
+ * @param smpl_cnt      Number of samples in the buffer.
+ * @param gain_start    Gain at the first sample, in the range [0..1].
+ * @param gain_end      Gain at the end of the buffer, in the range [0..1].
+ *
+ * @retval 0            Envelope applied.
+ * @retval -ENXIO       If pcm is NULL.
+ * @retval -EINVAL      If smpl_cnt == 0.
+ * @retval -EPERM       If gain_start or gain_end is out of range.
+ */
+int tone_envelope_apply(int16_t *pcm, size_t smpl_cnt, float gain_start, float gain_end);
+
 /**
  * @}
  */
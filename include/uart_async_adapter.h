@@ -75,6 +75,8 @@ struct uart_async_adapter_data {
 		size_t next_buf_len;
 		/** Timeout set by the user */
 		int32_t timeout;
+		/** Uptime in ticks when data was last received */
+		volatile int64_t last_rx_ticks;
 		/** Timer used for timeout */
 		struct k_timer timeout_timer;
 		/** RX state */
@@ -23,7 +23,9 @@
 #include <ironside/se/boot_report.h>
 #endif /* CONFIG_APP_JWT_PROVIDE_UUID */
 
+#if !defined(CONFIG_APP_JWT_NO_HEAP)
 #include <cJSON.h>
+#endif
 
 #include <app_jwt.h>
 
@@ -283,6 +285,259 @@ static int crypto_finish(const int key_id)
 	return 0;
 }
 
+#if defined(CONFIG_APP_JWT_NO_HEAP)
+/* Maximum size of the JSON form of the JWT header */
+#define JWT_HEADER_JSON_SZ (128)
+
+/* Maximum size of the JSON form of the JWT payload */
+#define JWT_PAYLOAD_JSON_SZ ((4 * APP_JWT_CLAIM_MAX_SIZE) + 64)
+
+static int json_append(char *const json, const size_t json_sz, size_t *const len,
+		       const char *fmt, ...)
+{
+	va_list ap;
+	int ret;
+
+	va_start(ap, fmt);
+	ret = vsnprintk((json + *len), (json_sz - *len), fmt, ap);
+	va_end(ap);
+
+	if ((ret < 0) || (ret >= (json_sz - *len))) {
+		return -EMSGSIZE;
+	}
+
+	*len += ret;
+
+	return 0;
+}
+
+static int b64_url_append(char *const buf, const size_t buf_sz, size_t *const pos,
+			  const uint8_t *const data, const size_t data_len)
+{
+	int err;
+	size_t olen;
+
+	err = base64_encode((buf + *pos), (buf_sz - *pos), &olen, data, data_len);
+	if (err) {
+		LOG_ERR("base64_encode() failed! (Error: %d)", err);
+		return -E2BIG;
+	}
+
+	/* Convert to base64 URL in place */
+	base64_url_format(buf + *pos);
+	*pos += strlen(buf + *pos);
+
+	return 0;
+}
+
+static int char_append(char *const buf, const size_t buf_sz, size_t *const pos, const char c)
+{
+	if ((*pos + 1) >= buf_sz) {
+		return -E2BIG;
+	}
+
+	buf[*pos] = c;
+	(*pos)++;
+	buf[*pos] = '\0';
+
+	return 0;
+}
+
+static int jwt_header_write(struct app_jwt_data *const jwt, const int key_id, char *const buf,
+			    const size_t buf_sz, size_t *const pos)
+{
+	int err;
+	size_t len = 0;
+	char json[JWT_HEADER_JSON_SZ];
+
+	/* Algorithme: format: always "ES256" */
+	if (jwt->alg != JWT_ALG_TYPE_ES256) {
+		return -ENOTSUP;
+	}
+
+	err = json_append(json, sizeof(json), &len, "{\"typ\":\"JWT\",\"alg\":\"ES256\"");
+	if (err) {
+		return err;
+	}
+
+	if (jwt->add_keyid_to_header) {
+		size_t olen;
+		uint8_t pub_key_hash[ECDSA_SHA_256_HASH_SZ];
+		char sha256_str[ECDSA_SHA_256_SIG_SZ + 1] = {0};
+		int32_t printed_bytes = 0;
+
+		/* Kid: format: sha256 string */
+		/* Get kid: sha256 over public key */
+		err = export_public_key_hash(key_id, pub_key_hash, ECDSA_SHA_256_HASH_SZ, &olen);
+		if (err) {
+			LOG_ERR("export_public_key_hash() failed! (Error: %d)", err);
+			return -EACCES;
+		}
+
+		for (uint32_t i = 0; i < 8; i++) {
+			printed_bytes += snprintf(
+				(sha256_str + printed_bytes), 9, "%08x",
+				sys_cpu_to_be32((uint32_t)*((uint32_t *)pub_key_hash + i)));
+		}
+		sha256_str[ECDSA_SHA_256_SIG_SZ] = '\0';
+
+		err = json_append(json, sizeof(json), &len, ",\"kid\":\"%s\"", sha256_str);
+		if (err) {
+			return err;
+		}
+	}
+
+	err = json_append(json, sizeof(json), &len, "}");
+	if (err) {
+		return err;
+	}
+
+	return b64_url_append(buf, buf_sz, pos, (uint8_t *)json, len);
+}
+
+static int jwt_payload_write(struct app_jwt_data *const jwt, char *const buf, const size_t buf_sz,
+			     size_t *const pos)
+{
+	int err;
+	size_t len = 0;
+	const char *sep = "";
+	uint64_t unix_time_ms = 0;
+	uint64_t issue_time = CONFIG_APP_JWT_DEFAULT_TIMESTAMP;
+	char json[JWT_PAYLOAD_JSON_SZ];
+
+	err = date_time_now(&unix_time_ms);
+	if (err) {
+		/* date_time_now error, use DEFAULT_TIMESTAMP value */
+		LOG_WRN("date_time_now() error, use %d", CONFIG_APP_JWT_DEFAULT_TIMESTAMP);
+	} else {
+		issue_time = (unix_time_ms / 1000);
+		if (issue_time == 0) {
+			LOG_WRN("invalid time value, use %d", CONFIG_APP_JWT_DEFAULT_TIMESTAMP);
+		}
+	}
+
+	err = json_append(json, sizeof(json), &len, "{");
+	if (err) {
+		return err;
+	}
+
+	if (jwt->add_timestamp && (issue_time != 0)) {
+		/* Issued at : timestamp is seconds */
+		err = json_append(json, sizeof(json), &len, "\"iat\":%llu", issue_time);
+		if (err) {
+			return err;
+		}
+		sep = ",";
+	}
+
+	if (jwt->json_token_id != NULL) {
+		err = json_append(json, sizeof(json), &len, "%s\"jti\":\"%.*s\"", sep,
+				  (APP_JWT_CLAIM_MAX_SIZE - 1), jwt->json_token_id);
+		if (err) {
+			return err;
+		}
+		sep = ",";
+	}
+
+	if (jwt->issuer != NULL) {
+		err = json_append(json, sizeof(json), &len, "%s\"iss\":\"%.*s\"", sep,
+				  (APP_JWT_CLAIM_MAX_SIZE - 1), jwt->issuer);
+		if (err) {
+			return err;
+		}
+		sep = ",";
+	}
+
+	if (jwt->subject != NULL) {
+		err = json_append(json, sizeof(json), &len, "%s\"sub\":\"%.*s\"", sep,
+				  (APP_JWT_CLAIM_MAX_SIZE - 1), jwt->subject);
+		if (err) {
+			return err;
+		}
+		sep = ",";
+	}
+
+	if (jwt->audience != NULL) {
+		err = json_append(json, sizeof(json), &len, "%s\"aud\":\"%.*s\"", sep,
+				  (APP_JWT_CLAIM_MAX_SIZE - 1), jwt->audience);
+		if (err) {
+			return err;
+		}
+		sep = ",";
+	}
+
+	/* Expiration: format: time in seconds as integer + expiration */
+	if (jwt->validity_s > 0) {
+		/* Add expiration (exp) claim */
+		err = json_append(json, sizeof(json), &len, "%s\"exp\":%llu", sep,
+				  (uint64_t)(jwt->validity_s + issue_time));
+		if (err) {
+			return err;
+		}
+	}
+
+	err = json_append(json, sizeof(json), &len, "}");
+	if (err) {
+		return err;
+	}
+
+	return b64_url_append(buf, buf_sz, pos, (uint8_t *)json, len);
+}
+
+static int jwt_generate_streamed(struct app_jwt_data *const jwt, const int key_id)
+{
+	int err;
+	size_t pos = 0;
+	size_t sig_len = 0;
+	uint8_t sig_raw[ECDSA_SHA_256_SIG_SZ];
+	char *const buf = jwt->jwt_buf;
+
+	/* Write the base64 URL header and payload directly into the output
+	 * buffer: <base64_header>.<base64_payload>
+	 */
+	err = jwt_header_write(jwt, key_id, buf, jwt->jwt_sz, &pos);
+	if (err) {
+		LOG_ERR("jwt_header_write() failed! (Error: %d)", err);
+		return err;
+	}
+
+	err = char_append(buf, jwt->jwt_sz, &pos, '.');
+	if (err) {
+		return err;
+	}
+
+	err = jwt_payload_write(jwt, buf, jwt->jwt_sz, &pos);
+	if (err) {
+		LOG_ERR("jwt_payload_write() failed! (Error: %d)", err);
+		return err;
+	}
+
+	/* Sign the part of the buffer written so far */
+	err = sign_message(key_id, buf, pos, sig_raw, sizeof(sig_raw), &sig_len);
+	if (err) {
+		LOG_ERR("sign_message() failed! (Error: %d)", err);
+		return -EACCES;
+	}
+
+#if defined(CONFIG_APP_JWT_VERIFY_SIGNATURE)
+	err = verify_message_signature(key_id, buf, pos, sig_raw, sig_len);
+	if (err) {
+		LOG_ERR("verify_message_signature() failed! (Error: %d)", err);
+		return -EACCES;
+	}
+#endif /* CONFIG_APP_JWT_VERIFY_SIGNATURE */
+
+	/* Append the signature, creating the complete JWT:
+	 * <base64_header>.<base64_payload>.<base64_signature>
+	 */
+	err = char_append(buf, jwt->jwt_sz, &pos, '.');
+	if (err) {
+		return err;
+	}
+
+	return b64_url_append(buf, jwt->jwt_sz, &pos, sig_raw, sig_len);
+}
+#else /* CONFIG_APP_JWT_NO_HEAP */
 static char *jwt_header_create(struct app_jwt_data *const jwt)
 {
 	if (jwt == NULL) {
@@ -645,6 +900,7 @@ static int jwt_signature_append(const char *const unsigned_jwt, const char *cons
 
 	return err;
 }
+#endif /* CONFIG_APP_JWT_NO_HEAP */
 
 int app_jwt_generate(struct app_jwt_data *const jwt)
 {
@@ -658,8 +914,10 @@ int app_jwt_generate(struct app_jwt_data *const jwt)
 
 	int err = 0;
 	int key_id = 0;
+#if !defined(CONFIG_APP_JWT_NO_HEAP)
 	char *unsigned_jwt;
 	uint8_t jwt_sig[B64_SIG_SZ];
+#endif
 
 	if (jwt->sec_tag != 0) {
 		/**
@@ -679,6 +937,13 @@ int app_jwt_generate(struct app_jwt_data *const jwt)
 		return err;
 	}
 
+#if defined(CONFIG_APP_JWT_NO_HEAP)
+	/* Stream the JWT directly into the caller provided buffer */
+	err = jwt_generate_streamed(jwt, key_id);
+	if (err) {
+		LOG_ERR("jwt_generate_streamed() failed! (Error: %d)", err);
+	}
+#else
 	/* Create the JWT to be signed */
 	unsigned_jwt = unsigned_jwt_create(jwt);
 	if (!unsigned_jwt) {
@@ -705,6 +970,7 @@ clean_exit:
 	unsigned_jwt = NULL;
 
 finish_crypto_exit:
+#endif /* CONFIG_APP_JWT_NO_HEAP */
 	/* Crypto services not required anymore */
 	if (crypto_finish(key_id)) {
 		LOG_DBG("crypto_finish() failed!");
@@ -9,6 +9,7 @@
 #include <stdbool.h>
 #include <stddef.h>
 #include <stdio.h>
+#include <string.h>
 #include <zephyr/toolchain.h>
 #include <zephyr/kernel.h>
 #include <zephyr/device.h>
@@ -19,12 +20,48 @@ LOG_MODULE_REGISTER(at_cmd_custom, CONFIG_AT_CMD_CUSTOM_LOG_LEVEL);
 
 #define CMD_COUNT (_nrf_modem_at_cmd_custom_list_end - _nrf_modem_at_cmd_custom_list_start)
 
+/* Sort the filters by descending length, then alphabetically.
+ * The Modem library matches the filters in list order, so this guarantees
+ * longest-prefix-match semantics independently of link order and puts
+ * duplicates next to each other so they can be reported.
+ */
+static void filter_list_sort(struct nrf_modem_at_cmd_custom *list, size_t count)
+{
+	struct nrf_modem_at_cmd_custom tmp;
+	size_t j;
+
+	for (size_t i = 1; i < count; i++) {
+		tmp = list[i];
+		for (j = i; j > 0; j--) {
+			if (list[j - 1].cmd_strlen > tmp.cmd_strlen) {
+				break;
+			}
+			if (list[j - 1].cmd_strlen == tmp.cmd_strlen &&
+			    strcmp(list[j - 1].cmd, tmp.cmd) <= 0) {
+				break;
+			}
+			list[j] = list[j - 1];
+		}
+		list[j] = tmp;
+	}
+
+	for (size_t i = 1; i < count; i++) {
+		if (list[i - 1].cmd_strlen == list[i].cmd_strlen &&
+		    strcmp(list[i - 1].cmd, list[i].cmd) == 0) {
+			LOG_WRN("Duplicate filter for %s, only one callback will trigger",
+				list[i].cmd);
+		}
+	}
+}
+
 static int at_cmd_custom_sys_init(void)
 {
 	int err;
 	extern struct nrf_modem_at_cmd_custom _nrf_modem_at_cmd_custom_list_start[];
 	extern struct nrf_modem_at_cmd_custom _nrf_modem_at_cmd_custom_list_end[];
 
+	filter_list_sort(_nrf_modem_at_cmd_custom_list_start, CMD_COUNT);
+
 	err = nrf_modem_at_cmd_custom_set(_nrf_modem_at_cmd_custom_list_start, CMD_COUNT);
 	LOG_INF("Custom AT commands enabled with %d entr%s.",
 		CMD_COUNT, CMD_COUNT > 1 ? "ies" : "y");
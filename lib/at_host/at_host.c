@@ -50,6 +50,18 @@ static char at_buf[AT_BUF_SIZE]; /* AT command and modem response buffer */
 static struct k_work_q at_host_work_q;
 static struct k_work cmd_send_work;
 
+#if defined(CONFIG_AT_HOST_CMD_PIPELINE)
+/* Queued command; the modem response reuses the same block. */
+struct at_cmd_buf {
+	void *fifo_reserved;
+	char buf[AT_BUF_SIZE];
+};
+
+K_MEM_SLAB_DEFINE(at_cmd_slab, sizeof(struct at_cmd_buf),
+		  CONFIG_AT_HOST_CMD_PIPELINE_DEPTH, sizeof(void *));
+static K_FIFO_DEFINE(at_cmd_fifo);
+#endif
+
 static inline void write_uart_string(const char *str)
 {
 	if (IS_LOG_BACKEND_UART(uart_dev)) {
@@ -90,6 +102,22 @@ static void cmd_send(struct k_work *work)
 
 	ARG_UNUSED(work);
 
+#if defined(CONFIG_AT_HOST_CMD_PIPELINE)
+	struct at_cmd_buf *cmd;
+
+	/* Send the queued commands back to back, writing the responses
+	 * to the UART in command order.
+	 */
+	while ((cmd = k_fifo_get(&at_cmd_fifo, K_NO_WAIT)) != NULL) {
+		err = nrf_modem_at_cmd(cmd->buf, sizeof(cmd->buf), "%s", cmd->buf);
+		if (err < 0) {
+			LOG_ERR("Error while processing AT command: %d", err);
+		}
+
+		write_uart_string(cmd->buf);
+		k_mem_slab_free(&at_cmd_slab, (void *)cmd);
+	}
+#else
 	/* Sending through string format rather than raw buffer in case
 	 * the buffer contains characters that need to be escaped
 	 */
@@ -102,6 +130,7 @@ static void cmd_send(struct k_work *work)
 
 	at_buf_busy = false;
 	uart_irq_rx_enable(uart_dev);
+#endif
 }
 
 static void uart_rx_handler(uint8_t character)
@@ -189,10 +218,26 @@ send:
 
 	/* Send the command, if there is one to send */
 	if (at_buf[0]) {
+#if defined(CONFIG_AT_HOST_CMD_PIPELINE)
+		struct at_cmd_buf *cmd;
+
+		/* Queue the command and keep receiving: the host does not
+		 * have to wait for the response before the next command.
+		 */
+		if (k_mem_slab_alloc(&at_cmd_slab, (void **)&cmd, K_NO_WAIT) != 0) {
+			LOG_ERR("Command pipeline full, dropping command");
+			return;
+		}
+
+		strcpy(cmd->buf, at_buf);
+		k_fifo_put(&at_cmd_fifo, cmd);
+		k_work_submit_to_queue(&at_host_work_q, &cmd_send_work);
+#else
 		/* Stop UART to protect at_buf */
 		uart_irq_rx_disable(uart_dev);
 		at_buf_busy = true;
 		k_work_submit_to_queue(&at_host_work_q, &cmd_send_work);
+#endif
 	}
 }
 
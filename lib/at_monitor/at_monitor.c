@@ -36,8 +36,146 @@ static bool is_direct(const struct at_monitor_entry *mon)
 	return mon->flags.direct;
 }
 
-static bool has_match(const struct at_monitor_entry *mon, const char *notif)
+#if defined(CONFIG_AT_MONITOR_TRIE)
+/* Trie over the monitor filters, built at initialization.
+ * A notification is matched against all filters in a single scan: from each
+ * position in the notification, the trie is walked for as long as the
+ * characters match, collecting the monitors whose entire filter was walked
+ * over. This preserves the substring semantics of the linear scan.
+ */
+
+/* Node 0 is reserved as the "no node" sentinel. */
+#define TRIE_NONE 0
+
+struct trie_node {
+	char ch;
+	uint8_t child; /* First child, TRIE_NONE if leaf. */
+	uint8_t sibling; /* Next node on the same level, TRIE_NONE if last. */
+	uint32_t terminal; /* Monitors whose entire filter ends at this node. */
+};
+
+BUILD_ASSERT(CONFIG_AT_MONITOR_TRIE_NODES <= UINT8_MAX + 1);
+
+static struct trie_node trie_nodes[CONFIG_AT_MONITOR_TRIE_NODES];
+static uint8_t trie_used = 1;
+static uint8_t trie_root; /* First child of the root. */
+static uint32_t trie_any_mask; /* Monitors with the ANY filter. */
+static bool trie_active;
+
+static int trie_insert(const char *filter, uint32_t bit)
+{
+	uint8_t *link = &trie_root;
+	uint8_t node = TRIE_NONE;
+
+	for (const char *c = filter; *c; c++) {
+		node = *link;
+		while (node != TRIE_NONE && trie_nodes[node].ch != *c) {
+			node = trie_nodes[node].sibling;
+		}
+		if (node == TRIE_NONE) {
+			if (trie_used >= CONFIG_AT_MONITOR_TRIE_NODES) {
+				return -ENOMEM;
+			}
+			node = trie_used++;
+			trie_nodes[node].ch = *c;
+			trie_nodes[node].sibling = *link;
+			*link = node;
+		}
+		link = &trie_nodes[node].child;
+	}
+
+	if (node == TRIE_NONE) {
+		/* Empty filter, matches everything. */
+		trie_any_mask |= bit;
+		return 0;
+	}
+
+	trie_nodes[node].terminal |= bit;
+
+	return 0;
+}
+
+static uint32_t trie_match(const char *notif)
+{
+	uint32_t mask = trie_any_mask;
+
+	for (const char *start = notif; *start; start++) {
+		uint8_t node = trie_root;
+		const char *c = start;
+
+		while (node != TRIE_NONE) {
+			while (node != TRIE_NONE && trie_nodes[node].ch != *c) {
+				node = trie_nodes[node].sibling;
+			}
+			if (node == TRIE_NONE) {
+				break;
+			}
+
+			mask |= trie_nodes[node].terminal;
+
+			c++;
+			if (*c == '\0') {
+				break;
+			}
+			node = trie_nodes[node].child;
+		}
+	}
+
+	return mask;
+}
+
+static void trie_build(void)
 {
+	int err;
+	size_t count;
+	uint32_t bit = 1;
+
+	STRUCT_SECTION_COUNT(at_monitor_entry, &count);
+	if (count > 32) {
+		LOG_WRN("Too many monitors for trie matching (%d), using linear scan", count);
+		return;
+	}
+
+	STRUCT_SECTION_FOREACH(at_monitor_entry, e) {
+		if (e->filter == ANY) {
+			trie_any_mask |= bit;
+		} else {
+			err = trie_insert(e->filter, bit);
+			if (err) {
+				LOG_WRN("Out of trie nodes, using linear scan");
+				return;
+			}
+		}
+		bit <<= 1;
+	}
+
+	trie_active = true;
+}
+#endif /* CONFIG_AT_MONITOR_TRIE */
+
+static uint32_t match_mask_get(const char *notif)
+{
+#if defined(CONFIG_AT_MONITOR_TRIE)
+	if (trie_active) {
+		return trie_match(notif);
+	}
+#endif
+	ARG_UNUSED(notif);
+
+	return 0;
+}
+
+static bool has_match(const struct at_monitor_entry *mon, size_t idx, uint32_t mask,
+		      const char *notif)
+{
+#if defined(CONFIG_AT_MONITOR_TRIE)
+	if (trie_active) {
+		return (mask & BIT(idx)) != 0;
+	}
+#endif
+	ARG_UNUSED(idx);
+	ARG_UNUSED(mask);
+
 	return (mon->filter == ANY || strstr(notif, mon->filter));
 }
 
@@ -50,12 +188,20 @@ void at_monitor_dispatch(const char *notif)
 	bool monitored;
 	struct at_notif_fifo *at_notif;
 	size_t sz_needed;
+	uint32_t mask;
+	size_t idx = 0;
 
 	__ASSERT_NO_MSG(notif != NULL);
 
 	monitored = false;
+	mask = match_mask_get(notif);
 	STRUCT_SECTION_FOREACH(at_monitor_entry, e) {
-		if (!is_paused(e) && has_match(e, notif)) {
+		/* The match mask bit index follows the section position of the
+		 * entry, so it must advance on every iteration.
+		 */
+		size_t bit_idx = idx++;
+
+		if (!is_paused(e) && has_match(e, bit_idx, mask, notif)) {
 			if (is_direct(e)) {
 				LOG_DBG("Dispatching to %p (ISR)", e->handler);
 				e->handler(notif);
@@ -92,9 +238,15 @@ static void at_monitor_task(struct k_work *work)
 
 	while ((at_notif = k_fifo_get(&at_monitor_fifo, K_NO_WAIT))) {
 		/* Match notification with all monitors */
+		uint32_t mask = match_mask_get(at_notif->data);
+		size_t idx = 0;
+
 		LOG_DBG("AT notif: %.*s", strlen(at_notif->data) - strlen("\r\n"), at_notif->data);
 		STRUCT_SECTION_FOREACH(at_monitor_entry, e) {
-			if (!is_paused(e) && !is_direct(e) && has_match(e, at_notif->data)) {
+			size_t bit_idx = idx++;
+
+			if (!is_paused(e) && !is_direct(e) &&
+			    has_match(e, bit_idx, mask, at_notif->data)) {
 				LOG_DBG("Dispatching to %p", e->handler);
 				e->handler(at_notif->data);
 			}
@@ -107,6 +259,10 @@ static int at_monitor_sys_init(void)
 {
 	int err;
 
+#if defined(CONFIG_AT_MONITOR_TRIE)
+	trie_build();
+#endif
+
 	err = nrf_modem_at_notif_handler_set(at_monitor_dispatch);
 	if (err) {
 		LOG_ERR("Failed to hook the dispatch function, err %d", err);
@@ -231,6 +231,64 @@ finalize:
 	return 0;
 }
 
+#if defined(CONFIG_AT_PARSER_FAST_SEEK)
+/* Advance the cursor past whole subparameters by counting top-level commas instead of
+ * tokenizing each subparameter on the way to the target index. Commas inside quoted
+ * strings and arrays do not delimit subparameters and are ignored. The skipped
+ * subparameters are not validated; the target subparameter is tokenized as usual.
+ */
+static void at_parser_fast_skip(struct at_parser *parser, size_t index)
+{
+	const char *cursor = parser->cursor;
+	bool quoted = false;
+	bool in_array = false;
+
+	/* The command prefix must be tokenized to be identified, and a pending empty
+	 * subparameter is consumed by the tokenizer without advancing the cursor.
+	 */
+	if (parser->count == 0 || parser->is_next_empty) {
+		return;
+	}
+
+	/* Stop at the start of the target subparameter. */
+	while (parser->count < index) {
+		char c = *cursor;
+
+		if (c == NULL_TERMINATOR) {
+			return;
+		}
+
+		if (quoted) {
+			quoted = (c != '"');
+		} else if (in_array) {
+			in_array = (c != ')');
+		} else if (c == '"') {
+			quoted = true;
+		} else if (c == '(') {
+			in_array = true;
+		} else if (c == CR || c == LF) {
+			return;
+		} else if (c == ',') {
+			/* One whole subparameter skipped. */
+			parser->count++;
+			parser->cursor = cursor + 1;
+
+			/* A comma at the end of the line means that the last subparameter
+			 * is empty, which the lexer cannot match.
+			 */
+			if (cursor[1] == NULL_TERMINATOR ||
+			    lookahead_cr_lf_or_more(&cursor[1]) ||
+			    lookahead_crlf_or_more(&cursor[1])) {
+				parser->is_next_empty = true;
+				return;
+			}
+		}
+
+		cursor++;
+	}
+}
+#endif /* CONFIG_AT_PARSER_FAST_SEEK */
+
 /* Seek the AT parser cursor to the given index. */
 static int at_parser_seek(struct at_parser *parser, size_t index, struct at_token *token)
 {
@@ -243,6 +301,9 @@ static int at_parser_seek(struct at_parser *parser, size_t index, struct at_toke
 	}
 
 	do {
+#if defined(CONFIG_AT_PARSER_FAST_SEEK)
+		at_parser_fast_skip(parser, index);
+#endif
 		err = at_parser_tok(parser, token);
 	} while (is_index_ahead(parser, index) && !err);
 
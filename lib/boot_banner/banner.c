@@ -7,6 +7,7 @@
 #include <zephyr/kernel.h>
 #include <zephyr/init.h>
 #include <zephyr/device.h>
+#include <boot_trace.h>
 #include <version.h>
 #include <zephyr_commit.h>
 #include <ncs_version.h>
@@ -27,6 +28,8 @@
 
 static int ncs_boot_banner(void)
 {
+	boot_trace_mark("boot_banner");
+
 #if defined(CONFIG_BOOT_DELAY) && (CONFIG_BOOT_DELAY > 0)
 	printk("*** Delaying boot by " STRINGIFY(CONFIG_BOOT_DELAY) "ms... ***\n");
 	k_busy_wait(CONFIG_BOOT_DELAY * USEC_PER_MSEC);
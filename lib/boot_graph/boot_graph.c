@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/logging/log.h>
+
+#include <boot_graph.h>
+#include <boot_trace.h>
+
+LOG_MODULE_REGISTER(boot_graph, CONFIG_NCS_BOOT_GRAPH_LOG_LEVEL);
+
+static K_MUTEX_DEFINE(graph_lock);
+static K_CONDVAR_DEFINE(graph_cv);
+
+static K_THREAD_STACK_ARRAY_DEFINE(worker_stacks, CONFIG_NCS_BOOT_GRAPH_WORKER_THREADS,
+				   CONFIG_NCS_BOOT_GRAPH_WORKER_STACK_SIZE);
+static struct k_thread worker_threads[CONFIG_NCS_BOOT_GRAPH_WORKER_THREADS];
+
+static struct boot_graph_step *step_lookup(const char *name)
+{
+	STRUCT_SECTION_FOREACH(boot_graph_step, step) {
+		if (strcmp(step->name, name) == 0) {
+			return step;
+		}
+	}
+
+	return NULL;
+}
+
+/* Mark a step failed without running it. Must be called with `graph_lock`
+ * held.
+ */
+static void step_skip(struct boot_graph_step *step, int result)
+{
+	step->result = result;
+	atomic_set(&step->state, BOOT_GRAPH_STEP_FAILED);
+	k_condvar_broadcast(&graph_cv);
+}
+
+/* Find a step that is ready to run and claim it. Must be called with
+ * `graph_lock` held. `idle` and `running` report whether any step is still
+ * waiting to run or currently running, for deadlock detection.
+ */
+static struct boot_graph_step *step_claim(bool *idle, bool *running)
+{
+	*idle = false;
+	*running = false;
+
+	STRUCT_SECTION_FOREACH(boot_graph_step, step) {
+		bool ready = true;
+
+		if (atomic_get(&step->state) == BOOT_GRAPH_STEP_RUNNING) {
+			*running = true;
+		}
+
+		if (atomic_get(&step->state) != BOOT_GRAPH_STEP_IDLE) {
+			continue;
+		}
+
+		for (size_t i = 0; step->deps[i] != NULL; i++) {
+			struct boot_graph_step *dep = step_lookup(step->deps[i]);
+
+			if (dep == NULL) {
+				LOG_ERR("Step %s depends on unknown step %s",
+					step->name, step->deps[i]);
+				step_skip(step, -EINVAL);
+				ready = false;
+				break;
+			}
+
+			if (atomic_get(&dep->state) == BOOT_GRAPH_STEP_FAILED) {
+				LOG_WRN("Skipping step %s, dependency %s failed",
+					step->name, dep->name);
+				step_skip(step, -ECANCELED);
+				ready = false;
+				break;
+			}
+
+			if (atomic_get(&dep->state) != BOOT_GRAPH_STEP_DONE) {
+				ready = false;
+				break;
+			}
+		}
+
+		if (atomic_get(&step->state) != BOOT_GRAPH_STEP_IDLE) {
+			/* Skipped above. */
+			continue;
+		}
+
+		*idle = true;
+
+		if (ready) {
+			atomic_set(&step->state, BOOT_GRAPH_STEP_RUNNING);
+			return step;
+		}
+	}
+
+	return NULL;
+}
+
+static void worker_fn(void *p1, void *p2, void *p3)
+{
+	struct boot_graph_step *step;
+	bool idle;
+	bool running;
+	int err;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	k_mutex_lock(&graph_lock, K_FOREVER);
+
+	while (true) {
+		step = step_claim(&idle, &running);
+
+		if (step == NULL) {
+			if (!idle) {
+				/* Nothing left for this worker to do. */
+				break;
+			}
+
+			if (!running) {
+				/* Steps are waiting but none can run and none
+				 * is running: the remainder of the graph is a
+				 * dependency cycle.
+				 */
+				STRUCT_SECTION_FOREACH(boot_graph_step, cyclic) {
+					if (atomic_get(&cyclic->state) ==
+					    BOOT_GRAPH_STEP_IDLE) {
+						LOG_ERR("Step %s is part of a dependency cycle",
+							cyclic->name);
+						step_skip(cyclic, -EDEADLK);
+					}
+				}
+				continue;
+			}
+
+			k_condvar_wait(&graph_cv, &graph_lock, K_FOREVER);
+			continue;
+		}
+
+		k_mutex_unlock(&graph_lock);
+
+		LOG_DBG("Running step %s", step->name);
+		err = step->init();
+		boot_trace_mark(step->name);
+
+		k_mutex_lock(&graph_lock, K_FOREVER);
+
+		step->result = err;
+		if (err) {
+			LOG_ERR("Step %s failed, err %d", step->name, err);
+			atomic_set(&step->state, BOOT_GRAPH_STEP_FAILED);
+		} else {
+			atomic_set(&step->state, BOOT_GRAPH_STEP_DONE);
+		}
+		k_condvar_broadcast(&graph_cv);
+	}
+
+	k_mutex_unlock(&graph_lock);
+}
+
+int boot_graph_run(void)
+{
+	int err = 0;
+
+	for (int i = 0; i < CONFIG_NCS_BOOT_GRAPH_WORKER_THREADS; i++) {
+		k_thread_create(&worker_threads[i], worker_stacks[i],
+				K_THREAD_STACK_SIZEOF(worker_stacks[i]),
+				worker_fn, NULL, NULL, NULL,
+				CONFIG_NCS_BOOT_GRAPH_WORKER_PRIORITY, 0, K_NO_WAIT);
+		k_thread_name_set(&worker_threads[i], "boot_graph");
+	}
+
+	for (int i = 0; i < CONFIG_NCS_BOOT_GRAPH_WORKER_THREADS; i++) {
+		k_thread_join(&worker_threads[i], K_FOREVER);
+	}
+
+	STRUCT_SECTION_FOREACH(boot_graph_step, step) {
+		if (atomic_get(&step->state) == BOOT_GRAPH_STEP_FAILED && err == 0) {
+			err = step->result;
+		}
+	}
+
+	return err;
+}
+
+int boot_graph_step_state_get(const char *name, int *result)
+{
+	struct boot_graph_step *step = step_lookup(name);
+
+	if (step == NULL) {
+		return -ENOENT;
+	}
+
+	if (result != NULL) {
+		*result = step->result;
+	}
+
+	return atomic_get(&step->state);
+}
+
+#if defined(CONFIG_NCS_BOOT_GRAPH_AUTO_RUN)
+static int boot_graph_auto_run(void)
+{
+	return boot_graph_run();
+}
+
+SYS_INIT(boot_graph_auto_run, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
+#endif /* CONFIG_NCS_BOOT_GRAPH_AUTO_RUN */
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/sys/atomic.h>
+
+#include <boot_trace.h>
+
+#if defined(CONFIG_NCS_BOOT_TRACE_SHELL)
+#include <zephyr/shell/shell.h>
+#endif
+
+#define BOOT_TRACE_MAGIC 0x42545243 /* "BTRC" */
+
+struct boot_trace_entry {
+	char name[CONFIG_NCS_BOOT_TRACE_NAME_LEN];
+	uint32_t cycles;
+};
+
+struct boot_trace_table {
+	uint32_t magic;
+	atomic_t count;
+	struct boot_trace_entry entries[CONFIG_NCS_BOOT_TRACE_ENTRY_COUNT];
+};
+
+/* Kept out of the zeroed image so that the table from the previous boot can
+ * be inspected with a debugger if this boot hangs before the shell is up.
+ * The table is reset from the earliest init level of the new boot.
+ */
+static __noinit struct boot_trace_table table;
+
+void boot_trace_mark(const char *name)
+{
+	atomic_val_t idx;
+
+	if (table.magic != BOOT_TRACE_MAGIC) {
+		return;
+	}
+
+	idx = atomic_inc(&table.count);
+	if (idx >= ARRAY_SIZE(table.entries)) {
+		return;
+	}
+
+	table.entries[idx].cycles = k_cycle_get_32();
+	strncpy(table.entries[idx].name, name, sizeof(table.entries[idx].name) - 1);
+	table.entries[idx].name[sizeof(table.entries[idx].name) - 1] = '\0';
+}
+
+static int boot_trace_init(void)
+{
+	memset(&table, 0, sizeof(table));
+	table.magic = BOOT_TRACE_MAGIC;
+
+	boot_trace_mark("pre_kernel");
+
+	return 0;
+}
+
+SYS_INIT(boot_trace_init, PRE_KERNEL_1, 0);
+
+#if defined(CONFIG_NCS_BOOT_TRACE_SHELL)
+
+static int cmd_boot_trace_show(const struct shell *sh, size_t argc, char **argv)
+{
+	uint32_t count = MIN(atomic_get(&table.count), ARRAY_SIZE(table.entries));
+	uint32_t prev_cycles = 0;
+
+	if (count == 0) {
+		shell_print(sh, "No boot trace entries.");
+		return 0;
+	}
+
+	shell_print(sh, "%-*s %12s %12s", CONFIG_NCS_BOOT_TRACE_NAME_LEN, "phase",
+		    "time [us]", "delta [us]");
+
+	for (uint32_t i = 0; i < count; i++) {
+		const struct boot_trace_entry *entry = &table.entries[i];
+
+		shell_print(sh, "%-*s %12u %12u", CONFIG_NCS_BOOT_TRACE_NAME_LEN, entry->name,
+			    k_cyc_to_us_near32(entry->cycles),
+			    k_cyc_to_us_near32(entry->cycles - prev_cycles));
+		prev_cycles = entry->cycles;
+	}
+
+	if (atomic_get(&table.count) > ARRAY_SIZE(table.entries)) {
+		shell_print(sh, "Table full, %lu marks dropped.",
+			    (unsigned long)(atomic_get(&table.count) - ARRAY_SIZE(table.entries)));
+	}
+
+	return 0;
+}
+
+SHELL_CMD_REGISTER(boot_trace, NULL, "Show boot phase timestamps", cmd_boot_trace_show);
+
+#endif /* CONFIG_NCS_BOOT_TRACE_SHELL */
@@ -54,6 +54,55 @@ int contin_array_create(void *const pcm_cont, uint32_t pcm_cont_size, void const
 	return 0;
 }
 
+int contin_array_slice_get(void const *const pcm_finite, uint32_t pcm_finite_size,
+			   uint32_t slice_size, void *const splice_buf,
+			   uint32_t *const _finite_pos, void const **slice)
+{
+	if (pcm_finite == NULL || splice_buf == NULL || _finite_pos == NULL || slice == NULL) {
+		return -ENXIO;
+	}
+
+	if (!pcm_finite_size || !slice_size) {
+		LOG_ERR("Size cannot be zero");
+		return -EPERM;
+	}
+
+	if (slice_size > pcm_finite_size) {
+		LOG_ERR("Slice larger than the finite array");
+		return -EINVAL;
+	}
+
+	if (*_finite_pos >= pcm_finite_size) {
+		*_finite_pos = 0;
+	}
+
+	if ((*_finite_pos + slice_size) <= pcm_finite_size) {
+		/* The slice is contiguous within the finite array, so it can be
+		 * handed out without copying
+		 */
+		*slice = (char const *)pcm_finite + *_finite_pos;
+
+		*_finite_pos += slice_size;
+		if (*_finite_pos == pcm_finite_size) {
+			*_finite_pos = 0;
+		}
+	} else {
+		/* The slice straddles the wrap-around, so the end and start of the
+		 * finite array are stitched together in the splice buffer
+		 */
+		uint32_t tail_size = pcm_finite_size - *_finite_pos;
+
+		memcpy(splice_buf, (char const *)pcm_finite + *_finite_pos, tail_size);
+		memcpy((char *)splice_buf + tail_size, pcm_finite, slice_size - tail_size);
+
+		*slice = splice_buf;
+
+		*_finite_pos = slice_size - tail_size;
+	}
+
+	return 0;
+}
+
 int contin_array_buf_create(struct net_buf *pcm_contin, void const *const pcm_finite,
 			    uint16_t pcm_finite_size, uint32_t locations, uint16_t *_finite_pos)
 {
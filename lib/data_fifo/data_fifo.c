@@ -6,13 +6,35 @@
 
 #include <data_fifo.h>
 
+#include <string.h>
 #include <zephyr/kernel.h>
+#include <nrf_latency_probe.h>
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(data_fifo, CONFIG_DATA_FIFO_LOG_LEVEL);
 
+NRF_LATENCY_PROBE_DEFINE(data_fifo_vacant_get);
+NRF_LATENCY_PROBE_DEFINE(data_fifo_filled_get);
+
 static struct k_spinlock lock;
 
+#if defined(CONFIG_DATA_FIFO_ZERO_COPY)
+/** @brief Find the in-flight external block descriptor for a given buffer.
+ *
+ * Must be called with the lock held.
+ */
+static struct data_fifo_ext_block *ext_block_find(struct data_fifo *data_fifo, void const *data)
+{
+	for (int i = 0; i < ARRAY_SIZE(data_fifo->ext_blocks); i++) {
+		if (data_fifo->ext_blocks[i].data == data) {
+			return &data_fifo->ext_blocks[i];
+		}
+	}
+
+	return NULL;
+}
+#endif /* CONFIG_DATA_FIFO_ZERO_COPY */
+
 /** @brief Checks that the elements in the msgq and slab are legal.
  * I.e. the number of msgq elements cannot be more than mem blocks used.
  */
@@ -25,6 +47,11 @@ static int msgq_slab_legal_used_elements(struct data_fifo *data_fifo, uint32_t *
 	uint32_t msgq_num_used = k_msgq_num_used_get(&data_fifo->msgq);
 	uint32_t slab_blocks_num_used = k_mem_slab_num_used_get(&data_fifo->mem_slab);
 
+#if defined(CONFIG_DATA_FIFO_ZERO_COPY)
+	/* External blocks occupy msgq elements without using slab blocks */
+	slab_blocks_num_used += atomic_get(&data_fifo->ext_in_flight);
+#endif /* CONFIG_DATA_FIFO_ZERO_COPY */
+
 	k_spin_unlock(&lock, key);
 
 	if (slab_blocks_num_used < msgq_num_used) {
@@ -41,6 +68,16 @@ static int msgq_slab_legal_used_elements(struct data_fifo *data_fifo, uint32_t *
 	return 0;
 }
 
+#if defined(CONFIG_DATA_FIFO_SPSC)
+/** @brief Get the ring entry for a free-running index. */
+static struct data_fifo_msgq *spsc_entry_get(struct data_fifo *data_fifo, uint32_t idx)
+{
+	struct data_fifo_msgq *entries = (struct data_fifo_msgq *)data_fifo->msgq_buffer;
+
+	return &entries[idx % data_fifo->elements_max];
+}
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
 int data_fifo_pointer_first_vacant_get(struct data_fifo *data_fifo, void **data,
 				       k_timeout_t timeout)
 {
@@ -48,7 +85,28 @@ int data_fifo_pointer_first_vacant_get(struct data_fifo *data_fifo, void **data,
 	__ASSERT_NO_MSG(data_fifo->initialized);
 	int ret;
 
+#if defined(CONFIG_DATA_FIFO_SPSC)
+	if (data_fifo->spsc) {
+		struct data_fifo_spsc *spsc = &data_fifo->spsc_state;
+		uint32_t alloc_idx = atomic_get(&spsc->alloc_idx);
+
+		/* Only the producer updates alloc_idx, so the read is stable */
+		if (alloc_idx - (uint32_t)atomic_get(&spsc->free_idx) >=
+		    data_fifo->elements_max) {
+			return -ENOMEM;
+		}
+
+		*data = data_fifo->slab_buffer +
+			(alloc_idx % data_fifo->elements_max) * data_fifo->block_size_max;
+		atomic_set(&spsc->alloc_idx, alloc_idx + 1);
+
+		return 0;
+	}
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
+	NRF_LATENCY_PROBE_BEGIN(data_fifo_vacant_get);
 	ret = k_mem_slab_alloc(&data_fifo->mem_slab, data, timeout);
+	NRF_LATENCY_PROBE_END(data_fifo_vacant_get);
 	return ret;
 }
 
@@ -66,6 +124,30 @@ int data_fifo_block_lock(struct data_fifo *data_fifo, void **data, size_t size)
 		return -EINVAL;
 	}
 
+#if defined(CONFIG_DATA_FIFO_SPSC)
+	if (data_fifo->spsc) {
+		struct data_fifo_spsc *spsc = &data_fifo->spsc_state;
+		uint32_t write_idx = atomic_get(&spsc->write_idx);
+
+		if (write_idx == (uint32_t)atomic_get(&spsc->alloc_idx)) {
+			LOG_ERR("No claimed block to lock");
+			return -ESPIPE;
+		}
+
+		struct data_fifo_msgq *entry = spsc_entry_get(data_fifo, write_idx);
+
+		entry->block_ptr = *data;
+		entry->size = size;
+
+		/* Publish the entry to the consumer. atomic_set implies a
+		 * full barrier, so the entry is written before the index.
+		 */
+		atomic_set(&spsc->write_idx, write_idx + 1);
+
+		return 0;
+	}
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
 	struct data_fifo_msgq msgq_tmp;
 
 	msgq_tmp.block_ptr = *data;
@@ -91,9 +173,30 @@ int data_fifo_pointer_last_filled_get(struct data_fifo *data_fifo, void **data,
 	__ASSERT_NO_MSG(data_fifo->initialized);
 	int ret;
 
+#if defined(CONFIG_DATA_FIFO_SPSC)
+	if (data_fifo->spsc) {
+		struct data_fifo_spsc *spsc = &data_fifo->spsc_state;
+		uint32_t read_idx = atomic_get(&spsc->read_idx);
+
+		if (read_idx == (uint32_t)atomic_get(&spsc->write_idx)) {
+			return -ENOMSG;
+		}
+
+		struct data_fifo_msgq *entry = spsc_entry_get(data_fifo, read_idx);
+
+		*data = entry->block_ptr;
+		*size = entry->size;
+		atomic_set(&spsc->read_idx, read_idx + 1);
+
+		return 0;
+	}
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
 	struct data_fifo_msgq msgq_tmp;
 
+	NRF_LATENCY_PROBE_BEGIN(data_fifo_filled_get);
 	ret = k_msgq_get(&data_fifo->msgq, &msgq_tmp, timeout);
+	NRF_LATENCY_PROBE_END(data_fifo_filled_get);
 	if (ret) {
 		return ret;
 	}
@@ -103,11 +206,122 @@ int data_fifo_pointer_last_filled_get(struct data_fifo *data_fifo, void **data,
 	return 0;
 }
 
+#if defined(CONFIG_DATA_FIFO_ZERO_COPY)
+int data_fifo_ext_block_put(struct data_fifo *data_fifo, void *data, size_t size,
+			    data_fifo_ext_release_cb_t release_cb, void *user_data)
+{
+	__ASSERT_NO_MSG(data_fifo != NULL);
+	__ASSERT_NO_MSG(data_fifo->initialized);
+	int ret;
+
+	if (data == NULL || size == 0) {
+		LOG_ERR("Data is NULL or size is zero");
+		return -EINVAL;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	/* Claim a vacant descriptor */
+	struct data_fifo_ext_block *block = ext_block_find(data_fifo, NULL);
+
+	if (block == NULL) {
+		k_spin_unlock(&lock, key);
+		LOG_ERR("No free external block descriptors");
+		return -ENOMEM;
+	}
+
+	block->data = data;
+	block->release_cb = release_cb;
+	block->user_data = user_data;
+	atomic_set(&block->ref_count, 1);
+	atomic_inc(&data_fifo->ext_in_flight);
+
+	k_spin_unlock(&lock, key);
+
+	struct data_fifo_msgq msgq_tmp;
+
+	msgq_tmp.block_ptr = data;
+	msgq_tmp.size = size;
+
+	ret = k_msgq_put(&data_fifo->msgq, &msgq_tmp, K_NO_WAIT);
+	if (ret) {
+		key = k_spin_lock(&lock);
+		block->data = NULL;
+		atomic_dec(&data_fifo->ext_in_flight);
+		k_spin_unlock(&lock, key);
+		return ret;
+	}
+
+	return 0;
+}
+
+int data_fifo_ext_block_ref(struct data_fifo *data_fifo, void *data)
+{
+	__ASSERT_NO_MSG(data_fifo != NULL);
+	__ASSERT_NO_MSG(data_fifo->initialized);
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	struct data_fifo_ext_block *block = ext_block_find(data_fifo, data);
+
+	if (block == NULL) {
+		k_spin_unlock(&lock, key);
+		return -ENODEV;
+	}
+
+	atomic_inc(&block->ref_count);
+
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+#endif /* CONFIG_DATA_FIFO_ZERO_COPY */
+
 void data_fifo_block_free(struct data_fifo *data_fifo, void *data)
 {
 	__ASSERT_NO_MSG(data_fifo != NULL);
 	__ASSERT_NO_MSG(data_fifo->initialized);
 
+#if defined(CONFIG_DATA_FIFO_SPSC)
+	if (data_fifo->spsc) {
+		struct data_fifo_spsc *spsc = &data_fifo->spsc_state;
+
+		/* Blocks are freed in fetch order, so only the tail index moves */
+		__ASSERT_NO_MSG((uint32_t)atomic_get(&spsc->free_idx) !=
+				(uint32_t)atomic_get(&spsc->read_idx));
+		atomic_inc(&spsc->free_idx);
+
+		return;
+	}
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
+#if defined(CONFIG_DATA_FIFO_ZERO_COPY)
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	struct data_fifo_ext_block *block = ext_block_find(data_fifo, data);
+
+	if (block != NULL) {
+		if (atomic_dec(&block->ref_count) == 1) {
+			data_fifo_ext_release_cb_t release_cb = block->release_cb;
+			void *user_data = block->user_data;
+
+			block->data = NULL;
+			atomic_dec(&data_fifo->ext_in_flight);
+			k_spin_unlock(&lock, key);
+
+			if (release_cb != NULL) {
+				release_cb(data, user_data);
+			}
+		} else {
+			k_spin_unlock(&lock, key);
+		}
+
+		return;
+	}
+
+	k_spin_unlock(&lock, key);
+#endif /* CONFIG_DATA_FIFO_ZERO_COPY */
+
 	k_mem_slab_free(&data_fifo->mem_slab, data);
 }
 
@@ -120,6 +334,19 @@ int data_fifo_num_used_get(struct data_fifo *data_fifo, uint32_t *alloced_num, u
 	uint32_t msgq_num_used = UINT32_MAX;
 	uint32_t slab_blocks_num_used = UINT32_MAX;
 
+#if defined(CONFIG_DATA_FIFO_SPSC)
+	if (data_fifo->spsc) {
+		struct data_fifo_spsc *spsc = &data_fifo->spsc_state;
+
+		*alloced_num = (uint32_t)atomic_get(&spsc->alloc_idx) -
+			       (uint32_t)atomic_get(&spsc->free_idx);
+		*locked_num = (uint32_t)atomic_get(&spsc->write_idx) -
+			      (uint32_t)atomic_get(&spsc->read_idx);
+
+		return 0;
+	}
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
 	ret = msgq_slab_legal_used_elements(data_fifo, &msgq_num_used, &slab_blocks_num_used);
 	if (ret) {
 		return ret;
@@ -138,6 +365,18 @@ int data_fifo_empty(struct data_fifo *data_fifo)
 	void *old_data;
 	size_t size;
 
+#if defined(CONFIG_DATA_FIFO_SPSC)
+	if (data_fifo->spsc) {
+		/* Both ends must be idle, as for the slab re-init below */
+		atomic_clear(&data_fifo->spsc_state.alloc_idx);
+		atomic_clear(&data_fifo->spsc_state.write_idx);
+		atomic_clear(&data_fifo->spsc_state.read_idx);
+		atomic_clear(&data_fifo->spsc_state.free_idx);
+
+		return 0;
+	}
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
 	ret = data_fifo_num_used_get(data_fifo, &fifo_alloced_num, &fifo_locked_num);
 	if (ret) {
 		LOG_ERR("Failed to get num used in FIFO");
@@ -192,6 +431,19 @@ int data_fifo_init(struct data_fifo *data_fifo)
 	__ASSERT_NO_MSG((data_fifo->block_size_max % WB_UP(1)) == 0);
 	int ret;
 
+#if defined(CONFIG_DATA_FIFO_SPSC)
+	if (data_fifo->spsc) {
+		atomic_clear(&data_fifo->spsc_state.alloc_idx);
+		atomic_clear(&data_fifo->spsc_state.write_idx);
+		atomic_clear(&data_fifo->spsc_state.read_idx);
+		atomic_clear(&data_fifo->spsc_state.free_idx);
+
+		data_fifo->initialized = true;
+
+		return 0;
+	}
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
 	k_msgq_init(&data_fifo->msgq, data_fifo->msgq_buffer, sizeof(struct data_fifo_msgq),
 		    data_fifo->elements_max);
 
@@ -202,6 +454,11 @@ int data_fifo_init(struct data_fifo *data_fifo)
 		return ret;
 	}
 
+#if defined(CONFIG_DATA_FIFO_ZERO_COPY)
+	memset(data_fifo->ext_blocks, 0, sizeof(data_fifo->ext_blocks));
+	atomic_clear(&data_fifo->ext_in_flight);
+#endif /* CONFIG_DATA_FIFO_ZERO_COPY */
+
 	data_fifo->initialized = true;
 
 	return ret;
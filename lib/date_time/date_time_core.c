@@ -20,6 +20,9 @@
 #include "date_time_core.h"
 #include "date_time_modem.h"
 #include "date_time_ntp.h"
+#if defined(CONFIG_DATE_TIME_RETAINED)
+#include "date_time_retained.h"
+#endif
 
 LOG_MODULE_DECLARE(date_time, CONFIG_DATE_TIME_LOG_LEVEL);
 
@@ -38,6 +41,11 @@ static K_WORK_DEFINE(date_time_update_manual_work, date_time_update_work_fn);
 static int64_t date_time_last_update_uptime;
 static date_time_evt_handler_t app_evt_handler;
 
+/* Whether system time was seeded from a retained snapshot after a warm
+ * reset. A seeded time is valid for consumers but still due for an update.
+ */
+static bool date_time_seeded;
+
 /* In units of quarters of hours, same as used by AT+CCLK. */
 static int date_time_tz = DATE_TIME_TZ_INVALID;
 
@@ -207,6 +215,23 @@ void date_time_core_init(void)
 		K_LOWEST_APPLICATION_THREAD_PRIO,
 		&cfg);
 
+#if defined(CONFIG_DATE_TIME_RETAINED)
+	int64_t retained_time_ms;
+
+	if (date_time_retained_load(&retained_time_ms) == 0) {
+		struct timespec tp = {
+			.tv_sec = retained_time_ms / 1000,
+			.tv_nsec = (retained_time_ms % 1000) * 1000000,
+		};
+
+		if (sys_clock_settime(SYS_CLOCK_REALTIME, &tp) == 0) {
+			date_time_seeded = true;
+			LOG_INF("System time seeded from retained snapshot");
+		}
+	}
+	date_time_retained_init();
+#endif
+
 	if (IS_ENABLED(CONFIG_DATE_TIME_AUTO_UPDATE) && IS_ENABLED(CONFIG_LTE_LINK_CONTROL)) {
 		lte_lc_register_handler(date_time_lte_ind_handler);
 	}
@@ -288,7 +313,7 @@ void date_time_core_register_handler(date_time_evt_handler_t evt_handler)
 
 bool date_time_core_is_valid(void)
 {
-	return (date_time_last_update_uptime != 0);
+	return (date_time_last_update_uptime != 0) || date_time_seeded;
 }
 
 bool date_time_core_is_valid_local(void)
@@ -303,6 +328,7 @@ bool date_time_core_is_valid_local(void)
 void date_time_core_clear(void)
 {
 	date_time_last_update_uptime = 0;
+	date_time_seeded = false;
 }
 
 int date_time_core_current_check(void)
@@ -351,6 +377,10 @@ void date_time_core_store_tz(int64_t curr_time_ms, enum date_time_evt_type time_
 		date_time_core_notify_event(DATE_TIME_NOT_OBTAINED);
 		return;
 	}
+#if defined(CONFIG_DATE_TIME_RETAINED)
+	date_time_retained_save();
+#endif
+
 	gmtime_r(&tp.tv_sec, &ltm);
 	LOG_DBG("System time updated: %04u-%02u-%02u %02u:%02u:%02u%+03d",
 		ltm.tm_year + 1900, ltm.tm_mon + 1, ltm.tm_mday,
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <stddef.h>
+#include <date_time.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/clock.h>
+#include <zephyr/sys/crc.h>
+#include <zephyr/logging/log.h>
+
+#include "date_time_core.h"
+#include "date_time_retained.h"
+
+LOG_MODULE_DECLARE(date_time, CONFIG_DATE_TIME_LOG_LEVEL);
+
+#define DATE_TIME_RETAINED_MAGIC 0x44544d45 /* "DTME" */
+
+struct date_time_retained_data {
+	uint32_t magic;
+	int64_t unix_time_ms;
+	uint32_t crc;
+};
+
+/* A power-on reset leaves the memory with random content, which the magic
+ * word and CRC reject; a warm reset (software, watchdog) keeps it intact.
+ */
+static __noinit struct date_time_retained_data retained;
+
+static void date_time_retained_work_fn(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(date_time_retained_work, date_time_retained_work_fn);
+
+static uint32_t retained_crc(void)
+{
+	return crc32_ieee((const uint8_t *)&retained,
+			  offsetof(struct date_time_retained_data, crc));
+}
+
+void date_time_retained_save(void)
+{
+	struct timespec tp;
+
+	if (!date_time_core_is_valid()) {
+		return;
+	}
+
+	if (sys_clock_gettime(SYS_CLOCK_REALTIME, &tp)) {
+		return;
+	}
+
+	retained.magic = DATE_TIME_RETAINED_MAGIC;
+	retained.unix_time_ms = (int64_t)tp.tv_sec * 1000 + (int64_t)tp.tv_nsec / 1000000;
+	retained.crc = retained_crc();
+}
+
+static void date_time_retained_work_fn(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	date_time_retained_save();
+	k_work_schedule(&date_time_retained_work,
+			K_SECONDS(CONFIG_DATE_TIME_RETAINED_REFRESH_SECONDS));
+}
+
+int date_time_retained_load(int64_t *unix_time_ms)
+{
+	if ((retained.magic != DATE_TIME_RETAINED_MAGIC) || (retained.crc != retained_crc())) {
+		return -ENODATA;
+	}
+
+	*unix_time_ms = retained.unix_time_ms;
+	return 0;
+}
+
+void date_time_retained_init(void)
+{
+	k_work_schedule(&date_time_retained_work,
+			K_SECONDS(CONFIG_DATE_TIME_RETAINED_REFRESH_SECONDS));
+}
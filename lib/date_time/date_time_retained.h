@@ -0,0 +1,16 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef DATE_TIME_RETAINED_H_
+#define DATE_TIME_RETAINED_H_
+
+#include <stdint.h>
+
+int date_time_retained_load(int64_t *unix_time_ms);
+void date_time_retained_save(void);
+void date_time_retained_init(void);
+
+#endif /* DATE_TIME_RETAINED_H_ */
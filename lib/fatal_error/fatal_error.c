@@ -8,6 +8,7 @@
 #include <zephyr/logging/log_ctrl.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/fatal.h>
+#include <nrf_profiler_flight_recorder.h>
 
 LOG_MODULE_REGISTER(fatal_error, CONFIG_FATAL_ERROR_LOG_LEVEL);
 
@@ -20,6 +21,12 @@ void k_sys_fatal_error_handler(unsigned int reason,
 	ARG_UNUSED(reason);
 
 	LOG_PANIC();
+
+	if (IS_ENABLED(CONFIG_NRF_PROFILER_NORDIC_FLIGHT_RECORDER)) {
+		/* Persist the recorded profiler events for post-mortem analysis. */
+		(void)nrf_profiler_flight_recorder_snapshot();
+	}
+
 	LOG_ERR("Resetting system");
 	sys_arch_reboot(0);
 
@@ -8,6 +8,7 @@
 #include <hal/nrf_ficr.h>
 #include <nrfx_nvmc.h>
 #include <errno.h>
+#include <fprotect.h>
 #include <zephyr/sys/__assert.h>
 #include <zephyr/kernel.h>
 
@@ -96,6 +97,44 @@ int fprotect_area(uint32_t start, size_t length)
 				       NRF_ACL_PERM_READ_NO_WRITE);
 }
 
+int fprotect_area_batch(const struct fprotect_region *regions, size_t count)
+{
+	uint32_t page_size = nrf_ficr_codepagesize_get(NRF_FICR);
+	uint32_t region_idx;
+	int result;
+
+	if (regions == NULL || count == 0) {
+		return -EINVAL;
+	}
+
+	/* Validate the whole map, including that it fits in the free ACL
+	 * regions, before committing any of it.
+	 */
+	result = find_free_region(&region_idx);
+	if (result != 0 || (count > (ACL_REGIONS_COUNT - region_idx))) {
+		return -ENOSPC;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		if (regions[i].start % page_size != 0 ||
+		    regions[i].length % page_size != 0 ||
+		    regions[i].length > NRF_ACL_REGION_SIZE_MAX ||
+		    regions[i].length == 0) {
+			return -EINVAL;
+		}
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		result = fprotect_set_permission(regions[i].start, regions[i].length,
+						 NRF_ACL_PERM_READ_NO_WRITE);
+		if (result != 0) {
+			return result;
+		}
+	}
+
+	return 0;
+}
+
 int fprotect_area_no_access(uint32_t start, size_t length)
 {
 	return fprotect_set_permission(start, length,
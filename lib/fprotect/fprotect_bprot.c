@@ -20,6 +20,7 @@
 #endif
 #include <zephyr/sys/util.h>
 #include <errno.h>
+#include <fprotect.h>
 
  /* The number of CONFIG registers present in the chip. */
 #define BPROT_CONFIGS_NUM DIV_ROUND_UP(BPROT_REGIONS_NUM, BITS_PER_LONG)
@@ -30,17 +31,13 @@
 #endif
 
 
-int fprotect_area(uint32_t start, size_t length)
-{
-	ENABLE_PROTECTION_IN_DEBUG(NRF_BPROT,
-				   ENABLE_IN_DEBUG
-				   );
+BUILD_ASSERT(BPROT_REGIONS_SIZE == CONFIG_FPROTECT_BLOCK_SIZE);
 
+/* Validate the given area and set its blocks in the given mask. */
+static int block_mask_add(uint32_t start, size_t length, uint32_t *block_mask)
+{
 	uint32_t block_start = start / BPROT_REGIONS_SIZE;
 	uint32_t block_end   = (start + length) / BPROT_REGIONS_SIZE;
-	uint32_t block_mask[BPROT_CONFIGS_NUM] = {0};
-
-	BUILD_ASSERT(BPROT_REGIONS_SIZE == CONFIG_FPROTECT_BLOCK_SIZE);
 
 	if ((start % BPROT_REGIONS_SIZE) ||
 	    (length % BPROT_REGIONS_SIZE) ||
@@ -58,9 +55,53 @@ int fprotect_area(uint32_t start, size_t length)
 		block_mask[i / BITS_PER_LONG] |= BIT(i % BITS_PER_LONG);
 	}
 
+	return 0;
+}
+
+static void block_mask_apply(const uint32_t *block_mask)
+{
+	ENABLE_PROTECTION_IN_DEBUG(NRF_BPROT,
+				   ENABLE_IN_DEBUG
+				   );
+
 	for (uint32_t i = 0; i < BPROT_CONFIGS_NUM; i++) {
 		PROTECT(NRF_BPROT, i, block_mask[i]);
 	}
+}
+
+int fprotect_area(uint32_t start, size_t length)
+{
+	uint32_t block_mask[BPROT_CONFIGS_NUM] = {0};
+	int err;
+
+	err = block_mask_add(start, length, block_mask);
+	if (err != 0) {
+		return err;
+	}
+
+	block_mask_apply(block_mask);
+
+	return 0;
+}
+
+int fprotect_area_batch(const struct fprotect_region *regions, size_t count)
+{
+	uint32_t block_mask[BPROT_CONFIGS_NUM] = {0};
+	int err;
+
+	if (regions == NULL || count == 0) {
+		return -EINVAL;
+	}
+
+	/* Validate the whole map before committing any of it. */
+	for (size_t i = 0; i < count; i++) {
+		err = block_mask_add(regions[i].start, regions[i].length, block_mask);
+		if (err != 0) {
+			return err;
+		}
+	}
+
+	block_mask_apply(block_mask);
 
 	return 0;
 }
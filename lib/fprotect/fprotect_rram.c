@@ -7,6 +7,7 @@
 #include <stdint.h>
 #include <string.h>
 #include <errno.h>
+#include <fprotect.h>
 #include <soc.h>
 #include <nrfx.h>
 #include <hal/nrf_rramc.h>
@@ -107,3 +108,19 @@ int fprotect_area(uint32_t start, size_t size)
 
 	return 0;
 }
+
+int fprotect_area_batch(const struct fprotect_region *regions, size_t count)
+{
+	if (regions == NULL || count == 0) {
+		return -EINVAL;
+	}
+
+	/* The RRAMC backend has a single region configuration register
+	 * available for fprotect, so only maps with one entry can be applied.
+	 */
+	if (count > 1) {
+		return -ENOSPC;
+	}
+
+	return fprotect_area(regions[0].start, regions[0].length);
+}
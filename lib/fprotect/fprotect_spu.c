@@ -10,17 +10,13 @@
 #include <errno.h>
 #include <soc.h>
 #include <nrfx.h>
+#include <fprotect.h>
 
 
 #define SPU_BLOCK_SIZE CONFIG_FPROTECT_BLOCK_SIZE
 
-int fprotect_area(uint32_t start, size_t length)
+static void spu_region_protect(uint32_t start, size_t length)
 {
-	if (start % SPU_BLOCK_SIZE != 0 ||
-		length % SPU_BLOCK_SIZE != 0) {
-		return -EINVAL;
-	}
-
 	for (uint32_t i = 0; i < length / SPU_BLOCK_SIZE; i++) {
 		nrf_spu_flashregion_set(NRF_SPU_S,
 				(start / SPU_BLOCK_SIZE) + i,
@@ -29,6 +25,37 @@ int fprotect_area(uint32_t start, size_t length)
 				NRF_SPU_MEM_PERM_READ,
 				true);
 	}
+}
+
+int fprotect_area(uint32_t start, size_t length)
+{
+	if (start % SPU_BLOCK_SIZE != 0 ||
+		length % SPU_BLOCK_SIZE != 0) {
+		return -EINVAL;
+	}
+
+	spu_region_protect(start, length);
+
+	return 0;
+}
+
+int fprotect_area_batch(const struct fprotect_region *regions, size_t count)
+{
+	if (regions == NULL || count == 0) {
+		return -EINVAL;
+	}
+
+	/* Validate the whole map before committing any of it. */
+	for (size_t i = 0; i < count; i++) {
+		if (regions[i].start % SPU_BLOCK_SIZE != 0 ||
+			regions[i].length % SPU_BLOCK_SIZE != 0) {
+			return -EINVAL;
+		}
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		spu_region_protect(regions[i].start, regions[i].length);
+	}
 
 	return 0;
 }
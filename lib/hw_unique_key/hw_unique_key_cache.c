@@ -0,0 +1,124 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+#include <hw_unique_key.h>
+
+/* Cache of derived keys, so that layers which repeatedly derive the same
+ * labeled key only pay for the hardware derivation once per boot. Derivations
+ * whose parameters exceed the bounds below bypass the cache.
+ */
+#define CACHE_MAX_CONTEXT_SIZE 32
+#define CACHE_MAX_LABEL_SIZE   32
+#define CACHE_MAX_OUTPUT_SIZE  32
+
+struct cache_entry {
+	bool valid;
+	enum hw_unique_key_slot key_slot;
+	uint8_t context[CACHE_MAX_CONTEXT_SIZE];
+	size_t context_size;
+	uint8_t label[CACHE_MAX_LABEL_SIZE];
+	size_t label_size;
+	uint8_t output[CACHE_MAX_OUTPUT_SIZE];
+	uint32_t output_size;
+	uint32_t last_used;
+};
+
+static struct cache_entry cache[CONFIG_HW_UNIQUE_KEY_DERIVATION_CACHE_ENTRIES];
+static uint32_t cache_use_counter;
+static K_MUTEX_DEFINE(cache_mutex);
+
+/* Expects the cache mutex to be locked. */
+static struct cache_entry *cache_find(enum hw_unique_key_slot key_slot, const uint8_t *context,
+				      size_t context_size, const uint8_t *label,
+				      size_t label_size, uint32_t output_size)
+{
+	for (int i = 0; i < ARRAY_SIZE(cache); i++) {
+		struct cache_entry *entry = &cache[i];
+
+		if (entry->valid && entry->key_slot == key_slot &&
+		    entry->context_size == context_size &&
+		    entry->label_size == label_size &&
+		    entry->output_size == output_size &&
+		    (context_size == 0 || memcmp(entry->context, context, context_size) == 0) &&
+		    (label_size == 0 || memcmp(entry->label, label, label_size) == 0)) {
+			return entry;
+		}
+	}
+
+	return NULL;
+}
+
+int hw_unique_key_derive_key_cached(enum hw_unique_key_slot key_slot, const uint8_t *context,
+				    size_t context_size, uint8_t const *label, size_t label_size,
+				    uint8_t *output, uint32_t output_size)
+{
+	struct cache_entry *entry;
+	int err;
+
+	if (context_size > CACHE_MAX_CONTEXT_SIZE || label_size > CACHE_MAX_LABEL_SIZE ||
+	    output_size > CACHE_MAX_OUTPUT_SIZE) {
+		return hw_unique_key_derive_key(key_slot, context, context_size, label,
+						label_size, output, output_size);
+	}
+
+	k_mutex_lock(&cache_mutex, K_FOREVER);
+
+	entry = cache_find(key_slot, context, context_size, label, label_size, output_size);
+	if (entry != NULL) {
+		entry->last_used = ++cache_use_counter;
+		memcpy(output, entry->output, output_size);
+		k_mutex_unlock(&cache_mutex);
+		return HW_UNIQUE_KEY_SUCCESS;
+	}
+
+	err = hw_unique_key_derive_key(key_slot, context, context_size, label, label_size,
+				       output, output_size);
+	if (err != HW_UNIQUE_KEY_SUCCESS) {
+		k_mutex_unlock(&cache_mutex);
+		return err;
+	}
+
+	/* Take a free entry, or evict the least recently used one. */
+	entry = &cache[0];
+	for (int i = 0; i < ARRAY_SIZE(cache); i++) {
+		if (!cache[i].valid) {
+			entry = &cache[i];
+			break;
+		}
+		if (cache[i].last_used < entry->last_used) {
+			entry = &cache[i];
+		}
+	}
+
+	memset(entry, 0, sizeof(*entry));
+	entry->valid = true;
+	entry->key_slot = key_slot;
+	if (context_size != 0) {
+		memcpy(entry->context, context, context_size);
+	}
+	entry->context_size = context_size;
+	if (label_size != 0) {
+		memcpy(entry->label, label, label_size);
+	}
+	entry->label_size = label_size;
+	memcpy(entry->output, output, output_size);
+	entry->output_size = output_size;
+	entry->last_used = ++cache_use_counter;
+
+	k_mutex_unlock(&cache_mutex);
+
+	return HW_UNIQUE_KEY_SUCCESS;
+}
+
+void hw_unique_key_cache_clear(void)
+{
+	k_mutex_lock(&cache_mutex, K_FOREVER);
+	memset(cache, 0, sizeof(cache));
+	k_mutex_unlock(&cache_mutex);
+}
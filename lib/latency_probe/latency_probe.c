@@ -0,0 +1,20 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <nrf_latency_probe.h>
+
+void nrf_latency_probe_reset(struct nrf_latency_probe *probe)
+{
+	/* Resetting is not atomic with respect to concurrent recording.
+	 * A sample recorded while the probe is reset may be partially
+	 * accounted, which is acceptable for statistics.
+	 */
+	for (size_t i = 0; i < NRF_LATENCY_PROBE_BUCKET_COUNT; i++) {
+		atomic_set(&probe->buckets[i], 0);
+	}
+	atomic_set(&probe->count, 0);
+	atomic_set(&probe->max_cycles, 0);
+}
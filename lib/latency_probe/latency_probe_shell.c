@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/shell/shell.h>
+#include <nrf_latency_probe.h>
+
+static struct nrf_latency_probe *probe_find(const char *name)
+{
+	STRUCT_SECTION_FOREACH(nrf_latency_probe, probe) {
+		if (strcmp(probe->name, name) == 0) {
+			return probe;
+		}
+	}
+
+	return NULL;
+}
+
+static int cmd_list(const struct shell *shell, size_t argc, char **argv)
+{
+	shell_fprintf(shell, SHELL_NORMAL, "%-32s %10s %12s\n",
+		      "PROBE", "COUNT", "MAX CYCLES");
+	STRUCT_SECTION_FOREACH(nrf_latency_probe, probe) {
+		shell_fprintf(shell, SHELL_NORMAL, "%-32s %10ld %12ld\n",
+			      probe->name, atomic_get(&probe->count),
+			      atomic_get(&probe->max_cycles));
+	}
+
+	return 0;
+}
+
+static int cmd_hist(const struct shell *shell, size_t argc, char **argv)
+{
+	struct nrf_latency_probe *probe = probe_find(argv[1]);
+
+	if (probe == NULL) {
+		shell_error(shell, "Unknown probe: %s", argv[1]);
+		return -ENOEXEC;
+	}
+
+	shell_fprintf(shell, SHELL_NORMAL, "%s: %ld samples, max %ld cycles\n",
+		      probe->name, atomic_get(&probe->count),
+		      atomic_get(&probe->max_cycles));
+	for (size_t i = 0; i < NRF_LATENCY_PROBE_BUCKET_COUNT; i++) {
+		atomic_val_t cnt = atomic_get(&probe->buckets[i]);
+
+		if (cnt == 0) {
+			continue;
+		}
+		shell_fprintf(shell, SHELL_NORMAL, "< 2^%-2u cycles: %ld\n",
+			      (unsigned int)i, cnt);
+	}
+
+	return 0;
+}
+
+static int cmd_reset(const struct shell *shell, size_t argc, char **argv)
+{
+	if (argc == 1) {
+		STRUCT_SECTION_FOREACH(nrf_latency_probe, probe) {
+			nrf_latency_probe_reset(probe);
+		}
+		return 0;
+	}
+
+	struct nrf_latency_probe *probe = probe_find(argv[1]);
+
+	if (probe == NULL) {
+		shell_error(shell, "Unknown probe: %s", argv[1]);
+		return -ENOEXEC;
+	}
+	nrf_latency_probe_reset(probe);
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_latency_probe,
+	SHELL_CMD_ARG(list, NULL, "List the latency probes", cmd_list, 1, 0),
+	SHELL_CMD_ARG(hist, NULL, "Display the histogram of a probe", cmd_hist, 2, 0),
+	SHELL_CMD_ARG(reset, NULL, "Reset one or all probes", cmd_reset, 1, 1),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_CMD_REGISTER(latency_probe, &sub_latency_probe,
+		   "Latency probe commands", NULL);
@@ -17,6 +17,9 @@
 
 #include "location_core.h"
 #include "location_utils.h"
+#if defined(CONFIG_LOCATION_ASSISTANCE_PREFETCH)
+#include "method_gnss.h"
+#endif
 
 LOG_MODULE_REGISTER(location, CONFIG_LOCATION_LOG_LEVEL);
 
@@ -398,3 +401,18 @@ void location_cloud_location_ext_result_set(
 	location_core_cloud_location_ext_result_set(result, location);
 #endif
 }
+
+int location_assistance_prefetch(void)
+{
+#if defined(CONFIG_LOCATION_ASSISTANCE_PREFETCH)
+	if (!initialized) {
+		LOG_ERR("Location library not initialized when calling %s", __func__);
+		return -EPERM;
+	}
+
+	method_gnss_assistance_prefetch();
+
+	return 0;
+#endif /* CONFIG_LOCATION_ASSISTANCE_PREFETCH */
+	return -ENOTSUP;
+}
@@ -325,6 +325,19 @@ static void location_core_current_config_set(const struct location_config *confi
 	memcpy(&loc_req_info.config, config, sizeof(loc_req_info.config));
 }
 
+#if defined(CONFIG_LOCATION_SERVICE_EXTERNAL) || defined(CONFIG_LOCATION_SCAN_PREFETCH)
+static bool location_core_is_cloud_method(int method)
+{
+	if (method == LOCATION_METHOD_CELLULAR ||
+	    method == LOCATION_METHOD_WIFI ||
+	    method == LOCATION_METHOD_WIFI_CELLULAR) {
+		return true;
+	}
+
+	return false;
+}
+#endif
+
 static int location_core_location_get_pos(void)
 {
 	int err;
@@ -355,6 +368,20 @@ static int location_core_location_get_pos(void)
 		location_utils_event_dispatch(&request_started);
 	}
 
+#if defined(CONFIG_LOCATION_SCAN_PREFETCH)
+	if (requested_method == LOCATION_METHOD_GNSS &&
+	    loc_req_info.config.mode == LOCATION_REQ_MODE_FALLBACK) {
+		/* Scan already for the cloud method that GNSS would fall back to */
+		for (int i = 1; i < loc_req_info.methods_count; i++) {
+			if (location_core_is_cloud_method(loc_req_info.methods[i])) {
+				method_cloud_location_prefetch(
+					&loc_req_info, loc_req_info.methods[i]);
+				break;
+			}
+		}
+	}
+#endif
+
 	if (loc_req_info.config.timeout != SYS_FOREVER_MS &&
 	    loc_req_info.config.timeout > 0) {
 		LOG_DBG("Starting request timer with timeout=%d", loc_req_info.config.timeout);
@@ -534,17 +561,6 @@ void location_core_event_cb_cloud_location_request(struct location_data_cloud *r
 	location_utils_event_dispatch(&cloud_location_request_event_data);
 }
 
-static bool location_core_is_cloud_method(int method)
-{
-	if (method == LOCATION_METHOD_CELLULAR ||
-	    method == LOCATION_METHOD_WIFI ||
-	    method == LOCATION_METHOD_WIFI_CELLULAR) {
-		return true;
-	}
-
-	return false;
-}
-
 void location_core_cloud_location_ext_result_set(
 	enum location_ext_result result,
 	struct location_data *location)
@@ -726,6 +742,11 @@ static void location_core_event_cb_fn(struct k_work *work)
 		}
 	}
 
+#if defined(CONFIG_LOCATION_SCAN_PREFETCH)
+	/* The request is finishing, stop the prefetched scans if they are still running */
+	method_cloud_location_prefetch_cancel();
+#endif
+
 	location_utils_event_dispatch(&loc_req_info.current_event_data);
 
 	k_work_cancel_delayable(&location_core_timeout_work);
@@ -854,6 +875,10 @@ int location_core_cancel(void)
 		LOG_DBG("No location request pending so not cancelling anything");
 	}
 
+#if defined(CONFIG_LOCATION_SCAN_PREFETCH)
+	method_cloud_location_prefetch_cancel();
+#endif
+
 	location_core_current_config_clear();
 
 	k_sem_give(&location_core_sem);
@@ -47,6 +47,125 @@ static bool running;
 static K_SEM_DEFINE(wifi_scan_ready, 0, 1);
 #endif
 
+#if defined(CONFIG_LOCATION_SCAN_PREFETCH)
+/* Same priority as the location library work queue. The scans cannot run in the library
+ * work queue because the GNSS method runs its tasks there while the scans are ongoing.
+ */
+#define PREFETCH_WORK_QUEUE_PRIORITY 5
+
+K_THREAD_STACK_DEFINE(method_cloud_location_prefetch_stack,
+		      CONFIG_LOCATION_SCAN_PREFETCH_STACK_SIZE);
+
+/** Work queue for the scans prefetched during GNSS positioning. */
+static struct k_work_q method_cloud_location_prefetch_work_q;
+
+/** Work item for running the prefetched scans. */
+static struct method_cloud_location_start_work_args method_cloud_location_prefetch_work;
+
+/** Semaphore indicating that the prefetched scans have finished. */
+static K_SEM_DEFINE(prefetch_done, 0, 1);
+
+/** Whether prefetched scan results are available for the ongoing location request. */
+static bool prefetch_valid;
+
+static void method_cloud_location_prefetch_work_fn(struct k_work *work)
+{
+	struct method_cloud_location_start_work_args *work_data =
+		CONTAINER_OF(work, struct method_cloud_location_start_work_args, work_item);
+
+#if defined(CONFIG_LOCATION_METHOD_WIFI)
+	k_sem_reset(&wifi_scan_ready);
+
+	if (work_data->wifi_config != NULL) {
+		scan_wifi_execute(work_data->wifi_config->timeout, &wifi_scan_ready);
+	}
+#endif
+
+#if defined(CONFIG_LOCATION_METHOD_CELLULAR)
+	if (work_data->cell_config != NULL) {
+		scan_cellular_execute(
+			work_data->cell_config->timeout,
+			work_data->cell_config->cell_count);
+	}
+#endif
+
+#if defined(CONFIG_LOCATION_METHOD_WIFI)
+	if (work_data->wifi_config != NULL) {
+		k_sem_take(&wifi_scan_ready, K_FOREVER);
+	}
+#endif
+
+	k_sem_give(&prefetch_done);
+}
+
+void method_cloud_location_prefetch(const struct location_request_info *request,
+				    enum location_method method)
+{
+	/* Select configurations based on the method GNSS would fall back to */
+	method_cloud_location_prefetch_work.wifi_config = NULL;
+	method_cloud_location_prefetch_work.cell_config = NULL;
+	if (method == LOCATION_METHOD_CELLULAR || method == LOCATION_METHOD_WIFI_CELLULAR) {
+		method_cloud_location_prefetch_work.cell_config = request->cellular;
+	}
+	if (method == LOCATION_METHOD_WIFI || method == LOCATION_METHOD_WIFI_CELLULAR) {
+		method_cloud_location_prefetch_work.wifi_config = request->wifi;
+	}
+
+	LOG_DBG("Starting scans while GNSS positioning is ongoing");
+
+	k_sem_reset(&prefetch_done);
+	prefetch_valid = true;
+
+	k_work_submit_to_queue(
+		&method_cloud_location_prefetch_work_q,
+		&method_cloud_location_prefetch_work.work_item);
+}
+
+void method_cloud_location_prefetch_cancel(void)
+{
+	if (!prefetch_valid) {
+		return;
+	}
+
+	prefetch_valid = false;
+
+	if (k_work_cancel(&method_cloud_location_prefetch_work.work_item) == 0) {
+		/* The work item already ran to completion, nothing to cancel */
+		return;
+	}
+
+	/* Cancel the scans so that the prefetch work item can finish */
+#if defined(CONFIG_LOCATION_METHOD_WIFI)
+	scan_wifi_cancel();
+#endif
+#if defined(CONFIG_LOCATION_METHOD_CELLULAR)
+	scan_cellular_cancel();
+#endif
+}
+
+/**
+ * Wait for the prefetched scans if they were started with the same configurations.
+ *
+ * @return Whether the prefetched scan results can be used instead of running the scans.
+ */
+static bool method_cloud_location_prefetch_results_wait(
+	struct method_cloud_location_start_work_args *work_data)
+{
+	if (!prefetch_valid ||
+	    method_cloud_location_prefetch_work.wifi_config != work_data->wifi_config ||
+	    method_cloud_location_prefetch_work.cell_config != work_data->cell_config) {
+		return false;
+	}
+
+	LOG_DBG("Waiting for the scans started during GNSS positioning");
+
+	k_sem_take(&prefetch_done, K_FOREVER);
+	prefetch_valid = false;
+
+	return true;
+}
+#endif /* CONFIG_LOCATION_SCAN_PREFETCH */
+
 static void method_cloud_location_positioning_work_fn(struct k_work *work)
 {
 	struct method_cloud_location_start_work_args *work_data =
@@ -61,6 +180,12 @@ static void method_cloud_location_positioning_work_fn(struct k_work *work)
 	struct lte_lc_cells_info *scan_cellular_info = NULL;
 	int err = 0;
 
+#if defined(CONFIG_LOCATION_SCAN_PREFETCH)
+	if (method_cloud_location_prefetch_results_wait(work_data)) {
+		goto scans_done;
+	}
+#endif
+
 #if defined(CONFIG_LOCATION_METHOD_WIFI)
 	k_sem_reset(&wifi_scan_ready);
 
@@ -72,13 +197,26 @@ static void method_cloud_location_positioning_work_fn(struct k_work *work)
 #if defined(CONFIG_LOCATION_METHOD_CELLULAR)
 	if (cell_config != NULL) {
 		scan_cellular_execute(cell_config->timeout, cell_config->cell_count);
-		scan_cellular_info = scan_cellular_results_get();
 	}
 #endif
 
 #if defined(CONFIG_LOCATION_METHOD_WIFI)
 	if (wifi_config != NULL) {
 		k_sem_take(&wifi_scan_ready, K_FOREVER);
+	}
+#endif
+
+#if defined(CONFIG_LOCATION_SCAN_PREFETCH)
+scans_done:
+#endif
+#if defined(CONFIG_LOCATION_METHOD_CELLULAR)
+	if (cell_config != NULL) {
+		scan_cellular_info = scan_cellular_results_get();
+	}
+#endif
+
+#if defined(CONFIG_LOCATION_METHOD_WIFI)
+	if (wifi_config != NULL) {
 		scan_wifi_info = scan_wifi_results_get();
 	}
 #endif
@@ -224,5 +362,31 @@ int method_cloud_location_init(void)
 {
 	running = false;
 
+#if defined(CONFIG_LOCATION_SCAN_PREFETCH)
+	/* A failing method init makes location_core_init() run the method inits again,
+	 * but starting an already started work queue a second time is not allowed.
+	 */
+	static bool prefetch_work_q_started;
+
+	k_work_init(
+		&method_cloud_location_prefetch_work.work_item,
+		method_cloud_location_prefetch_work_fn);
+
+	if (!prefetch_work_q_started) {
+		struct k_work_queue_config cfg = {
+			.name = "location_prefetch_workq",
+		};
+
+		k_work_queue_start(
+			&method_cloud_location_prefetch_work_q,
+			method_cloud_location_prefetch_stack,
+			K_THREAD_STACK_SIZEOF(method_cloud_location_prefetch_stack),
+			PREFETCH_WORK_QUEUE_PRIORITY,
+			&cfg);
+
+		prefetch_work_q_started = true;
+	}
+#endif
+
 	return 0;
 }
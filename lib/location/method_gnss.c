@@ -87,6 +87,9 @@ BUILD_ASSERT(
 static struct k_work method_gnss_prepare_work;
 static struct k_work method_gnss_start_work;
 static struct k_work method_gnss_pvt_work;
+#if defined(CONFIG_LOCATION_ASSISTANCE_PREFETCH)
+static struct k_work method_gnss_prefetch_work;
+#endif
 
 #if defined(CONFIG_NRF_CLOUD_AGNSS)
 static int64_t agnss_req_timestamp;
@@ -1224,6 +1227,31 @@ static void method_gnss_prepare_work_fn(struct k_work *work)
 	k_work_submit_to_queue(location_core_work_queue_get(), &method_gnss_start_work);
 }
 
+#if defined(CONFIG_LOCATION_ASSISTANCE_PREFETCH)
+static void method_gnss_prefetch_work_fn(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	if (running) {
+		/* An ongoing location request handles the assistance data need. */
+		LOG_DBG("Location request ongoing, skipping assistance prefetch");
+		return;
+	}
+
+#if defined(CONFIG_NRF_CLOUD_PGPS)
+	method_gnss_pgps_init();
+#endif
+
+	method_gnss_assistance_data_need_get();
+	method_gnss_assistance_request();
+}
+
+void method_gnss_assistance_prefetch(void)
+{
+	k_work_submit_to_queue(location_core_work_queue_get(), &method_gnss_prefetch_work);
+}
+#endif /* CONFIG_LOCATION_ASSISTANCE_PREFETCH */
+
 static void method_gnss_start_work_fn(struct k_work *work)
 {
 	int err = 0;
@@ -1342,6 +1370,9 @@ int method_gnss_init(void)
 	k_work_init(&method_gnss_pvt_work, method_gnss_pvt_work_fn);
 	k_work_init(&method_gnss_prepare_work, method_gnss_prepare_work_fn);
 	k_work_init(&method_gnss_start_work, method_gnss_start_work_fn);
+#if defined(CONFIG_LOCATION_ASSISTANCE_PREFETCH)
+	k_work_init(&method_gnss_prefetch_work, method_gnss_prefetch_work_fn);
+#endif
 
 #if defined(CONFIG_NRF_CLOUD_PGPS)
 #if defined(CONFIG_LOCATION_SERVICE_EXTERNAL)
@@ -14,5 +14,8 @@ int method_gnss_timeout(void);
 #if defined(CONFIG_LOCATION_DATA_DETAILS)
 void method_gnss_details_get(struct location_data_details *details);
 #endif
+#if defined(CONFIG_LOCATION_ASSISTANCE_PREFETCH)
+void method_gnss_assistance_prefetch(void);
+#endif
 
 #endif /* METHOD_GNSS_H */
@@ -5,6 +5,7 @@
  */
 
 #include <stdio.h>
+#include <string.h>
 #include <zephyr/kernel.h>
 #include <zephyr/device.h>
 #include <zephyr/logging/log.h>
@@ -186,6 +187,26 @@ static void scan_wifi_result_handle(struct net_mgmt_event_callback *cb)
 {
 	const struct wifi_scan_result *entry = (const struct wifi_scan_result *)cb->info;
 	struct wifi_scan_result *current;
+	struct wifi_scan_result *weakest = NULL;
+
+	/* The same AP can be reported more than once, for example when it is
+	 * seen on several channels. Keep the strongest observation only.
+	 */
+	for (int i = 0; i < scan_wifi_info.cnt; i++) {
+		current = &scan_wifi_info.ap_info[i];
+
+		if (current->mac_length == entry->mac_length &&
+		    memcmp(current->mac, entry->mac, entry->mac_length) == 0) {
+			if (entry->rssi > current->rssi) {
+				*current = *entry;
+			}
+			return;
+		}
+
+		if (weakest == NULL || current->rssi < weakest->rssi) {
+			weakest = current;
+		}
+	}
 
 	if (scan_wifi_info.cnt < CONFIG_LOCATION_METHOD_WIFI_SCANNING_RESULTS_MAX_CNT) {
 		current = &scan_wifi_info.ap_info[scan_wifi_info.cnt];
@@ -199,6 +220,17 @@ static void scan_wifi_result_handle(struct net_mgmt_event_callback *cb)
 				current->channel,
 				current->mac[0], current->mac[1], current->mac[2],
 				current->mac[3], current->mac[4], current->mac[5]);
+	} else if (weakest != NULL && entry->rssi > weakest->rssi) {
+		/* Buffer full: replace the weakest stored AP so that the
+		 * strongest APs are kept without buffering the full scan set.
+		 */
+		LOG_DBG("scan result buffer full - replacing the weakest AP "
+			"(rssi %d) with mac %02x:%02x:%02x:%02x:%02x:%02x (rssi %d)",
+				weakest->rssi,
+				entry->mac[0], entry->mac[1], entry->mac[2],
+				entry->mac[3], entry->mac[4], entry->mac[5],
+				entry->rssi);
+		*weakest = *entry;
 	} else {
 		LOG_WRN("Scanning result (mac %02x:%02x:%02x:%02x:%02x:%02x) "
 			"did not fit to result buffer - dropping it",
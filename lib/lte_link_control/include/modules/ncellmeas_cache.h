@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef NCELLMEAS_CACHE_H__
+#define NCELLMEAS_CACHE_H__
+
+#include <modem/lte_lc.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Store a completed neighbor cell measurement. GCI search types are not cached. */
+void ncellmeas_cache_update(enum lte_lc_neighbor_search_type search_type,
+			    const struct lte_lc_cells_info *cells);
+
+/* Serve a neighbor cell measurement request from the cache.
+ *
+ * If the cache holds a recent enough measurement of an equal or more thorough
+ * search type, an LTE_LC_EVT_NEIGHBOR_CELL_MEAS event with the cached result is
+ * dispatched from the work queue and true is returned. Otherwise false is
+ * returned and the caller starts a measurement in the modem.
+ */
+bool ncellmeas_cache_serve(const struct lte_lc_ncellmeas_params *params);
+
+/* Drop the cached measurement, for example when the serving cell has changed. */
+void ncellmeas_cache_invalidate(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NCELLMEAS_CACHE_H__ */
@@ -19,6 +19,7 @@
 #include "common/event_handler_list.h"
 #include "modules/cereg.h"
 #include "modules/cfun.h"
+#include "modules/ncellmeas_cache.h"
 #include "modules/psm.h"
 
 LOG_MODULE_DECLARE(lte_lc, CONFIG_LTE_LINK_CONTROL_LOG_LEVEL);
@@ -305,6 +306,13 @@ static void at_handler_cereg(const char *response)
 		memcpy(&prev_cell, &cell, sizeof(struct lte_lc_cell));
 		memcpy(&evt.cell, &cell, sizeof(struct lte_lc_cell));
 		event_handler_list_dispatch(&evt);
+
+		if (IS_ENABLED(CONFIG_LTE_LC_NCELLMEAS_CACHE_MODULE)) {
+			/* A cached neighbor cell measurement is no longer
+			 * representative when the serving cell changes.
+			 */
+			ncellmeas_cache_invalidate();
+		}
 	}
 
 	if (lte_mode != prev_lte_mode) {
@@ -18,6 +18,7 @@
 #include "common/event_handler_list.h"
 #include "common/helpers.h"
 #include "modules/ncellmeas.h"
+#include "modules/ncellmeas_cache.h"
 
 LOG_MODULE_DECLARE(lte_lc, CONFIG_LTE_LINK_CONTROL_LOG_LEVEL);
 
@@ -726,6 +727,10 @@ static void at_handler_ncellmeas(const char *response)
 
 	err = parse_ncellmeas(response, &evt.cells_info);
 
+	if (IS_ENABLED(CONFIG_LTE_LC_NCELLMEAS_CACHE_MODULE) && err == 0) {
+		ncellmeas_cache_update(ncellmeas_params.search_type, &evt.cells_info);
+	}
+
 	switch (err) {
 	case -E2BIG:
 		LOG_WRN("Not all neighbor cells could be parsed");
@@ -780,6 +785,13 @@ int ncellmeas_start(struct lte_lc_ncellmeas_params *params)
 		}
 	}
 
+	if (IS_ENABLED(CONFIG_LTE_LC_NCELLMEAS_CACHE_MODULE) && ncellmeas_cache_serve(params)) {
+		/* A recent enough measurement is dispatched from the cache
+		 * without starting a new search in the modem.
+		 */
+		return 0;
+	}
+
 	if (k_sem_take(&ncellmeas_idle_sem, K_SECONDS(1)) != 0) {
 		LOG_WRN("Neighbor cell measurement already in progress");
 		return -EINPROGRESS;
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <modem/lte_lc.h>
+
+#include "common/work_q.h"
+#include "common/event_handler_list.h"
+#include "modules/ncellmeas_cache.h"
+
+LOG_MODULE_DECLARE(lte_lc, CONFIG_LTE_LINK_CONTROL_LOG_LEVEL);
+
+/* Most recently completed neighbor cell measurement. */
+static struct {
+	/* Indicates whether the cache holds a measurement. */
+	bool valid;
+	/* Uptime when the measurement was stored. */
+	int64_t timestamp;
+	/* Search type of the stored measurement. */
+	enum lte_lc_neighbor_search_type search_type;
+	/* Stored measurement. The neighbor cell pointer refers to neighbor_cells below. */
+	struct lte_lc_cells_info cells_info;
+	struct lte_lc_ncell neighbor_cells[CONFIG_LTE_NEIGHBOR_CELLS_MAX];
+} cache;
+
+static K_MUTEX_DEFINE(cache_mutex);
+
+static void cache_dispatch_work_fn(struct k_work *work)
+{
+	struct lte_lc_evt evt = {0};
+
+	ARG_UNUSED(work);
+
+	k_mutex_lock(&cache_mutex, K_FOREVER);
+
+	if (cache.valid) {
+		evt.type = LTE_LC_EVT_NEIGHBOR_CELL_MEAS;
+		evt.cells_info = cache.cells_info;
+		event_handler_list_dispatch(&evt);
+	}
+
+	k_mutex_unlock(&cache_mutex);
+}
+
+static K_WORK_DEFINE(cache_dispatch_work, cache_dispatch_work_fn);
+
+void ncellmeas_cache_update(enum lte_lc_neighbor_search_type search_type,
+			    const struct lte_lc_cells_info *cells)
+{
+	if (search_type > LTE_LC_NEIGHBOR_SEARCH_TYPE_EXTENDED_COMPLETE) {
+		/* GCI measurements are not cached. */
+		return;
+	}
+
+	if (cells->current_cell.id == LTE_LC_CELL_EUTRAN_ID_INVALID ||
+	    cells->ncells_count > CONFIG_LTE_NEIGHBOR_CELLS_MAX) {
+		/* No serving cell information, so the measurement is not
+		 * useful as a basis for serving later requests.
+		 */
+		return;
+	}
+
+	k_mutex_lock(&cache_mutex, K_FOREVER);
+
+	cache.search_type = search_type;
+	cache.cells_info = *cells;
+	if (cells->ncells_count > 0) {
+		memcpy(cache.neighbor_cells, cells->neighbor_cells,
+		       cells->ncells_count * sizeof(struct lte_lc_ncell));
+		cache.cells_info.neighbor_cells = cache.neighbor_cells;
+	} else {
+		cache.cells_info.neighbor_cells = NULL;
+	}
+	cache.cells_info.gci_cells = NULL;
+	cache.cells_info.gci_cells_count = 0;
+	cache.timestamp = k_uptime_get();
+	cache.valid = true;
+
+	k_mutex_unlock(&cache_mutex);
+
+	LOG_DBG("Cached neighbor cell measurement, neighbor cell count: %d", cells->ncells_count);
+}
+
+bool ncellmeas_cache_serve(const struct lte_lc_ncellmeas_params *params)
+{
+	enum lte_lc_neighbor_search_type search_type =
+		params != NULL ? params->search_type : LTE_LC_NEIGHBOR_SEARCH_TYPE_DEFAULT;
+	bool served = false;
+
+	if (search_type > LTE_LC_NEIGHBOR_SEARCH_TYPE_EXTENDED_COMPLETE) {
+		/* GCI measurements are always performed in the modem. */
+		return false;
+	}
+
+	k_mutex_lock(&cache_mutex, K_FOREVER);
+
+	if (cache.valid && search_type <= cache.search_type &&
+	    (k_uptime_get() - cache.timestamp <
+	     CONFIG_LTE_LC_NCELLMEAS_CACHE_MAX_AGE_SEC * MSEC_PER_SEC)) {
+		served = true;
+		k_work_submit_to_queue(work_q_get(), &cache_dispatch_work);
+	}
+
+	k_mutex_unlock(&cache_mutex);
+
+	if (served) {
+		LOG_DBG("Serving neighbor cell measurement from cache");
+	}
+
+	return served;
+}
+
+void ncellmeas_cache_invalidate(void)
+{
+	k_mutex_lock(&cache_mutex, K_FOREVER);
+	cache.valid = false;
+	k_mutex_unlock(&cache_mutex);
+}
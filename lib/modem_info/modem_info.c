@@ -16,6 +16,7 @@
 #include <zephyr/toolchain.h>
 #include <stdint.h>
 #include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include <zephyr/kernel.h>
 #include <zephyr/types.h>
@@ -76,6 +77,12 @@ LOG_MODULE_REGISTER(modem_info);
 #define RSRP_NOTIFY_PARAM_INDEX	1
 #define RSRP_NOTIFY_PARAM_COUNT	5
 
+#define RSRQ_NOTIFY_PARAM_INDEX	3
+
+#define CEREG_STATUS_PARAM_INDEX	1
+#define CEREG_TAC_PARAM_INDEX		2
+#define CEREG_CELLID_PARAM_INDEX	3
+
 #define RSRP_PARAM_INDEX	6
 #define RSRP_PARAM_COUNT	7
 
@@ -134,6 +141,12 @@ LOG_MODULE_REGISTER(modem_info);
 #define CELL_RSRP_INVALID	255
 #define CELL_RSRQ_INVALID	255
 
+#define CELL_TAC_INVALID	0xFFFEU
+#define CELL_ID_INVALID		0xFFFFFFFFU
+
+/* TAC and cell ID are reported as hexadecimal strings of up to 8 characters */
+#define CEREG_HEX_PARAM_SIZE	9
+
 /* FW UUID is 36 characters: XXXXXXXX-XXXX-XXXX-XXXX-XXXXXXXXXXXX */
 #define FW_UUID_SIZE 37
 
@@ -716,6 +729,200 @@ int modem_info_rsrp_register(rsrp_cb_t cb)
 	return 0;
 }
 
+#if defined(CONFIG_MODEM_INFO_CACHE)
+
+AT_MONITOR(modem_info_cache_cesq_mon, "%CESQ", modem_info_cache_cesq_handler, PAUSED);
+AT_MONITOR(modem_info_cache_cereg_mon, "+CEREG", modem_info_cache_cereg_handler, PAUSED);
+
+static struct modem_info_snapshot snapshot_data;
+static bool snapshot_enabled;
+static K_MUTEX_DEFINE(snapshot_mutex);
+
+static void modem_info_cache_cesq_handler(const char *notif)
+{
+	int err;
+	uint16_t rsrp_idx;
+	uint16_t rsrq_idx;
+	struct at_parser parser;
+
+	err = at_parser_init(&parser, notif);
+	__ASSERT_NO_MSG(err == 0);
+
+	err = at_parser_num_get(&parser, RSRP_NOTIFY_PARAM_INDEX, &rsrp_idx);
+	if (err != 0) {
+		LOG_ERR("Failed to obtain RSRP value, %d", err);
+		return;
+	}
+
+	err = at_parser_num_get(&parser, RSRQ_NOTIFY_PARAM_INDEX, &rsrq_idx);
+	if (err != 0) {
+		LOG_ERR("Failed to obtain RSRQ value, %d", err);
+		return;
+	}
+
+	k_mutex_lock(&snapshot_mutex, K_FOREVER);
+
+	snapshot_data.rsrp_valid = (rsrp_idx != CELL_RSRP_INVALID);
+	if (snapshot_data.rsrp_valid) {
+		snapshot_data.rsrp_dbm = RSRP_IDX_TO_DBM(rsrp_idx);
+	}
+
+	snapshot_data.rsrq_valid = (rsrq_idx != CELL_RSRQ_INVALID);
+	if (snapshot_data.rsrq_valid) {
+		snapshot_data.rsrq_db = RSRQ_IDX_TO_DB(rsrq_idx);
+	}
+
+	snapshot_data.signal_uptime = k_uptime_get();
+
+	k_mutex_unlock(&snapshot_mutex);
+}
+
+static void modem_info_cache_cereg_handler(const char *notif)
+{
+	int err;
+	uint16_t status;
+	uint32_t area_code = CELL_TAC_INVALID;
+	uint32_t cell_id = CELL_ID_INVALID;
+	char hex_buf[CEREG_HEX_PARAM_SIZE];
+	size_t len;
+	struct at_parser parser;
+
+	err = at_parser_init(&parser, notif);
+	__ASSERT_NO_MSG(err == 0);
+
+	err = at_parser_num_get(&parser, CEREG_STATUS_PARAM_INDEX, &status);
+	if (err != 0) {
+		LOG_ERR("Failed to obtain registration status, %d", err);
+		return;
+	}
+
+	/* The TAC and cell ID are omitted from the notification when unknown */
+	len = sizeof(hex_buf) - 1;
+	err = at_parser_string_get(&parser, CEREG_TAC_PARAM_INDEX, hex_buf, &len);
+	if (err == 0) {
+		hex_buf[len] = '\0';
+		area_code = strtoul(hex_buf, NULL, 16);
+	}
+
+	len = sizeof(hex_buf) - 1;
+	err = at_parser_string_get(&parser, CEREG_CELLID_PARAM_INDEX, hex_buf, &len);
+	if (err == 0) {
+		hex_buf[len] = '\0';
+		cell_id = strtoul(hex_buf, NULL, 16);
+	}
+
+	k_mutex_lock(&snapshot_mutex, K_FOREVER);
+
+	snapshot_data.reg_status = status;
+	snapshot_data.cell_valid =
+		(area_code != CELL_TAC_INVALID) && (cell_id != CELL_ID_INVALID);
+	if (snapshot_data.cell_valid) {
+		snapshot_data.area_code = area_code;
+		snapshot_data.cell_id = cell_id;
+	}
+
+	snapshot_data.cell_uptime = k_uptime_get();
+
+	k_mutex_unlock(&snapshot_mutex);
+}
+
+/* Serve the RSRP from the snapshot, or -EAGAIN if the snapshot cannot serve it */
+static int snapshot_rsrp_get(int *val)
+{
+	int err = 0;
+
+	k_mutex_lock(&snapshot_mutex, K_FOREVER);
+
+	if (!snapshot_enabled || snapshot_data.signal_uptime == 0) {
+		err = -EAGAIN;
+	} else if (!snapshot_data.rsrp_valid) {
+		err = -ENOENT;
+	} else {
+		*val = snapshot_data.rsrp_dbm;
+	}
+
+	k_mutex_unlock(&snapshot_mutex);
+
+	return err;
+}
+
+/* Serve the RSRQ from the snapshot, or -EAGAIN if the snapshot cannot serve it */
+static int snapshot_rsrq_get(float *val)
+{
+	int err = 0;
+
+	k_mutex_lock(&snapshot_mutex, K_FOREVER);
+
+	if (!snapshot_enabled || snapshot_data.signal_uptime == 0) {
+		err = -EAGAIN;
+	} else if (!snapshot_data.rsrq_valid) {
+		err = -ENOENT;
+	} else {
+		*val = snapshot_data.rsrq_db;
+	}
+
+	k_mutex_unlock(&snapshot_mutex);
+
+	return err;
+}
+
+int modem_info_snapshot_enable(void)
+{
+	at_monitor_resume(&modem_info_cache_cereg_mon);
+	at_monitor_resume(&modem_info_cache_cesq_mon);
+
+	if (nrf_modem_at_printf("AT%%CESQ=1") != 0) {
+		at_monitor_pause(&modem_info_cache_cesq_mon);
+		at_monitor_pause(&modem_info_cache_cereg_mon);
+		return -EIO;
+	}
+
+	k_mutex_lock(&snapshot_mutex, K_FOREVER);
+	snapshot_enabled = true;
+	k_mutex_unlock(&snapshot_mutex);
+
+	return 0;
+}
+
+int modem_info_snapshot_disable(void)
+{
+	at_monitor_pause(&modem_info_cache_cesq_mon);
+	at_monitor_pause(&modem_info_cache_cereg_mon);
+
+	if (nrf_modem_at_printf("AT%%CESQ=0") != 0) {
+		return -EIO;
+	}
+
+	k_mutex_lock(&snapshot_mutex, K_FOREVER);
+	snapshot_enabled = false;
+	memset(&snapshot_data, 0, sizeof(snapshot_data));
+	k_mutex_unlock(&snapshot_mutex);
+
+	return 0;
+}
+
+int modem_info_snapshot_get(struct modem_info_snapshot *snapshot)
+{
+	if (snapshot == NULL) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&snapshot_mutex, K_FOREVER);
+
+	if (!snapshot_enabled) {
+		k_mutex_unlock(&snapshot_mutex);
+		return -EPERM;
+	}
+
+	memcpy(snapshot, &snapshot_data, sizeof(*snapshot));
+
+	k_mutex_unlock(&snapshot_mutex);
+
+	return 0;
+}
+
+#endif /* CONFIG_MODEM_INFO_CACHE */
+
 int modem_info_connectivity_stats_init(void)
 {
 	int err = nrf_modem_at_printf("AT%%XCONNSTAT=1");
@@ -867,6 +1074,16 @@ int modem_info_get_rsrp(int *val)
 		return -EINVAL;
 	}
 
+#if defined(CONFIG_MODEM_INFO_CACHE)
+	ret = snapshot_rsrp_get(val);
+	if (ret != -EAGAIN) {
+		if (ret == -ENOENT) {
+			LOG_WRN("No valid RSRP");
+		}
+		return ret;
+	}
+#endif
+
 	ret = nrf_modem_at_scanf("AT+CESQ",
 				 "+CESQ: %*d,%*d,%*d,%*d,%*d,%d", val);
 
@@ -893,6 +1110,16 @@ int modem_info_get_rsrq(float *val)
 		return -EINVAL;
 	}
 
+#if defined(CONFIG_MODEM_INFO_CACHE)
+	ret = snapshot_rsrq_get(val);
+	if (ret != -EAGAIN) {
+		if (ret == -ENOENT) {
+			LOG_WRN("No valid RSRQ");
+		}
+		return ret;
+	}
+#endif
+
 	ret = nrf_modem_at_scanf("AT+CESQ",
 				 "+CESQ: %*d,%*d,%*d,%*d,%d,%*d", &rsrq_idx);
 
@@ -88,12 +88,20 @@ int modem_jwt_generate(struct jwt_data *const jwt)
 
 	int ret;
 	char *cmd_resp;
+	bool heap_resp = !(jwt->jwt_buf && (jwt->jwt_sz >= CONFIG_MODEM_JWT_MAX_LEN));
 
-
-	/* Allocate response buffer */
-	cmd_resp = k_calloc(CONFIG_MODEM_JWT_MAX_LEN, 1);
-	if (!cmd_resp) {
-		return -ENOMEM;
+	if (heap_resp) {
+		/* Allocate response buffer */
+		cmd_resp = k_calloc(CONFIG_MODEM_JWT_MAX_LEN, 1);
+		if (!cmd_resp) {
+			return -ENOMEM;
+		}
+	} else {
+		/* The caller provided buffer is large enough to hold the full
+		 * AT response, so use it directly and skip the allocation.
+		 */
+		cmd_resp = jwt->jwt_buf;
+		memset(cmd_resp, 0, CONFIG_MODEM_JWT_MAX_LEN);
 	}
 
 	if (jwt->sec_tag) {
@@ -142,11 +150,13 @@ cleanup:
 		if (ret == 0) {
 			/* Remove any non-base64url characters */
 			base64_url_format(cmd_resp);
-			memcpy(jwt->jwt_buf, cmd_resp, jwt_sz);
+			if (cmd_resp != jwt->jwt_buf) {
+				memcpy(jwt->jwt_buf, cmd_resp, jwt_sz);
+			}
 		}
 	}
 
-	if (cmd_resp) {
+	if (heap_resp) {
 		k_free(cmd_resp);
 	}
 
@@ -180,6 +180,66 @@ int modem_key_mgmt_write(nrf_sec_tag_t sec_tag,
 	return 0;
 }
 
+int modem_key_mgmt_write_batch(const struct modem_key_mgmt_cred *creds, size_t count)
+{
+	int err;
+	bool cmee_was_enabled;
+	uint8_t digest[MODEM_KEY_MGMT_DIGEST_SIZE];
+
+	if (creds == NULL || count == 0) {
+		return -EINVAL;
+	}
+
+	for (size_t i = 0; i < count; i++) {
+		if (creds[i].buf == NULL || creds[i].len == 0) {
+			return -EINVAL;
+		}
+	}
+
+	k_mutex_lock(&key_mgmt_mutex, K_FOREVER);
+
+	cmee_enable(&cmee_was_enabled);
+
+	err = 0;
+
+	for (size_t i = 0; i < count; i++) {
+		const struct modem_key_mgmt_cred *cred = &creds[i];
+
+		if (cred->digest) {
+			err = digest_fetch(cred->sec_tag, cred->cred_type,
+					   digest, sizeof(digest));
+			if (err == 0 &&
+			    memcmp(digest, cred->digest, sizeof(digest)) == 0) {
+				LOG_DBG("Credential %u, type %d already up to date",
+					cred->sec_tag, cred->cred_type);
+				continue;
+			}
+			if (err && err != -ENOENT) {
+				err = translate_error(err);
+				break;
+			}
+		}
+
+		err = nrf_modem_at_printf("AT%%CMNG=0,%u,%d,\"%.*s\"",
+					  cred->sec_tag, cred->cred_type,
+					  cred->len, (const char *)cred->buf);
+		if (err) {
+			LOG_ERR("Failed to write credential %u, type %d",
+				cred->sec_tag, cred->cred_type);
+			err = translate_error(err);
+			break;
+		}
+	}
+
+	if (!cmee_was_enabled) {
+		cmee_disable();
+	}
+
+	k_mutex_unlock(&key_mgmt_mutex);
+
+	return err;
+}
+
 int modem_key_mgmt_read(nrf_sec_tag_t sec_tag,
 			enum modem_key_mgmt_cred_type cred_type,
 			void *buf, size_t *len)
@@ -289,28 +349,18 @@ out:
 
 #define MODEM_KEY_MGMT_DIGEST_STR_SIZE_WITHOUT_NULL_TERM 64
 
-int modem_key_mgmt_digest(nrf_sec_tag_t sec_tag,
-			  enum modem_key_mgmt_cred_type cred_type,
-			  void *buf, size_t len)
+/* Read the digest of the given credential into the given buffer.
+ * Expects the mutex to be locked and CMEE to be enabled.
+ */
+static int digest_fetch(nrf_sec_tag_t sec_tag,
+			enum modem_key_mgmt_cred_type cred_type,
+			void *buf, size_t len)
 {
 	char cmd[sizeof("AT%CMNG=1,##########,##")];
-	bool cmee_was_enabled;
 	int ret;
 
-	if (buf == NULL) {
-		return -EINVAL;
-	}
-
-	if (len < MODEM_KEY_MGMT_DIGEST_SIZE) {
-		return -ENOMEM;
-	}
-
 	snprintk(cmd, sizeof(cmd), "AT%%CMNG=1,%u,%u", sec_tag, cred_type);
 
-	k_mutex_lock(&key_mgmt_mutex, K_FOREVER);
-
-	cmee_enable(&cmee_was_enabled);
-
 	ret = nrf_modem_at_scanf(
 		cmd,
 		"%%CMNG: "
@@ -319,10 +369,6 @@ int modem_key_mgmt_digest(nrf_sec_tag_t sec_tag,
 		"\"%" STRINGIFY(MODEM_KEY_MGMT_DIGEST_STR_SIZE_WITHOUT_NULL_TERM) "s\"",
 		scratch_buf);
 
-	if (!cmee_was_enabled) {
-		cmee_disable();
-	}
-
 	switch (ret) {
 	case 1:
 		len = hex2bin(scratch_buf, strlen(scratch_buf), buf, len);
@@ -340,6 +386,34 @@ int modem_key_mgmt_digest(nrf_sec_tag_t sec_tag,
 		break;
 	}
 
+	return ret;
+}
+
+int modem_key_mgmt_digest(nrf_sec_tag_t sec_tag,
+			  enum modem_key_mgmt_cred_type cred_type,
+			  void *buf, size_t len)
+{
+	bool cmee_was_enabled;
+	int ret;
+
+	if (buf == NULL) {
+		return -EINVAL;
+	}
+
+	if (len < MODEM_KEY_MGMT_DIGEST_SIZE) {
+		return -ENOMEM;
+	}
+
+	k_mutex_lock(&key_mgmt_mutex, K_FOREVER);
+
+	cmee_enable(&cmee_was_enabled);
+
+	ret = digest_fetch(sec_tag, cred_type, buf, len);
+
+	if (!cmee_was_enabled) {
+		cmee_disable();
+	}
+
 	k_mutex_unlock(&key_mgmt_mutex);
 
 	if (ret) {
@@ -10,6 +10,7 @@
  */
 
 #include <net/nrf_802154_callbacks_dispatcher.h>
+#include "nrf_802154_trace_ring.h"
 #include <errno.h>
 #include <nrf_802154.h>
 #include <nrf_802154_types.h>
@@ -166,6 +167,9 @@ void nrf_802154_received_timestamp_raw(uint8_t *data, int8_t power, uint8_t lqi,
 {
 	const struct nrf_802154_callbacks *cb = active_client_callbacks();
 
+	/* The first byte of a raw frame is the PHR holding the frame length. */
+	nrf_802154_trace_record(NRF_802154_TRACE_RX, data[0], 0);
+
 	if (cb != NULL && cb->received_timestamp_raw != NULL) {
 		cb->received_timestamp_raw(data, power, lqi, time);
 	}
@@ -175,6 +179,8 @@ void nrf_802154_receive_failed(nrf_802154_rx_error_t error, uint32_t id)
 {
 	const struct nrf_802154_callbacks *cb = active_client_callbacks();
 
+	nrf_802154_trace_record(NRF_802154_TRACE_RX_FAILED, 0, (uint8_t)error);
+
 	if (cb != NULL && cb->receive_failed != NULL) {
 		cb->receive_failed(error, id);
 	}
@@ -184,6 +190,8 @@ void nrf_802154_tx_ack_started(const uint8_t *data)
 {
 	const struct nrf_802154_callbacks *cb = active_client_callbacks();
 
+	nrf_802154_trace_record(NRF_802154_TRACE_TX_ACK_STARTED, data[0], 0);
+
 	if (cb != NULL && cb->tx_ack_started != NULL) {
 		cb->tx_ack_started(data);
 	}
@@ -193,6 +201,8 @@ void nrf_802154_transmitted_raw(uint8_t *frame, const nrf_802154_transmit_done_m
 {
 	const struct nrf_802154_callbacks *cb = active_client_callbacks();
 
+	nrf_802154_trace_record(NRF_802154_TRACE_TX, frame[0], 0);
+
 	if (cb != NULL && cb->transmitted_raw != NULL) {
 		cb->transmitted_raw(frame, metadata);
 	}
@@ -203,6 +213,8 @@ void nrf_802154_transmit_failed(uint8_t *frame, nrf_802154_tx_error_t error,
 {
 	const struct nrf_802154_callbacks *cb = active_client_callbacks();
 
+	nrf_802154_trace_record(NRF_802154_TRACE_TX_FAILED, frame[0], (uint8_t)error);
+
 	if (cb != NULL && cb->transmit_failed != NULL) {
 		cb->transmit_failed(frame, error, metadata);
 	}
@@ -212,6 +224,8 @@ void nrf_802154_energy_detected(const nrf_802154_energy_detected_t *result)
 {
 	const struct nrf_802154_callbacks *cb = active_client_callbacks();
 
+	nrf_802154_trace_record(NRF_802154_TRACE_ED, 0, (uint8_t)result->ed_dbm);
+
 	if (cb != NULL && cb->energy_detected != NULL) {
 		cb->energy_detected(result);
 	}
@@ -221,6 +235,8 @@ void nrf_802154_energy_detection_failed(nrf_802154_ed_error_t error)
 {
 	const struct nrf_802154_callbacks *cb = active_client_callbacks();
 
+	nrf_802154_trace_record(NRF_802154_TRACE_ED_FAILED, 0, (uint8_t)error);
+
 	if (cb != NULL && cb->energy_detection_failed != NULL) {
 		cb->energy_detection_failed(error);
 	}
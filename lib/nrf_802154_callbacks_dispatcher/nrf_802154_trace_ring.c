@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "nrf_802154_trace_ring.h"
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+
+#define TRACE_RING_SIZE CONFIG_NRF_802154_CALLBACKS_DISPATCHER_TRACE_BUFFER_SIZE
+
+BUILD_ASSERT((TRACE_RING_SIZE & (TRACE_RING_SIZE - 1)) == 0,
+	     "Trace ring size must be a power of two");
+
+static struct nrf_802154_trace_event trace_ring[TRACE_RING_SIZE];
+static atomic_t trace_event_count;
+
+void nrf_802154_trace_record(uint8_t type, uint16_t length, uint8_t status)
+{
+	/* Claim a slot with a single atomic increment, so concurrent producers never
+	 * write to the same slot. A producer preempted mid-write can leave one torn
+	 * event behind, which is acceptable for diagnostics.
+	 */
+	uint32_t idx = (uint32_t)atomic_inc(&trace_event_count);
+	struct nrf_802154_trace_event *event = &trace_ring[idx & (TRACE_RING_SIZE - 1)];
+
+	event->timestamp = k_cycle_get_32();
+	event->length = length;
+	event->type = type;
+	event->status = status;
+}
+
+#if defined(CONFIG_NRF_802154_CALLBACKS_DISPATCHER_TRACE_SHELL)
+
+#include <string.h>
+#include <zephyr/shell/shell.h>
+
+static const char *trace_event_type_str(uint8_t type)
+{
+	switch (type) {
+	case NRF_802154_TRACE_RX:
+		return "rx";
+	case NRF_802154_TRACE_RX_FAILED:
+		return "rx_failed";
+	case NRF_802154_TRACE_TX_ACK_STARTED:
+		return "tx_ack_started";
+	case NRF_802154_TRACE_TX:
+		return "tx";
+	case NRF_802154_TRACE_TX_FAILED:
+		return "tx_failed";
+	case NRF_802154_TRACE_ED:
+		return "ed";
+	case NRF_802154_TRACE_ED_FAILED:
+		return "ed_failed";
+	default:
+		return "unknown";
+	}
+}
+
+static int cmd_dump(const struct shell *shell, size_t argc, char **argv)
+{
+	/* The ring may be written concurrently while it is drained, so the oldest
+	 * entries can be overwritten during the dump. That is acceptable for
+	 * diagnostics and keeps the producers free of locks.
+	 */
+	uint32_t count = (uint32_t)atomic_get(&trace_event_count);
+	uint32_t start = count > TRACE_RING_SIZE ? count - TRACE_RING_SIZE : 0;
+
+	shell_fprintf(shell, SHELL_NORMAL, "%10s %12s %16s %5s %6s\n",
+		      "EVENT", "CYCLES", "TYPE", "LEN", "STATUS");
+
+	for (uint32_t i = start; i < count; i++) {
+		const struct nrf_802154_trace_event *event = &trace_ring[i & (TRACE_RING_SIZE - 1)];
+
+		shell_fprintf(shell, SHELL_NORMAL, "%10u %12u %16s %5u %6u\n",
+			      i, event->timestamp, trace_event_type_str(event->type),
+			      event->length, event->status);
+	}
+
+	return 0;
+}
+
+static int cmd_reset(const struct shell *shell, size_t argc, char **argv)
+{
+	atomic_set(&trace_event_count, 0);
+	memset(trace_ring, 0, sizeof(trace_ring));
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(nrf_802154_trace_cmds,
+	SHELL_CMD_ARG(dump, NULL, "Dump the recorded packet events", cmd_dump, 1, 0),
+	SHELL_CMD_ARG(reset, NULL, "Discard the recorded packet events", cmd_reset, 1, 0),
+	SHELL_SUBCMD_SET_END);
+
+SHELL_CMD_REGISTER(nrf_802154_trace, &nrf_802154_trace_cmds,
+		   "nRF 802.15.4 packet trace commands", NULL);
+
+#endif /* CONFIG_NRF_802154_CALLBACKS_DISPATCHER_TRACE_SHELL */
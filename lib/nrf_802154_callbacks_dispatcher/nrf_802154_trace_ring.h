@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef NRF_802154_TRACE_RING_H_
+#define NRF_802154_TRACE_RING_H_
+
+/**
+ * @file
+ *   Binary packet-event trace ring for the nRF IEEE802.15.4 radio callbacks.
+ *
+ *   Each dispatched radio callback records one fixed-size event holding the
+ *   timestamp, event type, frame length and status code, but no payload.
+ *   The ring is written lock-free from the radio callback context and can be
+ *   drained with the nrf_802154_trace shell command.
+ */
+
+#include <stdint.h>
+
+#include <zephyr/toolchain.h>
+
+/** Type of a recorded packet event. */
+enum nrf_802154_trace_event_type {
+	NRF_802154_TRACE_RX = 1,
+	NRF_802154_TRACE_RX_FAILED,
+	NRF_802154_TRACE_TX_ACK_STARTED,
+	NRF_802154_TRACE_TX,
+	NRF_802154_TRACE_TX_FAILED,
+	NRF_802154_TRACE_ED,
+	NRF_802154_TRACE_ED_FAILED,
+};
+
+/** Recorded packet event. */
+struct nrf_802154_trace_event {
+	/** Kernel cycle counter value captured when the event was recorded. */
+	uint32_t timestamp;
+	/** Frame length in bytes, or 0 if the event carries no frame. */
+	uint16_t length;
+	/** Event type, see @ref nrf_802154_trace_event_type. */
+	uint8_t type;
+	/** Event specific status code, for example the driver error code. */
+	uint8_t status;
+};
+
+#if defined(CONFIG_NRF_802154_CALLBACKS_DISPATCHER_TRACE)
+
+/**
+ * @brief Record a packet event in the trace ring.
+ *
+ * Safe to call from any context, including the radio callback context.
+ * When the ring is full the oldest event is overwritten.
+ *
+ * @param type Event type.
+ * @param length Frame length in bytes, or 0 if not applicable.
+ * @param status Event specific status code, or 0 if not applicable.
+ */
+void nrf_802154_trace_record(uint8_t type, uint16_t length, uint8_t status);
+
+#else
+
+static inline void nrf_802154_trace_record(uint8_t type, uint16_t length, uint8_t status)
+{
+	ARG_UNUSED(type);
+	ARG_UNUSED(length);
+	ARG_UNUSED(status);
+}
+
+#endif /* CONFIG_NRF_802154_CALLBACKS_DISPATCHER_TRACE */
+
+#endif /* NRF_802154_TRACE_RING_H_ */
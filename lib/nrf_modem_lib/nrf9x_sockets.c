@@ -54,6 +54,15 @@ static struct nrf_sock_ctx {
 	struct k_poll_signal poll; /* poll() signal. */
 	struct socket_ncs_pollcb pollcb; /* Poll callback (owned by the app). */
 	struct socket_ncs_sendcb sendcb; /* Send callback. */
+#if defined(CONFIG_NRF_MODEM_LIB_SEND_COALESCING)
+	bool stream; /* Socket is a stream socket. */
+	bool coalesce; /* Coalescing active (stream socket, TCP_NODELAY off). */
+	size_t staged_len; /* Bytes staged in the coalescing buffer. */
+	int staged_err; /* Deferred flush error, reported on the next send. */
+	uint8_t staged_buf[CONFIG_NRF_MODEM_LIB_SEND_COALESCING_BUF_SIZE];
+	struct k_mutex staged_lock; /* Protects the staging state. */
+	struct k_work_delayable flush_work; /* Delayed flush of staged data. */
+#endif
 } offload_ctx[NRF_MODEM_MAX_SOCKET_COUNT];
 
 static K_MUTEX_DEFINE(ctx_lock);
@@ -94,6 +103,12 @@ static void release_ctx(struct nrf_sock_ctx *ctx)
 	ctx->zvfs_fd = -1;
 	memset(&ctx->pollcb, 0, sizeof(ctx->pollcb));
 	memset(&ctx->sendcb, 0, sizeof(ctx->sendcb));
+#if defined(CONFIG_NRF_MODEM_LIB_SEND_COALESCING)
+	ctx->stream = false;
+	ctx->coalesce = false;
+	ctx->staged_len = 0;
+	ctx->staged_err = 0;
+#endif
 
 	k_mutex_unlock(&ctx_lock);
 }
@@ -109,6 +124,119 @@ static struct nrf_sock_ctx *find_ctx(int fd)
 	return NULL;
 }
 
+#if defined(CONFIG_NRF_MODEM_LIB_SEND_COALESCING)
+/* Flush staged data to the modem. Must be called with `ctx->staged_lock` held.
+ * On failure the unsent remainder is kept for a later attempt and a negative
+ * errno value is returned.
+ */
+static int coalesce_flush_locked(struct nrf_sock_ctx *ctx)
+{
+	ssize_t sent;
+	size_t offset = 0;
+
+	while (offset < ctx->staged_len) {
+		sent = nrf_send(ctx->nrf_fd, ctx->staged_buf + offset,
+				ctx->staged_len - offset, 0);
+		if (sent < 0) {
+			memmove(ctx->staged_buf, ctx->staged_buf + offset,
+				ctx->staged_len - offset);
+			ctx->staged_len -= offset;
+			return -errno;
+		}
+		offset += sent;
+	}
+
+	ctx->staged_len = 0;
+
+	return 0;
+}
+
+static void coalesce_flush_work(struct k_work *work)
+{
+	struct k_work_delayable *dwork = k_work_delayable_from_work(work);
+	struct nrf_sock_ctx *ctx = CONTAINER_OF(dwork, struct nrf_sock_ctx, flush_work);
+	int err;
+
+	k_mutex_lock(&ctx->staged_lock, K_FOREVER);
+
+	if ((ctx->nrf_fd != -1) && (ctx->staged_len > 0)) {
+		err = coalesce_flush_locked(ctx);
+		if (err == -EAGAIN) {
+			/* The modem cannot take the data yet, try again later. */
+			k_work_schedule(&ctx->flush_work,
+					K_MSEC(CONFIG_NRF_MODEM_LIB_SEND_COALESCING_DELAY_MS));
+		} else if (err < 0) {
+			/* Report the error on the next send on this socket. */
+			ctx->staged_err = -err;
+			ctx->staged_len = 0;
+		}
+	}
+
+	k_mutex_unlock(&ctx->staged_lock);
+}
+
+static ssize_t coalesce_send(struct nrf_sock_ctx *ctx, const void *buf, size_t len)
+{
+	int err;
+
+	k_mutex_lock(&ctx->staged_lock, K_FOREVER);
+
+	if (ctx->staged_err != 0) {
+		errno = ctx->staged_err;
+		ctx->staged_err = 0;
+		k_mutex_unlock(&ctx->staged_lock);
+		return -1;
+	}
+
+	/* Writes that fill the buffer on their own gain nothing from staging;
+	 * flush what is pending and hand the payload to the modem directly.
+	 */
+	if (len >= sizeof(ctx->staged_buf)) {
+		err = coalesce_flush_locked(ctx);
+		k_mutex_unlock(&ctx->staged_lock);
+		if (err < 0) {
+			errno = -err;
+			return -1;
+		}
+		return nrf_send(ctx->nrf_fd, buf, len, 0);
+	}
+
+	if (len > sizeof(ctx->staged_buf) - ctx->staged_len) {
+		err = coalesce_flush_locked(ctx);
+		if (err < 0) {
+			k_mutex_unlock(&ctx->staged_lock);
+			errno = -err;
+			return -1;
+		}
+	}
+
+	memcpy(ctx->staged_buf + ctx->staged_len, buf, len);
+	ctx->staged_len += len;
+
+	/* Scheduling is a no-op while a flush is already pending, so the
+	 * deadline is measured from the first staged chunk.
+	 */
+	k_work_schedule(&ctx->flush_work, K_MSEC(CONFIG_NRF_MODEM_LIB_SEND_COALESCING_DELAY_MS));
+
+	k_mutex_unlock(&ctx->staged_lock);
+
+	return len;
+}
+
+static void coalesce_disable(struct nrf_sock_ctx *ctx)
+{
+	k_mutex_lock(&ctx->staged_lock, K_FOREVER);
+
+	ctx->coalesce = false;
+	if (ctx->staged_len > 0) {
+		(void)coalesce_flush_locked(ctx);
+	}
+
+	k_mutex_unlock(&ctx->staged_lock);
+	k_work_cancel_delayable(&ctx->flush_work);
+}
+#endif /* CONFIG_NRF_MODEM_LIB_SEND_COALESCING */
+
 static void z_to_nrf_ipv4(const struct net_sockaddr *z_in,
 			  struct nrf_sockaddr_in *nrf_out)
 {
@@ -414,6 +542,12 @@ static int nrf9x_socket_offload_accept(void *obj, struct net_sockaddr *addr,
 		goto error;
 	}
 
+#if defined(CONFIG_NRF_MODEM_LIB_SEND_COALESCING)
+	/* Accepted sockets are always stream sockets. */
+	ctx->stream = true;
+	ctx->coalesce = true;
+#endif
+
 	if ((addr != NULL) && (addrlen != NULL)) {
 		if (nrf_addr_ptr->sa_family == NRF_AF_INET) {
 			*addrlen = sizeof(struct net_sockaddr_in);
@@ -577,6 +711,26 @@ static int nrf9x_socket_offload_setsockopt(void *obj, int level, int optname,
 		return -1;
 	}
 
+#if defined(CONFIG_NRF_MODEM_LIB_SEND_COALESCING)
+	if ((level == NET_IPPROTO_TCP) && (optname == TCP_NODELAY)) {
+		/* The modem has no TCP_NODELAY option; it toggles the local
+		 * send coalescing instead.
+		 */
+		if ((optval == NULL) || (optlen < sizeof(int))) {
+			errno = EINVAL;
+			return -1;
+		}
+
+		if (*(const int *)optval != 0) {
+			coalesce_disable(ctx);
+		} else if (ctx->stream) {
+			ctx->coalesce = true;
+		}
+
+		return 0;
+	}
+#endif
+
 	if (z_to_nrf_optname(level, optname, &nrf_optname) < 0) {
 		errno = ENOPROTOOPT;
 		return -1;
@@ -639,6 +793,20 @@ static int nrf9x_socket_offload_getsockopt(void *obj, int level, int optname,
 	void *nrf_optval = optval;
 	nrf_socklen_t *nrf_optlen = (nrf_socklen_t *)optlen;
 
+#if defined(CONFIG_NRF_MODEM_LIB_SEND_COALESCING)
+	if ((level == NET_IPPROTO_TCP) && (optname == TCP_NODELAY)) {
+		if ((optval == NULL) || (optlen == NULL) || (*optlen < sizeof(int))) {
+			errno = EINVAL;
+			return -1;
+		}
+
+		*(int *)optval = OBJ_TO_CTX(obj)->coalesce ? 0 : 1;
+		*optlen = sizeof(int);
+
+		return 0;
+	}
+#endif
+
 	if (z_to_nrf_optname(level, optname, &nrf_optname) < 0) {
 		errno = ENOPROTOOPT;
 		return -1;
@@ -743,6 +911,22 @@ static ssize_t nrf9x_socket_offload_sendto(void *obj, const void *buf,
 		(void)k_mutex_unlock(ctx->lock);
 	}
 
+#if defined(CONFIG_NRF_MODEM_LIB_SEND_COALESCING)
+	if (ctx->coalesce) {
+		if ((to == NULL) && (flags == 0)) {
+			retval = coalesce_send(ctx, buf, len);
+			goto out;
+		}
+
+		/* Sends that bypass staging (nonzero flags or an explicit
+		 * address) must not overtake already staged data.
+		 */
+		k_mutex_lock(&ctx->staged_lock, K_FOREVER);
+		(void)coalesce_flush_locked(ctx);
+		k_mutex_unlock(&ctx->staged_lock);
+	}
+#endif
+
 	if (to == NULL) {
 		retval = nrf_sendto(sd, buf, len, flags, NULL, 0);
 	} else if (to->sa_family == NET_AF_INET) {
@@ -762,6 +946,9 @@ static ssize_t nrf9x_socket_offload_sendto(void *obj, const void *buf,
 		retval = -1;
 	}
 
+#if defined(CONFIG_NRF_MODEM_LIB_SEND_COALESCING)
+out:
+#endif
 	/* Context might have been freed during this call.
 	 * Check again before accessing.
 	 */
@@ -795,6 +982,23 @@ static ssize_t nrf9x_socket_offload_sendmsg(void *obj, const struct net_msghdr *
 		len += msg->msg_iov[i].iov_len;
 	}
 
+	/* A single buffer needs no staging, hand it to the modem directly. */
+	if (msg->msg_iovlen == 1) {
+		offset = 0;
+		ret = 0;
+		while ((offset < len) && (ret >= 0)) {
+			ret = nrf9x_socket_offload_sendto(obj,
+				(((uint8_t *)msg->msg_iov[0].iov_base) + offset),
+				(len - offset), flags,
+				msg->msg_name, msg->msg_namelen);
+			if (ret > 0) {
+				offset += ret;
+			}
+		}
+
+		return ret;
+	}
+
 	if (len <= sizeof(buf)) {
 		/* Protect `buf` access with a mutex. */
 		k_mutex_lock(&sendmsg_lock, K_FOREVER);
@@ -1103,6 +1307,16 @@ static int nrf9x_socket_offload_close(void *obj)
 	struct nrf_sock_ctx *ctx = OBJ_TO_CTX(obj);
 	int retval;
 
+#if defined(CONFIG_NRF_MODEM_LIB_SEND_COALESCING)
+	k_work_cancel_delayable(&ctx->flush_work);
+	k_mutex_lock(&ctx->staged_lock, K_FOREVER);
+	if (ctx->staged_len > 0) {
+		(void)coalesce_flush_locked(ctx);
+		ctx->staged_len = 0;
+	}
+	k_mutex_unlock(&ctx->staged_lock);
+#endif
+
 	retval = nrf_close(ctx->nrf_fd);
 	if (retval == 0) {
 		release_ctx(ctx);
@@ -1201,6 +1415,13 @@ static int nrf9x_socket_create(int family, int type, int proto)
 		return -1;
 	}
 
+#if defined(CONFIG_NRF_MODEM_LIB_SEND_COALESCING)
+	if ((type & ~(SOCK_NATIVE | SOCK_NATIVE_TLS)) == NET_SOCK_STREAM) {
+		ctx->stream = true;
+		ctx->coalesce = true;
+	}
+#endif
+
 	zvfs_finalize_fd(fd, ctx,
 		      (const struct fd_op_vtable *)&nrf9x_socket_fd_op_vtable);
 
@@ -1220,6 +1441,10 @@ static int nrf9x_socket_offload_init(const struct device *arg)
 
 	for (int i = 0; i < ARRAY_SIZE(offload_ctx); i++) {
 		offload_ctx[i].nrf_fd = -1;
+#if defined(CONFIG_NRF_MODEM_LIB_SEND_COALESCING)
+		k_mutex_init(&offload_ctx[i].staged_lock);
+		k_work_init_delayable(&offload_ctx[i].flush_work, coalesce_flush_work);
+#endif
 	}
 
 	return 0;
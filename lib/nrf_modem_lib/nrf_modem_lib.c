@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
  */
 
+#include <boot_trace.h>
 #include <modem/nrf_modem_lib.h>
 #include <modem/nrf_modem_lib_trace.h>
 #include <nrf_modem.h>
@@ -202,6 +203,8 @@ int nrf_modem_lib_init(void)
 		goto init_callbacks;
 	}
 
+	boot_trace_mark("nrf_modem_init");
+
 #if CONFIG_NRF_MODEM_LIB_TRACE
 	/* We enable tracing as early as possible because the modem can only store a given
 	 * amount of traces internally before they are dropped.
@@ -371,10 +371,96 @@ void nrf_modem_os_event_notify(uint32_t context)
 	}
 }
 
+#if defined(CONFIG_NRF_MODEM_LIB_HEAP_POOLS)
+/* Fixed size-class pools backing nrf_modem_os_alloc().
+ * Pool allocation and free are constant-time, unlike the library heap's
+ * free-list search, whose worst case grows with fragmentation.
+ */
+static uint8_t pool_buf_small[CONFIG_NRF_MODEM_LIB_HEAP_POOL_SMALL_SIZE *
+			      CONFIG_NRF_MODEM_LIB_HEAP_POOL_SMALL_COUNT]
+	__aligned(sizeof(void *));
+static uint8_t pool_buf_medium[CONFIG_NRF_MODEM_LIB_HEAP_POOL_MEDIUM_SIZE *
+			       CONFIG_NRF_MODEM_LIB_HEAP_POOL_MEDIUM_COUNT]
+	__aligned(sizeof(void *));
+static uint8_t pool_buf_large[CONFIG_NRF_MODEM_LIB_HEAP_POOL_LARGE_SIZE *
+			      CONFIG_NRF_MODEM_LIB_HEAP_POOL_LARGE_COUNT]
+	__aligned(sizeof(void *));
+
+/* Ordered by ascending block size. */
+static struct heap_pool {
+	struct k_mem_slab slab;
+	uint8_t *buf;
+	uint32_t block_size;
+	uint32_t block_count;
+} heap_pools[] = {
+	{
+		.buf = pool_buf_small,
+		.block_size = CONFIG_NRF_MODEM_LIB_HEAP_POOL_SMALL_SIZE,
+		.block_count = CONFIG_NRF_MODEM_LIB_HEAP_POOL_SMALL_COUNT,
+	},
+	{
+		.buf = pool_buf_medium,
+		.block_size = CONFIG_NRF_MODEM_LIB_HEAP_POOL_MEDIUM_SIZE,
+		.block_count = CONFIG_NRF_MODEM_LIB_HEAP_POOL_MEDIUM_COUNT,
+	},
+	{
+		.buf = pool_buf_large,
+		.block_size = CONFIG_NRF_MODEM_LIB_HEAP_POOL_LARGE_SIZE,
+		.block_count = CONFIG_NRF_MODEM_LIB_HEAP_POOL_LARGE_COUNT,
+	},
+};
+
+static void heap_pools_init(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(heap_pools); i++) {
+		k_mem_slab_init(&heap_pools[i].slab, heap_pools[i].buf,
+				heap_pools[i].block_size, heap_pools[i].block_count);
+	}
+}
+
+static void *heap_pool_alloc(size_t bytes)
+{
+	void *mem;
+
+	for (size_t i = 0; i < ARRAY_SIZE(heap_pools); i++) {
+		if (bytes > heap_pools[i].block_size) {
+			continue;
+		}
+		/* If this size class is exhausted, try the next larger one. */
+		if (k_mem_slab_alloc(&heap_pools[i].slab, &mem, K_NO_WAIT) == 0) {
+			return mem;
+		}
+	}
+
+	return NULL;
+}
+
+static bool heap_pool_free(void *mem)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(heap_pools); i++) {
+		if ((uint8_t *)mem >= heap_pools[i].buf &&
+		    (uint8_t *)mem < &heap_pools[i].buf[heap_pools[i].block_size *
+						       heap_pools[i].block_count]) {
+			k_mem_slab_free(&heap_pools[i].slab, mem);
+			return true;
+		}
+	}
+
+	return false;
+}
+#endif /* CONFIG_NRF_MODEM_LIB_HEAP_POOLS */
+
 void *nrf_modem_os_alloc(size_t bytes)
 {
 	extern uint32_t nrf_modem_lib_failed_allocs;
-	void * const addr = k_heap_alloc(&nrf_modem_lib_heap, bytes, K_NO_WAIT);
+	void *addr = NULL;
+
+#if defined(CONFIG_NRF_MODEM_LIB_HEAP_POOLS)
+	addr = heap_pool_alloc(bytes);
+#endif
+	if (!addr) {
+		addr = k_heap_alloc(&nrf_modem_lib_heap, bytes, K_NO_WAIT);
+	}
 
 	if (IS_ENABLED(CONFIG_NRF_MODEM_LIB_MEM_DIAG_ALLOC) && !addr) {
 		nrf_modem_lib_failed_allocs++;
@@ -385,6 +471,11 @@ void *nrf_modem_os_alloc(size_t bytes)
 
 void nrf_modem_os_free(void *mem)
 {
+#if defined(CONFIG_NRF_MODEM_LIB_HEAP_POOLS)
+	if (heap_pool_free(mem)) {
+		return;
+	}
+#endif
 	k_heap_free(&nrf_modem_lib_heap, mem);
 }
 
@@ -511,6 +602,9 @@ void nrf_modem_os_init(void)
 	/* Initialize heaps */
 	k_heap_init(&nrf_modem_lib_heap, library_heap_buf, sizeof(library_heap_buf));
 	k_heap_init(&nrf_modem_lib_shmem_heap, (void *)SHMEM_TX_HEAP_ADDR, SHMEM_TX_HEAP_SIZE);
+#if defined(CONFIG_NRF_MODEM_LIB_HEAP_POOLS)
+	heap_pools_init();
+#endif
 }
 
 void nrf_modem_os_shutdown(void)
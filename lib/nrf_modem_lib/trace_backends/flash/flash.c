@@ -12,8 +12,13 @@
 #include <zephyr/fs/fcb.h>
 #include <zephyr/storage/flash_map.h>
 #include <zephyr/sys/util.h>
+#include <zephyr/sys/byteorder.h>
 #include <zephyr/logging/log.h>
 
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_LZ4)
+#include <lz4.h>
+#endif
+
 #include <modem/trace_backend.h>
 
 LOG_MODULE_REGISTER(modem_trace_backend, CONFIG_MODEM_TRACE_BACKEND_LOG_LEVEL);
@@ -30,6 +35,20 @@ LOG_MODULE_REGISTER(modem_trace_backend, CONFIG_MODEM_TRACE_BACKEND_LOG_LEVEL);
 #define TRACE_MAGIC_INITIALIZED 0x152ac523
 #define PEEK_AT_OFFSET_MAGIC	0x153ac522
 
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_LZ4)
+
+#define LZ4_BLOCK_SIZE	    CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_LZ4_BLOCK_SIZE
+/* Each record stored in flash is a little-endian length followed by one LZ4 block. */
+#define LZ4_REC_HEADER_SIZE sizeof(uint16_t)
+
+/* Trace data staged for compression. */
+static uint8_t lz4_src_buf[LZ4_BLOCK_SIZE];
+static size_t lz4_src_len;
+/* One compressed record, including its length header. */
+static uint8_t lz4_dst_buf[LZ4_REC_HEADER_SIZE + LZ4_COMPRESSBOUND(LZ4_BLOCK_SIZE)];
+
+#endif /* CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_LZ4 */
+
 static trace_backend_processed_cb trace_processed_callback;
 
 static const struct flash_area *modem_trace_area;
@@ -117,7 +136,7 @@ static int fcb_walk_callback(struct fcb_entry_ctx *loc_ctx, void *arg)
 	return 0;
 }
 
-static int buffer_flush_to_flash(void)
+static int data_flush_to_flash(const uint8_t *data, size_t len)
 {
 	int err;
 	struct fcb_entry loc_flush;
@@ -126,13 +145,13 @@ static int buffer_flush_to_flash(void)
 		return -EPERM;
 	}
 
-	if (!backend_state.flash_buf_written) {
+	if (!len) {
 		return -ENODATA;
 	}
 
 	k_sem_take(&fcb_sem, K_FOREVER);
 
-	err = fcb_append(&trace_fcb, backend_state.flash_buf_written, &loc_flush);
+	err = fcb_append(&trace_fcb, len, &loc_flush);
 	if (err) {
 		if (IS_ENABLED(CONFIG_NRF_MODEM_TRACE_FLASH_NOSPACE_ERASE_OLDEST)) {
 			/* Find the number of trace bytes in oldest sector (that is not read). */
@@ -156,7 +175,7 @@ static int buffer_flush_to_flash(void)
 				goto out;
 			}
 
-			err = fcb_append(&trace_fcb, backend_state.flash_buf_written, &loc_flush);
+			err = fcb_append(&trace_fcb, len, &loc_flush);
 
 			peek_at_cache_invalidate();
 		}
@@ -170,9 +189,7 @@ static int buffer_flush_to_flash(void)
 		}
 	}
 
-	err = flash_area_write(
-		trace_fcb.fap, FCB_ENTRY_FA_DATA_OFF(loc_flush), backend_state.flash_buf,
-		backend_state.flash_buf_written);
+	err = flash_area_write(trace_fcb.fap, FCB_ENTRY_FA_DATA_OFF(loc_flush), data, len);
 	if (err) {
 		LOG_ERR("flash_area_write failed, err %d", err);
 
@@ -186,14 +203,121 @@ static int buffer_flush_to_flash(void)
 		goto out;
 	}
 
-	backend_state.flash_buf_written = 0;
-
 out:
 	k_sem_give(&fcb_sem);
 
 	return err;
 }
 
+static int buffer_flush_to_flash(void)
+{
+	int err;
+
+	err = data_flush_to_flash(backend_state.flash_buf, backend_state.flash_buf_written);
+	if (err == 0) {
+		backend_state.flash_buf_written = 0;
+	}
+
+	return err;
+}
+
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_FLUSH_THREAD)
+
+#define FLUSH_WATERMARK MIN(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_FLUSH_WATERMARK, BUF_SIZE)
+
+/* Batch handed over to the flush thread. Owned by the flush thread while flush_buf_len is set. */
+static uint8_t flush_buf[BUF_SIZE];
+static size_t flush_buf_len;
+static int last_flush_err;
+
+static K_SEM_DEFINE(flush_request_sem, 0, 1);
+static K_SEM_DEFINE(flush_done_sem, 1, 1);
+
+static void flush_thread_fn(void *p1, void *p2, void *p3)
+{
+	int err;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		k_sem_take(&flush_request_sem, K_FOREVER);
+
+		err = data_flush_to_flash(flush_buf, flush_buf_len);
+		if (err) {
+			if (err != -ENOSPC) {
+				LOG_ERR("data_flush_to_flash failed, err %d", err);
+			}
+
+			/* The batch is dropped and the error is reported on the next write. */
+			backend_state.trace_bytes_unread -= flush_buf_len;
+			last_flush_err = err;
+		}
+
+		flush_buf_len = 0;
+		k_sem_give(&flush_done_sem);
+	}
+}
+
+K_THREAD_DEFINE(trace_flash_flush_thread,
+		CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_FLUSH_THREAD_STACK_SIZE,
+		flush_thread_fn, NULL, NULL, NULL, K_LOWEST_APPLICATION_THREAD_PRIO, 0, 0);
+
+/* Hand the trace buffer over to the flush thread, waiting for it to be free. */
+static int buffer_flush(void)
+{
+	int err;
+
+	k_sem_take(&flush_done_sem, K_FOREVER);
+
+	if (last_flush_err) {
+		err = last_flush_err;
+		last_flush_err = 0;
+		k_sem_give(&flush_done_sem);
+
+		return err;
+	}
+
+	memcpy(flush_buf, backend_state.flash_buf, backend_state.flash_buf_written);
+	flush_buf_len = backend_state.flash_buf_written;
+	backend_state.flash_buf_written = 0;
+
+	k_sem_give(&flush_request_sem);
+
+	return 0;
+}
+
+/* Wait until a batch handed over to the flush thread has been written. */
+static void buffer_flush_wait(void)
+{
+	k_sem_take(&flush_done_sem, K_FOREVER);
+	k_sem_give(&flush_done_sem);
+}
+
+#else /* CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_FLUSH_THREAD */
+
+static int buffer_flush(void)
+{
+	return buffer_flush_to_flash();
+}
+
+static void buffer_flush_wait(void)
+{
+}
+
+#endif /* CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_FLUSH_THREAD */
+
+/* Buffer fill level at which the buffer is flushed or handed over to the flush thread. */
+static inline size_t buffer_flush_level(void)
+{
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_FLUSH_THREAD)
+	return FLUSH_WATERMARK;
+#else
+	return sizeof(backend_state.flash_buf);
+#endif
+}
+
 static int trace_flash_erase(void)
 {
 	int err;
@@ -531,6 +655,91 @@ int trace_backend_peek_at(size_t offset, void *buf, size_t len)
 	return (int)copied;
 }
 
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_LZ4)
+
+/* Compress the staged trace data into one record and store it in the trace buffer. */
+static int lz4_block_flush(void)
+{
+	int ret;
+	int comp_len;
+	size_t written;
+	size_t rec_len;
+	size_t off = 0;
+
+	if (!lz4_src_len) {
+		return 0;
+	}
+
+	comp_len = LZ4_compress_default((const char *)lz4_src_buf,
+					(char *)&lz4_dst_buf[LZ4_REC_HEADER_SIZE], lz4_src_len,
+					sizeof(lz4_dst_buf) - LZ4_REC_HEADER_SIZE);
+	if (comp_len <= 0) {
+		LOG_ERR("LZ4_compress_default failed");
+		lz4_src_len = 0;
+
+		return -EIO;
+	}
+
+	sys_put_le16((uint16_t)comp_len, lz4_dst_buf);
+	rec_len = LZ4_REC_HEADER_SIZE + comp_len;
+	lz4_src_len = 0;
+
+	while (off < rec_len) {
+		written = buffer_append(&lz4_dst_buf[off], rec_len - off);
+		off += written;
+
+		if (backend_state.flash_buf_written >= buffer_flush_level()) {
+			ret = buffer_flush();
+			if (ret) {
+				LOG_ERR("buffer_flush error %d", ret);
+
+				return ret;
+			}
+		}
+	}
+
+	return 0;
+}
+
+static int stream_write(const void *buf, size_t len)
+{
+	int ret;
+	size_t copy_len;
+	size_t written_total = 0;
+	size_t bytes_left = len;
+	const uint8_t *bytes = buf;
+
+	if (!is_initialized) {
+		return -EPERM;
+	}
+
+	while (bytes_left) {
+		if (lz4_src_len >= sizeof(lz4_src_buf)) {
+			ret = lz4_block_flush();
+			if (ret) {
+				return written_total ? written_total : ret;
+			}
+		}
+
+		copy_len = MIN(bytes_left, sizeof(lz4_src_buf) - lz4_src_len);
+		memcpy(&lz4_src_buf[lz4_src_len], &bytes[len - bytes_left], copy_len);
+		lz4_src_len += copy_len;
+		bytes_left -= copy_len;
+		written_total += copy_len;
+
+		ret = trace_processed_callback(copy_len);
+		if (ret < 0) {
+			LOG_ERR("trace_processed_callback failed: %d", ret);
+
+			return ret;
+		}
+	}
+
+	return written_total;
+}
+
+#else /* CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_LZ4 */
+
 static int stream_write(const void *buf, size_t len)
 {
 	int ret;
@@ -547,10 +756,10 @@ static int stream_write(const void *buf, size_t len)
 		written = buffer_append(&bytes[len - bytes_left], bytes_left);
 		written_total += written;
 
-		if (backend_state.flash_buf_written >= sizeof(backend_state.flash_buf)) {
-			ret = buffer_flush_to_flash();
+		if (backend_state.flash_buf_written >= buffer_flush_level()) {
+			ret = buffer_flush();
 			if (ret) {
-				LOG_ERR("buffer_flush_to_flash error %d", ret);
+				LOG_ERR("buffer_flush error %d", ret);
 
 				if (written_total) {
 					ret = trace_processed_callback(written);
@@ -581,6 +790,8 @@ static int stream_write(const void *buf, size_t len)
 	return written_total;
 }
 
+#endif /* CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_LZ4 */
+
 int trace_backend_write(const void *data, size_t len)
 {
 	int write_ret = stream_write(data, len);
@@ -607,6 +818,13 @@ int trace_backend_clear(void)
 
 	err = fcb_clear(&trace_fcb);
 
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_LZ4)
+	lz4_src_len = 0;
+#endif
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_FLUSH_THREAD)
+	flush_buf_len = 0;
+	last_flush_err = 0;
+#endif
 	backend_state.flash_buf_written = 0;
 	backend_state.loc.fe_sector = 0;
 	backend_state.loc.fe_elem_off = 0;
@@ -624,6 +842,11 @@ int trace_backend_clear(void)
 
 int trace_backend_deinit(void)
 {
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_LZ4)
+	lz4_block_flush();
+#endif
+	/* Wait for any batch handed over to the flush thread, then flush the rest directly. */
+	buffer_flush_wait();
 	buffer_flush_to_flash();
 	peek_at_cache_invalidate();
 
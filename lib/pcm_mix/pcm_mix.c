@@ -11,6 +11,11 @@
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(pcm_mix, CONFIG_PCM_MIX_LOG_LEVEL);
 
+#if defined(CONFIG_PCM_MIX_SIMD) && defined(__ARM_FEATURE_DSP)
+#include <cmsis_core.h>
+#define PCM_MIX_USE_SIMD 1
+#endif
+
 /* Clip signal if amplitude is outside legal range */
 static void hard_limiter(int32_t *const pcm)
 {
@@ -23,13 +28,46 @@ static void hard_limiter(int32_t *const pcm)
 	}
 }
 
+/* Saturating add for the 32-bit sample path */
+static int32_t sat_add_32(int32_t a, int32_t b)
+{
+#if defined(PCM_MIX_USE_SIMD)
+	return __QADD(a, b);
+#else
+	int64_t res = (int64_t)a + (int64_t)b;
+
+	if (res < INT32_MIN) {
+		LOG_DBG("Clip");
+		res = INT32_MIN;
+	} else if (res > INT32_MAX) {
+		LOG_DBG("Clip");
+		res = INT32_MAX;
+	}
+
+	return (int32_t)res;
+#endif /* PCM_MIX_USE_SIMD */
+}
+
 /* Mix stereo-stereo or mono-mono. I.e. buffers are of equal size */
 static void pcm_mix_identical(void *const pcm_a, size_t size_a, void const *const pcm_b,
 			      size_t size_b)
 {
 	int32_t res;
+	uint32_t i = 0;
 
-	for (uint32_t i = 0; i < size_b / 2; i++) {
+#if defined(PCM_MIX_USE_SIMD)
+	/* QADD16 adds and saturates two halfword pairs per instruction,
+	 * replacing the branchy hard limiter on the hot path.
+	 */
+	uint32_t *pair_a = (uint32_t *)pcm_a;
+	uint32_t const *pair_b = (uint32_t const *)pcm_b;
+
+	for (; i + 1 < size_b / 2; i += 2) {
+		pair_a[i / 2] = __QADD16(pair_a[i / 2], pair_b[i / 2]);
+	}
+#endif /* PCM_MIX_USE_SIMD */
+
+	for (; i < size_b / 2; i++) {
 		res = ((int16_t *)pcm_a)[i] + ((int16_t *)pcm_b)[i];
 
 		hard_limiter(&res);
@@ -43,12 +81,27 @@ static void pcm_mix_b_mono_into_a_stereo_lr(void *const pcm_a, size_t size_a,
 					    void const *const pcm_b, size_t size_b)
 {
 	int32_t res;
+	uint32_t i = 0;
+
+#if defined(PCM_MIX_USE_SIMD)
+	/* Duplicate each mono sample into both halfwords, then mix one
+	 * stereo L/R pair per QADD16.
+	 */
+	uint32_t *pair_a = (uint32_t *)pcm_a;
+	int16_t const *mono_b = (int16_t const *)pcm_b;
+
+	for (; i + 1 < size_b; i += 2) {
+		uint32_t mono_pair = __PKHBT(mono_b[i / 2], mono_b[i / 2], 16);
+
+		pair_a[i / 2] = __QADD16(pair_a[i / 2], mono_pair);
+	}
+#endif /* PCM_MIX_USE_SIMD */
 
 	/* Use size_b as this is the length of the mono sample.
 	 * This must be *2 to traverse the stereo sample and /2 since
 	 * the sample is two bytes in size.
 	 */
-	for (uint32_t i = 0; i < size_b; i++) {
+	for (; i < size_b; i++) {
 		res = ((int16_t *)pcm_a)[i] + ((int16_t *)pcm_b)[i / 2];
 
 		hard_limiter(&res);
@@ -62,8 +115,21 @@ static void pcm_mix_b_mono_into_a_stereo_l(void *const pcm_a, size_t size_a,
 					   void const *const pcm_b, size_t size_b)
 {
 	int32_t res;
+	uint32_t i = 0;
 
-	for (uint32_t i = 0; i < size_b / 2; i++) {
+#if defined(PCM_MIX_USE_SIMD)
+	/* The left sample sits in the low halfword of each stereo pair.
+	 * Adding zero to the high halfword leaves the right channel as is.
+	 */
+	uint32_t *pair_a = (uint32_t *)pcm_a;
+	int16_t const *mono_b = (int16_t const *)pcm_b;
+
+	for (; i < size_b / 2; i++) {
+		pair_a[i] = __QADD16(pair_a[i], (uint16_t)mono_b[i]);
+	}
+#endif /* PCM_MIX_USE_SIMD */
+
+	for (; i < size_b / 2; i++) {
 		res = ((int16_t *)pcm_a)[i * 2] + ((int16_t *)pcm_b)[i];
 
 		hard_limiter(&res);
@@ -77,8 +143,19 @@ static void pcm_mix_b_mono_into_a_stereo_r(void *const pcm_a, size_t size_a,
 					   void const *const pcm_b, size_t size_b)
 {
 	int32_t res;
+	uint32_t i = 0;
 
-	for (uint32_t i = 0; i < size_b / 2; i++) {
+#if defined(PCM_MIX_USE_SIMD)
+	/* The right sample sits in the high halfword of each stereo pair */
+	uint32_t *pair_a = (uint32_t *)pcm_a;
+	int16_t const *mono_b = (int16_t const *)pcm_b;
+
+	for (; i < size_b / 2; i++) {
+		pair_a[i] = __QADD16(pair_a[i], (uint32_t)(uint16_t)mono_b[i] << 16);
+	}
+#endif /* PCM_MIX_USE_SIMD */
+
+	for (; i < size_b / 2; i++) {
 		res = ((int16_t *)pcm_a)[i * 2 + 1] + ((int16_t *)pcm_b)[i];
 
 		hard_limiter(&res);
@@ -87,6 +164,44 @@ static void pcm_mix_b_mono_into_a_stereo_r(void *const pcm_a, size_t size_a,
 	}
 }
 
+/* Mix 32-bit streams of equal channel layout with saturation */
+static void pcm_mix_identical_32(void *const pcm_a, size_t size_a, void const *const pcm_b,
+				 size_t size_b)
+{
+	int32_t *samples_a = (int32_t *)pcm_a;
+	int32_t const *samples_b = (int32_t const *)pcm_b;
+
+	for (uint32_t i = 0; i < size_b / 4; i++) {
+		samples_a[i] = sat_add_32(samples_a[i], samples_b[i]);
+	}
+}
+
+/* Mix 32-bit mono into both channels of a stereo buffer */
+static void pcm_mix_b_mono_into_a_stereo_lr_32(void *const pcm_a, size_t size_a,
+					       void const *const pcm_b, size_t size_b)
+{
+	int32_t *samples_a = (int32_t *)pcm_a;
+	int32_t const *samples_b = (int32_t const *)pcm_b;
+
+	for (uint32_t i = 0; i < size_b / 2; i++) {
+		samples_a[i] = sat_add_32(samples_a[i], samples_b[i / 2]);
+	}
+}
+
+/* Mix 32-bit mono into one channel of a stereo buffer */
+static void pcm_mix_b_mono_into_a_stereo_single_32(void *const pcm_a, size_t size_a,
+						   void const *const pcm_b, size_t size_b,
+						   uint32_t channel_offset)
+{
+	int32_t *samples_a = (int32_t *)pcm_a;
+	int32_t const *samples_b = (int32_t const *)pcm_b;
+
+	for (uint32_t i = 0; i < size_b / 4; i++) {
+		samples_a[i * 2 + channel_offset] =
+			sat_add_32(samples_a[i * 2 + channel_offset], samples_b[i]);
+	}
+}
+
 int pcm_mix(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
 	    enum pcm_mix_mode mix_mode)
 {
@@ -133,3 +248,49 @@ int pcm_mix(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t si
 
 	return 0;
 }
+
+int pcm_mix_32(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
+	       enum pcm_mix_mode mix_mode)
+{
+	if (pcm_a == NULL || size_a == 0) {
+		return -EINVAL;
+	}
+
+	if (pcm_b == NULL || size_b == 0) {
+		/* Nothing to mix, returning */
+		return 0;
+	}
+
+	switch (mix_mode) {
+	case B_STEREO_INTO_A_STEREO:
+		/* Fall through */
+	case B_MONO_INTO_A_MONO:
+		if (size_b > size_a) {
+			return -EPERM;
+		}
+		pcm_mix_identical_32(pcm_a, size_a, pcm_b, size_b);
+		break;
+	case B_MONO_INTO_A_STEREO_LR:
+		if (size_b > (size_a / 2)) {
+			return -EPERM;
+		}
+		pcm_mix_b_mono_into_a_stereo_lr_32(pcm_a, size_a, pcm_b, size_b);
+		break;
+	case B_MONO_INTO_A_STEREO_L:
+		if (size_b > (size_a / 2)) {
+			return -EPERM;
+		}
+		pcm_mix_b_mono_into_a_stereo_single_32(pcm_a, size_a, pcm_b, size_b, 0);
+		break;
+	case B_MONO_INTO_A_STEREO_R:
+		if (size_b > (size_a / 2)) {
+			return -EPERM;
+		}
+		pcm_mix_b_mono_into_a_stereo_single_32(pcm_a, size_a, pcm_b, size_b, 1);
+		break;
+	default:
+		return -ESRCH;
+	};
+
+	return 0;
+}
@@ -8,6 +8,10 @@
 #include <zephyr/sys/slist.h>
 #include <qos.h>
 
+#if defined(CONFIG_QOS_LTE_SYNC)
+#include <modem/lte_lc.h>
+#endif
+
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(qos, CONFIG_QOS_LOG_LEVEL);
 
@@ -64,27 +68,38 @@ static void notify_event(struct qos_evt *evt)
 	}
 }
 
+static bool message_expired(const struct qos_data *message)
+{
+	return (message->expiry_uptime_ms > 0) && (k_uptime_get() >= message->expiry_uptime_ms);
+}
+
 STATIC void timeout_handler_work_fn(struct k_work *work)
 {
 	struct qos_metadata *node = NULL, *next_node = NULL;
-	struct qos_evt evt = {
-		.type = QOS_EVT_MESSAGE_REMOVED_FROM_LIST
-	};
+	struct qos_evt evt;
 
 	k_mutex_lock(&ctx_lock, K_FOREVER);
 
-	/* Remove all messages where the notified_count equals or exceeds
-	 * CONFIG_QOS_MESSAGE_NOTIFIED_COUNT_MAX
+	/* Remove all messages that have passed their expiry time or where the notified_count
+	 * equals or exceeds CONFIG_QOS_MESSAGE_NOTIFIED_COUNT_MAX
 	 */
 	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&ctx.pending_list, node, next_node, header) {
-		if (node->message.notified_count >= CONFIG_QOS_MESSAGE_NOTIFIED_COUNT_MAX) {
+		if (message_expired(&node->message)) {
+			LOG_DBG("Message ID: %d has passed its expiry time, "
+				"remove message from pending list.", node->message.id);
+			evt.type = QOS_EVT_MESSAGE_EXPIRED;
+		} else if (node->message.notified_count >= CONFIG_QOS_MESSAGE_NOTIFIED_COUNT_MAX) {
 			LOG_DBG("Notified count for message ID: %d exceeds the maximum allowed "
 				"value, remove message from pending list.", node->message.id);
-			evt.message = node->message;
-			notify_event(&evt);
-			memset(&node->message, 0, sizeof(struct qos_data));
-			sys_slist_find_and_remove(&ctx.pending_list, &node->header);
+			evt.type = QOS_EVT_MESSAGE_REMOVED_FROM_LIST;
+		} else {
+			continue;
 		}
+
+		evt.message = node->message;
+		notify_event(&evt);
+		memset(&node->message, 0, sizeof(struct qos_data));
+		sys_slist_find_and_remove(&ctx.pending_list, &node->header);
 	};
 
 	/* Don't shedule a new work if the pending list is empty. */
@@ -108,6 +123,31 @@ exit:
 	k_mutex_unlock(&ctx_lock);
 }
 
+#if defined(CONFIG_QOS_LTE_SYNC)
+static void qos_lte_ind_handler(const struct lte_lc_evt *const evt)
+{
+	if (evt->type != LTE_LC_EVT_RRC_UPDATE) {
+		return;
+	}
+
+	if (evt->rrc_mode != LTE_LC_RRC_MODE_CONNECTED) {
+		return;
+	}
+
+	k_mutex_lock(&ctx_lock, K_FOREVER);
+
+	/* Pull the next notification pass forward so that pending messages are sent while the
+	 * RRC connection is already established, instead of waking the modem from PSM or eDRX
+	 * sleep when the backoff timer expires.
+	 */
+	if (!sys_slist_is_empty(&ctx.pending_list)) {
+		k_work_reschedule(&ctx.timeout_handler_work, K_NO_WAIT);
+	}
+
+	k_mutex_unlock(&ctx_lock);
+}
+#endif /* CONFIG_QOS_LTE_SYNC */
+
 /* @brief Function that appends a message to the internal list of pending messages.
  *
  * @returns A positive value indicating the index of the internal list that the message was
@@ -189,6 +229,10 @@ int qos_init(qos_evt_handler_t evt_handler)
 	sys_slist_init(&ctx.pending_list);
 	k_work_init_delayable(&ctx.timeout_handler_work, timeout_handler_work_fn);
 
+#if defined(CONFIG_QOS_LTE_SYNC)
+	lte_lc_register_handler(qos_lte_ind_handler);
+#endif
+
 exit:
 	k_mutex_unlock(&ctx_lock);
 	return err;
@@ -283,6 +327,7 @@ void qos_message_print(const struct qos_data *message)
 	LOG_DBG("Message Buffer length: %d", message->data.len);
 	LOG_DBG("Message Flags: %x", message->flags);
 	LOG_DBG("Message type: %d", message->type);
+	LOG_DBG("Message expiry uptime: %lld ms", message->expiry_uptime_ms);
 }
 
 bool qos_message_has_flag(const struct qos_data *message, uint32_t flag)
@@ -37,6 +37,29 @@ struct ram_bank {
 
 extern char _image_ram_end[];
 
+struct ram_region {
+	uintptr_t start;
+	uintptr_t end;
+};
+
+#define RESERVED_RAM_REGION(node_id)                                                               \
+	{                                                                                          \
+		.start = DT_REG_ADDR(node_id),                                                     \
+		.end = DT_REG_ADDR(node_id) + DT_REG_SIZE(node_id),                                \
+	},
+
+/* Device tree memory regions carved out of SRAM (retention areas, shared
+ * memory) are placed outside the application image, yet remain in use and
+ * must not be powered down.
+ */
+static const struct ram_region reserved_regions[] = {
+#if DT_HAS_COMPAT_STATUS_OKAY(zephyr_memory_region)
+	DT_FOREACH_STATUS_OKAY(zephyr_memory_region, RESERVED_RAM_REGION)
+#endif
+	/* Terminator, avoids a zero-length array when no regions are defined. */
+	{ .start = 0, .end = 0 },
+};
+
 static const struct ram_bank banks[] = {
 #if defined(CONFIG_SOC_NRF54L15_CPUAPP)
 	/* Section numbers for RAM00 are 0-3 and for RAM01 are 4-7 within
@@ -222,7 +245,44 @@ void power_up_ram(uintptr_t start_address, uintptr_t end_address)
 
 void power_down_unused_ram(void)
 {
-	power_down_ram(RAM_IMAGE_END_ADDR, ram_end_addr());
+	uintptr_t start = RAM_IMAGE_END_ADDR;
+	uintptr_t end = ram_end_addr();
+
+	/* Power down the unused range in chunks, skipping reserved regions. */
+	while (start < end) {
+		uintptr_t chunk_end = end;
+		uintptr_t resume = end;
+		bool start_moved = false;
+
+		for (size_t i = 0; i < ARRAY_SIZE(reserved_regions); i++) {
+			const struct ram_region *region = &reserved_regions[i];
+
+			if ((region->end <= start) || (region->start >= end)) {
+				continue;
+			}
+
+			if (region->start <= start) {
+				/* The chunk begins inside a reserved region,
+				 * restart the scan past it.
+				 */
+				start = region->end;
+				start_moved = true;
+				break;
+			}
+
+			if (region->start < chunk_end) {
+				chunk_end = region->start;
+				resume = region->end;
+			}
+		}
+
+		if (start_moved) {
+			continue;
+		}
+
+		power_down_ram(start, chunk_end);
+		start = resume;
+	}
 }
 
 void power_up_unused_ram(void)
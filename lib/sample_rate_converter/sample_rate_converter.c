@@ -6,6 +6,9 @@
 
 #include "sample_rate_converter.h"
 #include "sample_rate_converter_filter.h"
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_RATIONAL
+#include "sample_rate_converter_polyphase.h"
+#endif
 
 #include <errno.h>
 #include <stdbool.h>
@@ -34,8 +37,25 @@ LOG_MODULE_REGISTER(sample_rate_converter, CONFIG_SAMPLE_RATE_CONVERTER_LOG_LEVE
 	(CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX * sizeof(uint32_t))
 #endif
 
+/* True when one sample rate is an integer multiple of the other */
+static bool conversion_ratio_is_integer(uint32_t sample_rate_input, uint32_t sample_rate_output)
+{
+	if (sample_rate_input > sample_rate_output) {
+		return (sample_rate_input % sample_rate_output) == 0;
+	}
+
+	return (sample_rate_output % sample_rate_input) == 0;
+}
+
 static int validate_sample_rates(uint32_t sample_rate_input, uint32_t sample_rate_output)
 {
+	if (IS_ENABLED(CONFIG_SAMPLE_RATE_CONVERTER_RATIONAL) &&
+	    (sample_rate_input != sample_rate_output) &&
+	    !conversion_ratio_is_integer(sample_rate_input, sample_rate_output)) {
+		/* Rational ratios are validated when the polyphase engine is initialized */
+		return 0;
+	}
+
 	if (sample_rate_input > sample_rate_output) {
 		if (sample_rate_input != 48000) {
 			LOG_ERR("Invalid input sample rate for downsampling %d", sample_rate_input);
@@ -111,6 +131,27 @@ static int sample_rate_converter_reconfigure(struct sample_rate_converter_ctx *c
 	ctx->sample_rate_input = sample_rate_input;
 	ctx->sample_rate_output = sample_rate_output;
 
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_RATIONAL
+	if (!conversion_ratio_is_integer(sample_rate_input, sample_rate_output)) {
+		ret = sample_rate_converter_polyphase_init(&ctx->polyphase, sample_rate_input,
+							   sample_rate_output);
+		if (ret) {
+			LOG_ERR("Failed to initialize polyphase engine (%d)", ret);
+			return ret;
+		}
+
+		ctx->rational = true;
+		ctx->filter_type = filter;
+
+		LOG_DBG("Sample rate converter initialized for rational conversion. Input sample "
+			"rate: %d, Output sample rate: %d",
+			ctx->sample_rate_input, ctx->sample_rate_output);
+		return 0;
+	}
+
+	ctx->rational = false;
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_RATIONAL */
+
 	ctx->conversion_ratio = calculate_conversion_ratio(sample_rate_input, sample_rate_output);
 
 	ctx->filter_type = filter;
@@ -247,6 +288,29 @@ int sample_rate_converter_process(struct sample_rate_converter_ctx *ctx,
 		}
 	}
 
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_RATIONAL
+	if (ctx->rational) {
+		size_t max_output_bytes =
+			sample_rate_converter_polyphase_max_output_samples(&ctx->polyphase,
+									   samples_in) *
+			bytes_per_sample;
+
+		if (max_output_bytes > output_size) {
+			LOG_ERR("Conversion process can produce more bytes than the output buffer "
+				"can hold");
+			return -EINVAL;
+		}
+
+		size_t samples_out;
+
+		sample_rate_converter_polyphase_process(&ctx->polyphase, input, samples_in, output,
+							&samples_out);
+		*output_written = samples_out * bytes_per_sample;
+
+		return 0;
+	}
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_RATIONAL */
+
 	if ((ctx->conversion_ratio < 0) && (samples_in < abs(ctx->conversion_ratio))) {
 		LOG_ERR("Number of samples in can not be less than the conversion ratio (%d) when "
 			"downsampling",
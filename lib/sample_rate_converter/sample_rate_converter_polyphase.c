@@ -0,0 +1,178 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "sample_rate_converter_polyphase.h"
+
+#include <string.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(sample_rate_converter_polyphase, CONFIG_SAMPLE_RATE_CONVERTER_LOG_LEVEL);
+
+/* Number of history samples carried between blocks */
+#define POLYPHASE_NUM_HISTORY_SAMPLES (SAMPLE_RATE_CONVERTER_POLYPHASE_TAPS - 1)
+
+static uint32_t greatest_common_divisor(uint32_t a, uint32_t b)
+{
+	while (b != 0) {
+		uint32_t tmp = a % b;
+
+		a = b;
+		b = tmp;
+	}
+
+	return a;
+}
+
+/**
+ * @brief Compute the four-tap interpolation kernel for one phase.
+ *
+ * @details The kernel is a Catmull-Rom spline evaluated at the fractional position for the phase.
+ *	    The coefficients sum to exactly one, so the engine is gain neutral for all phases.
+ */
+static void phase_kernel_get(float frac, float coeffs[SAMPLE_RATE_CONVERTER_POLYPHASE_TAPS])
+{
+	float f2 = frac * frac;
+	float f3 = f2 * frac;
+
+	coeffs[0] = -0.5f * f3 + f2 - 0.5f * frac;
+	coeffs[1] = 1.5f * f3 - 2.5f * f2 + 1.0f;
+	coeffs[2] = -1.5f * f3 + 2.0f * f2 + 0.5f * frac;
+	coeffs[3] = 0.5f * f3 - 0.5f * f2;
+}
+
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+static q15_t float_to_fixed(float value)
+{
+	float scaled = value * 32768.0f;
+
+	if (scaled >= 32767.0f) {
+		return INT16_MAX;
+	} else if (scaled <= -32768.0f) {
+		return INT16_MIN;
+	}
+
+	return (q15_t)scaled;
+}
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+static q31_t float_to_fixed(float value)
+{
+	float scaled = value * 2147483648.0f;
+
+	if (scaled >= 2147483647.0f) {
+		return INT32_MAX;
+	} else if (scaled <= -2147483648.0f) {
+		return INT32_MIN;
+	}
+
+	return (q31_t)scaled;
+}
+#endif
+
+int sample_rate_converter_polyphase_init(struct sample_rate_converter_polyphase *poly,
+					 uint32_t sample_rate_input, uint32_t sample_rate_output)
+{
+	uint32_t divisor = greatest_common_divisor(sample_rate_input, sample_rate_output);
+	uint32_t interp_factor = sample_rate_output / divisor;
+	uint32_t decim_factor = sample_rate_input / divisor;
+
+	if (interp_factor > CONFIG_SAMPLE_RATE_CONVERTER_MAX_PHASES) {
+		LOG_ERR("Conversion %d -> %d needs %d phases, max is %d", sample_rate_input,
+			sample_rate_output, interp_factor,
+			CONFIG_SAMPLE_RATE_CONVERTER_MAX_PHASES);
+		return -EINVAL;
+	}
+
+	poly->interp_factor = interp_factor;
+	poly->decim_factor = decim_factor;
+	poly->next_idx = 0;
+	poly->next_frac = 0;
+	memset(poly->history, 0, sizeof(poly->history));
+
+	for (uint32_t phase = 0; phase < interp_factor; phase++) {
+		float coeffs[SAMPLE_RATE_CONVERTER_POLYPHASE_TAPS];
+
+		phase_kernel_get((float)phase / (float)interp_factor, coeffs);
+
+		for (uint32_t tap = 0; tap < SAMPLE_RATE_CONVERTER_POLYPHASE_TAPS; tap++) {
+			poly->coeffs[(phase * SAMPLE_RATE_CONVERTER_POLYPHASE_TAPS) + tap] =
+				float_to_fixed(coeffs[tap]);
+		}
+	}
+
+	LOG_DBG("Polyphase engine initialized with factors %d/%d", interp_factor, decim_factor);
+
+	return 0;
+}
+
+size_t sample_rate_converter_polyphase_max_output_samples(
+	struct sample_rate_converter_polyphase const *poly, size_t samples_in)
+{
+	return ((samples_in * poly->interp_factor) + poly->decim_factor - 1) / poly->decim_factor;
+}
+
+void sample_rate_converter_polyphase_process(struct sample_rate_converter_polyphase *poly,
+					     void const *input, size_t samples_in, void *output,
+					     size_t *samples_out)
+{
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+	q15_t work[CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX + POLYPHASE_NUM_HISTORY_SAMPLES];
+	q15_t *out_samples = (q15_t *)output;
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+	q31_t work[CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX + POLYPHASE_NUM_HISTORY_SAMPLES];
+	q31_t *out_samples = (q31_t *)output;
+#endif
+	uint32_t idx = poly->next_idx;
+	uint32_t frac = poly->next_frac;
+	size_t num_out = 0;
+
+	memcpy(work, poly->history, sizeof(poly->history));
+	memcpy(&work[POLYPHASE_NUM_HISTORY_SAMPLES], input, samples_in * sizeof(work[0]));
+
+	while (idx < samples_in) {
+		/* Four input samples ending at the current position, with the
+		 * history samples covering the start of the stream.
+		 */
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+		const q15_t *coeffs = &poly->coeffs[frac * SAMPLE_RATE_CONVERTER_POLYPHASE_TAPS];
+		const q15_t *window = &work[idx];
+		int32_t acc = ((int32_t)coeffs[0] * window[0]) + ((int32_t)coeffs[1] * window[1]) +
+			      ((int32_t)coeffs[2] * window[2]) + ((int32_t)coeffs[3] * window[3]);
+
+		acc = (acc + (1 << 14)) >> 15;
+		if (acc > INT16_MAX) {
+			acc = INT16_MAX;
+		} else if (acc < INT16_MIN) {
+			acc = INT16_MIN;
+		}
+		out_samples[num_out++] = (q15_t)acc;
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+		const q31_t *coeffs = &poly->coeffs[frac * SAMPLE_RATE_CONVERTER_POLYPHASE_TAPS];
+		const q31_t *window = &work[idx];
+		int64_t acc = ((int64_t)coeffs[0] * window[0]) + ((int64_t)coeffs[1] * window[1]) +
+			      ((int64_t)coeffs[2] * window[2]) + ((int64_t)coeffs[3] * window[3]);
+
+		acc = (acc + (1LL << 30)) >> 31;
+		if (acc > INT32_MAX) {
+			acc = INT32_MAX;
+		} else if (acc < INT32_MIN) {
+			acc = INT32_MIN;
+		}
+		out_samples[num_out++] = (q31_t)acc;
+#endif
+
+		/* Advance the stream position by decim/interp input samples */
+		frac += poly->decim_factor;
+		idx += frac / poly->interp_factor;
+		frac %= poly->interp_factor;
+	}
+
+	/* Carry position and history over to the next block */
+	poly->next_idx = idx - samples_in;
+	poly->next_frac = frac;
+	memcpy(poly->history, &work[samples_in], sizeof(poly->history));
+
+	*samples_out = num_out;
+}
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2024 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _SAMPLE_RATE_CONVERTER_POLYPHASE_H_
+#define _SAMPLE_RATE_CONVERTER_POLYPHASE_H_
+
+#include "sample_rate_converter.h"
+
+/**
+ * @brief Initialize the polyphase engine for a rational conversion ratio.
+ *
+ * @details Reduces the sample rate fraction and precomputes one interpolation kernel per phase.
+ *	    The kernel table is only rebuilt when the conversion parameters change, so no filter
+ *	    staging is done per process call.
+ *
+ * @param[out]	poly			Pointer to the polyphase state.
+ * @param[in]	sample_rate_input	Sample rate of the input samples.
+ * @param[in]	sample_rate_output	Sample rate of the output samples.
+ *
+ * @retval	0	On success.
+ * @retval	-EINVAL	The interpolation factor exceeds CONFIG_SAMPLE_RATE_CONVERTER_MAX_PHASES.
+ */
+int sample_rate_converter_polyphase_init(struct sample_rate_converter_polyphase *poly,
+					 uint32_t sample_rate_input, uint32_t sample_rate_output);
+
+/**
+ * @brief Get the largest number of output samples a block of input can produce.
+ *
+ * @param[in]	poly		Pointer to the polyphase state.
+ * @param[in]	samples_in	Number of input samples in the block.
+ *
+ * @return Maximum number of output samples.
+ */
+size_t sample_rate_converter_polyphase_max_output_samples(
+	struct sample_rate_converter_polyphase const *poly, size_t samples_in);
+
+/**
+ * @brief Process a block of samples through the polyphase engine.
+ *
+ * @details Filter history and the phase position persist in the state between calls, so a stream
+ *	    can be processed block by block without glitches at the block boundaries.
+ *
+ * @param[in,out]	poly		Pointer to the polyphase state.
+ * @param[in]		input		Pointer to the input samples.
+ * @param[in]		samples_in	Number of input samples.
+ * @param[out]		output		Array that output samples will be written to.
+ * @param[out]		samples_out	Number of output samples written.
+ */
+void sample_rate_converter_polyphase_process(struct sample_rate_converter_polyphase *poly,
+					     void const *input, size_t samples_in, void *output,
+					     size_t *samples_out);
+
+#endif /* _SAMPLE_RATE_CONVERTER_POLYPHASE_H_ */
@@ -180,3 +180,63 @@ struct sfloat sfloat_from_float(float float_num)
 
 	return sfloat;
 }
+
+float sfloat_to_float(struct sfloat sfloat_num)
+{
+	/* Precomputed powers of ten covering the SFLOAT exponent range.
+	 * The exponent spans -8..7, so the negative branch indexes up to 8.
+	 */
+	static const float exp_func[] = {
+		1.0f, 10.0f, 100.0f, 1000.0f, 10000.0f, 100000.0f, 1000000.0f, 10000000.0f,
+		100000000.0f,
+	};
+	int16_t mantissa;
+	int8_t exp;
+
+	/* Decode mantissa and exponent from the two's-complement form. */
+	mantissa = (sfloat_num.val & SFLOAT_MANTISSA_MASK) >> SFLOAT_MANTISSA_BIT_POS;
+	if (mantissa > SFLOAT_MANTISSA_MAX) {
+		mantissa -= (SFLOAT_MANTISSA_MASK + 1);
+	}
+
+	exp = (sfloat_num.val & SFLOAT_EXP_MASK) >> SFLOAT_EXP_BIT_POS;
+	if (exp > SFLOAT_EXP_MAX) {
+		exp -= (SFLOAT_EXP_MASK >> SFLOAT_EXP_BIT_POS) + 1;
+	}
+
+	/* Handle special SFLOAT values. */
+	if (exp == SFLOAT_SPECIAL_EXP) {
+		switch (sfloat_num.val) {
+		case SFLOAT_POS_INFINITY:
+			return (1.0f / 0.0f);
+		case SFLOAT_NEG_INFINITY:
+			return (-1.0f / 0.0f);
+		case SFLOAT_NAN:
+		case SFLOAT_NRES:
+		case SFLOAT_RESERVED:
+			return (0.0f / 0.0f);
+		default:
+			break;
+		}
+	}
+
+	if (exp >= 0) {
+		return mantissa * exp_func[exp];
+	} else {
+		return mantissa / exp_func[-exp];
+	}
+}
+
+void sfloat_from_float_array(struct sfloat *sfloat_nums, const float *float_nums, size_t cnt)
+{
+	for (size_t i = 0; i < cnt; i++) {
+		sfloat_nums[i] = sfloat_from_float(float_nums[i]);
+	}
+}
+
+void sfloat_to_float_array(float *float_nums, const struct sfloat *sfloat_nums, size_t cnt)
+{
+	for (size_t i = 0; i < cnt; i++) {
+		float_nums[i] = sfloat_to_float(sfloat_nums[i]);
+	}
+}
@@ -21,6 +21,9 @@
 #include "sms_submit.h"
 #include "sms_deliver.h"
 #include "sms_internal.h"
+#if defined(CONFIG_SMS_REASSEMBLY)
+#include "sms_reassembly.h"
+#endif
 
 LOG_MODULE_REGISTER(sms, CONFIG_SMS_LOG_LEVEL);
 
@@ -199,6 +202,22 @@ static void sms_at_cmd_handler_cmt(const char *at_notif)
 	}
 	LOG_DBG("Valid SMS notification decoded");
 
+#if defined(CONFIG_SMS_REASSEMBLY)
+	if (sms_data_info.header.deliver.concatenated.present) {
+		err = sms_reassembly_insert(&sms_data_info);
+		if (err == -EINPROGRESS) {
+			/* Segment stored, waiting for the remaining segments.
+			 * Each segment is acknowledged separately above.
+			 */
+			return;
+		} else if (err) {
+			/* Message cannot be reassembled so the segments are
+			 * delivered to the subscribers one by one.
+			 */
+			LOG_DBG("Concatenated SMS not reassembled, err=%d", err);
+		}
+	}
+#endif
 	k_work_submit(&sms_notify_work);
 }
 
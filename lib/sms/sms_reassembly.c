@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/logging/log.h>
+#include <zephyr/kernel.h>
+#include <string.h>
+#include <errno.h>
+#include <modem/sms.h>
+
+#include "sms_reassembly.h"
+
+LOG_MODULE_DECLARE(sms, CONFIG_SMS_LOG_LEVEL);
+
+/**
+ * @brief Reassembly context for one concatenated SMS message.
+ *
+ * @details Each segment is stored into the slot given by its sequence number so
+ * that insertion does not depend on the number of segments received so far.
+ * Received segments are tracked in a bitmask, which also makes duplicated
+ * segments harmless as they simply overwrite their own slot.
+ */
+struct sms_reassembly_ctx {
+	/** @brief Indicates whether this context is in use. */
+	bool used;
+	/** @brief Uptime when the latest segment was stored. Used for expiry. */
+	int64_t last_segment_time;
+	/** @brief Bitmask of received segments. Bit 0 is the first segment. */
+	uint8_t received_mask;
+	/** @brief Header of the first segment of the message. */
+	struct sms_deliver_header header;
+	/** @brief Lengths of the stored segment payloads. */
+	uint16_t seg_len[CONFIG_SMS_REASSEMBLY_MAX_SEGMENTS];
+	/** @brief Segment payloads indexed by sequence number. */
+	uint8_t payload[CONFIG_SMS_REASSEMBLY_MAX_SEGMENTS][SMS_MAX_PAYLOAD_LEN_CHARS];
+};
+
+/** @brief Preallocated reassembly contexts. */
+static struct sms_reassembly_ctx contexts[CONFIG_SMS_REASSEMBLY_CTX_COUNT];
+
+/**
+ * @brief Drop contexts whose latest segment arrived too long ago.
+ *
+ * @param[in] now Current uptime in milliseconds.
+ */
+static void sms_reassembly_expire(int64_t now)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(contexts); i++) {
+		if (contexts[i].used &&
+		    (now - contexts[i].last_segment_time >
+		     CONFIG_SMS_REASSEMBLY_TIMEOUT_SEC * MSEC_PER_SEC)) {
+			LOG_WRN("Dropping incomplete concatenated SMS from %s (ref=%d)",
+				contexts[i].header.originating_address.address_str,
+				contexts[i].header.concatenated.ref_number);
+			contexts[i].used = false;
+		}
+	}
+}
+
+/**
+ * @brief Find the context for given originating address and reference number.
+ *
+ * @param[in] data Decoded SMS segment.
+ *
+ * @return Matching context, or NULL if there is none.
+ */
+static struct sms_reassembly_ctx *sms_reassembly_find(struct sms_data *data)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(contexts); i++) {
+		if (contexts[i].used &&
+		    contexts[i].header.concatenated.ref_number ==
+			data->header.deliver.concatenated.ref_number &&
+		    strcmp(contexts[i].header.originating_address.address_str,
+			   data->header.deliver.originating_address.address_str) == 0) {
+			return &contexts[i];
+		}
+	}
+	return NULL;
+}
+
+/**
+ * @brief Take a free context into use, evicting the oldest context if needed.
+ *
+ * @return Context to be used for a new concatenated message.
+ */
+static struct sms_reassembly_ctx *sms_reassembly_alloc(void)
+{
+	struct sms_reassembly_ctx *oldest = &contexts[0];
+
+	for (size_t i = 0; i < ARRAY_SIZE(contexts); i++) {
+		if (!contexts[i].used) {
+			return &contexts[i];
+		}
+		if (contexts[i].last_segment_time < oldest->last_segment_time) {
+			oldest = &contexts[i];
+		}
+	}
+
+	LOG_WRN("Out of reassembly contexts, dropping incomplete concatenated SMS "
+		"from %s (ref=%d)",
+		oldest->header.originating_address.address_str,
+		oldest->header.concatenated.ref_number);
+	oldest->used = false;
+	return oldest;
+}
+
+int sms_reassembly_insert(struct sms_data *data)
+{
+	struct sms_udh_concat *concat = &data->header.deliver.concatenated;
+	struct sms_reassembly_ctx *ctx;
+	int64_t now = k_uptime_get();
+	size_t len = 0;
+
+	if (!concat->present || concat->seq_number == 0 || concat->total_msgs == 0 ||
+	    concat->seq_number > concat->total_msgs) {
+		return -EBADMSG;
+	}
+	if (concat->total_msgs == 1) {
+		/* A concatenated message with a single segment is already complete. */
+		return 0;
+	}
+	if (concat->total_msgs > CONFIG_SMS_REASSEMBLY_MAX_SEGMENTS) {
+		return -EMSGSIZE;
+	}
+
+	sms_reassembly_expire(now);
+
+	ctx = sms_reassembly_find(data);
+	if (ctx != NULL && ctx->header.concatenated.total_msgs != concat->total_msgs) {
+		/* The reference number has been reused for a different message. */
+		ctx->used = false;
+		ctx = NULL;
+	}
+	if (ctx == NULL) {
+		ctx = sms_reassembly_alloc();
+		memset(ctx, 0, sizeof(struct sms_reassembly_ctx));
+		ctx->used = true;
+		ctx->header = data->header.deliver;
+	}
+	if (concat->seq_number == 1) {
+		/* Use the header of the first segment for the complete message. */
+		ctx->header = data->header.deliver;
+	}
+
+	memcpy(ctx->payload[concat->seq_number - 1], data->payload, data->payload_len);
+	ctx->seg_len[concat->seq_number - 1] = data->payload_len;
+	ctx->received_mask |= BIT(concat->seq_number - 1);
+	ctx->last_segment_time = now;
+
+	if (ctx->received_mask != BIT_MASK(concat->total_msgs)) {
+		return -EINPROGRESS;
+	}
+
+	/* All segments received, concatenate them into the output buffer. */
+	data->header.deliver = ctx->header;
+	for (uint8_t i = 0; i < concat->total_msgs; i++) {
+		memcpy(data->payload + len, ctx->payload[i], ctx->seg_len[i]);
+		len += ctx->seg_len[i];
+	}
+	data->payload[len] = '\0';
+	data->payload_len = len;
+	ctx->used = false;
+
+	LOG_DBG("Concatenated SMS complete, %d segments, %d characters",
+		concat->total_msgs, data->payload_len);
+
+	return 0;
+}
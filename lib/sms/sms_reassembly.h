@@ -0,0 +1,32 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _SMS_REASSEMBLY_INCLUDE_H_
+#define _SMS_REASSEMBLY_INCLUDE_H_
+
+/* Forward declaration */
+struct sms_data;
+
+/**
+ * @brief Insert a concatenated SMS segment into the reassembly ring.
+ *
+ * @details The segment is stored into the reassembly context for its originating
+ * address and concatenation reference number, directly into the slot given by its
+ * sequence number. When the last missing segment arrives, @p data is updated to
+ * hold the complete message. The header of the complete message is taken from the
+ * first segment of the message.
+ *
+ * @param[in,out] data Decoded SMS segment. Updated to hold the complete message
+ *                     when zero is returned.
+ *
+ * @retval 0 All segments have been received and @p data holds the complete message.
+ * @retval -EINPROGRESS Segment stored, waiting for more segments.
+ * @retval -EMSGSIZE Message has more segments than can be reassembled.
+ * @retval -EBADMSG Invalid concatenation information.
+ */
+int sms_reassembly_insert(struct sms_data *data);
+
+#endif
@@ -110,6 +110,83 @@ static int tone_gen_32(int32_t *tone, size_t *tone_size, uint16_t tone_freq_hz,
 	return 0;
 }
 
+int tone_osc_init(struct tone_oscillator *osc, uint16_t tone_freq_hz, uint32_t smpl_freq_hz,
+		  float amplitude)
+{
+	if (osc == NULL) {
+		return -ENXIO;
+	}
+
+	if (!smpl_freq_hz || tone_freq_hz < FREQ_LIMIT_LOW || tone_freq_hz > FREQ_LIMIT_HIGH) {
+		return -EINVAL;
+	}
+
+	if (amplitude > 1 || amplitude <= 0) {
+		return -EPERM;
+	}
+
+	osc->phase = 0;
+	osc->phase_inc = (uint32_t)(((uint64_t)tone_freq_hz << 32) / smpl_freq_hz);
+	osc->amplitude_q15 = (int16_t)(amplitude * INT16_MAX);
+
+	return 0;
+}
+
+int tone_bank_gen(int16_t *pcm, size_t smpl_cnt, struct tone_oscillator *osc, size_t osc_cnt)
+{
+	if (pcm == NULL || osc == NULL) {
+		return -ENXIO;
+	}
+
+	if (!smpl_cnt || !osc_cnt) {
+		return -EINVAL;
+	}
+
+	for (size_t i = 0; i < smpl_cnt; i++) {
+		int32_t acc = 0;
+
+		for (size_t j = 0; j < osc_cnt; j++) {
+			/* The sine is looked up from the top bits of the phase accumulator.
+			 * The table interpolation is done within CMSIS-DSP.
+			 */
+			q15_t res = arm_sin_q15((q15_t)(osc[j].phase >> 17));
+
+			acc += ((int32_t)res * osc[j].amplitude_q15) >> 15;
+			osc[j].phase += osc[j].phase_inc;
+		}
+
+		pcm[i] = (int16_t)__SSAT(acc, 16);
+	}
+
+	return 0;
+}
+
+int tone_envelope_apply(int16_t *pcm, size_t smpl_cnt, float gain_start, float gain_end)
+{
+	if (pcm == NULL) {
+		return -ENXIO;
+	}
+
+	if (!smpl_cnt) {
+		return -EINVAL;
+	}
+
+	if (gain_start > 1 || gain_start < 0 || gain_end > 1 || gain_end < 0) {
+		return -EPERM;
+	}
+
+	/* Track the gain in Q31 so the per-sample ramp increment keeps its precision. */
+	int64_t gain = (int64_t)(gain_start * INT32_MAX);
+	int64_t gain_inc = ((int64_t)(gain_end * INT32_MAX) - gain) / (int64_t)smpl_cnt;
+
+	for (size_t i = 0; i < smpl_cnt; i++) {
+		pcm[i] = (int16_t)(((int64_t)pcm[i] * gain) >> 31);
+		gain += gain_inc;
+	}
+
+	return 0;
+}
+
 int tone_gen_size(void *tone, size_t *tone_size, uint16_t tone_freq_hz, uint32_t sample_freq_hz,
 		  uint8_t sample_bits, uint8_t carrier_bits, float amplitude)
 {
@@ -33,6 +33,9 @@
 #ifdef CONFIG_SB_LCS_AWARE
 #include <nrf_lcs/nrf_lcs.h>
 #endif
+#ifdef CONFIG_SB_NRF53_RELEASE_NETWORK_CORE
+#include <hal/nrf_reset.h>
+#endif
 
 /* When searching for fw_info, we get slot address as a base. The slot address,
  * equivalent to an offset of the partition the slot resides on, is the beginning
@@ -209,6 +212,14 @@ int main(void)
 	printk("LCS-awareness disabled.\n\r");
 #endif /* CONFIG_SB_LCS_AWARE */
 
+#ifdef CONFIG_SB_NRF53_RELEASE_NETWORK_CORE
+	/* Release the network core before starting the validation below, so
+	 * that the network core bootloader verifies and boots its image in
+	 * parallel with the application core image validation.
+	 */
+	nrf_reset_network_force_off(NRF_RESET, false);
+#endif
+
 	/* Get slot/partition start address and offset it with
 	 * application header size.
 	 */
@@ -20,6 +20,11 @@ The CBOR header currently complies with the following format:
     ]
 }
 
+When the package is created with the --hash option, each image entry
+additionally carries a "sha256" key with the SHA-256 of the image as stored
+in the package (including any alignment padding). Devices can use the hash
+to verify a written image without re-reading the package.
+
 Usage examples:
 
 Creating DFU Multi Image package:
@@ -30,6 +35,7 @@ Showing DFU Multi Image package header:
 """
 
 import argparse
+import hashlib
 import os
 import struct
 
@@ -48,7 +54,24 @@ def get_aligned_size_and_padding(non_aligned_size: int, align: int, last_image:
     return non_aligned_size + needed_padding, needed_padding
 
 
-def generate_header(image: list, align: int) -> bytes:
+def calculate_image_hash(path: str, padding_length: int) -> bytes:
+    """
+    Calculate SHA-256 of an image as stored in the package, including padding
+    """
+
+    sha256 = hashlib.sha256()
+    with open(path, 'rb') as file:
+        while True:
+            chunk = file.read(READ_BUFFER_SIZE)
+            if not chunk:
+                break
+            sha256.update(chunk)
+    sha256.update(bytes([0xff] * padding_length))
+
+    return sha256.digest()
+
+
+def generate_header(image: list, align: int, include_hashes: bool) -> bytes:
     """
     Generate DFU Multi Image package header
     """
@@ -56,8 +79,12 @@ def generate_header(image: list, align: int) -> bytes:
     image_data = []
     for id, path in image:
         image_size = os.path.getsize(path)
-        aligned_size, _ = get_aligned_size_and_padding(image_size, align, id == image[-1][0])
-        image_data.append({'id': int(id), 'size': aligned_size})
+        aligned_size, padding_length = get_aligned_size_and_padding(
+            image_size, align, id == image[-1][0])
+        entry = {'id': int(id), 'size': aligned_size}
+        if include_hashes:
+            entry['sha256'] = calculate_image_hash(path, padding_length)
+        image_data.append(entry)
 
     header_data = {'img': image_data}
     header_cbor = cbor2.dumps(header_data)
@@ -87,13 +114,13 @@ def parse_header(file: object) -> object:
     return cbor2.loads(header_cbor)
 
 
-def generate_image(images: list, align: int, output_file: str) -> None:
+def generate_image(images: list, align: int, include_hashes: bool, output_file: str) -> None:
     """
     Generate DFU Multi Image package
     """
 
     with open(output_file, 'wb') as out_file:
-        out_file.write(generate_header(images, align))
+        out_file.write(generate_header(images, align, include_hashes))
 
         for id, path in images:
             image_size = os.path.getsize(path)
@@ -118,6 +145,8 @@ def show_header(input_file: str) -> None:
         for image in header['img']:
             print(f'- Id: {image["id"]}')
             print(f'  Size: {image["size"]}')
+            if 'sha256' in image:
+                print(f'  Sha256: {image["sha256"].hex()}')
 
 
 def main():
@@ -135,6 +164,9 @@ def main():
     create_parser.add_argument(
         '--align', type=int, default=1,
         help='Alignment of the start of every image. Gaps will be filled with 0xFF bytes.')
+    create_parser.add_argument(
+        '--hash', action='store_true',
+        help='Include SHA-256 of every image in the package header')
     create_parser.add_argument(
         'output_file', help='Path to output package file')
 
@@ -146,7 +178,7 @@ def main():
     args = parser.parse_args()
 
     if args.subcommand == 'create':
-        generate_image(args.image, args.align, args.output_file)
+        generate_image(args.image, args.align, args.hash, args.output_file)
     elif args.subcommand == 'show':
         show_header(args.input_file)
     else:
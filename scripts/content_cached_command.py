@@ -0,0 +1,76 @@
+#!/usr/bin/env python3
+#
+# Copyright (c) 2026 Nordic Semiconductor ASA
+#
+# SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+
+"""
+Run a post-build command only when its inputs changed.
+
+The tool hashes the wrapped command line together with the contents of the
+declared input files. If the digest matches the one stored in the stamp file
+from the previous run and all declared outputs exist, the command is skipped.
+Otherwise the command is executed and the stamp is updated on success.
+
+This allows expensive post-build steps, such as hex merging, to be skipped
+when an image was relinked with a fresh timestamp but identical contents.
+
+Usage:
+    content_cached_command.py --stamp STAMP [--output FILE]... [--input FILE]...
+                              -- COMMAND [ARG]...
+"""
+
+import argparse
+import hashlib
+import os
+import subprocess
+import sys
+
+
+def content_digest(command, inputs):
+    digest = hashlib.sha256()
+    digest.update('\0'.join(command).encode())
+    for path in sorted(inputs):
+        digest.update(b'\0')
+        with open(path, 'rb') as infile:
+            for chunk in iter(lambda: infile.read(65536), b''):
+                digest.update(chunk)
+    return digest.hexdigest()
+
+
+def main():
+    parser = argparse.ArgumentParser(
+        description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter,
+        allow_abbrev=False)
+    parser.add_argument('--stamp', required=True,
+                        help='File storing the input digest of the previous run')
+    parser.add_argument('--output', dest='outputs', action='append', default=[],
+                        help='Output file that must exist for the command to be skipped')
+    parser.add_argument('--input', dest='inputs', action='append', default=[],
+                        help='Input file included in the digest')
+    parser.add_argument('command', nargs=argparse.REMAINDER,
+                        help='Command to run, preceded by --')
+    args = parser.parse_args()
+
+    command = args.command
+    if command and command[0] == '--':
+        command = command[1:]
+    if not command:
+        parser.error('no command given')
+
+    digest = content_digest(command, args.inputs)
+
+    if all(os.path.exists(path) for path in args.outputs) and os.path.exists(args.stamp):
+        with open(args.stamp) as stampfile:
+            if stampfile.read().strip() == digest:
+                return 0
+
+    subprocess.check_call(command)
+
+    with open(args.stamp, 'w') as stampfile:
+        stampfile.write(digest + '\n')
+    return 0
+
+
+if __name__ == '__main__':
+    sys.exit(main())
@@ -50,6 +50,8 @@ class ModelCreator:
 
         self.timestamp_overflows = 0
         self.after_half = False
+        self.timestamp_format = 'absolute'
+        self.last_timestamp_raw = 0
 
         self.processed_events = ProcessedEvents()
         self.temp_events = []
@@ -138,8 +140,14 @@ class ModelCreator:
                 raise ValueError(f"Incorrect value: {temp_data}. Value is expected to be bigger than 0.")
             return temp_data
 
+        def timestamp_format_decode(data):
+            if data not in ('absolute', 'delta_varint'):
+                raise ValueError(f"Unknown timestamp format: {data}")
+            return data
+
         DECODE_MAP = {
-            "sys_clock_hw_cycles_per_sec":  sys_clock_hw_cycles_per_sec_decode
+            "sys_clock_hw_cycles_per_sec":  sys_clock_hw_cycles_per_sec_decode,
+            "timestamp_format":             timestamp_format_decode
         }
         ret_dict = {}
         items = data.strip().splitlines()
@@ -183,6 +191,8 @@ class ModelCreator:
         sys_config = self.decode_by_markers(in_data, sys_cfg_start_tag, sys_cfg_stop_tag)
         sys_dict = self.sys_config_decode_to_dict(sys_config)
 
+        self.timestamp_format = sys_dict.get('timestamp_format', 'absolute')
+
         sys_clock_hw_cycles_per_sec = sys_dict.get(sys_clock_hw_cycles_per_sec_tag)
         if sys_clock_hw_cycles_per_sec is not None:
             self.sec_per_timestamp_tick = 1 / sys_clock_hw_cycles_per_sec
@@ -220,6 +230,17 @@ class ModelCreator:
                 self.logger.error(f"Sending error: {err}. Cannot send descriptions.")
                 sys.exit()
 
+    def _read_varint(self):
+        value = 0
+        shift = 0
+        while True:
+            byte = self._read_bytes(1)[0]
+            value |= (byte & 0x7f) << shift
+            if not byte & 0x80:
+                break
+            shift += 7
+        return value
+
     def _read_single_event(self):
         id = int.from_bytes(
             self._read_bytes(1),
@@ -227,12 +248,17 @@ class ModelCreator:
             signed=False)
         et = self.raw_data.registered_events_types[id]
 
-        buf = self._read_bytes(4)
-        timestamp_raw = (
-            int.from_bytes(
-                buf,
-                byteorder=self.config['byteorder'],
-                signed=False))
+        if self.timestamp_format == 'delta_varint':
+            timestamp_raw = \
+                (self.last_timestamp_raw + self._read_varint()) % self.config['timestamp_raw_max']
+            self.last_timestamp_raw = timestamp_raw
+        else:
+            buf = self._read_bytes(4)
+            timestamp_raw = (
+                int.from_bytes(
+                    buf,
+                    byteorder=self.config['byteorder'],
+                    signed=False))
 
         if self.after_half \
         and timestamp_raw < 0.4 * self.config['timestamp_raw_max']:
@@ -935,6 +935,10 @@ This file contains all addresses and sizes of all partitions.
         parser.add_argument(f'--{x}-default-driver-kconfig', required=False, type=str, default='',
                             help="Default Kconfig option that is used to turn on the driver")
         parser.add_argument(f'--{x}-dynamic-partition', required=False, type=str, help='Name of dynamic partition')
+        parser.add_argument(f'--{x}-default-align', required=False, type=lambda z: int(z, 0), default=0,
+                            help="Alignment applied to the start address of every placed partition"
+                                 " in the region which does not carry an explicit 'align' directive."
+                                 " Only supported for regions with placement strategy 'complex'.")
 
     ranges_configuration = parser.parse_args(region_args)
 
@@ -970,12 +974,35 @@ def get_region_config_from_args(args, ranges_configuration):
     return regions
 
 
+def apply_default_align(partitions, region_config):
+    """Apply the region's default alignment to dynamically placed partitions.
+
+    The default alignment typically reflects the write granularity of the
+    memory technology backing the region, e.g. the RRAM write line or the
+    flash erase page. A partition which carries an explicit 'align' or
+    'align_next' directive keeps it, the default only fills in
+    'align': {'start': ...} where the configuration states no requirement.
+    Alignment is only supported by the 'complex' placement strategy, and
+    statically defined partitions keep their addresses.
+    """
+    default_align = region_config.get('default_align', 0)
+    if not default_align or region_config['placement_strategy'] != COMPLEX:
+        return
+
+    for config in partitions.values():
+        placement = config.get('placement')
+        if placement is None or 'align' in placement or 'align_next' in placement:
+            continue
+        placement['align'] = {'start': default_align}
+
+
 def solve_region(pm_config, region, region_config, static_config, regions):
     solution = dict()
     region_config['name'] = region
     partitions = {k: v for k, v in pm_config.items() if region in v['region']}
     static_partitions = {k: v for k, v in static_config.items() if region in v['region']}
 
+    apply_default_align(partitions, region_config)
     get_region_config(partitions, region_config, static_partitions, system_reqs=pm_config)
 
     solution.update(partitions)
@@ -110,6 +110,12 @@ def get_config_lines(gpm_config, greg_config, head, split, dest, current_domain=
             elif dest is DEST_KCONFIG and 'span' in partition:
                 add_line(f'{name_upper}_SPAN', string_of_strings(partition['span']))
 
+        if dest is DEST_HEADER:
+            for region_name, region in sorted(reg_config.items()):
+                if region.get('default_align'):
+                    add_line(f'{region_name.upper()}_REGION_ALIGN',
+                             hex(region['default_align']))
+
         add_line('NUM', str(partition_id))
 
         def find_depth(key, depth=0):
@@ -9,20 +9,40 @@
 #include <zephyr/spinlock.h>
 #include <zephyr/sys/slist.h>
 #include <app_event_manager.h>
+#include <nrf_latency_probe.h>
 #include <zephyr/logging/log.h>
 #include <zephyr/sys/reboot.h>
 
 LOG_MODULE_REGISTER(app_event_manager, CONFIG_APP_EVENT_MANAGER_LOG_LEVEL);
 
+NRF_LATENCY_PROBE_DEFINE(app_event_manager_dispatch);
+
 
 static void event_processor_fn(struct k_work *work);
 
 struct app_event_manager_event_display_bm _app_event_manager_event_display_bm;
 
+#if CONFIG_APP_EVENT_MANAGER_COALESCE_WINDOW_US > 0
+static K_WORK_DELAYABLE_DEFINE(event_processor, event_processor_fn);
+#else
 static K_WORK_DEFINE(event_processor, event_processor_fn);
+#endif
 static sys_slist_t eventq = SYS_SLIST_STATIC_INIT(&eventq);
 static struct k_spinlock lock;
 
+static void event_processor_trigger(void)
+{
+#if CONFIG_APP_EVENT_MANAGER_COALESCE_WINDOW_US > 0
+	/* The first event in a burst sets the deadline. Scheduling an already
+	 * pending work item does not move the deadline, so events submitted
+	 * within the window are dispatched in the same processing pass.
+	 */
+	k_work_schedule(&event_processor, K_USEC(CONFIG_APP_EVENT_MANAGER_COALESCE_WINDOW_US));
+#else
+	k_work_submit(&event_processor);
+#endif
+}
+
 static bool log_is_event_displayed(const struct event_type *et)
 {
 	size_t idx = et - _event_type_list_start;
@@ -114,6 +134,43 @@ static void log_event_init(void)
 	}
 }
 
+#ifdef CONFIG_APP_EVENT_MANAGER_SUBSCRIBER_CACHE
+/* Flattened dispatch table with one handler function pointer per subscriber.
+ * The handlers for event type n occupy indexes subscriber_cache_offs[n] up to
+ * subscriber_cache_offs[n + 1] in subscriber_cache.
+ */
+static cb_fn *subscriber_cache;
+static uint16_t *subscriber_cache_offs;
+
+static void subscriber_cache_build(void)
+{
+	size_t type_cnt = _event_type_list_end - _event_type_list_start;
+	size_t subs_cnt = 0;
+	size_t idx = 0;
+	size_t type_idx = 0;
+
+	STRUCT_SECTION_FOREACH(event_type, et) {
+		subs_cnt += et->subs_stop - et->subs_start;
+	}
+
+	subscriber_cache_offs =
+		app_event_manager_alloc((type_cnt + 1) * sizeof(*subscriber_cache_offs));
+	subscriber_cache = app_event_manager_alloc(subs_cnt * sizeof(*subscriber_cache));
+
+	STRUCT_SECTION_FOREACH(event_type, et) {
+		subscriber_cache_offs[type_idx] = idx;
+		type_idx++;
+
+		for (const struct event_subscriber *es = et->subs_start; es != et->subs_stop;
+		     es++) {
+			subscriber_cache[idx] = es->listener->notification;
+			idx++;
+		}
+	}
+	subscriber_cache_offs[type_idx] = idx;
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_SUBSCRIBER_CACHE */
+
 void * __weak app_event_manager_alloc(size_t size)
 {
 	void *event = k_malloc(size);
@@ -164,6 +221,8 @@ static void event_processor_fn(struct k_work *work)
 
 		const struct event_type *et = aeh->type_id;
 
+		NRF_LATENCY_PROBE_BEGIN(app_event_manager_dispatch);
+
 		if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PREPROCESS_HOOKS)) {
 			STRUCT_SECTION_FOREACH(event_preprocess_hook, h) {
 				h->hook(aeh);
@@ -174,23 +233,40 @@ static void event_processor_fn(struct k_work *work)
 
 		bool consumed = false;
 
-		for (const struct event_subscriber *es = et->subs_start;
-		     (es != et->subs_stop) && !consumed;
-		     es++) {
+#ifdef CONFIG_APP_EVENT_MANAGER_SUBSCRIBER_CACHE
+		if (subscriber_cache != NULL) {
+			size_t type_idx = et - _event_type_list_start;
+
+			for (uint16_t i = subscriber_cache_offs[type_idx];
+			     (i < subscriber_cache_offs[type_idx + 1]) && !consumed;
+			     i++) {
+				consumed = subscriber_cache[i](aeh);
+
+				if (consumed) {
+					log_event_consumed(et);
+				}
+			}
+		} else
+#endif /* CONFIG_APP_EVENT_MANAGER_SUBSCRIBER_CACHE */
+		{
+			for (const struct event_subscriber *es = et->subs_start;
+			     (es != et->subs_stop) && !consumed;
+			     es++) {
 
-			__ASSERT_NO_MSG(es != NULL);
+				__ASSERT_NO_MSG(es != NULL);
 
-			const struct event_listener *el = es->listener;
+				const struct event_listener *el = es->listener;
 
-			__ASSERT_NO_MSG(el != NULL);
-			__ASSERT_NO_MSG(el->notification != NULL);
+				__ASSERT_NO_MSG(el != NULL);
+				__ASSERT_NO_MSG(el->notification != NULL);
 
-			log_event_progress(et, el);
+				log_event_progress(et, el);
 
-			consumed = el->notification(aeh);
+				consumed = el->notification(aeh);
 
-			if (consumed) {
-				log_event_consumed(et);
+				if (consumed) {
+					log_event_consumed(et);
+				}
 			}
 		}
 
@@ -200,6 +276,8 @@ static void event_processor_fn(struct k_work *work)
 			}
 		}
 
+		NRF_LATENCY_PROBE_END(app_event_manager_dispatch);
+
 		app_event_manager_free(aeh);
 	}
 }
@@ -219,7 +297,32 @@ void _event_submit(struct app_event_header *aeh)
 	sys_slist_append(&eventq, &aeh->node);
 	k_spin_unlock(&lock, key);
 
-	k_work_submit(&event_processor);
+	event_processor_trigger();
+}
+
+void app_event_manager_submit_batch(struct app_event_header *aehs[], size_t cnt)
+{
+	if (cnt == 0) {
+		return;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	for (size_t i = 0; i < cnt; i++) {
+		__ASSERT_NO_MSG(aehs[i]);
+		APP_EVENT_ASSERT_ID(aehs[i]->type_id);
+
+		if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SUBMIT_HOOKS)) {
+			STRUCT_SECTION_FOREACH(event_submit_hook, h) {
+				h->hook(aehs[i]);
+			}
+		}
+		sys_slist_append(&eventq, &aehs[i]->node);
+	}
+
+	k_spin_unlock(&lock, key);
+
+	event_processor_trigger();
 }
 
 int app_event_manager_init(void)
@@ -231,6 +334,10 @@ int app_event_manager_init(void)
 
 	log_event_init();
 
+#ifdef CONFIG_APP_EVENT_MANAGER_SUBSCRIBER_CACHE
+	subscriber_cache_build();
+#endif
+
 	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_POSTINIT_HOOK)) {
 		STRUCT_SECTION_FOREACH(app_event_manager_postinit_hook, h) {
 			ret = h->hook();
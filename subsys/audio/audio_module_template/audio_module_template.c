@@ -193,6 +193,12 @@ const struct audio_module_functions audio_module_template_functions = {
 struct audio_module_description audio_module_template_dept = {
 	.name = "Audio Module Temp",
 	.type = AUDIO_MODULE_TYPE_IN_OUT,
+
+	/* Set to true if the data process function supports being handed the same
+	 * buffer as both input and output.
+	 */
+	.in_place = false,
+
 	.functions = &audio_module_template_functions};
 
 /**
@@ -126,7 +126,18 @@ static bool validate_parameters(struct audio_module_parameters const *const para
 		return false;
 	}
 
-	if (parameters->thread.stack == NULL || parameters->thread.stack_size == 0) {
+	if (parameters->thread.stack == NULL) {
+		/* A module without a thread is opened in fused mode and processes audio
+		 * data within the thread of the module it is connected from. It can
+		 * only be of a type that takes its input from another module and must
+		 * not have an RX FIFO.
+		 */
+		if (parameters->thread.stack_size != 0 ||
+		    parameters->description->type == AUDIO_MODULE_TYPE_INPUT ||
+		    parameters->thread.msg_rx != NULL) {
+			return false;
+		}
+	} else if (parameters->thread.stack_size == 0) {
 		return false;
 	}
 
@@ -261,6 +272,130 @@ static int tx_fifo_put(struct audio_module_handle *handle,
 	return 0;
 }
 
+static int send_to_connected_modules(struct audio_module_handle *handle,
+				     struct audio_data const *const audio_data);
+
+/**
+ * @brief Process audio data in a fused module, within the sending module's thread.
+ *
+ * @note The processed audio data is passed on to the fused module's connected
+ *       modules before the function returns, so a chain of fused modules
+ *       executes as nested direct function calls.
+ *
+ * @note The owner's reference to the audio data is released within the call,
+ *       either directly once the data has been consumed or, for in-place
+ *       processing, by the response callback of the module the data is passed
+ *       on to.
+ *
+ * @param owner       [in/out]  The handle for the module owning the audio data buffer.
+ * @param handle      [in/out]  The handle for the fused module instance.
+ * @param audio_data  [in]      Pointer to the audio data to process.
+ *
+ * @return 0 if successful, error otherwise.
+ */
+static int fused_data_process(struct audio_module_handle *owner,
+			      struct audio_module_handle *handle,
+			      struct audio_data const *const audio_data)
+{
+	int ret;
+	struct audio_module_handle *handle_to;
+	struct audio_data audio_data_out;
+	void *data;
+
+	if (!state_running(handle->state)) {
+		audio_data_release_cb((struct audio_module_handle_private *)owner, audio_data);
+
+		LOG_WRN("Fused module %s is in an invalid state %d", handle->name, handle->state);
+		return -ECANCELED;
+	}
+
+	if (handle->description->type == AUDIO_MODULE_TYPE_OUTPUT) {
+		/* Process the input audio data and output from the audio system. */
+		ret = handle->description->functions->data_process(
+			(struct audio_module_handle_private *)handle, audio_data, NULL);
+
+		audio_data_release_cb((struct audio_module_handle_private *)owner, audio_data);
+
+		if (ret) {
+			LOG_ERR("Data process error in fused module %s, ret %d", handle->name,
+				ret);
+			return ret;
+		}
+
+		return 0;
+	}
+
+	if (handle->description->in_place && handle->dest_count == 1 && !handle->use_tx_queue) {
+		handle_to = SYS_SLIST_PEEK_HEAD_CONTAINER(&handle->handle_dest_list, handle_to,
+							  node);
+		__ASSERT_NO_MSG(handle_to != NULL);
+
+		/* Process the audio data in place, within the owner's buffer. */
+		memcpy(&audio_data_out, audio_data, sizeof(struct audio_data));
+
+		ret = handle->description->functions->data_process(
+			(struct audio_module_handle_private *)handle, audio_data, &audio_data_out);
+		if (ret) {
+			audio_data_release_cb((struct audio_module_handle_private *)owner,
+					      audio_data);
+
+			LOG_ERR("Data process error in fused module %s, ret %d", handle->name,
+				ret);
+			return ret;
+		}
+
+		if (handle_to->fused) {
+			return fused_data_process(owner, handle_to, &audio_data_out);
+		}
+
+		/* The receiving module's response callback releases the owner's
+		 * reference to the audio data.
+		 */
+		ret = data_tx(owner, handle_to, &audio_data_out, &audio_data_release_cb);
+		if (ret) {
+			audio_data_release_cb((struct audio_module_handle_private *)owner,
+					      &audio_data_out);
+
+			LOG_ERR("Failed to send audio data to module %s from fused module %s, "
+				"ret %d",
+				handle_to->name, handle->name, ret);
+			return ret;
+		}
+
+		return 0;
+	}
+
+	/* Get a new output buffer. */
+	ret = k_mem_slab_alloc(handle->thread.data_slab, (void **)&data, K_NO_WAIT);
+	if (ret) {
+		audio_data_release_cb((struct audio_module_handle_private *)owner, audio_data);
+
+		LOG_ERR("No free data buffer for fused module %s, ret %d", handle->name, ret);
+		return ret;
+	}
+
+	/* Configure new audio data. */
+	audio_data_out.data = data;
+	audio_data_out.data_size = handle->thread.data_size;
+
+	/* Process the input audio data into the output audio data. */
+	ret = handle->description->functions->data_process(
+		(struct audio_module_handle_private *)handle, audio_data, &audio_data_out);
+
+	/* The input audio data has been consumed, so release the owner's reference to it. */
+	audio_data_release_cb((struct audio_module_handle_private *)owner, audio_data);
+
+	if (ret) {
+		k_mem_slab_free(handle->thread.data_slab, (void *)data);
+
+		LOG_ERR("Data process error in fused module %s, ret %d", handle->name, ret);
+		return ret;
+	}
+
+	/* Send processed audio data to next module(s). */
+	return send_to_connected_modules(handle, &audio_data_out);
+}
+
 /**
  * @brief Send the audio data item to all connected modules.
  *
@@ -305,6 +440,22 @@ static int send_to_connected_modules(struct audio_module_handle *handle,
 
 	/* Send to all internally connected modules. */
 	SYS_SLIST_FOR_EACH_CONTAINER(&handle->handle_dest_list, handle_to, node) {
+		if (handle_to->fused) {
+			/* The sending module's reference to the audio data is released
+			 * within the call.
+			 */
+			ret = fused_data_process(handle, handle_to, audio_data);
+			if (ret) {
+				LOG_ERR("Failed to process audio data in fused module %s from %s, "
+					"ret %d",
+					handle_to->name, handle->name, ret);
+
+				return ret;
+			}
+
+			continue;
+		}
+
 		ret = data_tx(handle, handle_to, audio_data, &audio_data_release_cb);
 		if (ret) {
 			LOG_ERR("Failed to send audio data to module %s from %s, ret %d",
@@ -593,6 +744,35 @@ int audio_module_open(struct audio_module_parameters const *const parameters,
 		return ret;
 	}
 
+	if (handle->thread.stack == NULL) {
+		/* The module is opened in fused mode. It has no thread or RX FIFO of
+		 * its own and processes audio data within the thread of the module it
+		 * is connected from.
+		 */
+		handle->fused = true;
+
+		if (handle->thread.msg_tx != NULL && !data_fifo_state(handle->thread.msg_tx)) {
+			ret = data_fifo_init(handle->thread.msg_tx);
+			if (ret) {
+				LOG_ERR("Failed to initialize the TX FIFO for module %s, ret %d",
+					handle->name, ret);
+
+				/* Clean up the handle. */
+				memset(handle, 0, sizeof(struct audio_module_handle));
+				return ret;
+			}
+		}
+
+		sys_slist_init(&handle->handle_dest_list);
+		k_mutex_init(&handle->dest_mutex);
+
+		handle->state = AUDIO_MODULE_STATE_CONFIGURED;
+
+		LOG_DBG("Opened fused module %s", handle->name);
+
+		return 0;
+	}
+
 	switch (handle->description->type) {
 	case AUDIO_MODULE_TYPE_INPUT:
 		thread_entry = (k_thread_entry_t)module_thread_input;
@@ -698,7 +878,9 @@ int audio_module_close(struct audio_module_handle *handle)
 	 *       Test the semaphore and wait for it to be zero.
 	 */
 
-	k_thread_abort(handle->thread_id);
+	if (!handle->fused) {
+		k_thread_abort(handle->thread_id);
+	}
 
 	/* Ensure module handle data is fully cleared. */
 	memset(handle, 0, sizeof(struct audio_module_handle));
@@ -6,14 +6,49 @@
 
 #include <bluetooth/adv_prov.h>
 
+#include <zephyr/sys/atomic.h>
+
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(bt_le_adv_prov, CONFIG_BT_ADV_PROV_LOG_LEVEL);
 
 enum provider_set {
 	PROVIDER_SET_AD,
-	PROVIDER_SET_SD
+	PROVIDER_SET_SD,
+
+	PROVIDER_SET_COUNT
+};
+
+#if defined(CONFIG_BT_ADV_PROV_DATA_CACHE)
+/* Cached result of a single provider. */
+struct cache_entry {
+	/* Data element returned by the provider. */
+	struct bt_data d;
+
+	/* Grace period requested by the provider. */
+	size_t grace_period_s;
+
+	/* Information if the provider provided data. */
+	bool provided;
+};
+
+/* Provider data cache of a single data set. */
+struct set_cache {
+	/* Cached provider results. */
+	struct cache_entry entry[CONFIG_BT_ADV_PROV_DATA_CACHE_PROV_CNT_MAX];
+
+	/* Providers whose data was invalidated since it was cached. */
+	ATOMIC_DEFINE(invalidated, CONFIG_BT_ADV_PROV_DATA_CACHE_PROV_CNT_MAX);
+
+	/* Advertising state for which the results were cached. */
+	struct bt_le_adv_prov_adv_state state;
+
+	/* Information if the cached results are valid. */
+	bool valid;
 };
 
+static struct set_cache set_caches[PROVIDER_SET_COUNT];
+#endif /* CONFIG_BT_ADV_PROV_DATA_CACHE */
+
 
 static void get_section_ptrs(enum provider_set set,
 			     const struct bt_le_adv_prov_provider **start,
@@ -75,6 +110,110 @@ static void update_common_feedback(struct bt_le_adv_prov_feedback *common_fb,
 	common_fb->grace_period_s = MAX(common_fb->grace_period_s, fb->grace_period_s);
 }
 
+#if defined(CONFIG_BT_ADV_PROV_DATA_CACHE)
+static bool cache_state_matches(const struct bt_le_adv_prov_adv_state *cached,
+				const struct bt_le_adv_prov_adv_state *state)
+{
+	return (cached->pairing_mode == state->pairing_mode) &&
+	       (cached->in_grace_period == state->in_grace_period) &&
+	       (cached->adv_handle == state->adv_handle);
+}
+
+static bool cache_can_reuse(enum provider_set set, const struct bt_le_adv_prov_adv_state *state)
+{
+	const struct set_cache *cache = &set_caches[set];
+
+	/* Advertising data that contain random values must be regenerated together with RPA
+	 * rotation. A new advertising session or a change of the advertising state may affect
+	 * the data of every provider.
+	 */
+	return cache->valid && !state->rpa_rotated && !state->new_adv_session &&
+	       cache_state_matches(&cache->state, state);
+}
+
+static bool cache_reuse(enum provider_set set, size_t prov_idx, struct bt_data *d, size_t *pos,
+			struct bt_le_adv_prov_feedback *common_fb)
+{
+	struct set_cache *cache = &set_caches[set];
+	const struct cache_entry *entry = &cache->entry[prov_idx];
+
+	if (atomic_test_and_clear_bit(cache->invalidated, prov_idx)) {
+		return false;
+	}
+
+	if (entry->provided) {
+		d[*pos] = entry->d;
+		(*pos)++;
+		common_fb->grace_period_s = MAX(common_fb->grace_period_s,
+						entry->grace_period_s);
+	}
+
+	return true;
+}
+
+static void cache_store(enum provider_set set, size_t prov_idx, const struct bt_data *d,
+			const struct bt_le_adv_prov_feedback *fb)
+{
+	struct cache_entry *entry;
+
+	if (prov_idx >= CONFIG_BT_ADV_PROV_DATA_CACHE_PROV_CNT_MAX) {
+		return;
+	}
+
+	entry = &set_caches[set].entry[prov_idx];
+	entry->provided = (d != NULL);
+
+	if (d != NULL) {
+		entry->d = *d;
+		entry->grace_period_s = fb->grace_period_s;
+	} else {
+		entry->grace_period_s = 0;
+	}
+}
+
+static void cache_update(enum provider_set set, const struct bt_le_adv_prov_adv_state *state,
+			 int err)
+{
+	struct set_cache *cache = &set_caches[set];
+
+	if (err || (get_section_size(set) > CONFIG_BT_ADV_PROV_DATA_CACHE_PROV_CNT_MAX)) {
+		cache->valid = false;
+		return;
+	}
+
+	cache->state = *state;
+	cache->valid = true;
+}
+
+void bt_le_adv_prov_data_invalidate(const struct bt_le_adv_prov_provider *prov)
+{
+	for (enum provider_set set = 0; set < PROVIDER_SET_COUNT; set++) {
+		struct set_cache *cache = &set_caches[set];
+		const struct bt_le_adv_prov_provider *start;
+		const struct bt_le_adv_prov_provider *end;
+
+		if (prov == NULL) {
+			cache->valid = false;
+			continue;
+		}
+
+		get_section_ptrs(set, &start, &end);
+
+		if ((prov >= start) && (prov < end)) {
+			size_t prov_idx = prov - start;
+
+			if (prov_idx < CONFIG_BT_ADV_PROV_DATA_CACHE_PROV_CNT_MAX) {
+				atomic_set_bit(cache->invalidated, prov_idx);
+			} else {
+				cache->valid = false;
+			}
+
+			return;
+		}
+	}
+}
+#endif /* CONFIG_BT_ADV_PROV_DATA_CACHE */
+
 static int get_providers_data(enum provider_set set, struct bt_data *d, size_t *d_len,
 			      const struct bt_le_adv_prov_adv_state *state,
 			      struct bt_le_adv_prov_feedback *fb)
@@ -93,20 +232,39 @@ static int get_providers_data(enum provider_set set, struct bt_data *d, size_t *
 	get_section_ptrs(set, &start, &end);
 	memset(&common_fb, 0, sizeof(common_fb));
 
+#if defined(CONFIG_BT_ADV_PROV_DATA_CACHE)
+	bool reuse = cache_can_reuse(set, state);
+#endif
+
 	for (const struct bt_le_adv_prov_provider *p = start; p < end; p++) {
+#if defined(CONFIG_BT_ADV_PROV_DATA_CACHE)
+		if (reuse && cache_reuse(set, p - start, d, &pos, &common_fb)) {
+			continue;
+		}
+#endif
 		memset(fb, 0, sizeof(*fb));
 		err = p->get_data(&d[pos], state, fb);
 
 		if (!err) {
+#if defined(CONFIG_BT_ADV_PROV_DATA_CACHE)
+			cache_store(set, p - start, &d[pos], fb);
+#endif
 			pos++;
 			update_common_feedback(&common_fb, fb);
 		} else if (err == -ENOENT) {
+#if defined(CONFIG_BT_ADV_PROV_DATA_CACHE)
+			cache_store(set, p - start, NULL, NULL);
+#endif
 			err = 0;
 		} else {
 			break;
 		}
 	}
 
+#if defined(CONFIG_BT_ADV_PROV_DATA_CACHE)
+	cache_update(set, state, err);
+#endif
+
 	if (!err) {
 		*d_len = pos;
 		memcpy(fb, &common_fb, sizeof(common_fb));
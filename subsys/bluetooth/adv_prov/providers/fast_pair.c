@@ -13,6 +13,9 @@ LOG_MODULE_DECLARE(bt_le_adv_prov, CONFIG_BT_ADV_PROV_LOG_LEVEL);
 
 #define ADV_DATA_BUF_SIZE	CONFIG_BT_ADV_PROV_FAST_PAIR_ADV_BUF_SIZE
 
+/* Provider instance registered at the end of this file. */
+extern struct bt_le_adv_prov_provider fast_pair;
+
 static bool enabled = true;
 static bool show_ui_pairing = IS_ENABLED(CONFIG_BT_ADV_PROV_FAST_PAIR_SHOW_UI_PAIRING);
 static enum bt_fast_pair_adv_battery_mode adv_battery_mode = (
@@ -27,12 +30,14 @@ static enum bt_fast_pair_adv_battery_mode adv_battery_mode = (
 void bt_le_adv_prov_fast_pair_enable(bool enable)
 {
 	enabled = enable;
+	bt_le_adv_prov_data_invalidate(&fast_pair);
 }
 
 #if CONFIG_BT_FAST_PAIR_SUBSEQUENT_PAIRING
 void bt_le_adv_prov_fast_pair_show_ui_pairing(bool enable)
 {
 	show_ui_pairing = enable;
+	bt_le_adv_prov_data_invalidate(&fast_pair);
 }
 #endif /* CONFIG_BT_FAST_PAIR_SUBSEQUENT_PAIRING */
 
@@ -50,6 +55,7 @@ int bt_le_adv_prov_fast_pair_set_battery_mode(enum bt_fast_pair_adv_battery_mode
 	}
 
 	adv_battery_mode = mode;
+	bt_le_adv_prov_data_invalidate(&fast_pair);
 
 	return 0;
 }
@@ -9,12 +9,16 @@
 
 #define GRACE_PERIOD_S	CONFIG_BT_ADV_PROV_SWIFT_PAIR_COOL_DOWN_DURATION
 
+/* Provider instance registered at the end of this file. */
+extern struct bt_le_adv_prov_provider swift_pair;
+
 static bool enabled = true;
 
 
 void bt_le_adv_prov_swift_pair_enable(bool enable)
 {
 	enabled = enable;
+	bt_le_adv_prov_data_invalidate(&swift_pair);
 }
 
 static int get_data(struct bt_data *ad, const struct bt_le_adv_prov_adv_state *state,
@@ -15,41 +15,59 @@ static void bt_conn_ctx_mem_free(struct k_mem_slab *mem_slab, void **data)
 	*data = NULL;
 }
 
+/* The per-slot locks cannot be initialized statically by the instance
+ * macro, so they are initialized on the first library call. The library
+ * mutex guards the initialization against concurrent first calls.
+ */
+static void slot_locks_init(struct bt_conn_ctx_lib *ctx_lib)
+{
+	if (atomic_get(&ctx_lib->slot_locks_initialized)) {
+		return;
+	}
+
+	k_mutex_lock(ctx_lib->mutex, K_FOREVER);
+
+	if (!atomic_get(&ctx_lib->slot_locks_initialized)) {
+		for (size_t i = 0; i < bt_conn_ctx_count(ctx_lib); i++) {
+			k_mutex_init(&ctx_lib->slot_locks[i]);
+		}
+
+		atomic_set(&ctx_lib->slot_locks_initialized, 1);
+	}
+
+	k_mutex_unlock(ctx_lib->mutex);
+}
+
 void *bt_conn_ctx_alloc(struct bt_conn_ctx_lib *ctx_lib, struct bt_conn *conn)
 {
 	__ASSERT_NO_MSG(conn != NULL);
 	__ASSERT_NO_MSG(ctx_lib != NULL);
 
-	int err = -ENOMEM;
-	struct bt_conn_ctx *ctx;
-
-	k_mutex_lock(ctx_lib->mutex, K_FOREVER);
-
-	for (size_t i = 0; i < CONFIG_BT_MAX_CONN; i++) {
-		ctx = &ctx_lib->ctx[i];
+	int err;
+	size_t index = bt_conn_index(conn);
+	struct bt_conn_ctx *ctx = &ctx_lib->ctx[index];
 
-		if (!ctx->conn && !ctx->data) {
-			err = k_mem_slab_alloc(ctx_lib->mem_slab,
-					       &ctx->data,
-					       K_NO_WAIT);
-			if (!err) {
-				ctx->conn = conn;
+	slot_locks_init(ctx_lib);
 
-				LOG_DBG("The memory for the connection context "
-					"has been allocated, conn %p, index: %u",
-					(void *)conn, i);
+	k_mutex_lock(&ctx_lib->slot_locks[index], K_FOREVER);
 
-				return ctx->data;
+	if (!ctx->conn && !ctx->data) {
+		err = k_mem_slab_alloc(ctx_lib->mem_slab,
+				       &ctx->data,
+				       K_NO_WAIT);
+		if (!err) {
+			ctx->conn = conn;
 
-			} else {
-				break;
-			}
+			LOG_DBG("The memory for the connection context "
+				"has been allocated, conn %p, index: %u",
+				(void *)conn, index);
 
+			return ctx->data;
 		}
 	}
 
 	LOG_WRN("Memory can not be allocated");
-	k_mutex_unlock(ctx_lib->mutex);
+	k_mutex_unlock(&ctx_lib->slot_locks[index]);
 
 	return NULL;
 }
@@ -59,49 +77,52 @@ int bt_conn_ctx_free(struct bt_conn_ctx_lib *ctx_lib, struct bt_conn *conn)
 	__ASSERT_NO_MSG(conn != NULL);
 	__ASSERT_NO_MSG(ctx_lib != NULL);
 
-	k_mutex_lock(ctx_lib->mutex, K_FOREVER);
+	size_t index = bt_conn_index(conn);
+	struct bt_conn_ctx *ctx = &ctx_lib->ctx[index];
 
-	for (size_t i = 0; i < CONFIG_BT_MAX_CONN; i++) {
-		struct bt_conn_ctx *ctx = &ctx_lib->ctx[i];
+	slot_locks_init(ctx_lib);
 
-		if (ctx->conn == conn) {
-			bt_conn_ctx_mem_free(ctx_lib->mem_slab, &ctx->data);
-			ctx->conn = NULL;
-			ctx->data = NULL;
+	k_mutex_lock(&ctx_lib->slot_locks[index], K_FOREVER);
 
-			LOG_DBG("The context memory for the connection "
-				"has been released, conn %p index %u",
-				(void *)conn, i);
+	if ((ctx->conn != conn) || !ctx->data) {
+		LOG_WRN("There is no allocated memory for this connection");
+		k_mutex_unlock(&ctx_lib->slot_locks[index]);
 
-			k_mutex_unlock(ctx_lib->mutex);
-
-			return 0;
-		}
+		return -EINVAL;
 	}
 
-	LOG_WRN("There is no allocated memory for this connection");
-	k_mutex_unlock(ctx_lib->mutex);
+	bt_conn_ctx_mem_free(ctx_lib->mem_slab, &ctx->data);
+	ctx->conn = NULL;
+	ctx->data = NULL;
 
-	return  -EINVAL;
+	LOG_DBG("The context memory for the connection "
+		"has been released, conn %p index %u",
+		(void *)conn, index);
+
+	k_mutex_unlock(&ctx_lib->slot_locks[index]);
+
+	return 0;
 }
 
 void bt_conn_ctx_free_all(struct bt_conn_ctx_lib *ctx_lib)
 {
 	__ASSERT_NO_MSG(ctx_lib != NULL);
 
-	k_mutex_lock(ctx_lib->mutex, K_FOREVER);
+	slot_locks_init(ctx_lib);
 
 	for (size_t i = 0; i < CONFIG_BT_MAX_CONN; i++) {
 		struct bt_conn_ctx *ctx = &ctx_lib->ctx[i];
 
+		k_mutex_lock(&ctx_lib->slot_locks[i], K_FOREVER);
+
 		if (ctx->data != NULL) {
 			k_mem_slab_free(ctx_lib->mem_slab, (void *)ctx->data);
 			ctx->conn = NULL;
 			ctx->data = NULL;
 		}
-	}
 
-	k_mutex_unlock(ctx_lib->mutex);
+		k_mutex_unlock(&ctx_lib->slot_locks[i]);
+	}
 
 	LOG_DBG("All allocated memory has been released");
 }
@@ -111,21 +132,24 @@ void *bt_conn_ctx_get(struct bt_conn_ctx_lib *ctx_lib, struct bt_conn *conn)
 	__ASSERT_NO_MSG(conn != NULL);
 	__ASSERT_NO_MSG(ctx_lib != NULL);
 
-	k_mutex_lock(ctx_lib->mutex, K_FOREVER);
+	/* The context slot of a connection is indexed directly by the
+	 * connection index, so no search is needed.
+	 */
+	size_t index = bt_conn_index(conn);
+	struct bt_conn_ctx *ctx = &ctx_lib->ctx[index];
 
-	for (size_t i = 0; i < CONFIG_BT_MAX_CONN; i++) {
-		struct bt_conn_ctx *ctx = &ctx_lib->ctx[i];
+	slot_locks_init(ctx_lib);
 
-		if (ctx->conn == conn) {
-			LOG_DBG("Memory block found for the connection");
+	k_mutex_lock(&ctx_lib->slot_locks[index], K_FOREVER);
 
-			return ctx->data;
-		}
+	if (ctx->conn == conn) {
+		LOG_DBG("Memory block found for the connection");
+
+		return ctx->data;
 	}
 
 	LOG_WRN("No memory block for connection");
-
-	k_mutex_unlock(ctx_lib->mutex);
+	k_mutex_unlock(&ctx_lib->slot_locks[index]);
 
 	return NULL;
 }
@@ -135,15 +159,17 @@ const struct bt_conn_ctx *bt_conn_ctx_get_by_id(struct bt_conn_ctx_lib *ctx_lib,
 	__ASSERT_NO_MSG(ctx_lib != NULL);
 	__ASSERT_NO_MSG(id < bt_conn_ctx_count(ctx_lib));
 
-	k_mutex_lock(ctx_lib->mutex, K_FOREVER);
-
 	struct bt_conn_ctx *ctx = &ctx_lib->ctx[id];
 
-	if (ctx_lib->ctx[id].conn != NULL) {
+	slot_locks_init(ctx_lib);
+
+	k_mutex_lock(&ctx_lib->slot_locks[id], K_FOREVER);
+
+	if (ctx->conn != NULL) {
 		return ctx;
 	}
 
-	k_mutex_unlock(ctx_lib->mutex);
+	k_mutex_unlock(&ctx_lib->slot_locks[id]);
 
 	return NULL;
 }
@@ -153,11 +179,14 @@ void bt_conn_ctx_release(struct bt_conn_ctx_lib *ctx_lib, void *ctx_data)
 	__ASSERT_NO_MSG(ctx_lib != NULL);
 	__ASSERT_NO_MSG(ctx_data != NULL);
 
+	/* The slot of the held context cannot change while its lock is
+	 * held, so this lookup is safe without additional locking.
+	 */
 	for (size_t i = 0; i < CONFIG_BT_MAX_CONN; i++) {
 		struct bt_conn_ctx *ctx = &ctx_lib->ctx[i];
 
 		if (ctx->data == ctx_data) {
-			k_mutex_unlock(ctx_lib->mutex);
+			k_mutex_unlock(&ctx_lib->slot_locks[i]);
 
 			return;
 		}
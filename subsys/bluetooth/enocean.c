@@ -55,14 +55,90 @@ static const struct bt_enocean_callbacks *cb;
 static struct k_work_delayable work;
 static bool commissioning;
 
+#if defined(CONFIG_BT_ENOCEAN_DEVICE_INDEX)
+/* Hash index over the device table, chaining entries per bucket. Bucket heads
+ * and links hold the device index plus one, so that the zero-initialized
+ * index is valid and empty before any device is loaded or commissioned.
+ */
+static uint16_t index_buckets[CONFIG_BT_ENOCEAN_DEVICE_INDEX_BUCKETS];
+static uint16_t index_next[CONFIG_BT_ENOCEAN_DEVICES_MAX];
+
+static uint16_t index_bucket(const bt_addr_le_t *addr)
+{
+	/* The upper two address bytes hold the device type, so only the lower
+	 * four carry entropy across a fleet of devices.
+	 */
+	return sys_get_le32(addr->a.val) % ARRAY_SIZE(index_buckets);
+}
+
+static void index_add(struct bt_enocean_device *dev)
+{
+	uint16_t bucket = index_bucket(&dev->addr);
+	uint16_t entry = (dev - &devices[0]) + 1;
+
+	for (uint16_t i = index_buckets[bucket]; i != 0; i = index_next[i - 1]) {
+		if (i == entry) {
+			return;
+		}
+	}
+
+	index_next[entry - 1] = index_buckets[bucket];
+	index_buckets[bucket] = entry;
+}
+
+static void index_remove(struct bt_enocean_device *dev)
+{
+	uint16_t bucket = index_bucket(&dev->addr);
+	uint16_t entry = (dev - &devices[0]) + 1;
+	uint16_t *link = &index_buckets[bucket];
+
+	while (*link != 0) {
+		if (*link == entry) {
+			*link = index_next[entry - 1];
+			return;
+		}
+
+		link = &index_next[*link - 1];
+	}
+}
+
+static struct bt_enocean_device *index_find(const bt_addr_le_t *addr)
+{
+	uint16_t bucket = index_bucket(addr);
+
+	for (uint16_t i = index_buckets[bucket]; i != 0; i = index_next[i - 1]) {
+		struct bt_enocean_device *dev = &devices[i - 1];
+
+		if ((dev->flags & FLAG_ACTIVE) &&
+		    !bt_addr_le_cmp(addr, &dev->addr)) {
+			return dev;
+		}
+	}
+
+	return NULL;
+}
+#else
+static inline void index_add(struct bt_enocean_device *dev) {}
+
+static inline void index_remove(struct bt_enocean_device *dev) {}
+#endif /* CONFIG_BT_ENOCEAN_DEVICE_INDEX */
+
 static struct bt_enocean_device *device_find(const bt_addr_le_t *addr)
 {
+#if defined(CONFIG_BT_ENOCEAN_DEVICE_INDEX)
+	struct bt_enocean_device *dev = index_find(addr);
+
+	if (dev) {
+		return dev;
+	}
+#else
 	for (int i = 0; i < ARRAY_SIZE(devices); ++i) {
 		if ((devices[i].flags & FLAG_ACTIVE) &&
 		    !bt_addr_le_cmp(addr, &devices[i].addr)) {
 			return &devices[i];
 		}
 	}
+#endif
 
 	LOG_DBG("Unknown device %s", bt_addr_le_str(addr));
 	return NULL;
@@ -77,6 +153,7 @@ static struct bt_enocean_device *device_alloc(const bt_addr_le_t *addr,
 			devices[i].seq = seq;
 			memcpy(devices[i].key, key, sizeof(devices[i].key));
 			devices[i].flags = 0;
+			index_add(&devices[i]);
 			return &devices[i];
 		}
 	}
@@ -512,6 +589,7 @@ static int settings_set(const char *key, size_t len, settings_read_cb read_cb,
 		bt_addr_le_copy(&dev->addr, &entry.addr);
 		memcpy(dev->key, entry.key, sizeof(dev->key));
 		dev->flags |= FLAG_ACTIVE;
+		index_add(dev);
 
 		LOG_DBG("Loaded %s", bt_addr_le_str(&dev->addr));
 		return 0;
@@ -625,6 +703,7 @@ void bt_enocean_decommission(struct bt_enocean_device *dev)
 		(void)settings_delete(name);
 	}
 
+	index_remove(dev);
 	dev->flags = 0;
 
 	if (cb->decommissioned) {
@@ -5,6 +5,7 @@
  */
 
 #include <errno.h>
+#include <zephyr/kernel.h>
 #include <zephyr/net_buf.h>
 #include <zephyr/random/random.h>
 #include <zephyr/bluetooth/bluetooth.h>
@@ -179,19 +180,137 @@ static void fp_adv_data_fill_battery_info(uint8_t *battery_info,
 	}
 }
 
+#if defined(CONFIG_BT_FAST_PAIR_ADV_AK_FILTER_PRECOMPUTE)
+/* Account Key Filter precomputed ahead of the next advertising payload update. The module
+ * relies on the cooperative thread context (also used by the advertising data fill operations
+ * and by the system workqueue) for synchronization. The work handler marks the entry as valid
+ * only after the entry is fully written and the entry is consumed before the work is
+ * resubmitted.
+ */
+static struct {
+	bool valid;
+	size_t account_key_cnt;
+	struct fp_account_key ak[CONFIG_BT_FAST_PAIR_STORAGE_ACCOUNT_KEY_MAX];
+	uint16_t salt;
+	bool has_battery_info;
+	uint8_t battery_info[FP_CRYPTO_BATTERY_INFO_LEN];
+	uint8_t filter[FP_CRYPTO_ACCOUNT_KEY_FILTER_SIZE(
+					CONFIG_BT_FAST_PAIR_STORAGE_ACCOUNT_KEY_MAX)];
+} ak_filter_precomp;
+
+static bool ak_filter_precomp_battery;
+static enum fp_field_type ak_filter_precomp_battery_data_type;
+
+static void ak_filter_precomp_work_handle(struct k_work *w);
+
+static K_WORK_DEFINE(ak_filter_precomp_work, ak_filter_precomp_work_handle);
+
+static void ak_filter_precomp_work_handle(struct k_work *w)
+{
+	size_t account_key_cnt = ARRAY_SIZE(ak_filter_precomp.ak);
+	int err;
+
+	err = fp_storage_ak_get(ak_filter_precomp.ak, &account_key_cnt);
+	if (err || (account_key_cnt == 0)) {
+		return;
+	}
+
+	err = sys_csrand_get(&ak_filter_precomp.salt, sizeof(ak_filter_precomp.salt));
+	if (err) {
+		return;
+	}
+
+	ak_filter_precomp.account_key_cnt = account_key_cnt;
+	ak_filter_precomp.has_battery_info = ak_filter_precomp_battery;
+	if (ak_filter_precomp.has_battery_info) {
+		fp_adv_data_fill_battery_info(ak_filter_precomp.battery_info,
+					      ak_filter_precomp_battery_data_type);
+	}
+
+	err = fp_crypto_account_key_filter(ak_filter_precomp.filter, ak_filter_precomp.ak,
+					   account_key_cnt, ak_filter_precomp.salt,
+					   ak_filter_precomp.has_battery_info ?
+						ak_filter_precomp.battery_info : NULL);
+	if (err) {
+		return;
+	}
+
+	ak_filter_precomp.valid = true;
+}
+
+static bool ak_filter_precomp_use(uint8_t *out, size_t ak_filter_size,
+				  const struct fp_account_key *ak, size_t account_key_cnt,
+				  const uint8_t *battery_info, uint16_t *salt)
+{
+	if (!ak_filter_precomp.valid) {
+		return false;
+	}
+
+	/* The precomputed Salt must not be reused in the next advertising payload to prevent
+	 * tracking. Consume the entry also on the input mismatch, because the inputs used to
+	 * precompute the filter are no longer up to date.
+	 */
+	ak_filter_precomp.valid = false;
+
+	if (ak_filter_precomp.account_key_cnt != account_key_cnt) {
+		return false;
+	}
+
+	if (memcmp(ak_filter_precomp.ak, ak, account_key_cnt * sizeof(ak[0])) != 0) {
+		return false;
+	}
+
+	if (ak_filter_precomp.has_battery_info != (battery_info != NULL)) {
+		return false;
+	}
+
+	if ((battery_info != NULL) &&
+	    (memcmp(ak_filter_precomp.battery_info, battery_info,
+		    FP_CRYPTO_BATTERY_INFO_LEN) != 0)) {
+		return false;
+	}
+
+	memcpy(out, ak_filter_precomp.filter, ak_filter_size);
+	*salt = ak_filter_precomp.salt;
+
+	return true;
+}
+
+static void ak_filter_precomp_request(bool add_battery_info,
+				      enum fp_field_type battery_data_type)
+{
+	ak_filter_precomp.valid = false;
+	ak_filter_precomp_battery = add_battery_info;
+	ak_filter_precomp_battery_data_type = battery_data_type;
+
+	(void)k_work_submit(&ak_filter_precomp_work);
+}
+#else
+static bool ak_filter_precomp_use(uint8_t *out, size_t ak_filter_size,
+				  const struct fp_account_key *ak, size_t account_key_cnt,
+				  const uint8_t *battery_info, uint16_t *salt)
+{
+	return false;
+}
+
+static void ak_filter_precomp_request(bool add_battery_info,
+				      enum fp_field_type battery_data_type)
+{
+}
+#endif /* defined(CONFIG_BT_FAST_PAIR_ADV_AK_FILTER_PRECOMPUTE) */
+
 static int fp_adv_data_fill_non_discoverable(struct net_buf_simple *buf, size_t account_key_cnt,
 					     enum fp_field_type ak_filter_type,
 					     enum bt_fast_pair_adv_battery_mode adv_battery_mode)
 {
 	uint8_t battery_info[FP_CRYPTO_BATTERY_INFO_LEN];
+	enum fp_field_type battery_data_type = FP_FIELD_TYPE_HIDE_BATTERY_UI_INDICATION;
 	bool add_battery_info = ((adv_battery_mode != BT_FAST_PAIR_ADV_BATTERY_MODE_NONE) &&
 				 (account_key_cnt != 0));
 
 	net_buf_simple_add_u8(buf, version_and_flags);
 
 	if (add_battery_info) {
-		enum fp_field_type battery_data_type;
-
 		if (adv_battery_mode == BT_FAST_PAIR_ADV_BATTERY_MODE_SHOW_UI_IND) {
 			battery_data_type = FP_FIELD_TYPE_SHOW_BATTERY_UI_INDICATION;
 		} else {
@@ -207,14 +326,10 @@ static int fp_adv_data_fill_non_discoverable(struct net_buf_simple *buf, size_t
 		struct fp_account_key ak[CONFIG_BT_FAST_PAIR_STORAGE_ACCOUNT_KEY_MAX];
 		size_t ak_filter_size = fp_crypto_account_key_filter_size(account_key_cnt);
 		size_t account_key_get_cnt = account_key_cnt;
+		uint8_t *ak_filter_buf;
 		uint16_t salt;
 		int err;
 
-		err = sys_csrand_get(&salt, sizeof(salt));
-		if (err) {
-			return err;
-		}
-
 		err = fp_storage_ak_get(ak, &account_key_get_cnt);
 		if (err) {
 			return err;
@@ -229,15 +344,27 @@ static int fp_adv_data_fill_non_discoverable(struct net_buf_simple *buf, size_t
 		__ASSERT_NO_MSG(ak_filter_size <= BIT_MASK(LEN_BITS));
 		net_buf_simple_add_u8(buf, ENCODE_FIELD_LEN_TYPE(ak_filter_size, ak_filter_type));
 
-		err = fp_crypto_account_key_filter(net_buf_simple_add(buf, ak_filter_size), ak,
-						   account_key_cnt, salt,
-						   add_battery_info ? battery_info : NULL);
-		if (err) {
-			return err;
+		ak_filter_buf = net_buf_simple_add(buf, ak_filter_size);
+
+		if (!ak_filter_precomp_use(ak_filter_buf, ak_filter_size, ak, account_key_cnt,
+					   add_battery_info ? battery_info : NULL, &salt)) {
+			err = sys_csrand_get(&salt, sizeof(salt));
+			if (err) {
+				return err;
+			}
+
+			err = fp_crypto_account_key_filter(ak_filter_buf, ak, account_key_cnt,
+							   salt,
+							   add_battery_info ? battery_info : NULL);
+			if (err) {
+				return err;
+			}
 		}
 
 		net_buf_simple_add_u8(buf, ENCODE_FIELD_LEN_TYPE(sizeof(salt), FP_FIELD_TYPE_SALT));
 		net_buf_simple_add_be16(buf, salt);
+
+		ak_filter_precomp_request(add_battery_info, battery_data_type);
 	}
 
 	if (add_battery_info) {
@@ -86,11 +86,7 @@ int fp_crypto_aes_key_compute(uint8_t *out, const uint8_t *in)
 
 size_t fp_crypto_account_key_filter_size(size_t n)
 {
-	if (n == 0) {
-		return 0;
-	} else {
-		return 1.2 * n + 3;
-	}
+	return FP_CRYPTO_ACCOUNT_KEY_FILTER_SIZE(n);
 }
 
 int fp_crypto_account_key_filter(uint8_t *out, const struct fp_account_key *account_key_list,
@@ -14,6 +14,75 @@ LOG_MODULE_DECLARE(fp_crypto, CONFIG_FP_CRYPTO_LOG_LEVEL);
 
 #include "fp_crypto.h"
 
+#if defined(CONFIG_BT_FAST_PAIR_CRYPTO_PSA_KEY_CACHE)
+/* Single-entry caches for the most recently imported keys. Fast Pair
+ * procedures use the same key for many consecutive operations, for example
+ * every block of an AES-CTR message, so keeping the PSA key imported skips
+ * the repeated key import and destruction. fp_crypto is called from a single
+ * context at a time, so the caches need no locking.
+ */
+struct key_cache {
+	psa_key_id_t key_id;
+	uint8_t key[FP_CRYPTO_AES256_KEY_LEN];
+	size_t key_len;
+};
+
+static struct key_cache aes128_key_cache;
+static struct key_cache hmac_key_cache;
+
+static psa_key_id_t key_cache_get(struct key_cache *cache, const uint8_t *key, size_t key_len)
+{
+	if ((cache->key_len == key_len) && (memcmp(cache->key, key, key_len) == 0)) {
+		return cache->key_id;
+	}
+
+	return PSA_KEY_ID_NULL;
+}
+
+static void key_cache_entry_clear(struct key_cache *cache)
+{
+	psa_status_t status;
+
+	if (cache->key_len == 0) {
+		return;
+	}
+
+	status = psa_destroy_key(cache->key_id);
+	if (status != PSA_SUCCESS) {
+		LOG_ERR("psa_destroy_key failed (err: %d)", status);
+	}
+
+	memset(cache, 0, sizeof(*cache));
+	cache->key_id = PSA_KEY_ID_NULL;
+}
+
+static void key_cache_put(struct key_cache *cache, psa_key_id_t key_id, const uint8_t *key,
+			  size_t key_len)
+{
+	if (key_len > sizeof(cache->key)) {
+		/* Key too long to track, the caller destroys it after use. */
+		return;
+	}
+
+	key_cache_entry_clear(cache);
+
+	cache->key_id = key_id;
+	cache->key_len = key_len;
+	memcpy(cache->key, key, key_len);
+}
+
+static bool key_cache_holds(const struct key_cache *cache, psa_key_id_t key_id)
+{
+	return (cache->key_len != 0) && (cache->key_id == key_id);
+}
+
+void fp_crypto_key_cache_clear(void)
+{
+	key_cache_entry_clear(&aes128_key_cache);
+	key_cache_entry_clear(&hmac_key_cache);
+}
+#endif /* CONFIG_BT_FAST_PAIR_CRYPTO_PSA_KEY_CACHE */
+
 int fp_crypto_sha256(uint8_t *out, const uint8_t *in, size_t data_len)
 {
 	size_t hash_len = 0;
@@ -80,17 +149,33 @@ int fp_crypto_hmac_sha256(uint8_t *out, const uint8_t *in, size_t data_len, cons
 			  size_t hmac_key_len)
 {
 	int err = 0;
-	psa_key_id_t hmac_key_id;
+	psa_key_id_t hmac_key_id = PSA_KEY_ID_NULL;
 	psa_status_t status;
 
-	hmac_key_id = import_hmac_sha256_key(hmac_key, hmac_key_len);
+#if defined(CONFIG_BT_FAST_PAIR_CRYPTO_PSA_KEY_CACHE)
+	hmac_key_id = key_cache_get(&hmac_key_cache, hmac_key, hmac_key_len);
+#endif
+
 	if (hmac_key_id == PSA_KEY_ID_NULL) {
-		LOG_ERR("import_hmac_sha256_key failed");
-		return -EIO;
+		hmac_key_id = import_hmac_sha256_key(hmac_key, hmac_key_len);
+		if (hmac_key_id == PSA_KEY_ID_NULL) {
+			LOG_ERR("import_hmac_sha256_key failed");
+			return -EIO;
+		}
+
+#if defined(CONFIG_BT_FAST_PAIR_CRYPTO_PSA_KEY_CACHE)
+		key_cache_put(&hmac_key_cache, hmac_key_id, hmac_key, hmac_key_len);
+#endif
 	}
 
 	err = fp_crypto_psa_hmac_sha256(out, in, data_len, hmac_key_id);
 
+#if defined(CONFIG_BT_FAST_PAIR_CRYPTO_PSA_KEY_CACHE)
+	if (key_cache_holds(&hmac_key_cache, hmac_key_id)) {
+		return err;
+	}
+#endif
+
 	status = psa_destroy_key(hmac_key_id);
 	if (status != PSA_SUCCESS) {
 		LOG_ERR("psa_destroy_key failed (err: %d)", status);
@@ -160,17 +245,33 @@ static int fp_crypto_aes128_ecb_crypt(uint8_t *out, const uint8_t *in, const uin
 				      bool encrypt)
 {
 	int err = 0;
-	psa_key_id_t key_id;
+	psa_key_id_t key_id = PSA_KEY_ID_NULL;
 	psa_status_t status;
 
-	key_id = import_aes128_key(k);
+#if defined(CONFIG_BT_FAST_PAIR_CRYPTO_PSA_KEY_CACHE)
+	key_id = key_cache_get(&aes128_key_cache, k, FP_CRYPTO_AES128_KEY_LEN);
+#endif
+
 	if (key_id == PSA_KEY_ID_NULL) {
-		LOG_ERR("import_aes128_key failed");
-		return -EIO;
+		key_id = import_aes128_key(k);
+		if (key_id == PSA_KEY_ID_NULL) {
+			LOG_ERR("import_aes128_key failed");
+			return -EIO;
+		}
+
+#if defined(CONFIG_BT_FAST_PAIR_CRYPTO_PSA_KEY_CACHE)
+		key_cache_put(&aes128_key_cache, key_id, k, FP_CRYPTO_AES128_KEY_LEN);
+#endif
 	}
 
 	err = fp_crypto_psa_aes128_ecb_crypt(out, in, key_id, encrypt);
 
+#if defined(CONFIG_BT_FAST_PAIR_CRYPTO_PSA_KEY_CACHE)
+	if (key_cache_holds(&aes128_key_cache, key_id)) {
+		return err;
+	}
+#endif
+
 	status = psa_destroy_key(key_id);
 	if (status != PSA_SUCCESS) {
 		LOG_ERR("psa_destroy_key failed (err: %d)", status);
@@ -50,6 +50,10 @@ extern "C" {
 #define FP_CRYPTO_ADDITIONAL_DATA_HEADER_LEN	16U
 /** Length of battery info (1-byte length and type field and 3-byte battery values field). */
 #define FP_CRYPTO_BATTERY_INFO_LEN		4U
+/** Size of Account Key Filter (1.2 * n + 3 bytes) for a given number of Account Keys.
+ *  Integer arithmetic is used to keep the result a constant expression.
+ */
+#define FP_CRYPTO_ACCOUNT_KEY_FILTER_SIZE(n)	(((n) == 0) ? 0 : ((6 * (n) + 15) / 5))
 
 /** Hash value using SHA-256.
  *
@@ -261,6 +265,19 @@ int fp_crypto_additional_data_encode(uint8_t *out_packet, const uint8_t *data, s
 int fp_crypto_additional_data_decode(uint8_t *out_data, const uint8_t *in_packet, size_t packet_len,
 				     const uint8_t *aes_key);
 
+#if defined(CONFIG_BT_FAST_PAIR_CRYPTO_PSA_KEY_CACHE)
+/** Clear cached cryptographic key material.
+ *
+ * Destroy keys that the crypto backend keeps imported between operations.
+ * Called when the procedure key material is invalidated.
+ */
+void fp_crypto_key_cache_clear(void);
+#else
+static inline void fp_crypto_key_cache_clear(void)
+{
+}
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -78,6 +78,7 @@ static void key_timeout(struct fp_procedure *proc)
 	proc->state = FP_STATE_INITIAL;
 	proc->wait_for_mask = 0;
 	memset(proc->aes_key, EMPTY_AES_KEY_BYTE, sizeof(proc->aes_key));
+	fp_crypto_key_cache_clear();
 }
 
 static void invalidate_key(struct fp_procedure *proc)
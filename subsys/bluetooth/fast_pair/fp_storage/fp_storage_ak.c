@@ -9,6 +9,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <zephyr/kernel.h>
 #include <zephyr/sys/__assert.h>
 #include <zephyr/settings/settings.h>
 #include <bluetooth/fast_pair/fast_pair.h>
@@ -274,6 +275,67 @@ static void ak_order_update_ram(uint8_t used_id)
 	account_key_order[0] = used_id;
 }
 
+static int ak_order_settings_save(void)
+{
+	return settings_save_one(SETTINGS_AK_ORDER_FULL_NAME, account_key_order,
+				 sizeof(account_key_order));
+}
+
+#if defined(CONFIG_BT_FAST_PAIR_STORAGE_AK_ORDER_DEFERRED_COMMIT)
+static void ak_order_save_work_handle(struct k_work *work)
+{
+	int err;
+
+	ARG_UNUSED(work);
+
+	err = ak_order_settings_save();
+	if (err) {
+		LOG_ERR("Unable to save new Account Key order in Settings. "
+			"Not propagating the error and keeping updated Account Key "
+			"order in RAM. After the Settings error the Account Key "
+			"order may change at reboot.");
+	}
+}
+
+static K_WORK_DELAYABLE_DEFINE(ak_order_save_work, ak_order_save_work_handle);
+#endif /* CONFIG_BT_FAST_PAIR_STORAGE_AK_ORDER_DEFERRED_COMMIT */
+
+static void ak_order_commit(void)
+{
+#if defined(CONFIG_BT_FAST_PAIR_STORAGE_AK_ORDER_DEFERRED_COMMIT)
+	/* Coalesce the Account Key order writes performed back-to-back during
+	 * a Fast Pair procedure into a single Settings write. Deferring the
+	 * write is safe: the stored order is only a usage heuristic and is
+	 * rebuilt during validation at bootup if it went stale.
+	 */
+	k_work_reschedule(&ak_order_save_work,
+			  K_MSEC(CONFIG_BT_FAST_PAIR_STORAGE_AK_ORDER_DEFERRED_COMMIT_TIMEOUT));
+#else
+	int err;
+
+	err = ak_order_settings_save();
+	if (err) {
+		LOG_ERR("Unable to save new Account Key order in Settings. "
+			"Not propagating the error and keeping updated Account Key "
+			"order in RAM. After the Settings error the Account Key "
+			"order may change at reboot.");
+	}
+#endif /* CONFIG_BT_FAST_PAIR_STORAGE_AK_ORDER_DEFERRED_COMMIT */
+}
+
+static void ak_order_commit_flush(bool save_pending)
+{
+#if defined(CONFIG_BT_FAST_PAIR_STORAGE_AK_ORDER_DEFERRED_COMMIT)
+	struct k_work_sync sync;
+
+	if (k_work_cancel_delayable_sync(&ak_order_save_work, &sync) && save_pending) {
+		ak_order_save_work_handle(NULL);
+	}
+#else
+	ARG_UNUSED(save_pending);
+#endif /* CONFIG_BT_FAST_PAIR_STORAGE_AK_ORDER_DEFERRED_COMMIT */
+}
+
 static int fp_settings_validate_ak_order(void)
 {
 	int err;
@@ -311,8 +373,7 @@ static int fp_settings_validate_ak_order(void)
 	}
 
 	if (ak_order_update_count > 0) {
-		err = settings_save_one(SETTINGS_AK_ORDER_FULL_NAME, account_key_order,
-					sizeof(account_key_order));
+		err = ak_order_settings_save();
 		if (err) {
 			return err;
 		}
@@ -580,18 +641,9 @@ int fp_storage_ak_find(struct fp_account_key *account_key,
 
 	for (size_t i = 0; i < account_key_count; i++) {
 		if (account_key_check_cb(&account_key_list[i], context)) {
-			int err;
-
 			ak_order_update_ram(ACCOUNT_KEY_METADATA_FIELD_GET(account_key_metadata[i],
 									   ID));
-			err = settings_save_one(SETTINGS_AK_ORDER_FULL_NAME, account_key_order,
-						sizeof(account_key_order));
-			if (err) {
-				LOG_ERR("Unable to save new Account Key order in Settings. "
-					"Not propagating the error and keeping updated Account Key "
-					"order in RAM. After the Settings error the Account Key "
-					"order may change at reboot.");
-			}
+			ak_order_commit();
 
 			if (account_key) {
 				*account_key = account_key_list[i];
@@ -739,14 +791,7 @@ int fp_storage_ak_save(const struct fp_account_key *account_key, const void *con
 	}
 
 	ak_order_update_ram(id);
-	err = settings_save_one(SETTINGS_AK_ORDER_FULL_NAME, account_key_order,
-				sizeof(account_key_order));
-	if (err) {
-		LOG_ERR("Unable to save new Account Key order in Settings. "
-			"Not propagating the error and keeping updated Account Key "
-			"order in RAM. After the Settings error the Account Key "
-			"order may change at reboot.");
-	}
+	ak_order_commit();
 
 	if (IS_ENABLED(CONFIG_BT_FAST_PAIR_STORAGE_AK_BOND) && ak_overwritten) {
 		/* Account Key overwritten. Remove bonds related with overwritten Account Key. */
@@ -967,6 +1012,9 @@ void fp_storage_ak_bond_delete(const bt_addr_le_t *addr)
 
 void fp_storage_ak_ram_clear(void)
 {
+	/* Drop a deferred Account Key order write, the order is being reset. */
+	ak_order_commit_flush(false);
+
 	memset(account_key_list, 0, sizeof(account_key_list));
 	memset(account_key_metadata, 0, sizeof(account_key_metadata));
 	account_key_count = 0;
@@ -1033,6 +1081,11 @@ static int fp_storage_ak_uninit(void)
 		return 0;
 	}
 
+	/* Persist a deferred Account Key order write before the module is
+	 * disabled.
+	 */
+	ak_order_commit_flush(true);
+
 	is_enabled = false;
 
 	return 0;
@@ -92,8 +92,48 @@ struct bt_gatt_dm {
 
 	/* Work item used for discovery callbacks. */
 	struct k_work discover_work;
+
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+	/* Peer identity address, captured when discovery starts. */
+	bt_addr_le_t peer;
+	/* Cache entry serving the current discovery, if any. */
+	struct cache_entry *cache_entry;
+	/* Discovery result may be stored in the cache. Only results of the
+	 * initial discovery are cached, as the cache can hold one service
+	 * instance per key and must hand out the first one.
+	 */
+	bool cacheable;
+#endif
+};
+
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+/* Cached discovery result, keyed by peer address and service UUID. The
+ * attribute user data chunks are moved from the instance to the entry when
+ * the result is released, so the attribute UUID pointers stay valid.
+ */
+struct cache_entry {
+	bool used;
+	/* Recency of use, for eviction */
+	uint32_t use_seq;
+	bt_addr_le_t peer;
+	bool svc_by_uuid;
+	union {
+		struct bt_uuid uuid;
+		struct bt_uuid_16 u16;
+		struct bt_uuid_32 u32;
+		struct bt_uuid_128 u128;
+	} svc_uuid;
+	/* End handle of the cached service, for bt_gatt_dm_continue */
+	uint16_t end_handle;
+	size_t attr_cnt;
+	struct bt_gatt_dm_attr attrs[CONFIG_BT_GATT_DM_MAX_ATTRS];
+	sys_slist_t chunk_list;
 };
 
+static struct cache_entry cache[CONFIG_BT_GATT_DM_CACHE_COUNT];
+static uint32_t cache_use_seq;
+#endif
+
 /* Currently only one instance is supported */
 static struct bt_gatt_dm bt_gatt_dm_inst;
 
@@ -156,6 +196,131 @@ static void svc_attr_memory_release(struct bt_gatt_dm *dm)
 	dm->cur_chunk_len = 0;
 }
 
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+static void cache_entry_release(struct cache_entry *entry)
+{
+	sys_snode_t *node;
+	struct data_chunk_item *item;
+
+	while (!sys_slist_is_empty(&entry->chunk_list)) {
+		node = sys_slist_get_not_empty(&entry->chunk_list);
+		item = CONTAINER_OF(node, struct data_chunk_item, node);
+		k_free(item);
+	}
+
+	entry->used = false;
+}
+
+static struct cache_entry *cache_find(const bt_addr_le_t *peer,
+				      const struct bt_uuid *uuid)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(cache); i++) {
+		struct cache_entry *entry = &cache[i];
+
+		if (!entry->used || !bt_addr_le_eq(&entry->peer, peer)) {
+			continue;
+		}
+
+		if (uuid ? (entry->svc_by_uuid &&
+			    (bt_uuid_cmp(&entry->svc_uuid.uuid, uuid) == 0)) :
+			   !entry->svc_by_uuid) {
+			return entry;
+		}
+	}
+
+	return NULL;
+}
+
+static struct cache_entry *cache_entry_alloc(void)
+{
+	struct cache_entry *entry = &cache[0];
+
+	for (size_t i = 0; i < ARRAY_SIZE(cache); i++) {
+		if (!cache[i].used) {
+			return &cache[i];
+		}
+
+		if (cache[i].use_seq < entry->use_seq) {
+			entry = &cache[i];
+		}
+	}
+
+	/* All entries in use, evict the least recently used one. */
+	cache_entry_release(entry);
+
+	return entry;
+}
+
+/* Move the discovery result from the instance to the cache. The user data
+ * chunks change owner, so the attribute UUID pointers remain valid.
+ */
+static void cache_store(struct bt_gatt_dm *dm)
+{
+	struct cache_entry *entry;
+
+	entry = cache_find(&dm->peer, dm->search_svc_by_uuid ?
+			   &dm->svc_uuid.uuid : NULL);
+	if (entry) {
+		cache_entry_release(entry);
+	} else {
+		entry = cache_entry_alloc();
+	}
+
+	bt_addr_le_copy(&entry->peer, &dm->peer);
+	entry->svc_by_uuid = dm->search_svc_by_uuid;
+	if (dm->search_svc_by_uuid) {
+		memcpy(&entry->svc_uuid, &dm->svc_uuid, sizeof(entry->svc_uuid));
+	}
+	entry->end_handle = dm->discover_params.end_handle;
+	entry->attr_cnt = dm->cur_attr_id;
+	memcpy(entry->attrs, dm->attrs, dm->cur_attr_id * sizeof(dm->attrs[0]));
+
+	entry->chunk_list = dm->chunk_list;
+	sys_slist_init(&dm->chunk_list);
+	dm->cur_chunk_len = 0;
+	dm->cur_attr_id = 0;
+
+	entry->use_seq = ++cache_use_seq;
+	entry->used = true;
+}
+
+/* Populate the instance from a cache entry. The attribute UUID pointers
+ * refer to chunks that stay owned by the cache.
+ */
+static void cache_serve(struct bt_gatt_dm *dm, struct cache_entry *entry)
+{
+	memcpy(dm->attrs, entry->attrs, entry->attr_cnt * sizeof(dm->attrs[0]));
+	dm->cur_attr_id = entry->attr_cnt;
+	dm->discover_params.end_handle = entry->end_handle;
+
+	entry->use_seq = ++cache_use_seq;
+	dm->cache_entry = entry;
+}
+
+int bt_gatt_dm_cache_invalidate(const bt_addr_le_t *peer)
+{
+	int count = 0;
+
+	for (size_t i = 0; i < ARRAY_SIZE(cache); i++) {
+		struct cache_entry *entry = &cache[i];
+
+		if (entry->used && (!peer || bt_addr_le_eq(&entry->peer, peer))) {
+			/* Skip an entry that is serving an ongoing discovery,
+			 * its chunks are referenced by the instance.
+			 */
+			if (bt_gatt_dm_inst.cache_entry == entry) {
+				continue;
+			}
+
+			cache_entry_release(entry);
+			count++;
+		}
+	}
+
+	return count;
+}
+#endif /* CONFIG_BT_GATT_DM_CACHE */
+
 /* Returns size of UUID structure with padding for memory alignment */
 static size_t get_uuid_size(const struct bt_uuid *uuid)
 {
@@ -307,6 +472,14 @@ static void gatt_discover_work(struct k_work *work)
 		return;
 	}
 
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+	if (dm->cache_entry) {
+		LOG_DBG("Serving discovery from cache");
+		discovery_complete(dm);
+		return;
+	}
+#endif
+
 	int err = bt_gatt_discover(dm->conn, &(dm->discover_params));
 
 	if (err) {
@@ -679,6 +852,28 @@ int bt_gatt_dm_start(struct bt_conn *conn,
 	dm->discover_params.type = BT_GATT_DISCOVER_PRIMARY;
 	k_work_init(&dm->discover_work, gatt_discover_work);
 
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+	struct cache_entry *entry;
+
+	bt_addr_le_copy(&dm->peer, bt_conn_get_dst(conn));
+	dm->cache_entry = NULL;
+	dm->cacheable = true;
+
+	entry = cache_find(&dm->peer, svc_uuid);
+	if (entry) {
+		/* Complete asynchronously from the discovery workqueue, as a
+		 * regular discovery would.
+		 */
+		cache_serve(dm, entry);
+#if defined(CONFIG_BT_GATT_DM_WORKQ_OWN)
+		k_work_submit_to_queue(&bt_gatt_dm_wq, &dm->discover_work);
+#else
+		k_work_submit(&dm->discover_work);
+#endif
+		return 0;
+	}
+#endif
+
 	err = bt_gatt_discover(conn, &dm->discover_params);
 	if (err) {
 		LOG_ERR("Discover failed, error: %d.", err);
@@ -717,6 +912,12 @@ int bt_gatt_dm_continue(struct bt_gatt_dm *dm, void *context)
 	}
 
 	dm->context = context;
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+	/* Only the initial discovery result is cached; see the cacheable
+	 * member description.
+	 */
+	dm->cacheable = false;
+#endif
 	dm->discover_params.start_handle = dm->discover_params.end_handle + 1;
 	dm->discover_params.end_handle = 0xffff;
 	dm->discover_params.type = BT_GATT_DISCOVER_PRIMARY;
@@ -740,6 +941,17 @@ int bt_gatt_dm_data_release(struct bt_gatt_dm *dm)
 	}
 
 	k_work_cancel(&dm->discover_work);
+
+#if defined(CONFIG_BT_GATT_DM_CACHE)
+	if (dm->cache_entry) {
+		/* The attribute chunks are owned by the cache. */
+		dm->cache_entry = NULL;
+		dm->cur_attr_id = 0;
+	} else if (dm->cacheable && dm->cur_attr_id > 0) {
+		cache_store(dm);
+	}
+#endif
+
 	svc_attr_memory_release(dm);
 	atomic_clear_bit(dm->state_flags, STATE_ATTRS_LOCKED);
 
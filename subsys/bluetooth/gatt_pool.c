@@ -6,6 +6,7 @@
 
 #include <errno.h>
 #include <bluetooth/gatt_pool.h>
+#include <zephyr/spinlock.h>
 #include <zephyr/logging/log.h>
 
 LOG_MODULE_REGISTER(bt_gatt_pool, CONFIG_BT_GATT_POOL_LOG_LEVEL);
@@ -14,63 +15,88 @@ LOG_MODULE_REGISTER(bt_gatt_pool, CONFIG_BT_GATT_POOL_LOG_LEVEL);
 struct svc_el_pool {
 	void *elements;
 	atomic_t *locks;
+	/* Stack of free element indexes, for allocation in constant time */
+	uint16_t *free_stack;
+	uint16_t free_cnt;
+	/* Most elements ever in use at the same time, for pool sizing */
+	uint16_t high_water;
+	bool initialized;
 };
 
+/* Protects the free stacks of all the pools */
+static struct k_spinlock pool_lock;
+
 #if CONFIG_BT_GATT_UUID16_POOL_SIZE != 0
 static struct bt_uuid_16 uuid_16_tab[CONFIG_BT_GATT_UUID16_POOL_SIZE];
 static ATOMIC_DEFINE(uuid_16_locks, ARRAY_SIZE(uuid_16_tab));
+static uint16_t uuid_16_free_stack[ARRAY_SIZE(uuid_16_tab)];
 #define BT_UUID_16_TAB uuid_16_tab
 #define BT_UUID_16_LOCKS uuid_16_locks
+#define BT_UUID_16_FREE_STACK uuid_16_free_stack
 #else
 #define BT_UUID_16_TAB NULL
 #define BT_UUID_16_LOCKS NULL
+#define BT_UUID_16_FREE_STACK NULL
 #endif
 
 #if CONFIG_BT_GATT_UUID32_POOL_SIZE != 0
 static struct bt_uuid_32 uuid_32_tab[CONFIG_BT_GATT_UUID32_POOL_SIZE];
 static ATOMIC_DEFINE(uuid_32_locks, ARRAY_SIZE(uuid_32_tab));
+static uint16_t uuid_32_free_stack[ARRAY_SIZE(uuid_32_tab)];
 #define BT_UUID_32_TAB uuid_32_tab
 #define BT_UUID_32_LOCKS uuid_32_locks
+#define BT_UUID_32_FREE_STACK uuid_32_free_stack
 #else
 #define BT_UUID_32_TAB NULL
 #define BT_UUID_32_LOCKS NULL
+#define BT_UUID_32_FREE_STACK NULL
 #endif
 
 #if CONFIG_BT_GATT_UUID128_POOL_SIZE != 0
 static struct bt_uuid_128 uuid_128_tab[CONFIG_BT_GATT_UUID128_POOL_SIZE];
 static ATOMIC_DEFINE(uuid_128_locks, ARRAY_SIZE(uuid_128_tab));
+static uint16_t uuid_128_free_stack[ARRAY_SIZE(uuid_128_tab)];
 #define BT_UUID_128_TAB uuid_128_tab
 #define BT_UUID_128_LOCKS uuid_128_locks
+#define BT_UUID_128_FREE_STACK uuid_128_free_stack
 #else
 #define BT_UUID_128_TAB NULL
 #define BT_UUID_128_LOCKS NULL
+#define BT_UUID_128_FREE_STACK NULL
 #endif
 
 #if CONFIG_BT_GATT_CHRC_POOL_SIZE != 0
 static struct bt_gatt_chrc chrc_tab[CONFIG_BT_GATT_CHRC_POOL_SIZE];
 static ATOMIC_DEFINE(chrc_locks, ARRAY_SIZE(chrc_tab));
+static uint16_t chrc_free_stack[ARRAY_SIZE(chrc_tab)];
 #define BT_GATT_CHRC_TAB chrc_tab
 #define BT_GATT_CHRC_LOCKS chrc_locks
+#define BT_GATT_CHRC_FREE_STACK chrc_free_stack
 #else
 #define BT_GATT_CHRC_TAB NULL
 #define BT_GATT_CHRC_LOCKS NULL
+#define BT_GATT_CHRC_FREE_STACK NULL
 #endif
 
 static struct svc_el_pool uuid_16_pool = {
 	.elements = BT_UUID_16_TAB,
 	.locks = BT_UUID_16_LOCKS,
+	.free_stack = BT_UUID_16_FREE_STACK,
 };
 static struct svc_el_pool uuid_32_pool = {
 	.elements = BT_UUID_32_TAB,
 	.locks = BT_UUID_32_LOCKS,
+	.free_stack = BT_UUID_32_FREE_STACK,
 };
 static struct svc_el_pool uuid_128_pool = {
 	.elements = BT_UUID_128_TAB,
 	.locks = BT_UUID_128_LOCKS,
+	.free_stack = BT_UUID_128_FREE_STACK,
 };
 static struct svc_el_pool chrc_pool = {
 	.elements = BT_GATT_CHRC_TAB,
 	.locks = BT_GATT_CHRC_LOCKS,
+	.free_stack = BT_GATT_CHRC_FREE_STACK,
 };
 
 static struct bt_uuid const * const uuid_primary = BT_UUID_GATT_PRIMARY;
@@ -90,15 +116,53 @@ static struct bt_uuid const * const uuid_ccc = BT_UUID_GATT_CCC;
 
 static size_t free_element_find(struct svc_el_pool *el_pool, size_t el_cnt)
 {
+	k_spinlock_key_t key;
+	size_t used;
+	size_t ind;
+
 	__ASSERT((el_pool->elements != NULL) && (el_pool->locks != NULL),
 		 "Pool uninitialized");
 
-	for (size_t i = 0; i < el_cnt; i++) {
-		if (!atomic_test_and_set_bit(el_pool->locks, i)) {
-			return i;
+	key = k_spin_lock(&pool_lock);
+
+	if (!el_pool->initialized) {
+		for (size_t i = 0; i < el_cnt; i++) {
+			el_pool->free_stack[i] = el_cnt - 1 - i;
 		}
+		el_pool->free_cnt = el_cnt;
+		el_pool->initialized = true;
+	}
+
+	if (el_pool->free_cnt == 0) {
+		k_spin_unlock(&pool_lock, key);
+		return el_cnt;
+	}
+
+	ind = el_pool->free_stack[--el_pool->free_cnt];
+
+	used = el_cnt - el_pool->free_cnt;
+	if (used > el_pool->high_water) {
+		el_pool->high_water = used;
+	}
+
+	k_spin_unlock(&pool_lock, key);
+
+	atomic_set_bit(el_pool->locks, ind);
+
+	return ind;
+}
+
+static void element_release(struct svc_el_pool *el_pool, size_t ind)
+{
+	k_spinlock_key_t key = k_spin_lock(&pool_lock);
+
+	if (atomic_test_and_clear_bit(el_pool->locks, ind)) {
+		el_pool->free_stack[el_pool->free_cnt++] = ind;
+	} else {
+		__ASSERT(false, "Releasing an element that is not in use");
 	}
-	return el_cnt;
+
+	k_spin_unlock(&pool_lock, key);
 }
 
 static int uuid_16_get(struct bt_uuid **uuid, struct svc_el_pool *uuid_pool)
@@ -163,8 +227,7 @@ static int chrc_get(struct bt_gatt_chrc **chrc)
 static void chrc_release(struct bt_gatt_chrc const *chrc)
 {
 	EL_IN_POOL_VERIFY(BT_GATT_CHRC_TAB, chrc);
-	atomic_clear_bit(chrc_pool.locks,
-			 ADDR_2_INDEX(BT_GATT_CHRC_TAB, chrc));
+	element_release(&chrc_pool, ADDR_2_INDEX(BT_GATT_CHRC_TAB, chrc));
 }
 
 static int uuid_register(struct bt_uuid **dest_uuid,
@@ -210,24 +273,24 @@ static void uuid_unregister(struct bt_uuid const *uuid)
 	case BT_UUID_TYPE_16:
 		EL_IN_POOL_VERIFY(BT_UUID_16_TAB, uuid);
 #if CONFIG_BT_GATT_UUID16_POOL_SIZE != 0
-		atomic_clear_bit(uuid_16_pool.locks,
-				 ADDR_2_INDEX(BT_UUID_16_TAB, uuid));
+		element_release(&uuid_16_pool,
+				ADDR_2_INDEX(BT_UUID_16_TAB, uuid));
 #endif
 		break;
 
 	case BT_UUID_TYPE_32:
 		EL_IN_POOL_VERIFY(BT_UUID_32_TAB, uuid);
 #if CONFIG_BT_GATT_UUID32_POOL_SIZE != 0
-		atomic_clear_bit(uuid_32_pool.locks,
-				 ADDR_2_INDEX(BT_UUID_32_TAB, uuid));
+		element_release(&uuid_32_pool,
+				ADDR_2_INDEX(BT_UUID_32_TAB, uuid));
 #endif
 		break;
 
 	case BT_UUID_TYPE_128:
 		EL_IN_POOL_VERIFY(BT_UUID_128_TAB, uuid);
 #if CONFIG_BT_GATT_UUID128_POOL_SIZE != 0
-		atomic_clear_bit(uuid_128_pool.locks,
-				 ADDR_2_INDEX(BT_UUID_128_TAB, uuid));
+		element_release(&uuid_128_pool,
+				ADDR_2_INDEX(BT_UUID_128_TAB, uuid));
 #endif
 		break;
 
@@ -443,8 +506,9 @@ void bt_gatt_pool_stats_print(void)
 	used_el_cnt = mask_print(BT_UUID_16_LOCKS,
 				 ARRAY_SIZE(BT_UUID_16_LOCKS));
 
-	printk("\nPool element usage: %d out of %d\n\n", used_el_cnt,
-	       CONFIG_BT_GATT_UUID16_POOL_SIZE);
+	printk("\nPool element usage: %d out of %d, high-water mark: %d\n\n",
+	       used_el_cnt, CONFIG_BT_GATT_UUID16_POOL_SIZE,
+	       uuid_16_pool.high_water);
 #endif
 
 #if CONFIG_BT_GATT_UUID32_POOL_SIZE != 0
@@ -453,8 +517,9 @@ void bt_gatt_pool_stats_print(void)
 	used_el_cnt = mask_print(BT_UUID_32_LOCKS,
 				 ARRAY_SIZE(BT_UUID_32_LOCKS));
 
-	printk("\nPool element usage: %d out of %d\n\n", used_el_cnt,
-	       CONFIG_BT_GATT_UUID32_POOL_SIZE);
+	printk("\nPool element usage: %d out of %d, high-water mark: %d\n\n",
+	       used_el_cnt, CONFIG_BT_GATT_UUID32_POOL_SIZE,
+	       uuid_32_pool.high_water);
 #endif
 
 #if CONFIG_BT_GATT_UUID128_POOL_SIZE != 0
@@ -463,8 +528,9 @@ void bt_gatt_pool_stats_print(void)
 	used_el_cnt = mask_print(BT_UUID_128_LOCKS,
 				 ARRAY_SIZE(BT_UUID_128_LOCKS));
 
-	printk("\nPool element usage: %d out of %d\n\n", used_el_cnt,
-	       CONFIG_BT_GATT_UUID128_POOL_SIZE);
+	printk("\nPool element usage: %d out of %d, high-water mark: %d\n\n",
+	       used_el_cnt, CONFIG_BT_GATT_UUID128_POOL_SIZE,
+	       uuid_128_pool.high_water);
 #endif
 
 #if CONFIG_BT_GATT_CHRC_POOL_SIZE != 0
@@ -473,8 +539,9 @@ void bt_gatt_pool_stats_print(void)
 	used_el_cnt = mask_print(BT_GATT_CHRC_LOCKS,
 				 ARRAY_SIZE(BT_GATT_CHRC_LOCKS));
 
-	printk("\nPool element usage: %d out of %d\n\n", used_el_cnt,
-	       CONFIG_BT_GATT_CHRC_POOL_SIZE);
+	printk("\nPool element usage: %d out of %d, high-water mark: %d\n\n",
+	       used_el_cnt, CONFIG_BT_GATT_CHRC_POOL_SIZE,
+	       chrc_pool.high_water);
 #endif
 }
 #endif /* CONFIG_BT_GATT_POOL_STATS */
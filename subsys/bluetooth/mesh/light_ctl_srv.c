@@ -501,7 +501,7 @@ int bt_mesh_light_ctl_pub(struct bt_mesh_light_ctl_srv *srv,
 				 BT_MESH_LIGHT_CTL_MSG_MAXLEN_STATUS);
 
 	ctl_encode_status(&msg, status);
-	return bt_mesh_msg_send(srv->model, ctx, &msg);
+	return model_status_send(srv->model, ctx, &msg);
 }
 
 int bt_mesh_light_ctl_range_pub(struct bt_mesh_light_ctl_srv *srv,
@@ -17,6 +17,9 @@
 #include <bluetooth/mesh/model_types.h>
 #include <bluetooth/mesh/gen_dtt_srv.h>
 #include "mesh/msg.h"
+#if defined(CONFIG_BT_MESH_PUB_COALESCE)
+#include "pub_agg.h"
+#endif
 
 #if IS_ENABLED(CONFIG_EMDS)
 /**
@@ -93,6 +96,24 @@ model_transition_is_invalid(const struct bt_mesh_model_transition *transition)
 
 int32_t model_ackd_timeout_get(const struct bt_mesh_model *model, struct bt_mesh_msg_ctx *ctx);
 
+/** @brief Send a status message, coalescing publications when enabled.
+ *
+ * Behaves as bt_mesh_msg_send, except that publications (@p ctx is NULL)
+ * go through the publication aggregator when
+ * @kconfig{CONFIG_BT_MESH_PUB_COALESCE} is enabled.
+ */
+static inline int model_status_send(const struct bt_mesh_model *model,
+				    struct bt_mesh_msg_ctx *ctx,
+				    struct net_buf_simple *buf)
+{
+#if defined(CONFIG_BT_MESH_PUB_COALESCE)
+	if (ctx == NULL) {
+		return bt_mesh_pub_agg_send(model, buf);
+	}
+#endif
+	return bt_mesh_msg_send(model, ctx, buf);
+}
+
 #endif /* MODEL_UTILS_H__ */
 
 /** @} */
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/bluetooth/mesh.h>
+#include "mesh/msg.h"
+#include "pub_agg.h"
+
+#define LOG_LEVEL CONFIG_BT_MESH_MODEL_LOG_LEVEL
+#include "zephyr/logging/log.h"
+LOG_MODULE_REGISTER(bt_mesh_pub_agg);
+
+struct pub_slot {
+	const struct bt_mesh_model *model;
+	uint8_t len;
+	uint8_t data[CONFIG_BT_MESH_PUB_COALESCE_MSG_SIZE];
+};
+
+static struct pub_slot slots[CONFIG_BT_MESH_PUB_COALESCE_SLOTS];
+static uint8_t slot_count;
+static K_MUTEX_DEFINE(pub_agg_lock);
+
+static void pub_agg_flush(struct k_work *work)
+{
+	struct pub_slot pending[ARRAY_SIZE(slots)];
+	uint8_t count;
+	int err;
+
+	k_mutex_lock(&pub_agg_lock, K_FOREVER);
+	count = slot_count;
+	memcpy(pending, slots, count * sizeof(slots[0]));
+	slot_count = 0;
+	k_mutex_unlock(&pub_agg_lock);
+
+	for (uint8_t i = 0; i < count; i++) {
+		struct net_buf_simple buf;
+
+		net_buf_simple_init_with_data(&buf, pending[i].data, pending[i].len);
+
+		err = bt_mesh_msg_send(pending[i].model, NULL, &buf);
+		if (err) {
+			LOG_WRN("Coalesced publication failed (err %d)", err);
+		}
+	}
+}
+
+static K_WORK_DELAYABLE_DEFINE(pub_agg_work, pub_agg_flush);
+
+int bt_mesh_pub_agg_send(const struct bt_mesh_model *model, struct net_buf_simple *buf)
+{
+	struct pub_slot *slot = NULL;
+
+	if (buf->len > CONFIG_BT_MESH_PUB_COALESCE_MSG_SIZE) {
+		return bt_mesh_msg_send(model, NULL, buf);
+	}
+
+	k_mutex_lock(&pub_agg_lock, K_FOREVER);
+
+	/* A status publication is a snapshot of the model state, so a newer
+	 * one supersedes whatever is already queued for the model.
+	 */
+	for (uint8_t i = 0; i < slot_count; i++) {
+		if (slots[i].model == model) {
+			slot = &slots[i];
+			break;
+		}
+	}
+
+	if (!slot) {
+		if (slot_count == ARRAY_SIZE(slots)) {
+			k_mutex_unlock(&pub_agg_lock);
+			return bt_mesh_msg_send(model, NULL, buf);
+		}
+
+		slot = &slots[slot_count++];
+		slot->model = model;
+	}
+
+	memcpy(slot->data, buf->data, buf->len);
+	slot->len = buf->len;
+
+	k_mutex_unlock(&pub_agg_lock);
+
+	/* The window is anchored at the first queued publication;
+	 * k_work_schedule does not push out an already scheduled flush.
+	 */
+	k_work_schedule(&pub_agg_work, K_MSEC(CONFIG_BT_MESH_PUB_COALESCE_WINDOW_MS));
+
+	return 0;
+}
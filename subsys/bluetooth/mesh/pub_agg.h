@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+/**
+ * @file
+ * @defgroup bt_mesh_pub_agg Publication aggregator.
+ * @{
+ * @brief Internal aggregator coalescing model status publications.
+ */
+#ifndef PUB_AGG_H__
+#define PUB_AGG_H__
+
+#include <zephyr/bluetooth/mesh.h>
+
+/** @brief Queue a status publication for coalesced transmission.
+ *
+ * The message is held back for up to
+ * @kconfig{CONFIG_BT_MESH_PUB_COALESCE_WINDOW_MS} and sent back to back
+ * with other publications queued within the same window. A newer status
+ * publication from the same model replaces a queued one. Messages that do
+ * not fit the aggregator are published immediately.
+ *
+ * @param model Model to publish on.
+ * @param buf   Encoded status message.
+ *
+ * @retval 0 The message was queued or published.
+ * Otherwise, a (negative) error code is returned.
+ */
+int bt_mesh_pub_agg_send(const struct bt_mesh_model *model, struct net_buf_simple *buf);
+
+#endif /* PUB_AGG_H__ */
+
+/** @} */
@@ -22,6 +22,74 @@ static struct bt_mesh_rpl replay_list[CONFIG_BT_MESH_CRPL];
 
 EMDS_STATIC_ENTRY_DEFINE(rpl_store, CONFIG_BT_MESH_RPL_INDEX, replay_list, sizeof(replay_list));
 
+#if defined(CONFIG_BT_MESH_RPL_FAST_LOOKUP)
+/* Index of the used replay_list slots, sorted by source address, so that
+ * lookups can binary search instead of scanning the list. The index is not
+ * persisted; it is rebuilt on the first lookup, after the replay list has
+ * been restored from Emergency Data Storage, and invalidated whenever the
+ * list is cleared or compacted.
+ */
+static uint16_t rpl_index[CONFIG_BT_MESH_CRPL];
+static uint16_t rpl_index_count;
+static bool rpl_index_valid;
+
+static void rpl_index_insert(const struct bt_mesh_rpl *rpl)
+{
+	uint16_t slot = rpl - replay_list;
+	uint16_t low = 0;
+	uint16_t high = rpl_index_count;
+
+	while (low < high) {
+		uint16_t mid = (low + high) / 2;
+
+		if (replay_list[rpl_index[mid]].src < rpl->src) {
+			low = mid + 1;
+		} else {
+			high = mid;
+		}
+	}
+
+	memmove(&rpl_index[low + 1], &rpl_index[low],
+		(rpl_index_count - low) * sizeof(rpl_index[0]));
+	rpl_index[low] = slot;
+	rpl_index_count++;
+}
+
+static void rpl_index_build(void)
+{
+	rpl_index_count = 0;
+
+	for (int i = 0; i < ARRAY_SIZE(replay_list); i++) {
+		if (replay_list[i].src) {
+			rpl_index_insert(&replay_list[i]);
+		}
+	}
+
+	rpl_index_valid = true;
+}
+
+static struct bt_mesh_rpl *rpl_index_find(uint16_t src)
+{
+	uint16_t low = 0;
+	uint16_t high = rpl_index_count;
+
+	while (low < high) {
+		uint16_t mid = (low + high) / 2;
+		struct bt_mesh_rpl *rpl = &replay_list[rpl_index[mid]];
+
+		if (rpl->src == src) {
+			return rpl;
+		} else if (rpl->src < src) {
+			low = mid + 1;
+		} else {
+			high = mid;
+		}
+	}
+
+	return NULL;
+}
+#endif /* CONFIG_BT_MESH_RPL_FAST_LOOKUP */
+
 void bt_mesh_rpl_update(struct bt_mesh_rpl *rpl,
 		struct bt_mesh_net_rx *rx)
 {
@@ -32,6 +100,16 @@ void bt_mesh_rpl_update(struct bt_mesh_rpl *rpl,
 		rpl->seg = 0;
 	}
 
+#if defined(CONFIG_BT_MESH_RPL_FAST_LOOKUP)
+	/* The slot may have been handed out empty by bt_mesh_rpl_check, for
+	 * example for a segmented message, and populated only now.
+	 */
+	if (rpl_index_valid && !rpl->src) {
+		rpl->src = rx->ctx.addr;
+		rpl_index_insert(rpl);
+	}
+#endif
+
 	rpl->src = rx->ctx.addr;
 	rpl->seq = rx->seq;
 	rpl->old_iv = rx->old_iv;
@@ -45,8 +123,6 @@ void bt_mesh_rpl_update(struct bt_mesh_rpl *rpl,
 bool bt_mesh_rpl_check(struct bt_mesh_net_rx *rx,
 		struct bt_mesh_rpl **match, bool bridge)
 {
-	int i;
-
 	/* Don't bother checking messages from ourselves */
 	if (rx->net_if == BT_MESH_NET_IF_LOCAL) {
 		return false;
@@ -57,7 +133,51 @@ bool bt_mesh_rpl_check(struct bt_mesh_net_rx *rx,
 		return false;
 	}
 
-	for (i = 0; i < ARRAY_SIZE(replay_list); i++) {
+#if defined(CONFIG_BT_MESH_RPL_FAST_LOOKUP)
+	struct bt_mesh_rpl *rpl;
+
+	if (!rpl_index_valid) {
+		rpl_index_build();
+	}
+
+	rpl = rpl_index_find(rx->ctx.addr);
+	if (!rpl) {
+		if (rpl_index_count == ARRAY_SIZE(replay_list)) {
+			LOG_ERR("RPL is full!");
+			return true;
+		}
+
+		/* The used slots form a prefix of the list, as entries are
+		 * allocated in order and the list is compacted on IV update.
+		 */
+		rpl = &replay_list[rpl_index_count];
+
+		if (match) {
+			*match = rpl;
+		} else {
+			bt_mesh_rpl_update(rpl, rx);
+		}
+
+		return false;
+	}
+
+	if (rx->old_iv && !rpl->old_iv) {
+		return true;
+	}
+
+	if ((!rx->old_iv && rpl->old_iv) || rpl->seq < rx->seq) {
+		if (match) {
+			*match = rpl;
+		} else {
+			bt_mesh_rpl_update(rpl, rx);
+		}
+
+		return false;
+	}
+
+	return true;
+#else
+	for (int i = 0; i < ARRAY_SIZE(replay_list); i++) {
 		struct bt_mesh_rpl *rpl = &replay_list[i];
 
 		/* Empty slot */
@@ -94,11 +214,16 @@ bool bt_mesh_rpl_check(struct bt_mesh_net_rx *rx,
 
 	LOG_ERR("RPL is full!");
 	return true;
+#endif /* CONFIG_BT_MESH_RPL_FAST_LOOKUP */
 }
 
 void bt_mesh_rpl_clear(void)
 {
 	(void)memset(replay_list, 0, sizeof(replay_list));
+
+#if defined(CONFIG_BT_MESH_RPL_FAST_LOOKUP)
+	rpl_index_count = 0;
+#endif
 }
 
 void bt_mesh_rpl_reset(void)
@@ -130,6 +255,11 @@ void bt_mesh_rpl_reset(void)
 	}
 
 	(void) memset(&replay_list[last - shift + 1], 0, sizeof(struct bt_mesh_rpl) * shift);
+
+#if defined(CONFIG_BT_MESH_RPL_FAST_LOOKUP)
+	/* Compaction moved the entries around, rebuild on the next lookup. */
+	rpl_index_valid = false;
+#endif
 }
 
 void bt_mesh_rpl_pending_store(uint16_t addr)
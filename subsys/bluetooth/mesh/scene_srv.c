@@ -6,6 +6,7 @@
 
 #include <stdint.h>
 #include <stdio.h>
+#include <string.h>
 #include <zephyr/bluetooth/mesh/access.h>
 #include <bluetooth/mesh/models.h>
 #include <zephyr/sys/byteorder.h>
@@ -343,6 +344,93 @@ static void page_recover(struct bt_mesh_scene_srv *srv, bool vnd,
 	}
 }
 
+#if defined(CONFIG_BT_MESH_SCENE_SRV_BATCHED_RECALL)
+/* Header prepended to each scene page buffered during a batched recall. */
+struct __packed recall_page {
+	uint16_t len;
+	uint8_t vnd;
+};
+
+static struct {
+	/* Whether a batched recall is in progress. */
+	bool active;
+	size_t len;
+	uint8_t buf[CONFIG_BT_MESH_SCENE_SRV_BATCHED_RECALL_BUF_SIZE];
+} recall_batch;
+
+static void recall_batch_apply(struct bt_mesh_scene_srv *srv)
+{
+	struct recall_page page;
+
+	for (size_t offset = 0; offset < recall_batch.len;
+	     offset += sizeof(page) + page.len) {
+		memcpy(&page, &recall_batch.buf[offset], sizeof(page));
+		page_recover(srv, page.vnd, &recall_batch.buf[offset + sizeof(page)], page.len);
+	}
+
+	recall_batch.len = 0;
+}
+
+static bool recall_batch_add(struct bt_mesh_scene_srv *srv, bool vnd,
+			     const uint8_t buf[], size_t len)
+{
+	struct recall_page page = { .len = len, .vnd = vnd };
+
+	if (!recall_batch.active) {
+		return false;
+	}
+
+	if (recall_batch.len + sizeof(page) + len > sizeof(recall_batch.buf)) {
+		/* Apply what has been buffered so far to preserve the page order,
+		 * then let the caller apply this page directly.
+		 */
+		recall_batch_apply(srv);
+
+		if (sizeof(page) + len > sizeof(recall_batch.buf)) {
+			return false;
+		}
+	}
+
+	memcpy(&recall_batch.buf[recall_batch.len], &page, sizeof(page));
+	memcpy(&recall_batch.buf[recall_batch.len + sizeof(page)], buf, len);
+	recall_batch.len += sizeof(page) + len;
+	return true;
+}
+
+static void recall_batch_start(void)
+{
+	recall_batch.active = true;
+	recall_batch.len = 0;
+}
+
+static void recall_batch_finish(struct bt_mesh_scene_srv *srv, bool apply)
+{
+	recall_batch.active = false;
+
+	if (apply) {
+		recall_batch_apply(srv);
+	} else {
+		recall_batch.len = 0;
+	}
+}
+#else
+static inline bool recall_batch_add(struct bt_mesh_scene_srv *srv, bool vnd,
+				    const uint8_t buf[], size_t len)
+{
+	return false;
+}
+
+static inline void recall_batch_start(void)
+{
+}
+
+static inline void recall_batch_finish(struct bt_mesh_scene_srv *srv, bool apply)
+{
+	ARG_UNUSED(srv);
+	ARG_UNUSED(apply);
+}
+#endif /* CONFIG_BT_MESH_SCENE_SRV_BATCHED_RECALL */
+
 static ssize_t entry_store(const struct bt_mesh_model *mod,
 			   const struct bt_mesh_scene_entry *entry, bool vnd,
 			   uint8_t buf[])
@@ -789,6 +877,14 @@ static int scene_srv_set(const struct bt_mesh_model *model, const char *path,
 	}
 
 	LOG_DBG("0x%x: %s", scene, bt_hex(buf, size));
+
+	/* During a batched recall the page is buffered and applied in one pass
+	 * with the other pages once all settings reads have completed.
+	 */
+	if (recall_batch_add(srv, vnd, buf, size)) {
+		return 0;
+	}
+
 	page_recover(srv, vnd, buf, size);
 	return 0;
 }
@@ -919,7 +1015,14 @@ int bt_mesh_scene_srv_set(struct bt_mesh_scene_srv *srv, uint16_t scene,
 
 	LOG_DBG("Loading %s", path);
 
+	/* Buffer the scene pages while the subtree is loaded, so that the model
+	 * states are applied in a single pass without flash reads in between and
+	 * all transitions start back to back.
+	 */
+	recall_batch_start();
 	err = settings_load_subtree(path);
+	recall_batch_finish(srv, err == 0);
+
 	if (!err) {
 		scene_recall_complete(srv);
 	}
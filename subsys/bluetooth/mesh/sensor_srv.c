@@ -233,6 +233,42 @@ column_get(const struct bt_mesh_sensor_series *series,
 	return NULL;
 }
 
+/** Index of the first column whose start value is not less than @c val. Only
+ *  valid when the column starts are sorted in ascending order.
+ */
+static uint32_t column_lower_bound(const struct bt_mesh_sensor_series *series,
+				   const struct bt_mesh_sensor_value *val)
+{
+	uint32_t lo = 0;
+	uint32_t hi = series->column_count;
+
+	while (lo < hi) {
+		uint32_t mid = lo + (hi - lo) / 2;
+
+		if (bt_mesh_sensor_value_compare(&series->columns[mid].start, val) < 0) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	return lo;
+}
+
+static const struct bt_mesh_sensor_column *
+column_search(const struct bt_mesh_sensor_series *series,
+	      const struct bt_mesh_sensor_value *val)
+{
+	uint32_t i = column_lower_bound(series, val);
+
+	if (i < series->column_count &&
+	    val->format->cb->compare(&series->columns[i].start, val) == 0) {
+		return &series->columns[i];
+	}
+
+	return NULL;
+}
+
 static int handle_column_get(const struct bt_mesh_model *model, struct bt_mesh_msg_ctx *ctx,
 			     struct net_buf_simple *buf)
 {
@@ -300,7 +336,8 @@ static int handle_column_get(const struct bt_mesh_model *model, struct bt_mesh_m
 
 	LOG_DBG("Column %s", bt_mesh_sensor_ch_str(&col_x));
 
-	col = column_get(&sensor->series, &col_x);
+	col = sensor->state.columns_sorted ? column_search(&sensor->series, &col_x) :
+					     column_get(&sensor->series, &col_x);
 	if (!col) {
 		LOG_WRN("Unknown column");
 		(void) sensor_ch_encode(&rsp, col_format, &col_x);
@@ -423,10 +460,22 @@ static int handle_series_get(const struct bt_mesh_model *model, struct bt_mesh_m
 		return -EMSGSIZE;
 	}
 
-	for (uint32_t i = 0; i < sensor->series.column_count; ++i) {
+	uint32_t first = 0;
+
+	if (ranged && sensor->state.columns_sorted) {
+		first = column_lower_bound(&sensor->series, &range_start);
+	}
+
+	for (uint32_t i = first; i < sensor->series.column_count; ++i) {
 		const struct bt_mesh_sensor_column *col =
 			&sensor->series.columns[i];
 
+		if (ranged && sensor->state.columns_sorted &&
+		    bt_mesh_sensor_value_compare(&col->start, &range_end) > 0) {
+			/* The columns are sorted, no later column is in range. */
+			break;
+		}
+
 		if (ranged &&
 		    !BT_MESH_SENSOR_VALUE_IN_RANGE(&col->start, &range_start, &range_end)) {
 			continue;
@@ -1008,6 +1057,22 @@ static int sensor_srv_init(const struct bt_mesh_model *model)
 		min_id = best->type->id + 1;
 	}
 
+	/* Series columns sorted by ascending start value can be binary searched
+	 * when handling column and series queries.
+	 */
+	for (int i = 0; i < srv->sensor_count; ++i) {
+		struct bt_mesh_sensor *s = srv->sensor_array[i];
+
+		s->state.columns_sorted = (s->series.columns && s->series.column_count);
+
+		for (uint32_t j = 1; s->state.columns_sorted && j < s->series.column_count; ++j) {
+			if (bt_mesh_sensor_value_compare(&s->series.columns[j - 1].start,
+							 &s->series.columns[j].start) >= 0) {
+				s->state.columns_sorted = 0;
+			}
+		}
+	}
+
 	srv->seq = 1;
 
 	srv->model = model;
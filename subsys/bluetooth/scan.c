@@ -14,6 +14,14 @@ LOG_MODULE_REGISTER(nrf_bt_scan, CONFIG_BT_SCAN_LOG_LEVEL);
 
 #define BT_SCAN_UUID_128_SIZE 16
 
+/* XOR of the 12 fixed bytes of the Bluetooth Base UUID
+ * (00000000-0000-1000-8000-00805F9B34FB). Folding a 16-bit or 32-bit UUID
+ * together with this constant gives the same value as folding its expanded
+ * 128-bit form, so UUIDs of different sizes hash consistently in the
+ * advertising data prefilter.
+ */
+#define BT_SCAN_UUID_BASE_FOLD 0x1b
+
 #define MODE_CHECK (BT_SCAN_NAME_FILTER | BT_SCAN_ADDR_FILTER | \
 	BT_SCAN_SHORT_NAME_FILTER | BT_SCAN_APPEARANCE_FILTER | \
 	BT_SCAN_UUID_FILTER | BT_SCAN_MANUFACTURER_DATA_FILTER)
@@ -110,6 +118,11 @@ struct bt_scan_uuid {
 		/* 128-bit UUID. */
 		struct bt_uuid_128 uuid_128;
 	} uuid_data;
+
+	/* Precomputed bit position of this UUID in the advertising data
+	 * prefilter mask.
+	 */
+	uint8_t prefilter_bit;
 };
 
 /* UUIDs filter structure.
@@ -524,13 +537,24 @@ static bool adv_addr_compare(const bt_addr_le_t *target_addr,
 {
 	const bt_addr_le_t *addr =
 			bt_scan.scan_filters.addr.target_addr;
-	uint8_t counter = bt_scan.scan_filters.addr.cnt;
+	size_t lo = 0;
+	size_t hi = bt_scan.scan_filters.addr.cnt;
 
-	for (size_t i = 0; i < counter; i++) {
-		if (bt_addr_le_cmp(target_addr, &addr[i]) == 0) {
-			control->filter_status.addr.addr = &addr[i];
+	/* The filter array is kept sorted on insertion,
+	 * so a binary search can be used here.
+	 */
+	while (lo < hi) {
+		size_t mid = lo + ((hi - lo) / 2);
+		int cmp = bt_addr_le_cmp(target_addr, &addr[mid]);
+
+		if (cmp == 0) {
+			control->filter_status.addr.addr = &addr[mid];
 
 			return true;
+		} else if (cmp > 0) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
 		}
 	}
 
@@ -562,24 +586,38 @@ static int scan_addr_filter_add(const bt_addr_le_t *target_addr)
 	bt_addr_le_t *addr_filter =
 			bt_scan.scan_filters.addr.target_addr;
 	uint8_t counter = bt_scan.scan_filters.addr.cnt;
+	size_t lo = 0;
+	size_t hi = counter;
 
 	/* If no memory for filter. */
 	if (counter >= CONFIG_BT_SCAN_ADDRESS_CNT) {
 		return -ENOMEM;
 	}
 
-	/* Check for duplicated filter. */
-	for (size_t i = 0; i < counter; i++) {
-		if (bt_addr_le_cmp(target_addr, &addr_filter[i]) == 0) {
+	/* Find the insertion point that keeps the filter array sorted.
+	 * The sorted order allows a binary search when matching
+	 * advertiser addresses. This also checks for a duplicated filter.
+	 */
+	while (lo < hi) {
+		size_t mid = lo + ((hi - lo) / 2);
+		int cmp = bt_addr_le_cmp(target_addr, &addr_filter[mid]);
+
+		if (cmp == 0) {
 			return 0;
+		} else if (cmp > 0) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
 		}
 	}
 
 	/* Add target address to filter. */
-	bt_addr_le_copy(&addr_filter[counter], target_addr);
+	memmove(&addr_filter[lo + 1], &addr_filter[lo],
+		(counter - lo) * sizeof(addr_filter[0]));
+	bt_addr_le_copy(&addr_filter[lo], target_addr);
 
 	LOG_DBG("Filter set on address type %i",
-		addr_filter[counter].type);
+		addr_filter[lo].type);
 
 	bt_addr_le_to_str(target_addr, addr, sizeof(addr));
 
@@ -777,30 +815,66 @@ static int scan_short_name_filter_add(const struct bt_scan_short_name *short_nam
 	return 0;
 }
 
-static bool find_uuid(const uint8_t *data,
-		      uint8_t data_len,
-		      uint8_t uuid_type,
-		      const struct bt_scan_uuid *target_uuid)
+static uint8_t uuid_data_len(uint8_t uuid_type)
 {
-	uint8_t uuid_len;
-
 	switch (uuid_type) {
 	case BT_UUID_TYPE_16:
-		uuid_len = sizeof(uint16_t);
-		break;
+		return sizeof(uint16_t);
 
 	case BT_UUID_TYPE_32:
-		uuid_len = sizeof(uint32_t);
-		break;
+		return sizeof(uint32_t);
 
 	case BT_UUID_TYPE_128:
-		uuid_len = BT_SCAN_UUID_128_SIZE * sizeof(uint8_t);
+		return BT_SCAN_UUID_128_SIZE * sizeof(uint8_t);
+
+	default:
+		return 0;
+	}
+}
+
+/* Fold the little-endian UUID bytes into a bit position for the prefilter
+ * mask. The same folding is applied to the UUIDs configured in the filter
+ * and to the UUIDs found in the advertising data, so a UUID can match a
+ * filter only if the filter bit is set in the advertisement mask.
+ */
+static uint8_t uuid_prefilter_hash(const uint8_t *data, uint8_t uuid_len)
+{
+	uint8_t fold = (uuid_len == BT_SCAN_UUID_128_SIZE) ?
+		       0 : BT_SCAN_UUID_BASE_FOLD;
+
+	for (size_t i = 0; i < uuid_len; i++) {
+		fold ^= data[i];
+	}
+
+	return fold % (sizeof(uint32_t) * BITS_PER_BYTE);
+}
+
+static uint8_t uuid_filter_hash(const struct bt_uuid *uuid)
+{
+	uint8_t raw[BT_SCAN_UUID_128_SIZE];
+
+	switch (uuid->type) {
+	case BT_UUID_TYPE_16:
+		sys_put_le16(BT_UUID_16(uuid)->val, raw);
+		break;
+
+	case BT_UUID_TYPE_32:
+		sys_put_le32(BT_UUID_32(uuid)->val, raw);
 		break;
 
 	default:
-		return false;
+		return uuid_prefilter_hash(BT_UUID_128(uuid)->val,
+					   BT_SCAN_UUID_128_SIZE);
 	}
 
+	return uuid_prefilter_hash(raw, uuid_data_len(uuid->type));
+}
+
+static bool find_uuid(const uint8_t *data,
+		      uint8_t data_len,
+		      uint8_t uuid_len,
+		      const struct bt_scan_uuid *target_uuid)
+{
 	for (size_t i = 0; i < data_len; i += uuid_len) {
 		struct bt_uuid_128 uuid;
 
@@ -823,12 +897,27 @@ static bool adv_uuid_compare(const struct bt_data *data, uint8_t uuid_type,
 			&bt_scan.scan_filters.uuid;
 	const bool all_filters_mode = bt_scan.scan_filters.all_mode;
 	const uint8_t counter = bt_scan.scan_filters.uuid.cnt;
+	const uint8_t uuid_len = uuid_data_len(uuid_type);
 	uint8_t data_len = data->data_len;
 	uint8_t uuid_match_cnt = 0;
+	uint32_t adv_mask = 0;
+
+	if (!uuid_len) {
+		return false;
+	}
+
+	/* Fold each UUID in the advertising data into the prefilter mask.
+	 * A filter whose precomputed bit is absent from the mask cannot
+	 * match, which rejects most filters without a full UUID comparison.
+	 */
+	for (size_t i = 0; i < data_len; i += uuid_len) {
+		adv_mask |= BIT(uuid_prefilter_hash(&data->data[i], uuid_len));
+	}
 
 	for (size_t i = 0; i < counter; i++) {
 
-		if (find_uuid(data->data, data_len, uuid_type,
+		if ((adv_mask & BIT(uuid_filter->uuid[i].prefilter_bit)) &&
+		    find_uuid(data->data, data_len, uuid_len,
 			      &uuid_filter->uuid[i])) {
 			control->filter_status.uuid.uuid[uuid_match_cnt] =
 				uuid_filter->uuid[i].uuid;
@@ -930,6 +1019,12 @@ static int scan_uuid_filter_add(struct bt_uuid *uuid)
 		return -EINVAL;
 	}
 
+	/* Precompute the prefilter mask bit used to reject this filter
+	 * against incoming advertising data without a full comparison.
+	 */
+	uuid_filter[counter].prefilter_bit =
+			uuid_filter_hash(uuid_filter[counter].uuid);
+
 	bt_scan.scan_filters.uuid.cnt++;
 	LOG_DBG("Added filter on UUID type %x", uuid->type);
 
@@ -145,6 +145,11 @@ bool bl_validate_firmware(uint32_t fw_dst_address, uint32_t fw_src_address)
 #include <zephyr/toolchain.h>
 #include <bl_crypto.h>
 #include "bl_validation_internal.h"
+#ifdef CONFIG_SB_CACHED_VALIDATION
+#include <fprotect.h>
+#include <nrfx_nvmc.h>
+#include <ocrypto_constant_time.h>
+#endif
 
 /* We keep the S0/S1 nomenclature, regardless of core, but partition S0/S1
  * targets differs. Below configuration, currently, addresses nRF5340
@@ -411,6 +416,108 @@ static bool validate_hash(const uint32_t fw_src_address, const uint32_t fw_size,
 }
 #endif
 
+#if defined(CONFIG_SB_CACHED_VALIDATION)
+#if USE_PARTITION_MANAGER
+#define VALIDATION_CACHE_ADDRESS	PM_VALIDATION_CACHE_ADDRESS
+#define VALIDATION_CACHE_SIZE		PM_VALIDATION_CACHE_SIZE
+#else
+#define VALIDATION_CACHE_ADDRESS	PARTITION_ADDRESS(validation_cache_partition)
+#define VALIDATION_CACHE_SIZE		PARTITION_SIZE(validation_cache_partition)
+#endif
+
+#define VALIDATION_CACHE_MAGIC 0x18f02c96
+
+/* Record of the last successful signature validation. The full image hash is
+ * recomputed on every boot; only the signature check is skipped when the hash
+ * matches. The page holding the record is locked with fprotect before booting.
+ */
+struct validation_cache {
+	uint32_t magic;
+	uint32_t address;
+	uint32_t version;
+	uint32_t size;
+	uint8_t hash[CONFIG_SB_HASH_LEN];
+};
+
+BUILD_ASSERT(sizeof(struct validation_cache) % 4 == 0,
+	     "struct validation_cache must be word sized for flash writes.");
+
+static bool image_hash_get(uint32_t fw_src_address, uint32_t fw_size, uint8_t *hash)
+{
+	bl_sha256_ctx_t ctx;
+	int retval = bl_sha256_init(&ctx);
+
+	if (retval != 0) {
+		return false;
+	}
+
+	retval = bl_sha256_update(&ctx,
+				  (const uint8_t *)fw_src_address + FIRMWARE_HEADER_SKIP,
+				  fw_size - FIRMWARE_HEADER_SKIP);
+	if (retval != 0) {
+		return false;
+	}
+
+	return bl_sha256_finalize(&ctx, hash) == 0;
+}
+
+static void validation_cache_store(uint32_t fw_dst_address, const struct fw_info *fwinfo,
+				   const uint8_t *hash)
+{
+	struct validation_cache cache = {
+		.magic = VALIDATION_CACHE_MAGIC,
+		.address = fw_dst_address,
+		.version = fwinfo->version,
+		.size = fwinfo->size,
+	};
+	nrfx_err_t err;
+
+	memcpy(cache.hash, hash, sizeof(cache.hash));
+
+	err = nrfx_nvmc_page_erase(VALIDATION_CACHE_ADDRESS);
+	if (err != NRFX_SUCCESS) {
+		LOG_WRN("Could not erase validation cache page: 0x%x", err);
+		return;
+	}
+
+	nrfx_nvmc_words_write(VALIDATION_CACHE_ADDRESS, (const uint32_t *)&cache,
+			      sizeof(cache) / 4);
+}
+
+static bool validate_cached(uint32_t fw_dst_address, uint32_t fw_src_address,
+			    const struct fw_info *fwinfo,
+			    const struct fw_validation_info *fw_val_info)
+{
+	const struct validation_cache *cache =
+		(const struct validation_cache *)VALIDATION_CACHE_ADDRESS;
+	uint8_t hash[CONFIG_SB_HASH_LEN];
+
+	if ((bl_crypto_init() != 0) ||
+	    !image_hash_get(fw_src_address, fwinfo->size, hash)) {
+		LOG_WRN("Could not hash image, falling back to signature validation.");
+		return validate_signature(fw_src_address, fwinfo->size, fw_val_info,
+					  false);
+	}
+
+	if ((cache->magic == VALIDATION_CACHE_MAGIC) &&
+	    (cache->address == fw_dst_address) &&
+	    (cache->version == fwinfo->version) &&
+	    (cache->size == fwinfo->size) &&
+	    ocrypto_constant_time_equal(cache->hash, hash, CONFIG_SB_HASH_LEN)) {
+		LOG_INF("Image hash matches cached validation, skipping signature check.");
+		return true;
+	}
+
+	if (!validate_signature(fw_src_address, fwinfo->size, fw_val_info, false)) {
+		return false;
+	}
+
+	validation_cache_store(fw_dst_address, fwinfo, hash);
+
+	return true;
+}
+#endif /* CONFIG_SB_CACHED_VALIDATION */
+
 
 static bool validate_firmware(uint32_t fw_dst_address, uint32_t fw_src_address,
 			      const struct fw_info *fwinfo, bool external)
@@ -562,6 +669,12 @@ static bool validate_firmware(uint32_t fw_dst_address, uint32_t fw_src_address,
 		return true;
 #endif /* SB_VALIDATION_STRUCT_HAS_HASH */
 	}
+#endif
+#if defined(CONFIG_SB_CACHED_VALIDATION)
+	if (!external) {
+		return validate_cached(fw_dst_address, fw_src_address, fwinfo,
+					fw_val_info);
+	}
 #endif
 	return validate_signature(fw_src_address, fwinfo->size, fw_val_info,
 				external);
@@ -590,6 +703,14 @@ bool bl_validate_firmware_local(uint32_t fw_address, const struct fw_info *fwinf
 void bl_validate_housekeeping(void)
 {
 	bl_root_of_trust_housekeeping();
+
+#if defined(CONFIG_SB_CACHED_VALIDATION)
+	int err = fprotect_area(VALIDATION_CACHE_ADDRESS, VALIDATION_CACHE_SIZE);
+
+	if (err) {
+		LOG_ERR("Failed to protect validation cache: %d", err);
+	}
+#endif
 }
 #endif
 
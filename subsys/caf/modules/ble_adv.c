@@ -138,6 +138,62 @@ static struct bt_conn *conn_get(void)
 	return conn;
 }
 
+#if CONFIG_CAF_BLE_ADV_BOND_CACHE
+struct bond_cache_entry {
+	bool valid;
+	size_t cnt;
+	bt_addr_le_t first_addr;
+};
+
+static struct bond_cache_entry bond_cache[CONFIG_BT_ID_MAX];
+
+static void bond_cache_fill_cb(const struct bt_bond_info *info, void *user_data)
+{
+	struct bond_cache_entry *entry = user_data;
+
+	/* Remember address of the first found bond. */
+	if (entry->cnt == 0) {
+		bt_addr_le_copy(&entry->first_addr, &info->addr);
+	}
+
+	entry->cnt++;
+}
+
+static struct bond_cache_entry *bond_cache_get(uint8_t local_id)
+{
+	struct bond_cache_entry *entry = &bond_cache[local_id];
+
+	if (!entry->valid) {
+		entry->cnt = 0;
+		bt_addr_le_copy(&entry->first_addr, BT_ADDR_LE_ANY);
+		bt_foreach_bond(local_id, bond_cache_fill_cb, entry);
+		entry->valid = true;
+	}
+
+	return entry;
+}
+
+static void bond_cache_invalidate(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(bond_cache); i++) {
+		bond_cache[i].valid = false;
+	}
+}
+
+static void bond_addr_get(uint8_t local_id, bt_addr_le_t *addr)
+{
+	bt_addr_le_copy(addr, &bond_cache_get(local_id)->first_addr);
+}
+
+static size_t bond_cnt(uint8_t local_id)
+{
+	return bond_cache_get(local_id)->cnt;
+}
+#else
+static inline void bond_cache_invalidate(void)
+{
+}
+
 static void bond_addr_get_cb(const struct bt_bond_info *info, void *user_data)
 {
 	bt_addr_le_t *addr = user_data;
@@ -169,6 +225,7 @@ static size_t bond_cnt(uint8_t local_id)
 
 	return cnt;
 }
+#endif /* CONFIG_CAF_BLE_ADV_BOND_CACHE */
 
 static bool can_direct_adv(uint8_t local_id)
 {
@@ -947,6 +1004,8 @@ static bool handle_ble_peer_event(const struct ble_peer_event *event)
 		break;
 
 	case PEER_STATE_SECURED:
+		/* A new bond may have been created. */
+		bond_cache_invalidate();
 		update_peer_is_rpa(event->id);
 		break;
 
@@ -1006,6 +1065,11 @@ static bool handle_ble_adv_data_update_event(const struct ble_adv_data_update_ev
 
 static bool handle_ble_peer_operation_event(const struct ble_peer_operation_event *event)
 {
+	/* Peer operations can remove bonds and remap application identities to
+	 * Bluetooth identities.
+	 */
+	bond_cache_invalidate();
+
 	switch (event->op)  {
 	case PEER_OPERATION_SELECTED:
 	case PEER_OPERATION_ERASE_ADV:
@@ -149,13 +149,16 @@ static void process_key(struct key_state *key, uint16_t key_id, bool pressed)
 			key->click_short_timeout = TIMER_INACTIVE;
 		} else {
 			key->click_short_timeout = SHORT_CLICK_MAX;
-			k_work_reschedule(&click_check, K_MSEC(CLICK_CHECK_PERIOD));
+			/* Schedule instead of reschedule not to delay a tick
+			 * that is already pending for other keys.
+			 */
+			k_work_schedule(&click_check, K_MSEC(CLICK_CHECK_PERIOD));
 		}
 
 		key->pressed_time = TIMER_INACTIVE;
 	} else if (pressed) {
 		key->pressed_time = 0;
-		k_work_reschedule(&click_check, K_MSEC(CLICK_CHECK_PERIOD));
+		k_work_schedule(&click_check, K_MSEC(CLICK_CHECK_PERIOD));
 	}
 }
 
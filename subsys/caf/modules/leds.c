@@ -50,6 +50,33 @@ static struct led leds[] = {
 	DT_INST_FOREACH_STATUS_OKAY(_LED_INSTANCE_DEF)
 };
 
+#ifdef CONFIG_CAF_LEDS_DEDICATED_WORKQUEUE
+static K_THREAD_STACK_DEFINE(led_workq_stack, CONFIG_CAF_LEDS_WORKQUEUE_STACK_SIZE);
+static struct k_work_q led_workq;
+
+static void led_work_reschedule(struct k_work_delayable *work, k_timeout_t delay)
+{
+	k_work_reschedule_for_queue(&led_workq, work, delay);
+}
+
+static void led_workq_init(void)
+{
+	k_work_queue_start(&led_workq, led_workq_stack,
+			   K_THREAD_STACK_SIZEOF(led_workq_stack),
+			   CONFIG_CAF_LEDS_WORKQUEUE_PRIORITY, NULL);
+	k_thread_name_set(&led_workq.thread, "caf_leds");
+}
+#else
+static void led_work_reschedule(struct k_work_delayable *work, k_timeout_t delay)
+{
+	k_work_reschedule(work, delay);
+}
+
+static void led_workq_init(void)
+{
+}
+#endif /* CONFIG_CAF_LEDS_DEDICATED_WORKQUEUE */
+
 
 static int set_color_one_channel(struct led *led, struct led_color *color)
 {
@@ -138,7 +165,7 @@ static void work_handler(struct k_work *work)
 		int32_t next_delay =
 			led->effect->steps[led->effect_step].substep_time;
 
-		k_work_reschedule(&led->work, K_MSEC(next_delay));
+		led_work_reschedule(&led->work, K_MSEC(next_delay));
 	}
 }
 
@@ -160,7 +187,7 @@ static void led_update(struct led *led)
 		int32_t next_delay =
 			led->effect->steps[led->effect_step].substep_time;
 
-		k_work_reschedule(&led->work, K_MSEC(next_delay));
+		led_work_reschedule(&led->work, K_MSEC(next_delay));
 	} else {
 		LOG_WRN("LED effect with no effect");
 	}
@@ -172,6 +199,8 @@ static int leds_init(void)
 
 	BUILD_ASSERT(DT_HAS_COMPAT_STATUS_OKAY(DT_DRV_COMPAT) > 0, "No LEDs defined");
 
+	led_workq_init();
+
 	for (size_t i = 0; (i < ARRAY_SIZE(leds)) && !err; i++) {
 		struct led *led = &leds[i];
 
@@ -13,6 +13,10 @@
 #include <zephyr/sys/reboot.h>
 #include <zephyr/sys/poweroff.h>
 
+#ifdef CONFIG_CAF_POWER_MANAGER_SHELL
+#include <zephyr/shell/shell.h>
+#endif
+
 #include <app_event_manager.h>
 #include <nrf_profiler.h>
 
@@ -59,6 +63,45 @@ static struct module_flags power_mode_restrict_flags[POWER_MANAGER_LEVEL_MAX];
 static bool check_if_power_state_allowed(enum power_manager_level lvl);
 
 
+#ifdef CONFIG_CAF_POWER_MANAGER_SHELL
+static uint32_t restrict_event_count[CONFIG_CAF_MODULES_FLAGS_COUNT];
+static uint32_t wake_up_count;
+static uint32_t keep_alive_count;
+static int64_t last_wake_up_uptime;
+
+static void stats_on_restrict(size_t module_idx)
+{
+	if (module_idx < ARRAY_SIZE(restrict_event_count)) {
+		restrict_event_count[module_idx]++;
+	}
+}
+
+static void stats_on_wake_up(void)
+{
+	wake_up_count++;
+	last_wake_up_uptime = k_uptime_get();
+}
+
+static void stats_on_keep_alive(void)
+{
+	keep_alive_count++;
+}
+#else
+static void stats_on_restrict(size_t module_idx)
+{
+	ARG_UNUSED(module_idx);
+}
+
+static void stats_on_wake_up(void)
+{
+}
+
+static void stats_on_keep_alive(void)
+{
+}
+#endif /* CONFIG_CAF_POWER_MANAGER_SHELL */
+
+
 static void power_down_counter_reset(void)
 {
 	BUILD_ASSERT(POWER_DOWN_CHECK_INTERVAL_SEC <= CONFIG_CAF_POWER_MANAGER_TIMEOUT);
@@ -227,6 +270,7 @@ static bool app_event_handler(const struct app_event_header *aeh)
 {
 	if (IS_ENABLED(CONFIG_CAF_KEEP_ALIVE_EVENTS) && is_keep_alive_event(aeh)) {
 		keep_alive_flag = true;
+		stats_on_keep_alive();
 
 		return false;
 	}
@@ -253,6 +297,7 @@ static bool app_event_handler(const struct app_event_header *aeh)
 		bool was_off_allowed = check_if_power_state_allowed(POWER_MANAGER_LEVEL_OFF);
 
 		restrict_power_state(event->module_idx, event->level);
+		stats_on_restrict(event->module_idx);
 
 		bool is_sus_allowed = check_if_power_state_allowed(POWER_MANAGER_LEVEL_SUSPENDED);
 		bool is_off_allowed = check_if_power_state_allowed(POWER_MANAGER_LEVEL_OFF);
@@ -336,6 +381,7 @@ static bool app_event_handler(const struct app_event_header *aeh)
 
 		LOG_INF("Wake up the board");
 
+		stats_on_wake_up();
 		set_power_state(POWER_STATE_IDLE);
 		power_down_counter_reset();
 		return false;
@@ -404,3 +450,77 @@ APP_EVENT_SUBSCRIBE(MODULE, module_state_event);
 APP_EVENT_SUBSCRIBE_EARLY(MODULE, wake_up_event);
 APP_EVENT_SUBSCRIBE_FINAL(MODULE, power_down_event);
 APP_EVENT_SUBSCRIBE_FINAL(MODULE, power_off_event);
+
+#ifdef CONFIG_CAF_POWER_MANAGER_SHELL
+static const char *power_state_name(enum power_state state)
+{
+	switch (state) {
+	case POWER_STATE_IDLE:
+		return "IDLE";
+	case POWER_STATE_SUSPENDING:
+		return "SUSPENDING";
+	case POWER_STATE_SUSPENDED:
+		return "SUSPENDED";
+	case POWER_STATE_OFF:
+		return "OFF";
+	case POWER_STATE_ERROR:
+		return "ERROR";
+	case POWER_STATE_ERROR_SUSPENDED:
+		return "ERROR_SUSPENDED";
+	case POWER_STATE_ERROR_OFF:
+		return "ERROR_OFF";
+	default:
+		return "UNKNOWN";
+	}
+}
+
+static const char *module_allowed_level_name(size_t module_idx)
+{
+	if (module_flags_test_bit(&power_mode_restrict_flags[POWER_MANAGER_LEVEL_SUSPENDED],
+				  module_idx)) {
+		return "ALIVE";
+	}
+	if (module_flags_test_bit(&power_mode_restrict_flags[POWER_MANAGER_LEVEL_OFF],
+				  module_idx)) {
+		return "SUSPENDED";
+	}
+	return "OFF";
+}
+
+static int cmd_power_manager_status(const struct shell *shell, size_t argc, char **argv)
+{
+	shell_print(shell, "Power state: %s", power_state_name(power_state));
+
+	if ((power_state == POWER_STATE_IDLE) &&
+	    k_work_delayable_is_pending(&power_down_trigger)) {
+		shell_print(shell, "Power down in ~%u s",
+			    (unsigned int)(CONFIG_CAF_POWER_MANAGER_TIMEOUT -
+					   power_down_interval_counter *
+					   POWER_DOWN_CHECK_INTERVAL_SEC));
+	}
+
+	shell_print(shell, "Wake-up events: %u (last at %lld ms uptime)",
+		    wake_up_count, last_wake_up_uptime);
+	shell_print(shell, "Keep-alive events: %u", keep_alive_count);
+	shell_print(shell, "");
+	shell_print(shell, "%-24s %-10s %s", "Module", "Allows", "Restrict events");
+
+	for (size_t i = 0; i < module_count(); i++) {
+		shell_print(shell, "%-24s %-10s %u",
+			    module_name_get(module_id_get(i)),
+			    module_allowed_level_name(i),
+			    restrict_event_count[i]);
+	}
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_power_manager,
+	SHELL_CMD(status, NULL,
+		  "Show power state, wake-up statistics and per-module power state restrictions",
+		  cmd_power_manager_status),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_CMD_REGISTER(power_manager, &sub_power_manager, "CAF power manager commands", NULL);
+#endif /* CONFIG_CAF_POWER_MANAGER_SHELL */
@@ -4,6 +4,8 @@
  * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
  */
 
+#include <string.h>
+
 #include <zephyr/kernel.h>
 #include <zephyr/device.h>
 #include <zephyr/settings/settings.h>
@@ -24,21 +26,61 @@ static struct k_thread thread;
 static K_THREAD_STACK_DEFINE(thread_stack, THREAD_STACK_SIZE);
 
 
-static void load_settings_thread(void)
+#define PRIORITY_SUBTREES	CONFIG_CAF_SETTINGS_LOADER_PRIORITY_SUBTREES
+#define PRIORITY_SUBTREES_USED	(sizeof(PRIORITY_SUBTREES) > 1)
+
+static int load_priority_subtrees(void)
 {
-	LOG_INF("Settings load thread started");
+	char subtrees[] = PRIORITY_SUBTREES;
+	char *state;
+	int err = 0;
+
+	for (char *subtree = strtok_r(subtrees, " ", &state);
+	     (subtree != NULL) && !err;
+	     subtree = strtok_r(NULL, " ", &state)) {
+		err = settings_load_subtree(subtree);
+		if (err) {
+			LOG_ERR("Cannot load subtree %s (err %d)", subtree, err);
+		}
+	}
 
-	int err = settings_load();
+	return err;
+}
+
+static void do_load_settings(void)
+{
+	int err = 0;
+
+	if (PRIORITY_SUBTREES_USED) {
+		err = load_priority_subtrees();
+		if (!err) {
+			LOG_INF("Priority subtrees loaded");
+			module_set_state(MODULE_STATE_READY);
+		}
+	}
+
+	if (!err) {
+		err = settings_load();
+	}
 
 	if (err) {
 		LOG_ERR("Cannot load settings");
 		module_set_state(MODULE_STATE_ERROR);
 	} else {
 		LOG_INF("Settings loaded");
-		module_set_state(MODULE_STATE_READY);
+		if (!PRIORITY_SUBTREES_USED) {
+			module_set_state(MODULE_STATE_READY);
+		}
 	}
 }
 
+static void load_settings_thread(void)
+{
+	LOG_INF("Settings load thread started");
+
+	do_load_settings();
+}
+
 static void start_loading_thread(void)
 {
 	k_thread_create(&thread, thread_stack,
@@ -54,15 +96,7 @@ static void load_settings(void)
 	if (IS_ENABLED(CONFIG_CAF_SETTINGS_LOADER_USE_THREAD)) {
 		start_loading_thread();
 	} else {
-		int err = settings_load();
-
-		if (err) {
-			LOG_ERR("Cannot load settings");
-			module_set_state(MODULE_STATE_ERROR);
-		} else {
-			LOG_INF("Settings loaded");
-			module_set_state(MODULE_STATE_READY);
-		}
+		do_load_settings();
 	}
 }
 
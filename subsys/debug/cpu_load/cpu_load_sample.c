@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+#include <debug/cpu_load.h>
+#include <zephyr/kernel.h>
+#include <zephyr/shell/shell.h>
+#include <zephyr/logging/log.h>
+
+LOG_MODULE_REGISTER(cpu_load_sample, CONFIG_NRF_CPU_LOAD_LOG_LEVEL);
+
+struct sample_entry {
+	k_tid_t thread;
+	const char *group;
+	uint32_t samples;
+};
+
+static struct sample_entry entries[CONFIG_NRF_CPU_LOAD_SAMPLE_THREADS_MAX];
+static uint32_t total_samples;
+static uint32_t untracked_samples;
+static struct k_timer sample_timer;
+static struct k_spinlock lock;
+
+static struct sample_entry *entry_find(k_tid_t thread,
+				       struct sample_entry **free_slot)
+{
+	for (int i = 0; i < ARRAY_SIZE(entries); i++) {
+		if (entries[i].thread == thread) {
+			return &entries[i];
+		}
+		if (free_slot && !*free_slot && !entries[i].thread) {
+			*free_slot = &entries[i];
+		}
+	}
+
+	return NULL;
+}
+
+static void sample_timer_expiry(struct k_timer *timer)
+{
+	/* Runs in the system clock interrupt, so the current thread is the
+	 * thread that was interrupted by the sampling tick.
+	 */
+	k_tid_t thread = k_current_get();
+	struct sample_entry *free_slot = NULL;
+	struct sample_entry *entry;
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	total_samples++;
+
+	entry = entry_find(thread, &free_slot);
+	if (!entry && free_slot) {
+		entry = free_slot;
+		entry->thread = thread;
+		entry->samples = 0;
+	}
+
+	if (entry) {
+		entry->samples++;
+	} else {
+		untracked_samples++;
+	}
+
+	k_spin_unlock(&lock, key);
+}
+
+int cpu_load_sample_thread_tag(k_tid_t thread, const char *group)
+{
+	struct sample_entry *free_slot = NULL;
+	struct sample_entry *entry;
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	entry = entry_find(thread, &free_slot);
+	if (!entry) {
+		if (!free_slot) {
+			k_spin_unlock(&lock, key);
+			return -ENOMEM;
+		}
+		entry = free_slot;
+		entry->thread = thread;
+		entry->samples = 0;
+	}
+
+	entry->group = group;
+
+	k_spin_unlock(&lock, key);
+
+	return 0;
+}
+
+void cpu_load_sample_reset(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	for (int i = 0; i < ARRAY_SIZE(entries); i++) {
+		entries[i].samples = 0;
+	}
+	total_samples = 0;
+	untracked_samples = 0;
+
+	k_spin_unlock(&lock, key);
+}
+
+int cpu_load_sample_group_get(const char *group)
+{
+	uint64_t samples = 0;
+	uint32_t total;
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	for (int i = 0; i < ARRAY_SIZE(entries); i++) {
+		if (entries[i].thread && entries[i].group &&
+		    strcmp(entries[i].group, group) == 0) {
+			samples += entries[i].samples;
+		}
+	}
+	total = total_samples;
+
+	k_spin_unlock(&lock, key);
+
+	if (total == 0) {
+		return 0;
+	}
+
+	return (int)((samples * 100000) / total);
+}
+
+static int cpu_load_sample_init(void)
+{
+	k_timer_init(&sample_timer, sample_timer_expiry, NULL);
+	k_timer_start(&sample_timer,
+		      K_USEC(CONFIG_NRF_CPU_LOAD_SAMPLE_PERIOD_US),
+		      K_USEC(CONFIG_NRF_CPU_LOAD_SAMPLE_PERIOD_US));
+
+	return 0;
+}
+
+#if defined(CONFIG_NRF_CPU_LOAD_CMDS)
+static void entry_print(const struct shell *shell,
+			const struct sample_entry *entry, uint32_t total)
+{
+	const char *name = k_thread_name_get(entry->thread);
+	uint64_t load = ((uint64_t)entry->samples * 100000) / total;
+
+	shell_print(shell, "%-20s %-12s %3u,%03u%% (%u samples)",
+		    name ? name : "<unnamed>",
+		    entry->group ? entry->group : "-",
+		    (uint32_t)(load / 1000), (uint32_t)(load % 1000),
+		    entry->samples);
+}
+
+static int cmd_cpu_load_threads(const struct shell *shell,
+				size_t argc, char **argv)
+{
+	struct sample_entry snapshot[ARRAY_SIZE(entries)];
+	uint32_t total;
+	uint32_t untracked;
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	memcpy(snapshot, entries, sizeof(snapshot));
+	total = total_samples;
+	untracked = untracked_samples;
+
+	k_spin_unlock(&lock, key);
+
+	if (total == 0) {
+		shell_print(shell, "No samples collected.");
+		return 0;
+	}
+
+	shell_print(shell, "%-20s %-12s %s", "Thread", "Group", "Load");
+	for (int i = 0; i < ARRAY_SIZE(snapshot); i++) {
+		if (snapshot[i].thread && snapshot[i].samples) {
+			entry_print(shell, &snapshot[i], total);
+		}
+	}
+
+	if (untracked) {
+		shell_print(shell, "Untracked: %u of %u samples "
+			    "(increase NRF_CPU_LOAD_SAMPLE_THREADS_MAX)",
+			    untracked, total);
+	}
+
+	return 0;
+}
+
+static int cmd_cpu_load_threads_reset(const struct shell *shell,
+				      size_t argc, char **argv)
+{
+	cpu_load_sample_reset();
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_cmd_cpu_load_threads,
+	SHELL_CMD_ARG(reset, NULL, "Reset thread samples",
+			cmd_cpu_load_threads_reset, 1, 0),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_CMD_ARG_REGISTER(cpu_load_threads, &sub_cmd_cpu_load_threads,
+		"Per-thread CPU load", cmd_cpu_load_threads, 1, 0);
+#endif /* CONFIG_NRF_CPU_LOAD_CMDS */
+
+SYS_INIT(cpu_load_sample_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
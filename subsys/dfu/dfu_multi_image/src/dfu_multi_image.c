@@ -5,6 +5,7 @@
  */
 
 #include <dfu/dfu_multi_image.h>
+#include <zephyr/kernel.h>
 #include <zephyr/sys/byteorder.h>
 #include <zephyr/sys/util.h>
 #include <zephyr/logging/log.h>
@@ -35,6 +36,8 @@ LOG_MODULE_REGISTER(dfu_multi_image, CONFIG_DFU_MULTI_IMAGE_LOG_LEVEL);
 struct image_info {
 	int32_t id;
 	uint32_t size;
+	uint8_t hash[DFU_MULTI_IMAGE_HASH_SIZE];
+	bool has_hash;
 };
 
 struct header {
@@ -95,6 +98,22 @@ static bool parse_image_info(zcbor_state_t *states, struct image_info *image)
 	res = res && zcbor_int32_decode(states, &image->id);
 	res = res && zcbor_tstr_expect_lit(states, "size");
 	res = res && zcbor_uint32_decode(states, &image->size);
+
+	/* Optional per-image SHA-256, present in packages built with hashes. */
+	if (res && zcbor_tstr_expect_lit(states, "sha256")) {
+		struct zcbor_string hash;
+
+		res = zcbor_bstr_decode(states, &hash);
+
+		if (res && (hash.len == sizeof(image->hash))) {
+			memcpy(image->hash, hash.value, sizeof(image->hash));
+			image->has_hash = true;
+		}
+	} else if (res) {
+		/* Clear the error set by the failed expect. */
+		(void)zcbor_pop_error(states);
+	}
+
 	res = res && zcbor_map_end_decode(states);
 
 	return res;
@@ -457,6 +476,10 @@ int dfu_multi_image_init(uint8_t *buffer, size_t buffer_size)
 		return -EINVAL;
 	}
 
+#ifdef CONFIG_DFU_MULTI_IMAGE_ASYNC_WRITES
+	write_queue_reset();
+#endif
+
 	memset(&ctx, 0, sizeof(ctx));
 	ctx.buffer = buffer;
 	ctx.buffer_size = buffer_size;
@@ -476,22 +499,11 @@ int dfu_multi_image_register_writer(const struct dfu_image_writer *writer)
 	return 0;
 }
 
-int dfu_multi_image_write(size_t offset, const uint8_t *chunk, size_t chunk_size)
+static int write_chunk(size_t offset, const uint8_t *chunk, size_t chunk_size)
 {
 	int result;
 	size_t chunk_offset = 0;
 
-#ifdef CONFIG_DFU_MULTI_IMAGE_SAVE_PROGRESS
-	if (!ctx.saved_progress_loaded) {
-		/* Load saved progress from settings if available */
-		int err = load_saved_progress();
-
-		if (err) {
-			return err;
-		}
-	}
-#endif /* CONFIG_DFU_MULTI_IMAGE_SAVE_PROGRESS */
-
 	if (offset > ctx.cur_offset) {
 		/* Unexpected data gap */
 		return -ESPIPE;
@@ -518,6 +530,125 @@ int dfu_multi_image_write(size_t offset, const uint8_t *chunk, size_t chunk_size
 	return 0;
 }
 
+#ifdef CONFIG_DFU_MULTI_IMAGE_ASYNC_WRITES
+
+struct write_item {
+	void *fifo_reserved;
+	size_t offset;
+	size_t size;
+	uint8_t data[CONFIG_DFU_MULTI_IMAGE_ASYNC_WRITES_CHUNK_SIZE];
+};
+
+static struct write_item write_items[CONFIG_DFU_MULTI_IMAGE_ASYNC_WRITES_CHUNK_COUNT];
+static bool write_items_initialized;
+
+static K_FIFO_DEFINE(free_items);
+static K_FIFO_DEFINE(queued_items);
+static K_SEM_DEFINE(queue_drained, 0, 1);
+static atomic_t queued_count;
+/* First error returned by a deferred write, reported by the next API call. */
+static atomic_t write_error;
+
+static void write_thread_fn(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		struct write_item *item = k_fifo_get(&queued_items, K_FOREVER);
+
+		if (atomic_get(&write_error) == 0) {
+			int err = write_chunk(item->offset, item->data, item->size);
+
+			if (err) {
+				LOG_ERR("Deferred write failed: %d", err);
+				atomic_set(&write_error, err);
+			}
+		}
+
+		k_fifo_put(&free_items, item);
+
+		if (atomic_dec(&queued_count) == 1) {
+			k_sem_give(&queue_drained);
+		}
+	}
+}
+
+K_THREAD_DEFINE(dfu_multi_image_writer, CONFIG_DFU_MULTI_IMAGE_ASYNC_WRITES_STACK_SIZE,
+		write_thread_fn, NULL, NULL, NULL, CONFIG_DFU_MULTI_IMAGE_ASYNC_WRITES_PRIORITY,
+		0, 0);
+
+static void write_queue_flush(void)
+{
+	while (atomic_get(&queued_count) > 0) {
+		k_sem_take(&queue_drained, K_MSEC(10));
+	}
+}
+
+static void write_queue_reset(void)
+{
+	if (!write_items_initialized) {
+		for (size_t i = 0; i < ARRAY_SIZE(write_items); i++) {
+			k_fifo_put(&free_items, &write_items[i]);
+		}
+
+		write_items_initialized = true;
+	}
+
+	write_queue_flush();
+	atomic_set(&write_error, 0);
+}
+
+static int write_chunk_async(size_t offset, const uint8_t *chunk, size_t chunk_size)
+{
+	int err = atomic_get(&write_error);
+
+	if (err) {
+		return err;
+	}
+
+	while (chunk_size > 0) {
+		struct write_item *item = k_fifo_get(&free_items, K_FOREVER);
+		const size_t part_size = MIN(chunk_size, sizeof(item->data));
+
+		item->offset = offset;
+		item->size = part_size;
+		memcpy(item->data, chunk, part_size);
+
+		atomic_inc(&queued_count);
+		k_fifo_put(&queued_items, item);
+
+		offset += part_size;
+		chunk += part_size;
+		chunk_size -= part_size;
+	}
+
+	return 0;
+}
+
+#endif /* CONFIG_DFU_MULTI_IMAGE_ASYNC_WRITES */
+
+int dfu_multi_image_write(size_t offset, const uint8_t *chunk, size_t chunk_size)
+{
+#ifdef CONFIG_DFU_MULTI_IMAGE_SAVE_PROGRESS
+	if (!ctx.saved_progress_loaded) {
+		/* Load saved progress from settings if available */
+		int err = load_saved_progress();
+
+		if (err) {
+			return err;
+		}
+	}
+#endif /* CONFIG_DFU_MULTI_IMAGE_SAVE_PROGRESS */
+
+#ifdef CONFIG_DFU_MULTI_IMAGE_ASYNC_WRITES
+	return write_chunk_async(offset, chunk, chunk_size);
+#else
+	return write_chunk(offset, chunk, chunk_size);
+#endif
+}
+
 size_t dfu_multi_image_offset(void)
 {
 #ifdef CONFIG_DFU_MULTI_IMAGE_SAVE_PROGRESS
@@ -531,9 +662,34 @@ size_t dfu_multi_image_offset(void)
 	}
 #endif /* CONFIG_DFU_MULTI_IMAGE_SAVE_PROGRESS */
 
+#ifdef CONFIG_DFU_MULTI_IMAGE_ASYNC_WRITES
+	/* Wait for the queued chunks so that the reported offset is settled */
+	write_queue_flush();
+#endif
+
 	return ctx.cur_offset;
 }
 
+int dfu_multi_image_hash_get(int image_id, const uint8_t **hash)
+{
+	if (hash == NULL) {
+		return -EINVAL;
+	}
+
+	for (size_t i = 0; i < ctx.header.image_count; i++) {
+		if (ctx.header.images[i].id == image_id) {
+			if (!ctx.header.images[i].has_hash) {
+				return -ENOENT;
+			}
+
+			*hash = ctx.header.images[i].hash;
+			return 0;
+		}
+	}
+
+	return -ENOENT;
+}
+
 int dfu_multi_image_done(bool success)
 {
 #ifdef CONFIG_DFU_MULTI_IMAGE_SAVE_PROGRESS
@@ -547,6 +703,14 @@ int dfu_multi_image_done(bool success)
 	}
 #endif /* CONFIG_DFU_MULTI_IMAGE_SAVE_PROGRESS */
 
+#ifdef CONFIG_DFU_MULTI_IMAGE_ASYNC_WRITES
+	write_queue_flush();
+
+	if (success && atomic_get(&write_error) != 0) {
+		return atomic_get(&write_error);
+	}
+#endif
+
 	const struct dfu_image_writer *writer = current_image_writer();
 	int err = 0;
 
@@ -572,6 +736,11 @@ int dfu_multi_image_done(bool success)
 int dfu_multi_image_reset(void)
 {
 	int err = 0;
+
+#ifdef CONFIG_DFU_MULTI_IMAGE_ASYNC_WRITES
+	write_queue_reset();
+#endif
+
 	const struct dfu_image_writer *writer = current_image_writer();
 
 #ifdef CONFIG_DFU_MULTI_IMAGE_SAVE_PROGRESS
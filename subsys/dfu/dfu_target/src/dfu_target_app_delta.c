@@ -0,0 +1,429 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/sys/byteorder.h>
+#include <zephyr/dfu/mcuboot.h>
+#include <crc32_fast.h>
+#include <dfu/dfu_target.h>
+#include <dfu/dfu_target_app_delta.h>
+#include <dfu/dfu_target_stream.h>
+
+LOG_MODULE_REGISTER(dfu_target_app_delta, CONFIG_DFU_TARGET_LOG_LEVEL);
+
+/* The patch stream consists of a fixed-size header followed by a sequence of
+ * operations:
+ *
+ *	magic		(4 bytes, little endian)
+ *	target size	(4 bytes, little endian)
+ *	target CRC-32	(4 bytes, little endian, IEEE)
+ *	reserved	(4 bytes)
+ *
+ *	opcode		(1 byte, COPY or INSERT)
+ *	length		(varint, LEB128)
+ *	source offset	(varint, COPY only)
+ *	literal data	(length bytes, INSERT only)
+ *
+ * COPY reads length bytes from the given offset in the primary slot, INSERT
+ * takes them from the patch stream. The patched image is complete when the
+ * output reaches the target size from the header.
+ */
+#define APP_DELTA_HEADER_MAGIC 0x544c444e /* "NDLT" */
+#define APP_DELTA_HEADER_SIZE 16
+
+#define APP_DELTA_OP_COPY 0x00
+#define APP_DELTA_OP_INSERT 0x01
+
+#ifdef CONFIG_PARTITION_MANAGER_ENABLED
+#include <pm_config.h>
+#define PRIMARY_PARTITION_ID PM_MCUBOOT_PRIMARY_ID
+#define SECONDARY_PARTITION_ID PM_MCUBOOT_SECONDARY_ID
+#else
+#define PRIMARY_PARTITION_ID FIXED_PARTITION_ID(slot0_partition)
+#define SECONDARY_PARTITION_ID FIXED_PARTITION_ID(slot1_partition)
+#endif
+
+enum delta_state {
+	/* Receiving the patch header */
+	DELTA_STATE_HEADER,
+	/* Receiving the next opcode */
+	DELTA_STATE_OPCODE,
+	/* Receiving the operation length varint */
+	DELTA_STATE_LENGTH,
+	/* Receiving the source offset varint of a COPY */
+	DELTA_STATE_OFFSET,
+	/* Receiving literal data of an INSERT */
+	DELTA_STATE_INSERT,
+	/* Output has reached the target size */
+	DELTA_STATE_DONE,
+};
+
+static struct {
+	enum delta_state state;
+	/* Patch header accumulator */
+	uint8_t header[APP_DELTA_HEADER_SIZE];
+	size_t header_len;
+	/* Varint accumulator */
+	uint64_t varint;
+	uint8_t varint_shift;
+	/* Current operation */
+	uint8_t opcode;
+	size_t op_len;
+	/* Size and CRC of the patched image, from the header */
+	size_t target_size;
+	uint32_t target_crc;
+	/* Output progress */
+	size_t out_written;
+	uint32_t out_crc;
+	/* Patch bytes consumed */
+	size_t patch_offset;
+} ctx;
+
+static const struct flash_area *primary_fa;
+static uint8_t *stream_buf;
+static size_t stream_buf_len;
+static uint8_t copy_buf[CONFIG_DFU_TARGET_APP_DELTA_COPY_BUF_SIZE];
+
+bool dfu_target_app_delta_identify(const void *const buf)
+{
+	return sys_get_le32(buf) == APP_DELTA_HEADER_MAGIC;
+}
+
+int dfu_target_app_delta_set_buf(uint8_t *buf, size_t len)
+{
+	if (buf == NULL) {
+		return -EINVAL;
+	}
+
+	stream_buf = buf;
+	stream_buf_len = len;
+
+	return 0;
+}
+
+/**
+ * @brief Write patched output through the stream, updating progress and CRC.
+ */
+static int out_write(const uint8_t *data, size_t len)
+{
+	int err;
+
+	if (ctx.out_written + len > ctx.target_size) {
+		LOG_ERR("Patch output exceeds target size %zu", ctx.target_size);
+		return -EINVAL;
+	}
+
+	err = dfu_target_stream_write(data, len);
+	if (err != 0) {
+		return err;
+	}
+
+	ctx.out_crc = crc32_fast_update(ctx.out_crc, data, len);
+	ctx.out_written += len;
+
+	if (ctx.out_written == ctx.target_size) {
+		ctx.state = DELTA_STATE_DONE;
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Copy a region of the primary slot to the output.
+ */
+static int copy_from_primary(size_t src_offset, size_t len)
+{
+	int err;
+	size_t chunk;
+
+	if (src_offset + len > primary_fa->fa_size) {
+		LOG_ERR("COPY out of bounds: %zu + %zu > %zu", src_offset, len,
+			(size_t)primary_fa->fa_size);
+		return -EINVAL;
+	}
+
+	while (len > 0) {
+		chunk = MIN(len, sizeof(copy_buf));
+
+		err = flash_area_read(primary_fa, src_offset, copy_buf, chunk);
+		if (err != 0) {
+			LOG_ERR("Failed to read primary slot, err %d", err);
+			return err;
+		}
+
+		err = out_write(copy_buf, chunk);
+		if (err != 0) {
+			return err;
+		}
+
+		src_offset += chunk;
+		len -= chunk;
+	}
+
+	return 0;
+}
+
+static int header_parse(void)
+{
+	uint32_t magic = sys_get_le32(&ctx.header[0]);
+
+	if (magic != APP_DELTA_HEADER_MAGIC) {
+		LOG_ERR("Invalid patch magic 0x%08x", magic);
+		return -EINVAL;
+	}
+
+	ctx.target_size = sys_get_le32(&ctx.header[4]);
+	ctx.target_crc = sys_get_le32(&ctx.header[8]);
+
+	if (ctx.target_size == 0) {
+		LOG_ERR("Patch target size is zero");
+		return -EINVAL;
+	}
+
+	LOG_DBG("Patch target size %zu, CRC 0x%08x", ctx.target_size, ctx.target_crc);
+
+	return 0;
+}
+
+/**
+ * @brief Consume one varint byte. Returns true when the varint is complete.
+ */
+static bool varint_feed(uint8_t byte)
+{
+	ctx.varint |= (uint64_t)(byte & 0x7f) << ctx.varint_shift;
+	ctx.varint_shift += 7;
+
+	return (byte & 0x80) == 0;
+}
+
+int dfu_target_app_delta_init(size_t file_size, int img_num, dfu_target_callback_t cb)
+{
+	int err;
+	const struct flash_area *secondary_fa;
+
+	ARG_UNUSED(cb);
+
+	if (img_num != 0) {
+		LOG_ERR("Only image 0 is supported");
+		return -ENOENT;
+	}
+
+	if (stream_buf == NULL) {
+		LOG_ERR("Missing stream_buf, call '..set_buf' before '..init'");
+		return -ENODEV;
+	}
+
+	err = flash_area_open(PRIMARY_PARTITION_ID, &primary_fa);
+	if (err != 0) {
+		LOG_ERR("Failed to open primary slot, err %d", err);
+		return err;
+	}
+
+	err = flash_area_open(SECONDARY_PARTITION_ID, &secondary_fa);
+	if (err != 0) {
+		LOG_ERR("Failed to open secondary slot, err %d", err);
+		flash_area_close(primary_fa);
+		primary_fa = NULL;
+		return err;
+	}
+
+	err = dfu_target_stream_init(&(struct dfu_target_stream_init){
+		.id = "APP_DELTA",
+		.fdev = flash_area_get_device(secondary_fa),
+		.buf = stream_buf,
+		.len = stream_buf_len,
+		.offset = secondary_fa->fa_off,
+		.size = secondary_fa->fa_size,
+		.cb = NULL });
+
+	flash_area_close(secondary_fa);
+
+	if (err != 0) {
+		LOG_ERR("dfu_target_stream_init failed %d", err);
+		flash_area_close(primary_fa);
+		primary_fa = NULL;
+		return err;
+	}
+
+	memset(&ctx, 0, sizeof(ctx));
+	ctx.state = DELTA_STATE_HEADER;
+
+	return 0;
+}
+
+int dfu_target_app_delta_offset_get(size_t *offset)
+{
+	if (offset == NULL) {
+		return -EINVAL;
+	}
+
+	*offset = ctx.patch_offset;
+
+	return 0;
+}
+
+int dfu_target_app_delta_write(const void *const buf, size_t len)
+{
+	int err;
+	const uint8_t *data = buf;
+	size_t pos = 0;
+	size_t chunk;
+
+	while (pos < len) {
+		switch (ctx.state) {
+		case DELTA_STATE_HEADER:
+			chunk = MIN(len - pos, APP_DELTA_HEADER_SIZE - ctx.header_len);
+			memcpy(&ctx.header[ctx.header_len], &data[pos], chunk);
+			ctx.header_len += chunk;
+			pos += chunk;
+
+			if (ctx.header_len == APP_DELTA_HEADER_SIZE) {
+				err = header_parse();
+				if (err != 0) {
+					return err;
+				}
+				ctx.state = DELTA_STATE_OPCODE;
+			}
+			break;
+		case DELTA_STATE_OPCODE:
+			ctx.opcode = data[pos++];
+
+			if (ctx.opcode != APP_DELTA_OP_COPY &&
+			    ctx.opcode != APP_DELTA_OP_INSERT) {
+				LOG_ERR("Invalid patch opcode 0x%02x", ctx.opcode);
+				return -EINVAL;
+			}
+
+			ctx.varint = 0;
+			ctx.varint_shift = 0;
+			ctx.state = DELTA_STATE_LENGTH;
+			break;
+		case DELTA_STATE_LENGTH:
+			if (!varint_feed(data[pos++])) {
+				break;
+			}
+
+			ctx.op_len = ctx.varint;
+			ctx.varint = 0;
+			ctx.varint_shift = 0;
+
+			if (ctx.op_len == 0) {
+				LOG_ERR("Zero-length patch operation");
+				return -EINVAL;
+			}
+
+			ctx.state = (ctx.opcode == APP_DELTA_OP_COPY) ? DELTA_STATE_OFFSET :
+									DELTA_STATE_INSERT;
+			break;
+		case DELTA_STATE_OFFSET:
+			if (!varint_feed(data[pos++])) {
+				break;
+			}
+
+			err = copy_from_primary(ctx.varint, ctx.op_len);
+			if (err != 0) {
+				return err;
+			}
+
+			if (ctx.state != DELTA_STATE_DONE) {
+				ctx.state = DELTA_STATE_OPCODE;
+			}
+			break;
+		case DELTA_STATE_INSERT:
+			chunk = MIN(len - pos, ctx.op_len);
+
+			err = out_write(&data[pos], chunk);
+			if (err != 0) {
+				return err;
+			}
+
+			pos += chunk;
+			ctx.op_len -= chunk;
+
+			if (ctx.op_len == 0 && ctx.state != DELTA_STATE_DONE) {
+				ctx.state = DELTA_STATE_OPCODE;
+			}
+			break;
+		case DELTA_STATE_DONE:
+			LOG_ERR("Patch data past end of target image");
+			return -EINVAL;
+		}
+	}
+
+	ctx.patch_offset += len;
+
+	return 0;
+}
+
+int dfu_target_app_delta_done(bool successful)
+{
+	int err;
+
+	err = dfu_target_stream_done(successful);
+	if (err != 0) {
+		LOG_ERR("dfu_target_stream_done error %d", err);
+		return err;
+	}
+
+	if (primary_fa != NULL) {
+		flash_area_close(primary_fa);
+		primary_fa = NULL;
+	}
+
+	if (!successful) {
+		LOG_INF("Application delta upgrade aborted.");
+		return 0;
+	}
+
+	if (ctx.state != DELTA_STATE_DONE) {
+		LOG_ERR("Patch stream incomplete: %zu of %zu bytes written", ctx.out_written,
+			ctx.target_size);
+		return -EINVAL;
+	}
+
+	if (ctx.out_crc != ctx.target_crc) {
+		LOG_ERR("Patched image CRC mismatch: 0x%08x != 0x%08x", ctx.out_crc,
+			ctx.target_crc);
+		return -EINVAL;
+	}
+
+	LOG_INF("Application delta upgrade complete");
+
+	return 0;
+}
+
+int dfu_target_app_delta_schedule_update(int img_num)
+{
+	int err;
+
+	if (img_num != 0 && img_num != -1) {
+		return -ENOENT;
+	}
+
+	err = boot_request_upgrade_multi(0, BOOT_UPGRADE_TEST);
+	if (err != 0) {
+		LOG_ERR("boot_request_upgrade error %d", err);
+	} else {
+		LOG_INF("Patched image upgrade scheduled. Reset device to apply");
+	}
+
+	return err;
+}
+
+int dfu_target_app_delta_reset(void)
+{
+	if (primary_fa != NULL) {
+		flash_area_close(primary_fa);
+		primary_fa = NULL;
+	}
+
+	memset(&ctx, 0, sizeof(ctx));
+
+	return dfu_target_stream_reset();
+}
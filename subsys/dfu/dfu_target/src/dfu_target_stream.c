@@ -11,6 +11,10 @@
 #include <dfu/dfu_target_stream.h>
 #include <dfu_stream_flatten.h>
 
+#ifdef CONFIG_DFU_TARGET_STREAM_ASYNC
+#include <zephyr/sys/ring_buffer.h>
+#endif
+
 #ifdef CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS
 #define MODULE "dfu"
 #include <zephyr/settings/settings.h>
@@ -98,6 +102,234 @@ SETTINGS_STATIC_HANDLER_DEFINE(dfu_target, MODULE, NULL, settings_set,
 
 #endif /* CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS */
 
+#ifdef CONFIG_DFU_TARGET_STREAM_ERASE_AHEAD
+
+/* Serializes flash access between the write path and the erase-ahead work. */
+static K_MUTEX_DEFINE(flash_lock);
+
+static K_THREAD_STACK_DEFINE(erase_ahead_stack, CONFIG_DFU_TARGET_STREAM_ERASE_AHEAD_STACK_SIZE);
+static struct k_work_q erase_ahead_work_q;
+static bool erase_ahead_work_q_started;
+
+static void flash_lock_take(void)
+{
+	k_mutex_lock(&flash_lock, K_FOREVER);
+}
+
+static void flash_lock_give(void)
+{
+	k_mutex_unlock(&flash_lock);
+}
+
+/**
+ * @brief Keep pages erased ahead of the write pointer.
+ *
+ * Runs on a low-priority work queue, so that erasing yields to
+ * higher-priority activity, and releases the flash lock between pages so
+ * that the write path is never blocked for more than one page erase.
+ */
+static void erase_ahead_work_fn(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	while (true) {
+		struct flash_pages_info page;
+		int err;
+
+		flash_lock_take();
+
+		if (stream.fdev == NULL || stream.erased_up_to >= stream.available) {
+			flash_lock_give();
+			return;
+		}
+
+		err = flash_get_page_info_by_offs(stream.fdev,
+						  stream.offset + stream.erased_up_to, &page);
+		if (err != 0) {
+			LOG_ERR("Error %d while getting page info", err);
+			flash_lock_give();
+			return;
+		}
+
+		/* Stop once the configured number of pages ahead of the write
+		 * pointer is erased.
+		 */
+		if (stream.erased_up_to >=
+		    stream.bytes_written +
+			    CONFIG_DFU_TARGET_STREAM_ERASE_AHEAD_PAGES * page.size) {
+			flash_lock_give();
+			return;
+		}
+
+		LOG_DBG("Erasing ahead at offset 0x%08lx", (long)page.start_offset);
+
+		err = flash_flatten(stream.fdev, page.start_offset, page.size);
+		if (err != 0) {
+			LOG_ERR("Error %d while erasing ahead", err);
+			flash_lock_give();
+			return;
+		}
+
+		stream.erased_up_to = page.start_offset + page.size - stream.offset;
+
+		flash_lock_give();
+	}
+}
+
+static K_WORK_DEFINE(erase_ahead_work, erase_ahead_work_fn);
+
+static void erase_ahead_submit(void)
+{
+	if (!erase_ahead_work_q_started) {
+		k_work_queue_start(&erase_ahead_work_q, erase_ahead_stack,
+				   K_THREAD_STACK_SIZEOF(erase_ahead_stack),
+				   CONFIG_DFU_TARGET_STREAM_ERASE_AHEAD_PRIORITY, NULL);
+		k_thread_name_set(&erase_ahead_work_q.thread, "dfu_erase_ahead");
+		erase_ahead_work_q_started = true;
+	}
+
+	k_work_submit_to_queue(&erase_ahead_work_q, &erase_ahead_work);
+}
+
+#else
+
+static void flash_lock_take(void)
+{
+}
+
+static void flash_lock_give(void)
+{
+}
+
+static void erase_ahead_submit(void)
+{
+}
+
+#endif /* CONFIG_DFU_TARGET_STREAM_ERASE_AHEAD */
+
+#ifdef CONFIG_DFU_TARGET_STREAM_ASYNC
+
+RING_BUF_DECLARE(async_queue, CONFIG_DFU_TARGET_STREAM_ASYNC_BUF_SIZE);
+
+static K_SEM_DEFINE(async_data_sem, 0, 1);
+static K_SEM_DEFINE(async_space_sem, 0, 1);
+static K_SEM_DEFINE(async_drained_sem, 0, 1);
+
+/* First error reported by the flash thread, returned on the next write. */
+static int async_err;
+static bool async_draining;
+
+/**
+ * @brief Thread programming queued chunks to flash.
+ *
+ * Runs at low priority so that reception of the next chunk overlaps with
+ * programming of the previous one.
+ */
+static void async_flash_thread(void *p1, void *p2, void *p3)
+{
+	uint8_t *data;
+	uint32_t claimed;
+	int err;
+
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		k_sem_take(&async_data_sem, K_FOREVER);
+
+		while ((claimed = ring_buf_get_claim(&async_queue, &data,
+						     ring_buf_capacity_get(&async_queue))) > 0) {
+			if (async_err == 0) {
+				flash_lock_take();
+				err = stream_flash_buffered_write(&stream, data, claimed, false);
+				flash_lock_give();
+				if (err != 0) {
+					LOG_ERR("stream_flash_buffered_write error %d", err);
+					async_err = err;
+				} else {
+					erase_ahead_submit();
+#ifdef CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS
+					err = store_progress();
+					if (err != 0) {
+						/* Failing to store progress is not a critical
+						 * error you'll just be left to download a bit
+						 * more if you fail and resume.
+						 */
+						LOG_WRN("Unable to store write progress: %d",
+							err);
+					}
+#endif
+				}
+			}
+
+			ring_buf_get_finish(&async_queue, claimed);
+			k_sem_give(&async_space_sem);
+		}
+
+		if (async_draining) {
+			k_sem_give(&async_drained_sem);
+		}
+	}
+}
+
+K_THREAD_DEFINE(dfu_stream_flash, CONFIG_DFU_TARGET_STREAM_ASYNC_STACK_SIZE, async_flash_thread,
+		NULL, NULL, NULL, CONFIG_DFU_TARGET_STREAM_ASYNC_THREAD_PRIO, 0, 0);
+
+/**
+ * @brief Queue a chunk for the flash thread, blocking when the queue is full.
+ */
+static int async_write(const uint8_t *buf, size_t len)
+{
+	size_t written = 0;
+
+	while (written < len) {
+		if (async_err != 0) {
+			return async_err;
+		}
+
+		written += ring_buf_put(&async_queue, &buf[written], len - written);
+		k_sem_give(&async_data_sem);
+
+		if (written < len) {
+			/* Queue full, back-pressure the caller until the flash
+			 * thread has freed up space.
+			 */
+			k_sem_take(&async_space_sem, K_FOREVER);
+		}
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Wait until the flash thread has programmed all queued chunks.
+ */
+static int async_flush(void)
+{
+	async_draining = true;
+
+	while (!ring_buf_is_empty(&async_queue)) {
+		k_sem_give(&async_data_sem);
+		k_sem_take(&async_drained_sem, K_FOREVER);
+	}
+
+	async_draining = false;
+
+	return async_err;
+}
+
+static void async_reset(void)
+{
+	ring_buf_reset(&async_queue);
+	async_err = 0;
+	k_sem_reset(&async_data_sem);
+	k_sem_reset(&async_space_sem);
+	k_sem_reset(&async_drained_sem);
+}
+
+#endif /* CONFIG_DFU_TARGET_STREAM_ASYNC */
+
 struct stream_flash_ctx *dfu_target_stream_get_stream(void)
 {
 	return &stream;
@@ -118,6 +350,10 @@ int dfu_target_stream_init(const struct dfu_target_stream_init *init)
 
 	current_id = init->id;
 
+#ifdef CONFIG_DFU_TARGET_STREAM_ASYNC
+	async_reset();
+#endif
+
 	err = stream_flash_init(&stream, init->fdev, init->buf, init->len,
 				init->offset, init->size, NULL);
 	if (err) {
@@ -147,6 +383,9 @@ int dfu_target_stream_init(const struct dfu_target_stream_init *init)
 	}
 #endif /* CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS */
 
+	/* Start erasing ahead of the first write */
+	erase_ahead_submit();
+
 	return 0;
 }
 
@@ -174,6 +413,9 @@ int dfu_target_stream_bytes_buffered_get(size_t *out)
 
 int dfu_target_stream_write(const uint8_t *buf, size_t len)
 {
+#ifdef CONFIG_DFU_TARGET_STREAM_ASYNC
+	return async_write(buf, len);
+#else
 #ifdef CONFIG_DFU_TARGET_STREAM_SYNCHRONOUS
 	/**
 	 * Flush immediately.
@@ -186,9 +428,13 @@ int dfu_target_stream_write(const uint8_t *buf, size_t len)
 	 * described case, as the server would need to retransmit
 	 * already ack-ed data.
 	 */
+	flash_lock_take();
 	int err = stream_flash_buffered_write(&stream, buf, len, true);
+	flash_lock_give();
 #else
+	flash_lock_take();
 	int err = stream_flash_buffered_write(&stream, buf, len, false);
+	flash_lock_give();
 #endif
 
 	if (err != 0) {
@@ -196,6 +442,8 @@ int dfu_target_stream_write(const uint8_t *buf, size_t len)
 		return err;
 	}
 
+	erase_ahead_submit();
+
 #ifdef CONFIG_DFU_TARGET_STREAM_SAVE_PROGRESS
 	err = store_progress();
 	if (err != 0) {
@@ -207,14 +455,31 @@ int dfu_target_stream_write(const uint8_t *buf, size_t len)
 #endif
 
 	return err;
+#endif /* CONFIG_DFU_TARGET_STREAM_ASYNC */
 }
 
 int dfu_target_stream_done(bool successful)
 {
 	int err = 0;
 
+#ifdef CONFIG_DFU_TARGET_STREAM_ASYNC
+	/* Program any queued chunks before flushing the stream. */
+	int flush_err = async_flush();
+
+	if (flush_err != 0) {
+		LOG_ERR("Failed to drain write queue: %d", flush_err);
+		/* Queued image data has been dropped, the image is incomplete.
+		 * Store the progress as for an unfinished stream and report
+		 * the error to the caller.
+		 */
+		successful = false;
+	}
+#endif
+
 	if (successful) {
+		flash_lock_take();
 		err = stream_flash_buffered_write(&stream, NULL, 0, true);
+		flash_lock_give();
 		if (err != 0) {
 			LOG_ERR("stream_flash_buffered_write error %d", err);
 		}
@@ -240,6 +505,12 @@ int dfu_target_stream_done(bool successful)
 
 	current_id = NULL;
 
+#ifdef CONFIG_DFU_TARGET_STREAM_ASYNC
+	if (flush_err != 0) {
+		return flush_err;
+	}
+#endif
+
 	return err;
 }
 
@@ -247,6 +518,10 @@ int dfu_target_stream_reset(void)
 {
 	int err = 0;
 
+#ifdef CONFIG_DFU_TARGET_STREAM_ASYNC
+	async_reset();
+#endif
+
 	stream.buf_bytes = 0;
 	stream.bytes_written = 0;
 
@@ -266,7 +541,9 @@ int dfu_target_stream_reset(void)
 	/* Erase just the first page. Stream write will take care of erasing remaining pages
 	 * on a next buffered_write round
 	 */
+	flash_lock_take();
 	err = stream_flash_flatten_page(&stream, stream.offset);
+	flash_lock_give();
 	current_id = NULL;
 
 	return err;
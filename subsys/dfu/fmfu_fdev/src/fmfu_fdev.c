@@ -78,6 +78,114 @@ static int write_chunk(uint8_t *buf, size_t buf_len, uint32_t address, bool is_b
 	return 0;
 }
 
+#if defined(CONFIG_FMFU_FDEV_PREFETCH)
+#define PREFETCH_STACK_SIZE 1024
+
+struct prefetch_op {
+	struct k_work work;
+	const struct device *fdev;
+	uint32_t addr;
+	size_t len;
+	uint8_t *buf;
+	int err;
+	struct k_sem done;
+};
+
+static K_THREAD_STACK_DEFINE(prefetch_stack, PREFETCH_STACK_SIZE);
+static struct k_work_q prefetch_work_q;
+
+static void prefetch_work_fn(struct k_work *work)
+{
+	struct prefetch_op *op = CONTAINER_OF(work, struct prefetch_op, work);
+
+	op->err = flash_read(op->fdev, op->addr, op->buf, op->len);
+	k_sem_give(&op->done);
+}
+
+static void prefetch_start(struct prefetch_op *op, const struct device *fdev,
+			   uint32_t addr, uint8_t *buf, size_t len)
+{
+	static bool work_q_started;
+
+	if (!work_q_started) {
+		k_work_queue_start(&prefetch_work_q, prefetch_stack,
+				   K_THREAD_STACK_SIZEOF(prefetch_stack),
+				   K_LOWEST_APPLICATION_THREAD_PRIO, NULL);
+		work_q_started = true;
+	}
+
+	op->fdev = fdev;
+	op->addr = addr;
+	op->buf = buf;
+	op->len = len;
+	k_work_init(&op->work, prefetch_work_fn);
+	k_sem_init(&op->done, 0, 1);
+	k_work_submit_to_queue(&prefetch_work_q, &op->work);
+}
+
+static int load_segment(const struct device *fdev, size_t seg_size, uint32_t seg_target_addr,
+			uint32_t seg_offset, uint8_t *buf, size_t buf_len, bool is_bootloader)
+{
+	int err;
+	uint32_t read_addr = seg_offset;
+	size_t bytes_left = seg_size;
+	/* Split the buffer in two so that the next chunk can be read from the
+	 * flash device while the current one is written to the modem.
+	 */
+	size_t chunk_len = buf_len / 2;
+	uint8_t *bufs[2] = { buf, buf + chunk_len };
+	uint8_t cur = 0;
+	struct prefetch_op op;
+	size_t read_len;
+
+	if (chunk_len == 0) {
+		return -ENOMEM;
+	}
+
+	read_len = MIN(chunk_len, bytes_left);
+
+	err = flash_read(fdev, read_addr, bufs[cur], read_len);
+	if (err != 0) {
+		LOG_ERR("flash_read failed: %d", err);
+		return err;
+	}
+
+	while (bytes_left) {
+		size_t next_len = MIN(chunk_len, bytes_left - read_len);
+
+		if (next_len) {
+			prefetch_start(&op, fdev, read_addr + read_len, bufs[cur ^ 1], next_len);
+		}
+
+		err = write_chunk(bufs[cur], read_len, seg_target_addr, is_bootloader);
+
+		if (next_len) {
+			/* The prefetched buffer is on our stack, so wait for
+			 * the read to finish even if the write failed.
+			 */
+			k_sem_take(&op.done, K_FOREVER);
+		}
+
+		if (err != 0) {
+			LOG_ERR("write_chunk failed: %d", err);
+			return err;
+		}
+
+		if (next_len && op.err != 0) {
+			LOG_ERR("flash_read failed: %d", op.err);
+			return op.err;
+		}
+
+		LOG_DBG("Wrote chunk: offset 0x%x target addr 0x%x size 0x%x", read_addr,
+			seg_target_addr, read_len);
+
+		seg_target_addr += read_len;
+		bytes_left -= read_len;
+		read_addr += read_len;
+		read_len = next_len;
+		cur ^= 1;
+	}
+#else /* CONFIG_FMFU_FDEV_PREFETCH */
 static int load_segment(const struct device *fdev, size_t seg_size, uint32_t seg_target_addr,
 			uint32_t seg_offset, uint8_t *buf, size_t buf_len, bool is_bootloader)
 {
@@ -107,6 +215,7 @@ static int load_segment(const struct device *fdev, size_t seg_size, uint32_t seg
 		bytes_left -= read_len;
 		read_addr += read_len;
 	}
+#endif /* CONFIG_FMFU_FDEV_PREFETCH */
 
 	if (is_bootloader) {
 		/* We need to explicitly call _apply() once all chunks of the
@@ -135,13 +135,26 @@ static void dm_config_get(struct dm_request *dm_req, nrf_dm_config_t *dm_config)
 
 static uint32_t dm_proc_execute_duration_us(struct dm_request *dm_req)
 {
+	/* The ranging duration is derived from the full timing schedule of the
+	 * procedure, which is relatively costly to compute. The schedule only
+	 * depends on the role and the ranging mode, so the result is cached
+	 * per combination and reused for subsequent requests.
+	 */
+	static uint32_t duration_cache[2][2];
+	uint32_t *cached =
+		&duration_cache[(dm_req->role == DM_ROLE_INITIATOR) ? 0 : 1]
+			       [(dm_req->ranging_mode == DM_RANGING_MODE_RTT) ? 0 : 1];
 	uint32_t time_us;
-	nrf_dm_config_t config;
 
-	dm_config_get(dm_req, &config);
+	if (*cached == 0) {
+		nrf_dm_config_t config;
 
-	time_us = nrf_dm_get_duration_us(&config) + NRF_DM_PROC_EXECUTE_DURATION_OVERHEAD_US +
-						    dm_req->extra_window_time_us;
+		dm_config_get(dm_req, &config);
+		*cached = nrf_dm_get_duration_us(&config) +
+			  NRF_DM_PROC_EXECUTE_DURATION_OVERHEAD_US;
+	}
+
+	time_us = *cached + dm_req->extra_window_time_us;
 
 	if (dm_req->role == DM_ROLE_REFLECTOR) {
 		time_us += DM_REFLECTOR_OVERHEAD_US;
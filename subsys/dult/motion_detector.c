@@ -64,6 +64,49 @@ enum motion_poll_state {
 static enum motion_poll_state poll_state = MOTION_POLL_STATE_STOPPED;
 static uint8_t sound_count;
 
+#if defined(CONFIG_DULT_MOTION_DETECTOR_EVENT_REPORTING)
+static atomic_t motion_reported;
+
+static bool motion_reported_consume(void)
+{
+	return atomic_clear(&motion_reported) != 0;
+}
+
+static void motion_reported_clear(void)
+{
+	atomic_clear(&motion_reported);
+}
+
+int dult_motion_detector_motion_reported(const struct dult_user *user)
+{
+	if (!dult_user_is_registered(user)) {
+		return -EACCES;
+	}
+
+	if (!dult_user_is_ready()) {
+		return -EACCES;
+	}
+
+	if (!is_enabled || (poll_state == MOTION_POLL_STATE_STOPPED)) {
+		/* The motion detector is not running: nothing to latch. */
+		return 0;
+	}
+
+	atomic_set(&motion_reported, 1);
+
+	return 0;
+}
+#else
+static inline bool motion_reported_consume(void)
+{
+	return false;
+}
+
+static inline void motion_reported_clear(void)
+{
+}
+#endif /* CONFIG_DULT_MOTION_DETECTOR_EVENT_REPORTING */
+
 static void motion_enable_work_handle(struct k_work *work)
 {
 	int ret;
@@ -91,6 +134,7 @@ static void state_reset(void)
 
 	poll_state = MOTION_POLL_STATE_STOPPED;
 	sound_count = 0;
+	motion_reported_clear();
 
 	/* The state_reset might be called directly from work and thus the calling work may still
 	 * be running.
@@ -132,15 +176,21 @@ static void motion_poll_handle(void)
 	bool motion_detected;
 
 	__ASSERT(motion_detector_cb, "Motion detector callback structure is not registered");
-	__ASSERT(motion_detector_cb->period_expired,
+	__ASSERT(IS_ENABLED(CONFIG_DULT_MOTION_DETECTOR_EVENT_REPORTING) ||
+		 motion_detector_cb->period_expired,
 		 "Motion detector period_expired callback is not populated");
 
-	if (!motion_detector_cb || !motion_detector_cb->period_expired) {
+	if (!motion_detector_cb ||
+	    (!IS_ENABLED(CONFIG_DULT_MOTION_DETECTOR_EVENT_REPORTING) &&
+	     !motion_detector_cb->period_expired)) {
 		LOG_ERR("Motion detector period_expired callback is not populated");
 		return;
 	}
 
-	motion_detected = motion_detector_cb->period_expired();
+	motion_detected = motion_reported_consume();
+	if (motion_detector_cb->period_expired) {
+		motion_detected = motion_detector_cb->period_expired() || motion_detected;
+	}
 	if (motion_detected) {
 		/* Don't reschedule the work. It will be rescheduled after
 		 * a sound playing action is finished.
@@ -325,7 +375,8 @@ int dult_motion_detector_cb_register(const struct dult_user *user,
 		return -EALREADY;
 	}
 
-	if (!cb || !cb->start || !cb->period_expired || !cb->stop) {
+	if (!cb || !cb->start || !cb->stop ||
+	    (!IS_ENABLED(CONFIG_DULT_MOTION_DETECTOR_EVENT_REPORTING) && !cb->period_expired)) {
 		return -EINVAL;
 	}
 
@@ -8,6 +8,7 @@
 
 #include "emds_flash.h"
 
+#include <zephyr/kernel.h>
 #include <zephyr/drivers/flash.h>
 #include <zephyr/sys/crc.h>
 
@@ -86,6 +87,217 @@ static sys_slist_t emds_dynamic_entries;
 static struct emds_partition partition[PARTITIONS_NUM_MAX];
 static emds_store_cb_t app_store_cb;
 
+#if defined(CONFIG_EMDS_BACKGROUND_ERASE)
+static struct {
+	int partition_idx;
+	off_t off;
+	bool active;
+} bg_erase;
+
+static void bg_erase_work_fn(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(bg_erase_work, bg_erase_work_fn);
+
+static bool partition_is_empty(const struct emds_partition *partition)
+{
+	uint8_t cmp[sizeof(struct emds_snapshot_metadata)];
+	uint8_t cache[sizeof(struct emds_snapshot_metadata)];
+	int rc;
+
+	memset(cmp, partition->fp->erase_value, sizeof(cmp));
+
+	/* The last metadata slot and the first data entry delimit the used
+	 * areas, which grow towards each other. If both are empty, so is
+	 * the rest of the partition.
+	 */
+	rc = flash_area_read(partition->fa, partition->fa->fa_size - sizeof(cache), cache,
+			     sizeof(cache));
+	if (rc || memcmp(cmp, cache, sizeof(cache))) {
+		return false;
+	}
+
+	rc = flash_area_read(partition->fa, 0, cache, sizeof(struct emds_data_entry));
+	if (rc || memcmp(cmp, cache, sizeof(struct emds_data_entry))) {
+		return false;
+	}
+
+	return true;
+}
+
+static void bg_erase_work_fn(struct k_work *work)
+{
+	const struct emds_partition *target = &partition[bg_erase.partition_idx];
+	size_t chunk_size;
+	int rc;
+
+	ARG_UNUSED(work);
+
+	if (!bg_erase.active) {
+		return;
+	}
+
+	/* Never touch the partition holding the allocated snapshot. */
+	if ((emds_state == EMDS_STATE_READY) &&
+	    (bg_erase.partition_idx == allocated_snapshot.partition_index)) {
+		bg_erase.active = false;
+		return;
+	}
+
+	if (flash_params_get_erase_cap(target->fp) & FLASH_ERASE_C_EXPLICIT) {
+		struct flash_pages_info info;
+
+		rc = flash_get_page_info_by_offs(target->fa->fa_dev,
+						 target->fa->fa_off + bg_erase.off, &info);
+		if (rc) {
+			LOG_ERR("Unable to get page info: %d", rc);
+			bg_erase.active = false;
+			return;
+		}
+		chunk_size = info.size;
+	} else {
+		chunk_size = MIN(CONFIG_EMDS_BACKGROUND_ERASE_CHUNK_SIZE,
+				 target->fa->fa_size - bg_erase.off);
+	}
+
+	rc = flash_area_flatten(target->fa, bg_erase.off, chunk_size);
+	if (rc) {
+		LOG_ERR("Background erase failed at offset 0x%04lx: %d", bg_erase.off, rc);
+		bg_erase.active = false;
+		return;
+	}
+
+	bg_erase.off += chunk_size;
+	if (bg_erase.off >= target->fa->fa_size) {
+		LOG_DBG("Background erase of partition %d finished", bg_erase.partition_idx);
+		bg_erase.active = false;
+		return;
+	}
+
+	k_work_schedule(&bg_erase_work, K_MSEC(CONFIG_EMDS_BACKGROUND_ERASE_INTERVAL_MS));
+}
+
+static void bg_erase_evaluate(void)
+{
+	int other_idx = (PARTITIONS_NUM_MAX - 1) - allocated_snapshot.partition_index;
+
+	if (bg_erase.active) {
+		return;
+	}
+
+	/* The other partition may still hold the snapshot to fall back to
+	 * until the new generation is stored.
+	 */
+	if ((freshest_snapshot.metadata.fresh_cnt > 0) &&
+	    (freshest_snapshot.partition_index == other_idx)) {
+		return;
+	}
+
+	if (partition_is_empty(&partition[other_idx])) {
+		return;
+	}
+
+	LOG_DBG("Scheduling background erase of partition %d", other_idx);
+	bg_erase.partition_idx = other_idx;
+	bg_erase.off = 0;
+	bg_erase.active = true;
+	k_work_schedule(&bg_erase_work, K_MSEC(CONFIG_EMDS_BACKGROUND_ERASE_INTERVAL_MS));
+}
+
+static void bg_erase_cancel(void)
+{
+	bg_erase.active = false;
+	k_work_cancel_delayable(&bg_erase_work);
+}
+#else
+static void bg_erase_evaluate(void)
+{
+}
+
+static void bg_erase_cancel(void)
+{
+}
+#endif /* CONFIG_EMDS_BACKGROUND_ERASE */
+
+#if defined(CONFIG_EMDS_STAGED_STORE)
+static uint8_t staging_buf[CONFIG_EMDS_STAGED_STORE_BUFFER_SIZE] __aligned(sizeof(uint32_t));
+static size_t staging_len;
+static bool staging_ready;
+
+static void staging_header_place(size_t *off, const struct emds_entry *entry)
+{
+	struct emds_data_entry data_entry = {
+		.id = entry->id,
+		.length = entry->len,
+	};
+
+	memcpy(&staging_buf[*off], &data_entry, sizeof(data_entry));
+	*off += sizeof(data_entry) + entry->len;
+}
+
+static void staging_prepare(size_t data_size)
+{
+	size_t off = 0;
+	struct emds_dynamic_entry *ch;
+
+	staging_ready = false;
+
+	if (data_size > sizeof(staging_buf)) {
+		LOG_WRN("Snapshot size %zu exceeds staging buffer, using chunked store",
+			data_size);
+		return;
+	}
+
+	STRUCT_SECTION_FOREACH(emds_entry, static_entry) {
+		staging_header_place(&off, static_entry);
+	}
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&emds_dynamic_entries, ch, node) {
+		staging_header_place(&off, &ch->entry);
+	}
+
+	staging_len = data_size;
+	staging_ready = true;
+}
+
+static void staging_store(const struct emds_partition *partition)
+{
+	size_t off = 0;
+	struct emds_dynamic_entry *ch;
+
+	/* Headers were placed at emds_prepare() time, only the live
+	 * payloads are copied here.
+	 */
+	STRUCT_SECTION_FOREACH(emds_entry, static_entry) {
+		off += sizeof(struct emds_data_entry);
+		memcpy(&staging_buf[off], static_entry->data, static_entry->len);
+		off += static_entry->len;
+	}
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&emds_dynamic_entries, ch, node) {
+		off += sizeof(struct emds_data_entry);
+		memcpy(&staging_buf[off], ch->entry.data, ch->entry.len);
+		off += ch->entry.len;
+	}
+
+	allocated_snapshot.metadata.snapshot_crc =
+		crc32_k_4_2_update(0, staging_buf, staging_len);
+	emds_flash_write_data(partition, allocated_snapshot.metadata.data_instance_off,
+			      staging_buf, staging_len);
+}
+static void staging_invalidate(void)
+{
+	staging_ready = false;
+}
+#else
+static void staging_prepare(size_t data_size)
+{
+	ARG_UNUSED(data_size);
+}
+
+static void staging_invalidate(void)
+{
+}
+#endif /* CONFIG_EMDS_STAGED_STORE */
+
 static void emds_print_init_info(void)
 {
 	LOG_DBG("EMDS initialized with the following partitions:");
@@ -368,6 +580,8 @@ int emds_prepare(void)
 		if (rc == 0) {
 			allocated_snapshot.partition_index = freshest_partition_idx;
 			emds_state = EMDS_STATE_READY;
+			staging_prepare(data_size);
+			bg_erase_evaluate();
 			return 0;
 		}
 		rc = 0;
@@ -389,6 +603,8 @@ int emds_prepare(void)
 			if (rc == 0) {
 				allocated_snapshot.partition_index = idx;
 				emds_state = EMDS_STATE_READY;
+				staging_prepare(data_size);
+				bg_erase_evaluate();
 				return 0;
 			}
 		}
@@ -485,17 +701,24 @@ int emds_store(void)
 				      offsetof(struct emds_snapshot_metadata, snapshot_crc));
 	}
 
-	STRUCT_SECTION_FOREACH(emds_entry, ch) {
-		entry_to_stream(&partition[idx], &data_off, data_chunk, &wp, ch);
-	}
+#if defined(CONFIG_EMDS_STAGED_STORE)
+	if (staging_ready) {
+		staging_store(&partition[idx]);
+	} else
+#endif
+	{
+		STRUCT_SECTION_FOREACH(emds_entry, ch) {
+			entry_to_stream(&partition[idx], &data_off, data_chunk, &wp, ch);
+		}
 
-	struct emds_dynamic_entry *ch;
+		struct emds_dynamic_entry *ch;
 
-	SYS_SLIST_FOR_EACH_CONTAINER(&emds_dynamic_entries, ch, node) {
-		entry_to_stream(&partition[idx], &data_off, data_chunk, &wp, &ch->entry);
-	}
+		SYS_SLIST_FOR_EACH_CONTAINER(&emds_dynamic_entries, ch, node) {
+			entry_to_stream(&partition[idx], &data_off, data_chunk, &wp, &ch->entry);
+		}
 
-	stream_fflush(&partition[idx], &data_off, data_chunk, &wp);
+		stream_fflush(&partition[idx], &data_off, data_chunk, &wp);
+	}
 
 	if (flash_params_get_erase_cap(partition[idx].fp) & FLASH_ERASE_C_EXPLICIT) {
 		LOG_DBG("Writing snapshot crc on offset: 0x%4lx, crc : 0x%4x",
@@ -518,6 +741,7 @@ int emds_store(void)
 
 unlock_and_exit:
 	emds_state = EMDS_STATE_INITIALIZED;
+	staging_invalidate();
 	RESUME_POFWARN();
 	/* Unlock all interrupts */
 	irq_unlock(store_key);
@@ -539,6 +763,8 @@ int emds_clear(void)
 	}
 
 	emds_state = EMDS_STATE_INITIALIZED;
+	bg_erase_cancel();
+	staging_invalidate();
 	memset(&freshest_snapshot, 0, sizeof(freshest_snapshot));
 	memset(&allocated_snapshot, 0, sizeof(allocated_snapshot));
 	for (int i = 0; i < PARTITIONS_NUM_MAX; i++) {
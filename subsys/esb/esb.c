@@ -26,6 +26,7 @@
 #include <mpsl_fem_protocol_api.h>
 #include <mpsl_timeslot.h>
 #include <multithreading_lock.h>
+#include <nrf_latency_probe.h>
 
 #include "esb_peripherals.h"
 #include "esb_ppi_api.h"
@@ -35,6 +36,13 @@
 
 LOG_MODULE_REGISTER(esb, CONFIG_ESB_LOG_LEVEL);
 
+NRF_LATENCY_PROBE_DEFINE(esb_tx_to_ack);
+
+/* Timestamp of the last TX transaction start. Written and read in the
+ * radio interrupt context only.
+ */
+static uint32_t tx_start_cycles;
+
 BUILD_ASSERT(!IS_ENABLED(CONFIG_ESB_MPSL_TIMESLOT) || ESB_NRF_TIMER_INSTANCE == MPSL_TIMER0,
 	     "ESB Timer differ from MPSL Timer");
 
@@ -168,6 +176,15 @@ struct payload_tx_fifo {
 	 /* Payload queue */
 	struct esb_payload *payload[CONFIG_ESB_TX_FIFO_SIZE];
 
+#if defined(CONFIG_ESB_TX_DESCRIPTORS)
+	/* Descriptor backing the corresponding payload slot, or NULL when the
+	 * slot was filled by esb_write_payload(). For descriptor-backed slots,
+	 * only the header fields of the payload are valid and the data is read
+	 * from the application buffer when the radio PDU is built.
+	 */
+	struct esb_tx_desc *desc[CONFIG_ESB_TX_FIFO_SIZE];
+#endif
+
 	uint32_t back;	/* Back of the queue (last in). */
 	uint32_t front;	/* Front of queue (first out). */
 	atomic_t count;	/* Number of elements in the queue. */
@@ -283,6 +300,29 @@ static uint8_t rx_payload_buffer[CONFIG_ESB_MAX_PAYLOAD_LENGTH +
 struct payload_wrap ack_pl_wrap[CONFIG_ESB_TX_FIFO_SIZE];
 struct payload_wrap *ack_pl_wrap_pipe[CONFIG_ESB_PIPE_COUNT];
 
+#if defined(CONFIG_ESB_ACK_PAYLOAD_PRESTAGE)
+/* Prestaged ACK PDUs per pipe. The staging holds the pipe's head ACK payload
+ * and the one following it in ready-to-transmit PDU buffers, so that the
+ * RX to ACK TX turnaround only patches the PDU header and switches the radio
+ * packet pointer. Advancing after a delivered ACK payload is a pointer move,
+ * and refilling the staging is deferred until the ACK transmission is over.
+ */
+static uint8_t ack_prestage_buffer[CONFIG_ESB_PIPE_COUNT][2]
+				  [CONFIG_ESB_MAX_PAYLOAD_LENGTH + sizeof(struct esb_radio_pdu)];
+
+struct ack_prestage {
+	/* PDU with the pipe's head ACK payload. NULL when not staged. */
+	struct esb_radio_pdu *cur;
+	/* PDU with the ACK payload following the head. NULL when not staged. */
+	struct esb_radio_pdu *next;
+};
+
+static struct ack_prestage ack_prestage_pipe[CONFIG_ESB_PIPE_COUNT];
+
+/* Bitmask of pipes to refill after the ACK transmission is over. */
+static uint32_t ack_prestage_pending;
+#endif /* CONFIG_ESB_ACK_PAYLOAD_PRESTAGE */
+
 /* Run time variables */
 static uint8_t pids[CONFIG_ESB_PIPE_COUNT];
 static struct pipe_info rx_pipe_info[CONFIG_ESB_PIPE_COUNT];
@@ -1182,8 +1222,50 @@ static bool update_radio_parameters(void)
 	return params_valid;
 }
 
+#if defined(CONFIG_ESB_TX_DESCRIPTORS)
+/* Complete the descriptor in the given TX FIFO slot, if any. */
+static void tx_desc_complete(uint32_t index, int result)
+{
+	struct esb_tx_desc *desc = tx_fifo.desc[index];
+
+	if (desc == NULL) {
+		return;
+	}
+
+	tx_fifo.desc[index] = NULL;
+
+	if (desc->complete) {
+		desc->complete(desc, result);
+	}
+}
+
+/* Cancel all queued descriptors, for example when the FIFO is flushed. */
+static void tx_desc_cancel_all(void)
+{
+	for (size_t i = 0; i < CONFIG_ESB_TX_FIFO_SIZE; i++) {
+		tx_desc_complete(i, -ECANCELED);
+	}
+}
+#endif /* CONFIG_ESB_TX_DESCRIPTORS */
+
+/* Get the data of the payload at the front of the TX FIFO. */
+static const uint8_t *tx_front_data(void)
+{
+#if defined(CONFIG_ESB_TX_DESCRIPTORS)
+	if (tx_fifo.desc[tx_fifo.front] != NULL) {
+		return tx_fifo.desc[tx_fifo.front]->data;
+	}
+#endif
+
+	return tx_fifo.payload[tx_fifo.front]->data;
+}
+
 static void reset_fifos(void)
 {
+#if defined(CONFIG_ESB_TX_DESCRIPTORS)
+	tx_desc_cancel_all();
+#endif
+
 	tx_fifo.back = 0;
 	tx_fifo.front = 0;
 	atomic_clear(&tx_fifo.count);
@@ -1217,6 +1299,10 @@ static void initialize_fifos(void)
 	for (size_t i = 0; i < CONFIG_ESB_PIPE_COUNT; i++) {
 		ack_pl_wrap_pipe[i] = NULL;
 	}
+
+#if defined(CONFIG_ESB_ACK_PAYLOAD_PRESTAGE)
+	ack_prestage_reset();
+#endif
 }
 
 static void tx_fifo_remove_first(void)
@@ -1225,6 +1311,10 @@ static void tx_fifo_remove_first(void)
 		return;
 	}
 
+#if defined(CONFIG_ESB_TX_DESCRIPTORS)
+	tx_desc_complete(tx_fifo.front, 0);
+#endif
+
 	if (++tx_fifo.front >= CONFIG_ESB_TX_FIFO_SIZE) {
 		tx_fifo.front = 0;
 	}
@@ -1408,6 +1498,8 @@ static void start_tx_transaction(void)
 	bool ack = true;
 	bool is_tx_idle = false;
 	struct esb_radio_pdu *pdu = (struct esb_radio_pdu *)tx_payload_buffer;
+
+	tx_start_cycles = NRF_LATENCY_PROBE_TIMESTAMP();
 	/* Prepare the payload */
 	current_payload = tx_fifo.payload[tx_fifo.front];
 
@@ -1418,7 +1510,7 @@ static void start_tx_transaction(void)
 
 		pdu->type.fixed_pdu.pid = current_payload->pid;
 
-		memcpy(pdu->data, current_payload->data, current_payload->length);
+		memcpy(pdu->data, tx_front_data(), current_payload->length);
 
 		if (fast_switching) {
 			nrf_radio_shorts_set(NRF_RADIO, (RADIO_RSSI_SHORTS |
@@ -1446,7 +1538,7 @@ static void start_tx_transaction(void)
 		/* nRF24L01 chip inverts ACK bit */
 		pdu->type.dpl_pdu.ack = !current_payload->noack;
 
-		memcpy(pdu->data, current_payload->data, current_payload->length);
+		memcpy(pdu->data, tx_front_data(), current_payload->length);
 
 		/* Handling ack if noack is set to false or if selective auto ack is turned off */
 		if (ack) {
@@ -1799,6 +1891,7 @@ static void on_radio_disabled_tx_wait_for_ack(void)
 	/* If the radio has received a packet and the CRC status is OK */
 	if (nrf_radio_event_check(NRF_RADIO, ESB_RADIO_EVENT_END) &&
 	    nrf_radio_crc_status_check(NRF_RADIO)) {
+		NRF_LATENCY_PROBE_RECORD(esb_tx_to_ack, tx_start_cycles);
 		atomic_set_bit(&interrupt_flags, ESB_EVENT_TX_SUCCESS);
 		last_tx_attempts = esb_cfg.retransmit_count - retransmits_remaining + 1;
 
@@ -2004,10 +2097,77 @@ static void clear_events_restart_rx(void)
 	radio_start();
 }
 
-static void prepare_ack_pdu_dpl(bool retransmit_payload, struct pipe_info *pipe_info)
+#if defined(CONFIG_ESB_ACK_PAYLOAD_PRESTAGE)
+static void ack_prestage_reset(void)
+{
+	for (size_t i = 0; i < CONFIG_ESB_PIPE_COUNT; i++) {
+		ack_prestage_pipe[i].cur = NULL;
+		ack_prestage_pipe[i].next = NULL;
+	}
+
+	ack_prestage_pending = 0;
+}
+
+/* Fill the unstaged prestage buffers of a pipe from its ACK payload queue.
+ * Must not be called while the radio may be transmitting from the staging,
+ * that is, only with the radio interrupt disabled or from the radio interrupt
+ * outside of the ACK transmission.
+ */
+static void ack_prestage_fill(uint32_t pipe)
+{
+	struct ack_prestage *prestage = &ack_prestage_pipe[pipe];
+	struct payload_wrap *pl = ack_pl_wrap_pipe[pipe];
+	struct esb_radio_pdu *free_pdu;
+
+	if (pl == NULL) {
+		return;
+	}
+
+	/* The buffer not referenced by the other slot is free for filling. */
+	free_pdu = (struct esb_radio_pdu *)ack_prestage_buffer[pipe][0];
+
+	if (prestage->cur == NULL) {
+		if (prestage->next == free_pdu) {
+			free_pdu = (struct esb_radio_pdu *)ack_prestage_buffer[pipe][1];
+		}
+
+		memset(&free_pdu->type.dpl_pdu, 0, sizeof(free_pdu->type.dpl_pdu));
+		free_pdu->type.dpl_pdu.length = pl->p_payload->length;
+		memcpy(free_pdu->data, pl->p_payload->data, pl->p_payload->length);
+		prestage->cur = free_pdu;
+	}
+
+	if ((prestage->next == NULL) && (pl->p_next != NULL)) {
+		pl = pl->p_next;
+
+		if (prestage->cur == free_pdu) {
+			free_pdu = (struct esb_radio_pdu *)ack_prestage_buffer[pipe][1];
+		}
+
+		memset(&free_pdu->type.dpl_pdu, 0, sizeof(free_pdu->type.dpl_pdu));
+		free_pdu->type.dpl_pdu.length = pl->p_payload->length;
+		memcpy(free_pdu->data, pl->p_payload->data, pl->p_payload->length);
+		prestage->next = free_pdu;
+	}
+}
+
+/* The head ACK payload of the pipe was delivered. The staged follow-up payload
+ * becomes the head and refilling is deferred out of the turnaround.
+ */
+static void ack_prestage_advance(uint32_t pipe)
+{
+	ack_prestage_pipe[pipe].cur = ack_prestage_pipe[pipe].next;
+	ack_prestage_pipe[pipe].next = NULL;
+	ack_prestage_pending |= BIT(pipe);
+}
+#endif /* CONFIG_ESB_ACK_PAYLOAD_PRESTAGE */
+
+static struct esb_radio_pdu *prepare_ack_pdu_dpl(bool retransmit_payload,
+						 struct pipe_info *pipe_info)
 {
 	struct esb_radio_pdu *tx_pdu = (struct esb_radio_pdu *)tx_payload_buffer;
 	struct esb_radio_pdu *rx_pdu = (struct esb_radio_pdu *)rx_payload_buffer;
+	struct esb_radio_pdu *ack_pdu = tx_pdu;
 
 	uint32_t pipe = nrf_radio_rxmatch_get(NRF_RADIO);
 
@@ -2029,13 +2189,27 @@ static void prepare_ack_pdu_dpl(bool retransmit_payload, struct pipe_info *pipe_
 			/* ACK payloads also require TX_DS */
 			/* (page 40 of the 'nRF24LE1_Product_Specification_rev1_6.pdf') */
 			atomic_set_bit(&interrupt_flags, ESB_EVENT_TX_SUCCESS);
+
+#if defined(CONFIG_ESB_ACK_PAYLOAD_PRESTAGE)
+			ack_prestage_advance(pipe);
+#endif
 		}
 
 		if (current_payload != 0) {
 			pipe_info->ack_payload = true;
 
+#if defined(CONFIG_ESB_ACK_PAYLOAD_PRESTAGE)
+			if (ack_prestage_pipe[pipe].cur != NULL) {
+				ack_pdu = ack_prestage_pipe[pipe].cur;
+			} else {
+				tx_pdu->type.dpl_pdu.length = current_payload->length;
+				memcpy(tx_pdu->data, current_payload->data,
+				       current_payload->length);
+			}
+#else
 			tx_pdu->type.dpl_pdu.length = current_payload->length;
 			memcpy(tx_pdu->data, current_payload->data, current_payload->length);
+#endif
 		} else {
 			pipe_info->ack_payload = false;
 			tx_pdu->type.dpl_pdu.length = 0;
@@ -2045,8 +2219,10 @@ static void prepare_ack_pdu_dpl(bool retransmit_payload, struct pipe_info *pipe_
 		tx_pdu->type.dpl_pdu.length = 0;
 	}
 
-	tx_pdu->type.dpl_pdu.pid = rx_pdu->type.dpl_pdu.pid;
-	tx_pdu->type.dpl_pdu.ack = rx_pdu->type.dpl_pdu.ack;
+	ack_pdu->type.dpl_pdu.pid = rx_pdu->type.dpl_pdu.pid;
+	ack_pdu->type.dpl_pdu.ack = rx_pdu->type.dpl_pdu.ack;
+
+	return ack_pdu;
 }
 
 static void on_radio_disabled_rx(void)
@@ -2082,9 +2258,11 @@ static void on_radio_disabled_rx(void)
 	if ((esb_cfg.selective_auto_ack == false) || rx_pdu->type.dpl_pdu.ack) {
 		esb_fem_for_tx_ack();
 
+		struct esb_radio_pdu *ack_pdu = tx_pdu;
+
 		switch (esb_cfg.protocol) {
 		case ESB_PROTOCOL_ESB_DPL:
-			prepare_ack_pdu_dpl(retransmit_payload, pipe_info);
+			ack_pdu = prepare_ack_pdu_dpl(retransmit_payload, pipe_info);
 			break;
 
 		case ESB_PROTOCOL_ESB:
@@ -2101,7 +2279,7 @@ static void on_radio_disabled_rx(void)
 		update_radio_tx_power();
 
 		nrf_radio_txaddress_set(NRF_RADIO, nrf_radio_rxmatch_get(NRF_RADIO));
-		nrf_radio_packetptr_set(NRF_RADIO, tx_pdu);
+		nrf_radio_packetptr_set(NRF_RADIO, ack_pdu);
 
 		if (fast_switching) {
 			nrf_radio_shorts_set(NRF_RADIO, (RADIO_RSSI_SHORTS |
@@ -2149,6 +2327,18 @@ static void on_radio_disabled_rx_send_ack(void)
 	on_radio_disabled = on_radio_disabled_rx;
 
 	esb_state = ESB_STATE_PRX;
+
+#if defined(CONFIG_ESB_ACK_PAYLOAD_PRESTAGE)
+	/* The ACK transmission is over, refill the staging of the pipes that
+	 * advanced, outside of the RX to ACK TX turnaround.
+	 */
+	while (ack_prestage_pending) {
+		uint32_t pipe = find_lsb_set(ack_prestage_pending) - 1;
+
+		ack_prestage_pending &= ~BIT(pipe);
+		ack_prestage_fill(pipe);
+	}
+#endif
 }
 
 static void on_radio_end_monitor(void)
@@ -2689,6 +2879,10 @@ int esb_write_payload(const struct esb_payload *payload)
 
 			atomic_inc(&tx_fifo.count);
 
+#if defined(CONFIG_ESB_ACK_PAYLOAD_PRESTAGE)
+			ack_prestage_fill(payload->pipe);
+#endif
+
 			if (!IS_ENABLED(CONFIG_ESB_MPSL_TIMESLOT) ||
 			    (esb_state == ESB_STATE_PRX || esb_state == ESB_STATE_PRX_SEND_ACK)) {
 				irq_enable(ESB_RADIO_IRQ_NUMBER);
@@ -2705,6 +2899,68 @@ int esb_write_payload(const struct esb_payload *payload)
 	return 0;
 }
 
+int esb_write_desc(struct esb_tx_desc *desc)
+{
+#if defined(CONFIG_ESB_TX_DESCRIPTORS)
+	if (esb_state == ESB_STATE_UNINITIALIZED) {
+		return -EACCES;
+	}
+
+	if (esb_cfg.mode != ESB_MODE_PTX) {
+		return -EPERM;
+	}
+
+	if (desc == NULL || desc->data == NULL) {
+		return -EINVAL;
+	}
+
+	if ((desc->length == 0) || (desc->length > CONFIG_ESB_MAX_PAYLOAD_LENGTH) ||
+	    ((esb_cfg.protocol == ESB_PROTOCOL_ESB) &&
+	     (desc->length != esb_cfg.payload_length))) {
+		return -EMSGSIZE;
+	}
+
+	if (atomic_get(&tx_fifo.count) >= CONFIG_ESB_TX_FIFO_SIZE) {
+		return -ENOMEM;
+	}
+
+	if (desc->pipe >= CONFIG_ESB_PIPE_COUNT) {
+		return -EINVAL;
+	}
+
+	/* Only the header fields of the FIFO slot are filled in. The data
+	 * stays in the application buffer and is copied once, into the radio
+	 * PDU, when the transmission starts.
+	 */
+	tx_fifo.payload[tx_fifo.back]->length = desc->length;
+	tx_fifo.payload[tx_fifo.back]->pipe = desc->pipe;
+	tx_fifo.payload[tx_fifo.back]->noack = desc->noack;
+
+	pids[desc->pipe] = (pids[desc->pipe] + 1) % (PID_MAX + 1);
+	tx_fifo.payload[tx_fifo.back]->pid = pids[desc->pipe];
+
+	tx_fifo.desc[tx_fifo.back] = desc;
+
+	if (++tx_fifo.back >= CONFIG_ESB_TX_FIFO_SIZE) {
+		tx_fifo.back = 0;
+	}
+
+	atomic_inc(&tx_fifo.count);
+
+	if (esb_cfg.tx_mode == ESB_TXMODE_AUTO &&
+	    (esb_state == ESB_STATE_IDLE ||
+	     (IS_ENABLED(CONFIG_ESB_NEVER_DISABLE_TX) && esb_state == ESB_STATE_PTX_TXIDLE))) {
+		schedule_tx_transaction();
+	}
+
+	return 0;
+#else
+	ARG_UNUSED(desc);
+
+	return -ENOTSUP;
+#endif /* CONFIG_ESB_TX_DESCRIPTORS */
+}
+
 int esb_read_rx_payload(struct esb_payload *payload)
 {
 	if (esb_state == ESB_STATE_UNINITIALIZED) {
@@ -2802,6 +3058,10 @@ int esb_flush_tx(void)
 		return 0;
 	}
 
+#if defined(CONFIG_ESB_TX_DESCRIPTORS)
+	tx_desc_cancel_all();
+#endif
+
 	atomic_clear(&tx_fifo.count);
 	tx_fifo.back = 0;
 	tx_fifo.front = 0;
@@ -2815,6 +3075,10 @@ int esb_flush_tx(void)
 		ack_pl_wrap_pipe[i] = NULL;
 	}
 
+#if defined(CONFIG_ESB_ACK_PAYLOAD_PRESTAGE)
+	ack_prestage_reset();
+#endif
+
 	return 0;
 }
 
@@ -2830,6 +3094,11 @@ int esb_pop_tx(void)
 		return -ENODATA;
 	}
 
+#if defined(CONFIG_ESB_TX_DESCRIPTORS)
+	/* The payload is removed without being transmitted. */
+	tx_desc_complete(tx_fifo.front, -ECANCELED);
+#endif
+
 	tx_fifo_remove_first();
 
 	return 0;
@@ -71,6 +71,29 @@ static K_EVENT_DEFINE(emp_all_remotes_started);
 /** @brief IPC communication data. One entry per connected core. */
 static struct emp_ipc_data emp_ipc_data[CONFIG_EVENT_MANAGER_PROXY_CH_COUNT];
 
+#if defined(CONFIG_EVENT_MANAGER_PROXY_BATCH)
+/** @brief Size of the length field preceding every event in a batch. */
+#define EMP_BATCH_ENTRY_HEADER_SIZE sizeof(uint32_t)
+
+/** @brief Event batch buffer. One entry per connected core.
+ *
+ * Events are serialized back-to-back, each preceded by its length and
+ * padded to the 4-byte boundary, and sent in a single IPC message.
+ */
+struct emp_batch_data {
+	struct k_spinlock lock;
+	size_t len;
+	uint8_t buf[CONFIG_EVENT_MANAGER_PROXY_BATCH_BUF_SIZE] __aligned(sizeof(uint32_t));
+};
+
+static struct emp_batch_data emp_batch_data[CONFIG_EVENT_MANAGER_PROXY_CH_COUNT];
+
+static void handle_batch_flush_timeout(struct k_work *work);
+
+/** @brief Work used to bound the time events can wait in batch buffers. */
+static K_WORK_DELAYABLE_DEFINE(emp_batch_flush_work, handle_batch_flush_timeout);
+#endif /* CONFIG_EVENT_MANAGER_PROXY_BATCH */
+
 
 /**
  * @brief Find IPC structure by the given instance.
@@ -159,6 +182,30 @@ static void handle_remote_event(struct emp_ipc_data *ipc, const void *data, size
 	_event_submit(event);
 }
 
+#if defined(CONFIG_EVENT_MANAGER_PROXY_BATCH)
+static void handle_remote_batch(struct emp_ipc_data *ipc, const void *data, size_t len)
+{
+	const uint8_t *buf = data;
+	size_t offset = 0;
+
+	while ((offset + EMP_BATCH_ENTRY_HEADER_SIZE) <= len) {
+		uint32_t event_size;
+
+		memcpy(&event_size, &buf[offset], sizeof(event_size));
+		offset += EMP_BATCH_ENTRY_HEADER_SIZE;
+
+		if ((event_size == 0) || ((offset + event_size) > len)) {
+			LOG_ERR("Malformed event batch from remote %p", ipc);
+			__ASSERT_NO_MSG(false);
+			return;
+		}
+
+		handle_remote_event(ipc, &buf[offset], event_size);
+		offset += ROUND_UP(event_size, sizeof(uint32_t));
+	}
+}
+#endif /* CONFIG_EVENT_MANAGER_PROXY_BATCH */
+
 static void handle_remote_command_subscribe(struct emp_ipc_data *ipc, const void *data, size_t len)
 {
 	if (ipc->started) {
@@ -256,7 +303,11 @@ static void handle_ipc_data_receive(const void *data, size_t len, void *priv)
 	__ASSERT_NO_MSG(!k_is_in_isr());
 
 	if (ipc->started && emp_started) {
+#if defined(CONFIG_EVENT_MANAGER_PROXY_BATCH)
+		handle_remote_batch(ipc, data, len);
+#else
 		handle_remote_event(ipc, data, len);
+#endif
 	} else {
 		handle_remote_command(ipc, data, len);
 	}
@@ -274,9 +325,68 @@ static void handle_ipc_endpoint_error(const char *message, void *priv)
 	__ASSERT_NO_MSG(false);
 }
 
+static int ipc_send_with_retries(struct emp_ipc_data *ipc, const void *data, size_t len)
+{
+	int ret;
+
+	for (size_t cnt = CONFIG_EVENT_MANAGER_PROXY_SEND_RETRIES + 1; cnt > 0; --cnt) {
+		ret = ipc_service_send(&ipc->ept, data, len);
+		if (ret >= 0) {
+			break;
+		}
+		k_usleep(1);
+	}
+
+	if (ret < 0) {
+		LOG_ERR("Cannot send event to remote %p, err: %d", ipc, ret);
+		__ASSERT_NO_MSG(false);
+	}
+
+	return ret;
+}
+
+#if defined(CONFIG_EVENT_MANAGER_PROXY_BATCH)
+static int batch_flush(struct emp_ipc_data *ipc)
+{
+	struct emp_batch_data *batch = &emp_batch_data[ipc2idx(ipc)];
+	uint32_t buffer[DIV_ROUND_UP(CONFIG_EVENT_MANAGER_PROXY_BATCH_BUF_SIZE,
+				     sizeof(uint32_t))];
+	k_spinlock_key_t key;
+	size_t len;
+
+	/* Copy the batch out under the lock, as sending may retry and sleep. */
+	key = k_spin_lock(&batch->lock);
+	len = batch->len;
+	if (len > 0) {
+		memcpy(buffer, batch->buf, len);
+		batch->len = 0;
+	}
+	k_spin_unlock(&batch->lock, key);
+
+	if (len == 0) {
+		return 0;
+	}
+
+	return ipc_send_with_retries(ipc, buffer, len);
+}
+
+static void handle_batch_flush_timeout(struct k_work *work)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(emp_ipc_data); ++i) {
+		struct emp_ipc_data *ipc = &emp_ipc_data[i];
+
+		if (ipc->used && ipc->started) {
+			(void)batch_flush(ipc);
+		}
+	}
+}
+
 static int send_event_to_remote(struct emp_ipc_data *ipc, const struct app_event_header *eh)
 {
 	const struct event_type *remote_ev = ipc->event_type_map[et2idx(eh->type_id)];
+	struct emp_batch_data *batch = &emp_batch_data[ipc2idx(ipc)];
+	struct app_event_header *remote_eh;
+	k_spinlock_key_t key;
 	int ret;
 
 	if (remote_ev == NULL) {
@@ -284,27 +394,78 @@ static int send_event_to_remote(struct emp_ipc_data *ipc, const struct app_event
 	}
 
 	size_t size = app_event_manager_event_size(eh);
-	uint32_t buffer[DIV_ROUND_UP(size, sizeof(uint32_t))];
-	struct app_event_header *remote_eh = (struct app_event_header *)buffer;
+	uint32_t event_size = size;
+	size_t entry_size = EMP_BATCH_ENTRY_HEADER_SIZE + ROUND_UP(size, sizeof(uint32_t));
+
+	if (entry_size > sizeof(batch->buf)) {
+		/* An event that does not fit in the batch buffer is sent in
+		 * its own message. Flush the batch first to keep the event
+		 * order.
+		 */
+		uint32_t buffer[1 + DIV_ROUND_UP(size, sizeof(uint32_t))];
+
+		memcpy(&buffer[0], &event_size, sizeof(event_size));
+		remote_eh = (struct app_event_header *)&buffer[1];
+		memcpy(remote_eh, eh, size);
+		remote_eh->type_id = remote_ev;
+
+		ret = batch_flush(ipc);
+		if (ret < 0) {
+			return ret;
+		}
 
-	memcpy(buffer, eh, sizeof(buffer));
-	remote_eh->type_id = remote_ev;
+		return ipc_send_with_retries(ipc, buffer, sizeof(buffer));
+	}
 
-	for (size_t cnt = CONFIG_EVENT_MANAGER_PROXY_SEND_RETRIES + 1; cnt > 0; --cnt) {
-		ret = ipc_service_send(&ipc->ept, buffer, sizeof(buffer));
-		if (ret >= 0) {
-			break;
+	key = k_spin_lock(&batch->lock);
+
+	if ((batch->len + entry_size) > sizeof(batch->buf)) {
+		k_spin_unlock(&batch->lock, key);
+
+		ret = batch_flush(ipc);
+		if (ret < 0) {
+			return ret;
 		}
-		k_usleep(1);
+
+		key = k_spin_lock(&batch->lock);
 	}
 
-	if (ret < 0) {
-		LOG_ERR("Cannot send event to remote %p, err: %d", ipc, ret);
-		__ASSERT_NO_MSG(false);
+	memcpy(&batch->buf[batch->len], &event_size, sizeof(event_size));
+	remote_eh = (struct app_event_header *)
+		    &batch->buf[batch->len + EMP_BATCH_ENTRY_HEADER_SIZE];
+	memcpy(remote_eh, eh, size);
+	remote_eh->type_id = remote_ev;
+	batch->len += entry_size;
+
+	k_spin_unlock(&batch->lock, key);
+
+	/* Bound the time the event can wait in the batch buffer. The work
+	 * is not rescheduled if it is already pending.
+	 */
+	(void)k_work_schedule(&emp_batch_flush_work,
+			      K_MSEC(CONFIG_EVENT_MANAGER_PROXY_BATCH_FLUSH_TIMEOUT_MS));
+
+	return 0;
+}
+#else
+static int send_event_to_remote(struct emp_ipc_data *ipc, const struct app_event_header *eh)
+{
+	const struct event_type *remote_ev = ipc->event_type_map[et2idx(eh->type_id)];
+
+	if (remote_ev == NULL) {
+		return 0;
 	}
 
-	return ret;
+	size_t size = app_event_manager_event_size(eh);
+	uint32_t buffer[DIV_ROUND_UP(size, sizeof(uint32_t))];
+	struct app_event_header *remote_eh = (struct app_event_header *)buffer;
+
+	memcpy(buffer, eh, sizeof(buffer));
+	remote_eh->type_id = remote_ev;
+
+	return ipc_send_with_retries(ipc, buffer, sizeof(buffer));
 }
+#endif /* CONFIG_EVENT_MANAGER_PROXY_BATCH */
 
 static void event_manager_proxy_on_event_process(const struct app_event_header *eh)
 {
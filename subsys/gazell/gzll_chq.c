@@ -0,0 +1,234 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+
+#include <nrf_gzll.h>
+#include <gzll_chq.h>
+
+LOG_MODULE_REGISTER(gzll_chq, CONFIG_GAZELL_LOG_LEVEL);
+
+/* Failure rate EWMA fixed point scale. EWMA_UNIT corresponds to 100 %. */
+#define EWMA_UNIT  256
+#define EWMA_SHIFT CONFIG_GAZELL_CHANNEL_QUALITY_EWMA_SHIFT
+
+#define BLACKLIST_LEVEL \
+	((EWMA_UNIT * CONFIG_GAZELL_CHANNEL_QUALITY_BLACKLIST_THRESHOLD) / 100)
+/* Blacklisted channels are re-admitted below half of the blacklist level,
+ * so that a channel does not toggle on every evaluation.
+ */
+#define READMIT_LEVEL (BLACKLIST_LEVEL / 2)
+
+struct channel_stats {
+	/* RF channel number of the entry. */
+	uint8_t channel;
+	/* Failure rate EWMA, EWMA_UNIT fixed point. */
+	uint16_t fail_ewma;
+	/* True if the channel is excluded from the active channel table. */
+	bool blacklisted;
+	uint32_t success_count;
+	uint32_t fail_count;
+};
+
+static struct channel_stats stats[NRF_GZLL_CONST_MAX_CHANNEL_TABLE_SIZE];
+static uint8_t monitored_count;
+/* Channel table most recently written to the Gazell Link Layer. */
+static uint8_t active_table[NRF_GZLL_CONST_MAX_CHANNEL_TABLE_SIZE];
+static uint8_t active_count;
+
+bool gzll_chq_init(void)
+{
+	uint8_t channels[NRF_GZLL_CONST_MAX_CHANNEL_TABLE_SIZE];
+	uint32_t size = NRF_GZLL_CONST_MAX_CHANNEL_TABLE_SIZE;
+	uint8_t i;
+
+	if (!nrf_gzll_get_channel_table(channels, &size) || size == 0) {
+		return false;
+	}
+
+	memset(stats, 0, sizeof(stats));
+
+	for (i = 0; i < size; i++) {
+		stats[i].channel = channels[i];
+		active_table[i] = channels[i];
+	}
+
+	monitored_count = size;
+	active_count = size;
+
+	return true;
+}
+
+void gzll_chq_report(uint8_t channel_index, bool success)
+{
+	struct channel_stats *ch;
+
+	if (channel_index >= monitored_count) {
+		return;
+	}
+
+	ch = &stats[channel_index];
+
+	if (success) {
+		ch->success_count++;
+	} else {
+		ch->fail_count++;
+	}
+
+	ch->fail_ewma -= ch->fail_ewma >> EWMA_SHIFT;
+	if (!success) {
+		ch->fail_ewma += EWMA_UNIT >> EWMA_SHIFT;
+	}
+}
+
+/* Blacklisted channels carry no traffic, so their statistics would never
+ * recover. Decay their failure rate on every evaluation until they are
+ * re-admitted and probed again.
+ */
+static void blacklist_decay(void)
+{
+	uint8_t i;
+
+	for (i = 0; i < monitored_count; i++) {
+		if (stats[i].blacklisted) {
+			stats[i].fail_ewma -= stats[i].fail_ewma >> EWMA_SHIFT;
+
+			if (stats[i].fail_ewma < READMIT_LEVEL) {
+				stats[i].blacklisted = false;
+				LOG_INF("Channel %u re-admitted", stats[i].channel);
+			}
+		}
+	}
+}
+
+/* Build the channel table sorted by ascending failure rate, excluding
+ * blacklisted channels while keeping at least the configured minimum.
+ */
+static uint8_t build_table(uint8_t *table)
+{
+	uint8_t order[NRF_GZLL_CONST_MAX_CHANNEL_TABLE_SIZE];
+	uint8_t count = 0;
+	uint8_t i, j;
+
+	for (i = 0; i < monitored_count; i++) {
+		for (j = count; j > 0; j--) {
+			if (stats[order[j - 1]].fail_ewma <= stats[i].fail_ewma) {
+				break;
+			}
+			order[j] = order[j - 1];
+		}
+		order[j] = i;
+		count++;
+	}
+
+	/* The minimum number of samples prevents blacklisting on a few
+	 * unlucky transactions right after the statistics were reset.
+	 */
+	for (i = 0; i < monitored_count; i++) {
+		struct channel_stats *ch = &stats[order[i]];
+
+		if (i < CONFIG_GAZELL_CHANNEL_QUALITY_MIN_CHANNELS) {
+			ch->blacklisted = false;
+		} else if (!ch->blacklisted &&
+			   (ch->fail_ewma >= BLACKLIST_LEVEL) &&
+			   (ch->success_count + ch->fail_count >=
+			    CONFIG_GAZELL_CHANNEL_QUALITY_MIN_SAMPLES)) {
+			ch->blacklisted = true;
+			LOG_INF("Channel %u blacklisted", ch->channel);
+		}
+	}
+
+	count = 0;
+	for (i = 0; i < monitored_count; i++) {
+		if (!stats[order[i]].blacklisted) {
+			table[count++] = stats[order[i]].channel;
+		}
+	}
+
+	return count;
+}
+
+static bool channel_table_write(const uint8_t *table, uint8_t count)
+{
+	bool update_ok = true;
+	bool gzll_enabled_state;
+
+	gzll_enabled_state = nrf_gzll_is_enabled();
+
+	if (gzll_enabled_state) {
+		unsigned int key = irq_lock();
+
+		nrf_gzll_disable();
+
+		while (nrf_gzll_is_enabled()) {
+			k_cpu_atomic_idle(key);
+			key = irq_lock();
+		}
+
+		irq_unlock(key);
+	}
+
+	update_ok &= nrf_gzll_set_channel_table((uint8_t *)table, count);
+	if (gzll_enabled_state) {
+		update_ok &= nrf_gzll_enable();
+	}
+
+	return update_ok;
+}
+
+bool gzll_chq_apply(void)
+{
+	uint8_t table[NRF_GZLL_CONST_MAX_CHANNEL_TABLE_SIZE];
+	uint8_t count;
+
+	if (monitored_count == 0) {
+		return false;
+	}
+
+	blacklist_decay();
+
+	count = build_table(table);
+
+	if ((count == active_count) &&
+	    (memcmp(table, active_table, count) == 0)) {
+		return true;
+	}
+
+	if (!channel_table_write(table, count)) {
+		LOG_ERR("Failed to apply channel table");
+		return false;
+	}
+
+	memcpy(active_table, table, count);
+	active_count = count;
+
+	LOG_DBG("Channel table updated, %u of %u channels in use",
+		count, monitored_count);
+
+	return true;
+}
+
+bool gzll_chq_quality_get(uint8_t channel_index, struct gzll_chq_quality *quality)
+{
+	const struct channel_stats *ch;
+
+	if ((channel_index >= monitored_count) || (quality == NULL)) {
+		return false;
+	}
+
+	ch = &stats[channel_index];
+
+	quality->channel = ch->channel;
+	quality->fail_rate = (ch->fail_ewma * 100) / EWMA_UNIT;
+	quality->blacklisted = ch->blacklisted;
+	quality->success_count = ch->success_count;
+	quality->fail_count = ch->fail_count;
+
+	return true;
+}
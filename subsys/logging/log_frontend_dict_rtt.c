@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log_core.h>
+#include <zephyr/logging/log_frontend.h>
+#include <zephyr/logging/log_output_dict.h>
+#include <zephyr/sys/mpsc_pbuf.h>
+#include <SEGGER_RTT.h>
+
+/* The frontend captures log messages in the binary dictionary format:
+ * the cbprintf package holding the format string pointer and the raw
+ * arguments is copied into a lock-free multi-producer ring buffer
+ * together with the dictionary message header. A low-priority thread
+ * drains the ring buffer to a dedicated RTT up channel. Formatting is
+ * done offline with the Zephyr dictionary log parser and the log
+ * database extracted from the ELF file.
+ */
+
+struct log_frontend_pkt_hdr {
+	MPSC_PBUF_HDR;
+	uint32_t len: 32 - MPSC_PBUF_HDR_BITS;
+};
+
+BUILD_ASSERT(sizeof(struct log_frontend_pkt_hdr) == sizeof(uint32_t));
+
+struct log_frontend_pkt {
+	struct log_frontend_pkt_hdr hdr;
+	uint8_t data[];
+};
+
+union log_frontend_pkt_word {
+	struct log_frontend_pkt_hdr hdr;
+	uint32_t word;
+};
+
+static uint32_t pbuf_data[CONFIG_LOG_FRONTEND_DICT_RTT_BUFFER_SIZE / sizeof(uint32_t)];
+static struct mpsc_pbuf_buffer pbuf;
+static uint8_t rtt_buf[CONFIG_LOG_FRONTEND_DICT_RTT_OUTPUT_BUFFER_SIZE];
+
+static K_SEM_DEFINE(data_sem, 0, 1);
+static atomic_t dropped_cnt;
+static bool in_panic;
+
+static uint32_t pkt_get_wlen(const union mpsc_pbuf_generic *packet)
+{
+	const struct log_frontend_pkt_hdr *hdr =
+		(const struct log_frontend_pkt_hdr *)packet;
+
+	return hdr->len;
+}
+
+static void pkt_dropped(const struct mpsc_pbuf_buffer *buffer,
+			const union mpsc_pbuf_generic *packet)
+{
+	ARG_UNUSED(buffer);
+	ARG_UNUSED(packet);
+
+	atomic_inc(&dropped_cnt);
+}
+
+static int rtt_blocking_write(const uint8_t *data, size_t len)
+{
+	uint8_t retry_cnt = 0;
+	static const uint8_t retry_cnt_max = 100;
+	size_t num_bytes_send;
+
+	num_bytes_send = SEGGER_RTT_WriteNoLock(CONFIG_LOG_FRONTEND_DICT_RTT_CHANNEL,
+						data, len);
+	while (num_bytes_send != len) {
+		/* Give the host time to read the data and free some space
+		 * in the buffer.
+		 */
+		if (!in_panic) {
+			k_sleep(K_MSEC(10));
+		}
+		num_bytes_send = SEGGER_RTT_WriteNoLock(
+					CONFIG_LOG_FRONTEND_DICT_RTT_CHANNEL,
+					data, len);
+
+		retry_cnt++;
+		if (retry_cnt > retry_cnt_max) {
+			return -ENOBUFS;
+		}
+	}
+
+	return 0;
+}
+
+static void dropped_notify(void)
+{
+	uint32_t dropped = (uint32_t)atomic_clear(&dropped_cnt);
+	struct log_dict_output_dropped_msg_t msg = {
+		.type = MSG_DROPPED_MSG,
+		.num_dropped_messages = MIN(dropped, UINT16_MAX),
+	};
+
+	(void)rtt_blocking_write((const uint8_t *)&msg, sizeof(msg));
+}
+
+static bool process_pending(void)
+{
+	const union mpsc_pbuf_generic *packet = mpsc_pbuf_claim(&pbuf);
+
+	if (packet == NULL) {
+		return false;
+	}
+
+	const struct log_frontend_pkt *pkt = (const struct log_frontend_pkt *)packet;
+	size_t len = pkt->hdr.len * sizeof(uint32_t) - sizeof(pkt->hdr);
+
+	(void)rtt_blocking_write(pkt->data, len);
+	mpsc_pbuf_free(&pbuf, packet);
+
+	if (atomic_get(&dropped_cnt) > 0) {
+		dropped_notify();
+	}
+
+	return true;
+}
+
+void log_frontend_msg(const void *source, const struct log_msg_desc desc,
+		      uint8_t *package, const void *data)
+{
+	struct log_dict_output_normal_msg_hdr_t msg_hdr = {
+		.type = MSG_NORMAL,
+		.domain = desc.domain,
+		.level = desc.level,
+		.package_len = desc.package_len,
+		.data_len = desc.data_len,
+		.timestamp = z_log_timestamp(),
+	};
+	size_t hdr_len = sizeof(struct log_frontend_pkt_hdr) + sizeof(msg_hdr);
+	size_t total_len = hdr_len + desc.package_len + desc.data_len;
+	size_t total_wlen = DIV_ROUND_UP(total_len, sizeof(uint32_t));
+
+	msg_hdr.source = (source != NULL) ?
+			(IS_ENABLED(CONFIG_LOG_RUNTIME_FILTERING) ?
+				log_dynamic_source_id((struct log_source_dynamic_data *)source) :
+				log_const_source_id((const struct log_source_const_data *)source)) :
+			0U;
+
+	union mpsc_pbuf_generic *packet = mpsc_pbuf_alloc(&pbuf, total_wlen, K_NO_WAIT);
+
+	if (packet == NULL) {
+		atomic_inc(&dropped_cnt);
+		return;
+	}
+
+	struct log_frontend_pkt *pkt = (struct log_frontend_pkt *)packet;
+
+	pkt->hdr.len = total_wlen;
+	memcpy(pkt->data, &msg_hdr, sizeof(msg_hdr));
+	memcpy(&pkt->data[sizeof(msg_hdr)], package, desc.package_len);
+	if (data != NULL) {
+		memcpy(&pkt->data[sizeof(msg_hdr) + desc.package_len], data, desc.data_len);
+	}
+
+	mpsc_pbuf_commit(&pbuf, packet);
+
+	if (in_panic) {
+		while (process_pending()) {
+		}
+	} else {
+		k_sem_give(&data_sem);
+	}
+}
+
+void log_frontend_panic(void)
+{
+	in_panic = true;
+
+	/* Flush everything that was captured before the panic. */
+	while (process_pending()) {
+	}
+}
+
+void log_frontend_init(void)
+{
+	const struct mpsc_pbuf_buffer_config config = {
+		.buf = pbuf_data,
+		.size = ARRAY_SIZE(pbuf_data),
+		.notify_drop = pkt_dropped,
+		.get_wlen = pkt_get_wlen,
+		.flags = IS_ENABLED(CONFIG_LOG_FRONTEND_DICT_RTT_OVERWRITE) ?
+				MPSC_PBUF_MODE_OVERWRITE : 0,
+	};
+
+	mpsc_pbuf_init(&pbuf, &config);
+
+	int ret = SEGGER_RTT_ConfigUpBuffer(CONFIG_LOG_FRONTEND_DICT_RTT_CHANNEL,
+					    "Dictionary logs",
+					    rtt_buf, sizeof(rtt_buf),
+					    SEGGER_RTT_MODE_NO_BLOCK_SKIP);
+
+	ARG_UNUSED(ret);
+	__ASSERT_NO_MSG(ret >= 0);
+}
+
+static void log_frontend_thread_fn(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		if (!process_pending()) {
+			(void)k_sem_take(&data_sem, K_FOREVER);
+		}
+	}
+}
+
+K_THREAD_DEFINE(log_frontend_dict_rtt, CONFIG_LOG_FRONTEND_DICT_RTT_STACK_SIZE,
+		log_frontend_thread_fn, NULL, NULL, NULL,
+		CONFIG_LOG_FRONTEND_DICT_RTT_THREAD_PRIORITY, 0, 0);
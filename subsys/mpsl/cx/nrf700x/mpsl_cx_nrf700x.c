@@ -22,6 +22,7 @@
 #include <stdint.h>
 
 #include <zephyr/device.h>
+#include <zephyr/kernel.h>
 #include <zephyr/drivers/gpio.h>
 #include <zephyr/devicetree.h>
 #include <soc_nrf_common.h>
@@ -94,6 +95,143 @@ static uint32_t grant_abs_pin;
 
 static bool enabled = true;
 
+static int32_t grant_pin_is_asserted(bool *is_asserted);
+
+#if defined(CONFIG_MPSL_CX_NRF700X_STATS)
+
+/* The tracking state is updated from the radio protocol context (request and
+ * release) and from the GRANT pin ISR. The update paths only add to counters
+ * and advance the phase timestamp, so a reader may observe a snapshot that is
+ * an event or two old, which is acceptable for statistics.
+ */
+static struct mpsl_cx_nrf700x_stats cx_stats = {
+	.tx_grant_latency_min_us = UINT32_MAX,
+};
+
+static bool tx_request_active;
+static bool tx_granted;
+static bool tx_latency_pending;
+static uint32_t tx_request_cycles;
+static uint32_t phase_start_cycles;
+
+static void stats_latency_sample(uint32_t latency_us)
+{
+	cx_stats.tx_grant_latency_min_us = MIN(cx_stats.tx_grant_latency_min_us, latency_us);
+	cx_stats.tx_grant_latency_max_us = MAX(cx_stats.tx_grant_latency_max_us, latency_us);
+	cx_stats.tx_grant_latency_sum_us += latency_us;
+	cx_stats.tx_grant_latency_samples++;
+}
+
+static void stats_phase_time_add(uint32_t now_cycles)
+{
+	uint32_t elapsed_us = k_cyc_to_us_near32(now_cycles - phase_start_cycles);
+
+	if (tx_granted) {
+		cx_stats.tx_granted_time_us += elapsed_us;
+	} else {
+		cx_stats.tx_denied_time_us += elapsed_us;
+	}
+
+	phase_start_cycles = now_cycles;
+}
+
+static void stats_on_request(mpsl_cx_op_map_t ops)
+{
+	uint32_t now = k_cycle_get_32();
+	bool grant_asserted = false;
+
+	if (tx_request_active) {
+		stats_phase_time_add(now);
+		tx_request_active = false;
+	}
+
+	if ((ops & MPSL_CX_OP_TX) == 0U) {
+		if ((ops & (MPSL_CX_OP_RX | MPSL_CX_OP_IDLE_LISTEN)) != 0U) {
+			cx_stats.rx_requests++;
+		}
+		return;
+	}
+
+	(void)grant_pin_is_asserted(&grant_asserted);
+
+	cx_stats.tx_requests++;
+	tx_request_active = true;
+	tx_granted = grant_asserted || !enabled;
+	tx_request_cycles = now;
+	phase_start_cycles = now;
+
+	if (tx_granted) {
+		tx_latency_pending = false;
+		cx_stats.tx_grants++;
+		stats_latency_sample(0);
+	} else {
+		tx_latency_pending = true;
+	}
+}
+
+static void stats_on_release(void)
+{
+	if (tx_request_active) {
+		stats_phase_time_add(k_cycle_get_32());
+		tx_request_active = false;
+		tx_latency_pending = false;
+	}
+
+	cx_stats.releases++;
+}
+
+static void stats_on_grant_change(bool tx_allowed)
+{
+	uint32_t now = k_cycle_get_32();
+
+	if (!tx_request_active || tx_allowed == tx_granted) {
+		return;
+	}
+
+	stats_phase_time_add(now);
+	tx_granted = tx_allowed;
+
+	if (tx_allowed) {
+		cx_stats.tx_grants++;
+		if (tx_latency_pending) {
+			tx_latency_pending = false;
+			stats_latency_sample(k_cyc_to_us_near32(now - tx_request_cycles));
+		}
+	} else {
+		cx_stats.tx_denials++;
+	}
+}
+
+void mpsl_cx_nrf700x_stats_get(struct mpsl_cx_nrf700x_stats *stats)
+{
+	*stats = cx_stats;
+}
+
+void mpsl_cx_nrf700x_stats_reset(void)
+{
+	cx_stats = (struct mpsl_cx_nrf700x_stats){
+		.tx_grant_latency_min_us = UINT32_MAX,
+	};
+}
+
+#else /* defined(CONFIG_MPSL_CX_NRF700X_STATS) */
+
+static inline void stats_on_request(mpsl_cx_op_map_t ops)
+{
+	ARG_UNUSED(ops);
+}
+
+static inline void stats_on_release(void)
+{
+}
+
+static inline void stats_on_grant_change(bool tx_allowed)
+{
+	ARG_UNUSED(tx_allowed);
+}
+
+#endif /* defined(CONFIG_MPSL_CX_NRF700X_STATS) */
+
 static int32_t grant_pin_is_asserted(bool *is_asserted)
 {
 #if defined(CONFIG_SOC_SERIES_BSIM_NRFXX)
@@ -163,6 +301,8 @@ static void gpiote_irq_handler(const struct device *gpiob, struct gpio_callback
 			granted_ops = granted_ops_map(false);
 		}
 
+		stats_on_grant_change((granted_ops & MPSL_CX_OP_TX) != 0U);
+
 		if (granted_ops != last_notified) {
 			last_notified = granted_ops;
 			callback_copy(granted_ops);
@@ -267,6 +407,8 @@ static int32_t request(const mpsl_cx_request_t *req_params)
 		return -NRF_EPERM;
 	}
 
+	stats_on_request(req_params->ops);
+
 	return 0;
 }
 
@@ -285,6 +427,8 @@ static int32_t release(void)
 		return -NRF_EPERM;
 	}
 
+	stats_on_release();
+
 	return 0;
 }
 
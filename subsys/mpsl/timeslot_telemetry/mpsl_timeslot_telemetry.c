@@ -0,0 +1,190 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+#include <mpsl_timeslot.h>
+#include <mpsl/mpsl_timeslot_telemetry.h>
+
+#if defined(CONFIG_MPSL_TIMESLOT_TELEMETRY_SHELL)
+#include <zephyr/shell/shell.h>
+#endif
+
+struct telemetry_session {
+	mpsl_timeslot_callback_t user_callback;
+	uint32_t request_cycles;
+	bool request_pending;
+};
+
+/* The counters are only written from the timeslot signal callback, except for
+ * the request counter and timestamp which are written from the context that
+ * calls mpsl_timeslot_telemetry_request(). Readers may observe a counter set
+ * mid-update, which is acceptable for statistics.
+ */
+static struct mpsl_timeslot_telemetry_stats telemetry_stats = {
+	.latency_min_us = UINT32_MAX,
+};
+
+static struct telemetry_session sessions[MPSL_TIMESLOT_CONTEXT_COUNT_MAX];
+
+static void latency_sample_add(uint32_t latency_us)
+{
+	telemetry_stats.latency_min_us = MIN(telemetry_stats.latency_min_us, latency_us);
+	telemetry_stats.latency_max_us = MAX(telemetry_stats.latency_max_us, latency_us);
+	telemetry_stats.latency_sum_us += latency_us;
+	telemetry_stats.latency_samples++;
+}
+
+static mpsl_timeslot_signal_return_param_t *telemetry_callback(mpsl_timeslot_session_id_t session_id,
+							       uint32_t signal)
+{
+	static mpsl_timeslot_signal_return_param_t no_action = {
+		.callback_action = MPSL_TIMESLOT_SIGNAL_ACTION_NONE,
+	};
+	struct telemetry_session *session;
+
+	if (session_id >= ARRAY_SIZE(sessions) || sessions[session_id].user_callback == NULL) {
+		return &no_action;
+	}
+
+	session = &sessions[session_id];
+
+	switch (signal) {
+	case MPSL_TIMESLOT_SIGNAL_START:
+		telemetry_stats.starts++;
+		if (session->request_pending) {
+			session->request_pending = false;
+			latency_sample_add(k_cyc_to_us_near32(
+				k_cycle_get_32() - session->request_cycles));
+		}
+		break;
+	case MPSL_TIMESLOT_SIGNAL_BLOCKED:
+		telemetry_stats.blocked++;
+		session->request_pending = false;
+		break;
+	case MPSL_TIMESLOT_SIGNAL_CANCELLED:
+		telemetry_stats.cancelled++;
+		session->request_pending = false;
+		break;
+	case MPSL_TIMESLOT_SIGNAL_EXTEND_SUCCEEDED:
+		telemetry_stats.extend_succeeded++;
+		break;
+	case MPSL_TIMESLOT_SIGNAL_EXTEND_FAILED:
+		telemetry_stats.extend_failed++;
+		break;
+	case MPSL_TIMESLOT_SIGNAL_OVERSTAYED:
+		telemetry_stats.overstayed++;
+		break;
+	default:
+		break;
+	}
+
+	return session->user_callback(session_id, signal);
+}
+
+int mpsl_timeslot_telemetry_session_open(mpsl_timeslot_callback_t callback,
+					 mpsl_timeslot_session_id_t *p_session_id)
+{
+	int err;
+
+	err = mpsl_timeslot_session_open(telemetry_callback, p_session_id);
+	if (err) {
+		return err;
+	}
+
+	/* The first signal cannot arrive before the first request, which in
+	 * turn cannot be issued before this function has returned the session
+	 * id, so storing the callback after opening is safe.
+	 */
+	if (*p_session_id < ARRAY_SIZE(sessions)) {
+		sessions[*p_session_id].user_callback = callback;
+		sessions[*p_session_id].request_pending = false;
+	}
+
+	return 0;
+}
+
+int mpsl_timeslot_telemetry_request(mpsl_timeslot_session_id_t session_id,
+				    const mpsl_timeslot_request_t *p_request)
+{
+	if (session_id < ARRAY_SIZE(sessions)) {
+		sessions[session_id].request_cycles = k_cycle_get_32();
+		sessions[session_id].request_pending = true;
+		telemetry_stats.requests++;
+	}
+
+	return mpsl_timeslot_request(session_id, p_request);
+}
+
+int mpsl_timeslot_telemetry_session_close(mpsl_timeslot_session_id_t session_id)
+{
+	int err;
+
+	err = mpsl_timeslot_session_close(session_id);
+	if (err == 0 && session_id < ARRAY_SIZE(sessions)) {
+		sessions[session_id].user_callback = NULL;
+		sessions[session_id].request_pending = false;
+	}
+
+	return err;
+}
+
+void mpsl_timeslot_telemetry_stats_get(struct mpsl_timeslot_telemetry_stats *stats)
+{
+	*stats = telemetry_stats;
+}
+
+void mpsl_timeslot_telemetry_stats_reset(void)
+{
+	telemetry_stats = (struct mpsl_timeslot_telemetry_stats){
+		.latency_min_us = UINT32_MAX,
+	};
+}
+
+#if defined(CONFIG_MPSL_TIMESLOT_TELEMETRY_SHELL)
+
+static int cmd_timeslot_stats(const struct shell *sh, size_t argc, char **argv)
+{
+	struct mpsl_timeslot_telemetry_stats stats;
+
+	mpsl_timeslot_telemetry_stats_get(&stats);
+
+	shell_print(sh, "Requests:          %u", stats.requests);
+	shell_print(sh, "Starts:            %u", stats.starts);
+	shell_print(sh, "Blocked:           %u", stats.blocked);
+	shell_print(sh, "Cancelled:         %u", stats.cancelled);
+	shell_print(sh, "Extend succeeded:  %u", stats.extend_succeeded);
+	shell_print(sh, "Extend failed:     %u", stats.extend_failed);
+	shell_print(sh, "Overstayed:        %u", stats.overstayed);
+
+	if (stats.latency_samples > 0) {
+		shell_print(sh, "Request-to-start latency (us): min %u, max %u, avg %u",
+			    stats.latency_min_us, stats.latency_max_us,
+			    (uint32_t)(stats.latency_sum_us / stats.latency_samples));
+	} else {
+		shell_print(sh, "Request-to-start latency: no samples");
+	}
+
+	return 0;
+}
+
+static int cmd_timeslot_reset(const struct shell *sh, size_t argc, char **argv)
+{
+	mpsl_timeslot_telemetry_stats_reset();
+	shell_print(sh, "Timeslot statistics reset");
+
+	return 0;
+}
+
+SHELL_STATIC_SUBCMD_SET_CREATE(sub_mpsl_timeslot,
+	SHELL_CMD(stats, NULL, "Print timeslot statistics", cmd_timeslot_stats),
+	SHELL_CMD(reset, NULL, "Reset timeslot statistics", cmd_timeslot_reset),
+	SHELL_SUBCMD_SET_END
+);
+
+SHELL_CMD_REGISTER(mpsl_timeslot, &sub_mpsl_timeslot, "MPSL timeslot telemetry commands", NULL);
+
+#endif /* CONFIG_MPSL_TIMESLOT_TELEMETRY_SHELL */
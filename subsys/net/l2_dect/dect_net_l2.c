@@ -401,6 +401,110 @@ exit:
 	return NET_CONTINUE;
 }
 
+#if defined(CONFIG_NET_L2_DECT_QOS)
+/* QoS TX queuing: outgoing packets are classified by net_pkt priority into a
+ * control and a bulk queue, and a dedicated work queue hands them to the DECT
+ * MAC driver with the control queue always drained first. This keeps
+ * latency-critical traffic from waiting behind long bulk bursts in the
+ * driver.
+ */
+K_THREAD_STACK_DEFINE(dect_net_l2_tx_stack, CONFIG_NET_L2_DECT_QOS_STACK_SIZE);
+
+static struct k_work_q dect_net_l2_tx_work_q;
+static struct k_work dect_net_l2_tx_work;
+
+static struct k_fifo dect_net_l2_tx_fifos[DECT_NET_L2_QOS_QUEUE_COUNT];
+
+static atomic_t qos_depth[DECT_NET_L2_QOS_QUEUE_COUNT];
+static atomic_t qos_max_depth[DECT_NET_L2_QOS_QUEUE_COUNT];
+static atomic_t qos_enqueued[DECT_NET_L2_QOS_QUEUE_COUNT];
+static atomic_t qos_dropped[DECT_NET_L2_QOS_QUEUE_COUNT];
+
+void dect_net_l2_qos_stats_get(struct dect_net_l2_qos_stats *stats)
+{
+	for (int i = 0; i < DECT_NET_L2_QOS_QUEUE_COUNT; i++) {
+		stats->depth[i] = atomic_get(&qos_depth[i]);
+		stats->max_depth[i] = atomic_get(&qos_max_depth[i]);
+		stats->enqueued[i] = atomic_get(&qos_enqueued[i]);
+		stats->dropped[i] = atomic_get(&qos_dropped[i]);
+	}
+}
+
+static void dect_net_l2_tx_work_handler(struct k_work *work)
+{
+	struct net_pkt *pkt;
+	int ret;
+
+	ARG_UNUSED(work);
+
+	while (true) {
+		enum dect_net_l2_qos_queue queue = DECT_NET_L2_QOS_CONTROL;
+
+		pkt = k_fifo_get(&dect_net_l2_tx_fifos[DECT_NET_L2_QOS_CONTROL], K_NO_WAIT);
+		if (pkt == NULL) {
+			queue = DECT_NET_L2_QOS_BULK;
+			pkt = k_fifo_get(&dect_net_l2_tx_fifos[DECT_NET_L2_QOS_BULK], K_NO_WAIT);
+		}
+		if (pkt == NULL) {
+			break;
+		}
+
+		atomic_dec(&qos_depth[queue]);
+
+		struct net_if *iface = net_pkt_iface(pkt);
+		const struct dect_nr_hal_api *api = net_if_get_device(iface)->api;
+
+		ret = net_l2_send(api->send, net_if_get_device(iface), iface, pkt);
+		if (ret) {
+			LOG_ERR("%s: iface %p send error %d", (__func__), iface, ret);
+		}
+		net_pkt_unref(pkt);
+	}
+}
+
+static int dect_net_l2_qos_enqueue(struct net_pkt *pkt)
+{
+	enum dect_net_l2_qos_queue queue = (net_pkt_priority(pkt) >= NET_PRIORITY_CA) ?
+		DECT_NET_L2_QOS_CONTROL : DECT_NET_L2_QOS_BULK;
+	atomic_val_t depth;
+
+	if (atomic_get(&qos_depth[queue]) >= CONFIG_NET_L2_DECT_QOS_QUEUE_DEPTH) {
+		atomic_inc(&qos_dropped[queue]);
+		return -ENOBUFS;
+	}
+
+	depth = atomic_inc(&qos_depth[queue]) + 1;
+	if (depth > atomic_get(&qos_max_depth[queue])) {
+		atomic_set(&qos_max_depth[queue], depth);
+	}
+	atomic_inc(&qos_enqueued[queue]);
+
+	k_fifo_put(&dect_net_l2_tx_fifos[queue], pkt);
+	k_work_submit_to_queue(&dect_net_l2_tx_work_q, &dect_net_l2_tx_work);
+
+	return 0;
+}
+
+static void dect_net_l2_qos_init(void)
+{
+	static bool initialized;
+
+	if (initialized) {
+		return;
+	}
+	initialized = true;
+
+	for (int i = 0; i < DECT_NET_L2_QOS_QUEUE_COUNT; i++) {
+		k_fifo_init(&dect_net_l2_tx_fifos[i]);
+	}
+	k_work_init(&dect_net_l2_tx_work, dect_net_l2_tx_work_handler);
+	k_work_queue_start(&dect_net_l2_tx_work_q, dect_net_l2_tx_stack,
+			   K_THREAD_STACK_SIZEOF(dect_net_l2_tx_stack),
+			   CONFIG_NET_L2_DECT_QOS_THREAD_PRIO, NULL);
+	k_thread_name_set(&dect_net_l2_tx_work_q.thread, "dect_l2_tx");
+}
+#endif /* CONFIG_NET_L2_DECT_QOS */
+
 /**
  * @brief DECT L2 send handler - transmits packets through DECT driver
  *
@@ -603,6 +707,23 @@ static int dect_net_l2_send(struct net_if *iface, struct net_pkt *pkt)
 		goto error;
 	}
 send:
+#if defined(CONFIG_NET_L2_DECT_QOS)
+	/* The TX worker owns the packet once it is enqueued and may send and
+	 * unref it before this thread runs again, so the length must be read
+	 * before handing the packet over.
+	 */
+	int pkt_len = net_pkt_get_len(pkt);
+
+	LOG_DBG("iface %p queueing %d bytes (caller %p)", iface, pkt_len,
+		__builtin_return_address(0));
+
+	ret = dect_net_l2_qos_enqueue(pkt);
+	if (ret) {
+		goto error;
+	}
+
+	return pkt_len;
+#else
 	ret = net_l2_send(api->send, net_if_get_device(iface), iface, pkt);
 	if (ret) {
 		goto error;
@@ -613,6 +734,7 @@ send:
 	LOG_DBG("iface %p sent %d bytes (caller %p)", iface, ret, __builtin_return_address(0));
 
 	return ret;
+#endif /* CONFIG_NET_L2_DECT_QOS */
 error:
 	LOG_ERR("%s: iface %p send error %d", (__func__), iface, ret);
 	return ret;
@@ -657,6 +779,10 @@ void dect_net_l2_init(struct net_if *iface, struct dect_settings *initial_settin
 	LOG_DBG("Initializing DECT L2 %p for iface %d (%p)", ctx, net_if_get_by_iface(iface),
 		iface);
 
+#if defined(CONFIG_NET_L2_DECT_QOS)
+	dect_net_l2_qos_init();
+#endif
+
 	net_if_flag_set(iface, NET_IF_IPV6);
 	net_if_flag_set(iface, NET_IF_IPV6_NO_ND);
 	net_if_dormant_on(iface);
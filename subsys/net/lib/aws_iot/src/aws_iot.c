@@ -12,6 +12,11 @@
 #include <net/mqtt_helper.h>
 #include <stdio.h>
 
+#if defined(CONFIG_AWS_IOT_SHADOW_DELTA_FILTER)
+#include <cJSON.h>
+#include <cJSON_os.h>
+#endif
+
 LOG_MODULE_REGISTER(aws_iot, CONFIG_AWS_IOT_LOG_LEVEL);
 
 /* Empty string used to request the AWS IoT shadow document. */
@@ -588,8 +593,127 @@ static void on_error(enum mqtt_helper_error error)
 	error_notify(error);
 }
 
+#if defined(CONFIG_AWS_IOT_SHADOW_DELTA_FILTER)
+/* Reported shadow state from the last successfully published update. */
+static cJSON *last_reported;
+
+static void shadow_cache_reset(void)
+{
+	cJSON_Delete(last_reported);
+	last_reported = NULL;
+}
+
+static void shadow_cache_merge(cJSON *reported)
+{
+	cJSON *child;
+
+	if (last_reported == NULL) {
+		last_reported = cJSON_Duplicate(reported, true);
+		return;
+	}
+
+	cJSON_ArrayForEach(child, reported) {
+		cJSON_DeleteItemFromObject(last_reported, child->string);
+		cJSON_AddItemToObject(last_reported, child->string,
+				      cJSON_Duplicate(child, true));
+	}
+}
+
+/* Reduce a shadow update document to the reported state entries that differ
+ * from the last successfully published state. Documents that are not valid
+ * JSON, or that carry anything besides reported state, are published as is.
+ *
+ * Returns 1 if nothing has changed and the publication can be skipped,
+ * 0 if the document in param, possibly reduced, should be published.
+ */
+static int shadow_delta_filter(struct mqtt_publish_param *param, char **delta_out)
+{
+	cJSON *doc, *state, *reported, *child, *delta_doc, *delta_state, *delta_reported;
+	bool changed = false;
+	bool reduce;
+
+	doc = cJSON_ParseWithLength(param->message.payload.data, param->message.payload.len);
+	if (doc == NULL) {
+		return 0;
+	}
+
+	state = cJSON_GetObjectItem(doc, "state");
+	reported = (state != NULL) ? cJSON_GetObjectItem(state, "reported") : NULL;
+	if (!cJSON_IsObject(reported)) {
+		cJSON_Delete(doc);
+		return 0;
+	}
+
+	reduce = (last_reported != NULL) && (cJSON_GetArraySize(doc) == 1) &&
+		 (cJSON_GetArraySize(state) == 1);
+	if (!reduce) {
+		shadow_cache_merge(reported);
+		cJSON_Delete(doc);
+		return 0;
+	}
+
+	delta_reported = cJSON_CreateObject();
+	if (delta_reported == NULL) {
+		shadow_cache_merge(reported);
+		cJSON_Delete(doc);
+		return 0;
+	}
+
+	cJSON_ArrayForEach(child, reported) {
+		cJSON *prev = cJSON_GetObjectItem(last_reported, child->string);
+
+		if ((prev != NULL) && cJSON_Compare(prev, child, true)) {
+			continue;
+		}
+
+		cJSON_AddItemToObject(delta_reported, child->string,
+				      cJSON_Duplicate(child, true));
+		changed = true;
+	}
+
+	shadow_cache_merge(reported);
+	cJSON_Delete(doc);
+
+	if (!changed) {
+		cJSON_Delete(delta_reported);
+		return 1;
+	}
+
+	delta_doc = cJSON_CreateObject();
+	delta_state = cJSON_CreateObject();
+	if ((delta_doc == NULL) || (delta_state == NULL)) {
+		cJSON_Delete(delta_doc);
+		cJSON_Delete(delta_state);
+		cJSON_Delete(delta_reported);
+		return 0;
+	}
+
+	cJSON_AddItemToObject(delta_state, "reported", delta_reported);
+	cJSON_AddItemToObject(delta_doc, "state", delta_state);
+
+	*delta_out = cJSON_PrintUnformatted(delta_doc);
+	cJSON_Delete(delta_doc);
+	if (*delta_out == NULL) {
+		return 0;
+	}
+
+	LOG_DBG("Reduced shadow update from %d to %d bytes",
+		param->message.payload.len, (int)strlen(*delta_out));
+
+	param->message.payload.data = *delta_out;
+	param->message.payload.len = strlen(*delta_out);
+
+	return 0;
+}
+#endif /* CONFIG_AWS_IOT_SHADOW_DELTA_FILTER */
+
 int aws_iot_send(const struct aws_iot_data *const tx_data)
 {
+	int err;
+#if defined(CONFIG_AWS_IOT_SHADOW_DELTA_FILTER)
+	char *delta = NULL;
+#endif
+
 	if (tx_data == NULL) {
 		LOG_ERR("Invalid argument tx_data");
 		return -EINVAL;
@@ -613,6 +737,13 @@ int aws_iot_send(const struct aws_iot_data *const tx_data)
 	case AWS_IOT_SHADOW_TOPIC_UPDATE:
 		param.message.topic.topic.utf8 = update_topic;
 		param.message.topic.topic.size = strlen(update_topic);
+
+#if defined(CONFIG_AWS_IOT_SHADOW_DELTA_FILTER)
+		if (shadow_delta_filter(&param, &delta) == 1) {
+			LOG_DBG("Reported shadow state unchanged, nothing to publish");
+			return 0;
+		}
+#endif
 		break;
 	case AWS_IOT_SHADOW_TOPIC_DELETE:
 		param.message.topic.topic.utf8 = delete_topic;
@@ -633,7 +764,20 @@ int aws_iot_send(const struct aws_iot_data *const tx_data)
 	LOG_DBG("Using message ID %d", param.message_id);
 	LOG_DBG("Publishing to topic: %s", (char *)param.message.topic.topic.utf8);
 
-	return mqtt_helper_publish(&param);
+	err = mqtt_helper_publish(&param);
+
+#if defined(CONFIG_AWS_IOT_SHADOW_DELTA_FILTER)
+	cJSON_free(delta);
+
+	if (err) {
+		/* The reported shadow state is now unknown;
+		 * publish the next update in full.
+		 */
+		shadow_cache_reset();
+	}
+#endif
+
+	return err;
 }
 
 int aws_iot_disconnect(void)
@@ -687,6 +831,13 @@ int aws_iot_connect(const struct aws_iot_config *const config)
 		return err;
 	}
 
+#if defined(CONFIG_AWS_IOT_SHADOW_DELTA_FILTER)
+	/* The shadow may have changed while disconnected;
+	 * publish the next update in full.
+	 */
+	shadow_cache_reset();
+#endif
+
 	err = mqtt_helper_connect(&conn_params);
 	if (err) {
 		LOG_ERR("mqtt_helper_connect, error: %d", err);
@@ -757,6 +908,10 @@ int aws_iot_init(aws_iot_evt_handler_t event_handler)
 		return err;
 	}
 
+#if defined(CONFIG_AWS_IOT_SHADOW_DELTA_FILTER)
+	cJSON_Init();
+#endif
+
 	module_evt_handler = event_handler;
 	return 0;
 }
@@ -20,6 +20,11 @@
 #include <net/azure_fota.h>
 #endif
 
+#if defined(CONFIG_AZURE_IOT_HUB_TWIN_REPORTED_DELTA_FILTER)
+#include <cJSON.h>
+#include <cJSON_os.h>
+#endif
+
 #include <zephyr/logging/log.h>
 
 LOG_MODULE_REGISTER(azure_iot_hub, CONFIG_AZURE_IOT_HUB_LOG_LEVEL);
@@ -713,6 +718,10 @@ int azure_iot_hub_init(const azure_iot_hub_evt_handler_t event_handler)
 
 	evt_handler = event_handler;
 
+#if defined(CONFIG_AZURE_IOT_HUB_TWIN_REPORTED_DELTA_FILTER)
+	cJSON_Init();
+#endif
+
 	iot_hub_state_set(STATE_DISCONNECTED);
 
 	return 0;
@@ -786,6 +795,13 @@ int azure_iot_hub_connect(const struct azure_iot_hub_config *config)
 
 	iot_hub_state_set(STATE_CONNECTING);
 
+#if defined(CONFIG_AZURE_IOT_HUB_TWIN_REPORTED_DELTA_FILTER)
+	/* The twin may have changed while disconnected;
+	 * publish the next update in full.
+	 */
+	reported_cache_reset();
+#endif
+
 	/* Notify the application that the library is currently connecting to the IoT hub. */
 	azure_iot_hub_notify_event(&evt);
 
@@ -918,11 +934,107 @@ exit:
 	return err;
 }
 
+#if defined(CONFIG_AZURE_IOT_HUB_TWIN_REPORTED_DELTA_FILTER)
+/* Reported twin properties from the last successfully published update. */
+static cJSON *last_reported;
+
+static void reported_cache_reset(void)
+{
+	cJSON_Delete(last_reported);
+	last_reported = NULL;
+}
+
+static void reported_cache_merge(cJSON *reported)
+{
+	cJSON *child;
+
+	if (last_reported == NULL) {
+		last_reported = cJSON_Duplicate(reported, true);
+		return;
+	}
+
+	cJSON_ArrayForEach(child, reported) {
+		cJSON_DeleteItemFromObject(last_reported, child->string);
+		cJSON_AddItemToObject(last_reported, child->string,
+				      cJSON_Duplicate(child, true));
+	}
+}
+
+/* Reduce a reported properties update to the properties that differ from the
+ * last successfully published update. Payloads that are not JSON objects are
+ * published as is.
+ *
+ * Returns 1 if nothing has changed and the publication can be skipped,
+ * 0 if the document in param, possibly reduced, should be published.
+ */
+static int twin_delta_filter(struct mqtt_publish_param *param, char **delta_out)
+{
+	cJSON *doc, *child, *delta_doc;
+	bool changed = false;
+
+	doc = cJSON_ParseWithLength(param->message.payload.data, param->message.payload.len);
+	if (!cJSON_IsObject(doc)) {
+		cJSON_Delete(doc);
+		return 0;
+	}
+
+	if (last_reported == NULL) {
+		reported_cache_merge(doc);
+		cJSON_Delete(doc);
+		return 0;
+	}
+
+	delta_doc = cJSON_CreateObject();
+	if (delta_doc == NULL) {
+		reported_cache_merge(doc);
+		cJSON_Delete(doc);
+		return 0;
+	}
+
+	cJSON_ArrayForEach(child, doc) {
+		cJSON *prev = cJSON_GetObjectItem(last_reported, child->string);
+
+		if ((prev != NULL) && cJSON_Compare(prev, child, true)) {
+			continue;
+		}
+
+		cJSON_AddItemToObject(delta_doc, child->string,
+				      cJSON_Duplicate(child, true));
+		changed = true;
+	}
+
+	reported_cache_merge(doc);
+	cJSON_Delete(doc);
+
+	if (!changed) {
+		cJSON_Delete(delta_doc);
+		return 1;
+	}
+
+	*delta_out = cJSON_PrintUnformatted(delta_doc);
+	cJSON_Delete(delta_doc);
+	if (*delta_out == NULL) {
+		return 0;
+	}
+
+	LOG_DBG("Reduced reported properties update from %d to %d bytes",
+		param->message.payload.len, (int)strlen(*delta_out));
+
+	param->message.payload.data = *delta_out;
+	param->message.payload.len = strlen(*delta_out);
+
+	return 0;
+}
+#endif /* CONFIG_AZURE_IOT_HUB_TWIN_REPORTED_DELTA_FILTER */
+
 int azure_iot_hub_send(const struct azure_iot_hub_msg *const msg)
 {
 	int err;
 	ssize_t topic_len;
 	char topic[CONFIG_AZURE_IOT_HUB_TOPIC_MAX_LEN + 1];
+#if defined(CONFIG_AZURE_IOT_HUB_TWIN_REPORTED_DELTA_FILTER)
+	char *delta = NULL;
+#endif
 
 	if (msg == NULL) {
 		return -EINVAL;
@@ -1016,6 +1128,13 @@ int azure_iot_hub_send(const struct azure_iot_hub_msg *const msg)
 			LOG_ERR("Failed to get twin patch topic, az error: %d", err);
 			return -EFAULT;
 		}
+
+#if defined(CONFIG_AZURE_IOT_HUB_TWIN_REPORTED_DELTA_FILTER)
+		if (twin_delta_filter(&param, &delta) == 1) {
+			LOG_DBG("Reported properties unchanged, nothing to publish");
+			return 0;
+		}
+#endif
 		break;
 	}
 	case AZURE_IOT_HUB_TOPIC_TWIN_REQUEST: {
@@ -1058,7 +1177,20 @@ int azure_iot_hub_send(const struct azure_iot_hub_msg *const msg)
 	param.message.topic.topic.size = topic_len;
 	param.message.topic.topic.utf8 = topic;
 
-	return mqtt_helper_publish(&param);
+	err = mqtt_helper_publish(&param);
+
+#if defined(CONFIG_AZURE_IOT_HUB_TWIN_REPORTED_DELTA_FILTER)
+	cJSON_free(delta);
+
+	if (err) {
+		/* The reported twin state is now unknown;
+		 * publish the next update in full.
+		 */
+		reported_cache_reset();
+	}
+#endif
+
+	return err;
 }
 
 int azure_iot_hub_disconnect(void)
@@ -11,18 +11,34 @@
 
 LOG_MODULE_REGISTER(coap_utils, CONFIG_COAP_UTILS_LOG_LEVEL);
 
+#if defined(CONFIG_COAP_UTILS_BLOCK_DOWNLOAD)
+/* Room for a full block2 payload in addition to the header and options. */
+#define MAX_COAP_MSG_LEN (CONFIG_COAP_UTILS_BLOCK_DOWNLOAD_BLOCK_SIZE + 128)
+/* Reply slot 0 serves coap_send_request(); the rest serve block downloads. */
+#define COAP_MAX_REPLIES (1 + CONFIG_COAP_UTILS_BLOCK_DOWNLOAD_WINDOW)
+#else
 #define MAX_COAP_MSG_LEN 256
+#define COAP_MAX_REPLIES 1
+#endif
 #define COAP_VER 1
 #define COAP_TOKEN_LEN 8
-#define COAP_MAX_REPLIES 1
 #define COAP_POOL_SLEEP 500
 #define COAP_OPEN_SOCKET_SLEEP 200
-#if defined(CONFIG_NRF_MODEM_LIB)
+#if defined(CONFIG_COAP_UTILS_BLOCK_DOWNLOAD)
+#define COAP_RECEIVE_STACK_SIZE 2048
+#elif defined(CONFIG_NRF_MODEM_LIB)
 #define COAP_RECEIVE_STACK_SIZE 1096
 #else
 #define COAP_RECEIVE_STACK_SIZE 996
 #endif
 
+#if defined(CONFIG_COAP_UTILS_BLOCK_DOWNLOAD)
+/* Block requests carry no payload, so a small buffer is enough. */
+#define BLOCK_REQUEST_MSG_LEN 128
+#define BLOCK_RETRY_TIMEOUT_MS 2000
+#define BLOCK_MAX_RETRIES 4
+#endif
+
 const static int nfds = 1;
 static struct zsock_pollfd fds;
 static struct coap_reply replies[COAP_MAX_REPLIES];
@@ -130,7 +146,11 @@ static void coap_receive(void)
 
 		reply = coap_response_received(&response, &from_addr, replies,
 					       COAP_MAX_REPLIES);
-		if (reply) {
+		/* Block download replies are managed by the download engine,
+		 * which may already have reused the slot for the next block.
+		 */
+		if (reply && (!IS_ENABLED(CONFIG_COAP_UTILS_BLOCK_DOWNLOAD) ||
+			      (reply == &replies[0]))) {
 			coap_reply_clear(reply);
 		}
 	}
@@ -200,6 +220,324 @@ static void coap_set_response_callback(struct coap_packet *request,
 	reply->reply = reply_cb;
 }
 
+#if defined(CONFIG_COAP_UTILS_BLOCK_DOWNLOAD)
+struct block_slot {
+	/* Request sent, response not yet received. */
+	bool pending;
+	/* Response stored in data, not yet delivered to the application. */
+	bool received;
+	unsigned int num;
+	uint16_t len;
+	uint8_t data[CONFIG_COAP_UTILS_BLOCK_DOWNLOAD_BLOCK_SIZE];
+};
+
+static struct {
+	bool active;
+	/* Set once the first response has confirmed the block size. */
+	bool size_negotiated;
+	bool last_seen;
+	struct sockaddr addr;
+	const char *const *uri_path_options;
+	coap_block_download_cb_t cb;
+	uint16_t block_size;
+	unsigned int next_deliver;
+	unsigned int next_request;
+	/* Number of the final block; valid when last_seen is set. */
+	unsigned int last_num;
+	uint8_t retries;
+	struct block_slot window[CONFIG_COAP_UTILS_BLOCK_DOWNLOAD_WINDOW];
+} download;
+
+static K_MUTEX_DEFINE(download_mutex);
+static void block_retry_work_fn(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(block_retry_work, block_retry_work_fn);
+
+static int block_reply_cb(const struct coap_packet *response,
+			  struct coap_reply *reply, const struct sockaddr *from);
+
+static uint8_t block_szx(uint16_t block_size)
+{
+	uint8_t szx = 0;
+
+	while ((16U << szx) < block_size) {
+		szx++;
+	}
+
+	return szx;
+}
+
+static int block_request_send(struct block_slot *slot, unsigned int num)
+{
+	struct coap_packet request;
+	struct coap_reply *reply;
+	const char *const *opt;
+	uint8_t buf[BLOCK_REQUEST_MSG_LEN];
+	int ret;
+
+	ret = coap_packet_init(&request, buf, sizeof(buf), COAP_VER,
+			       COAP_TYPE_NON_CON, COAP_TOKEN_LEN,
+			       coap_next_token(), COAP_METHOD_GET,
+			       coap_next_id());
+	if (ret < 0) {
+		LOG_ERR("Failed to init CoAP message");
+		return ret;
+	}
+
+	for (opt = download.uri_path_options; opt && *opt; opt++) {
+		ret = coap_packet_append_option(&request, COAP_OPTION_URI_PATH,
+						*(const uint8_t *const *)opt,
+						strlen(*opt));
+		if (ret < 0) {
+			LOG_ERR("Unable add option to request");
+			return ret;
+		}
+	}
+
+	ret = coap_append_option_int(&request, COAP_OPTION_BLOCK2,
+				     (num << 4) | block_szx(download.block_size));
+	if (ret < 0) {
+		LOG_ERR("Unable to add block2 option to request");
+		return ret;
+	}
+
+	reply = &replies[1 + (slot - download.window)];
+	coap_reply_clear(reply);
+	coap_reply_init(reply, &request);
+	reply->reply = block_reply_cb;
+	reply->user_data = slot;
+
+	slot->pending = true;
+	slot->received = false;
+	slot->num = num;
+
+	ret = coap_send_message(&download.addr, &request);
+	if (ret < 0) {
+		LOG_ERR("Transmission failed: %d", errno);
+		slot->pending = false;
+		coap_reply_clear(reply);
+	}
+
+	return ret;
+}
+
+static void block_window_fill(void)
+{
+	for (int i = 0; i < ARRAY_SIZE(download.window); i++) {
+		struct block_slot *slot = &download.window[i];
+
+		if (slot->pending || slot->received) {
+			continue;
+		}
+		if (download.last_seen &&
+		    (download.next_request > download.last_num)) {
+			break;
+		}
+		if (block_request_send(slot, download.next_request) < 0) {
+			break;
+		}
+		download.next_request++;
+		/* Only one block outstanding until the server has confirmed
+		 * the block size; the rest of the window would otherwise be
+		 * requested with the wrong block numbering.
+		 */
+		if (!download.size_negotiated) {
+			break;
+		}
+	}
+}
+
+static void block_download_end(void)
+{
+	download.active = false;
+	k_work_cancel_delayable(&block_retry_work);
+	for (int i = 1; i < COAP_MAX_REPLIES; i++) {
+		coap_reply_clear(&replies[i]);
+	}
+}
+
+static void block_download_abort(int err)
+{
+	coap_block_download_cb_t cb = download.cb;
+
+	block_download_end();
+	cb(err, NULL, 0, 0, true);
+}
+
+static void block_deliver(void)
+{
+	bool progress = true;
+
+	while (progress && download.active) {
+		progress = false;
+		for (int i = 0; i < ARRAY_SIZE(download.window); i++) {
+			struct block_slot *slot = &download.window[i];
+			bool last;
+
+			if (!slot->received ||
+			    (slot->num != download.next_deliver)) {
+				continue;
+			}
+
+			last = download.last_seen &&
+			       (slot->num == download.last_num);
+			download.cb(0, slot->data, slot->len,
+				    (size_t)slot->num * download.block_size,
+				    last);
+			slot->received = false;
+			download.next_deliver++;
+			progress = true;
+
+			if (last) {
+				LOG_DBG("Block download complete");
+				block_download_end();
+				return;
+			}
+		}
+	}
+}
+
+static int block_reply_cb(const struct coap_packet *response,
+			  struct coap_reply *reply, const struct sockaddr *from)
+{
+	struct block_slot *slot = reply->user_data;
+	const uint8_t *payload;
+	uint16_t payload_len;
+	uint8_t code;
+	int block_opt;
+
+	ARG_UNUSED(from);
+
+	k_mutex_lock(&download_mutex, K_FOREVER);
+
+	if (!download.active || !slot->pending) {
+		goto unlock;
+	}
+
+	code = coap_header_get_code(response);
+	if (code != COAP_RESPONSE_CODE_CONTENT) {
+		LOG_ERR("Unexpected response code: 0x%x", code);
+		block_download_abort(-EBADMSG);
+		goto unlock;
+	}
+
+	block_opt = coap_get_option_int(response, COAP_OPTION_BLOCK2);
+	payload = coap_packet_get_payload(response, &payload_len);
+	if ((block_opt < 0) || (payload == NULL) ||
+	    (payload_len > sizeof(slot->data))) {
+		LOG_ERR("Invalid block response");
+		block_download_abort(-EBADMSG);
+		goto unlock;
+	}
+
+	if (!download.size_negotiated) {
+		uint16_t server_size =
+			coap_block_size_to_bytes(GET_BLOCK_SIZE(block_opt));
+
+		/* The server may only lower the block size (RFC 7959). */
+		if (server_size < download.block_size) {
+			LOG_DBG("Server lowered block size to %u", server_size);
+			download.block_size = server_size;
+		}
+		download.size_negotiated = true;
+	}
+
+	if (!GET_MORE(block_opt)) {
+		download.last_seen = true;
+		download.last_num = GET_BLOCK_NUM(block_opt);
+
+		/* Drop outstanding requests for blocks past the end. */
+		for (int i = 0; i < ARRAY_SIZE(download.window); i++) {
+			if (download.window[i].pending &&
+			    (download.window[i].num > download.last_num)) {
+				download.window[i].pending = false;
+				coap_reply_clear(&replies[1 + i]);
+			}
+		}
+	}
+
+	memcpy(slot->data, payload, payload_len);
+	slot->len = payload_len;
+	slot->num = GET_BLOCK_NUM(block_opt);
+	slot->pending = false;
+	slot->received = true;
+	download.retries = 0;
+
+	block_deliver();
+	if (download.active) {
+		block_window_fill();
+		k_work_reschedule(&block_retry_work,
+				  K_MSEC(BLOCK_RETRY_TIMEOUT_MS));
+	}
+
+unlock:
+	k_mutex_unlock(&download_mutex);
+	return 0;
+}
+
+static void block_retry_work_fn(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	k_mutex_lock(&download_mutex, K_FOREVER);
+
+	if (!download.active) {
+		goto unlock;
+	}
+
+	if (++download.retries > BLOCK_MAX_RETRIES) {
+		LOG_ERR("Block download timed out");
+		block_download_abort(-ETIMEDOUT);
+		goto unlock;
+	}
+
+	LOG_DBG("Re-requesting pending blocks, retry %u", download.retries);
+	for (int i = 0; i < ARRAY_SIZE(download.window); i++) {
+		if (download.window[i].pending) {
+			(void)block_request_send(&download.window[i],
+						 download.window[i].num);
+		}
+	}
+	k_work_reschedule(&block_retry_work, K_MSEC(BLOCK_RETRY_TIMEOUT_MS));
+
+unlock:
+	k_mutex_unlock(&download_mutex);
+}
+
+int coap_block_download(const struct sockaddr *addr,
+			const char *const *uri_path_options,
+			coap_block_download_cb_t cb)
+{
+	if ((addr == NULL) || (uri_path_options == NULL) || (cb == NULL)) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&download_mutex, K_FOREVER);
+
+	if (download.active) {
+		k_mutex_unlock(&download_mutex);
+		return -EBUSY;
+	}
+
+	memset(&download, 0, sizeof(download));
+	download.active = true;
+	download.addr = *addr;
+	download.uri_path_options = uri_path_options;
+	download.cb = cb;
+	download.block_size = CONFIG_COAP_UTILS_BLOCK_DOWNLOAD_BLOCK_SIZE;
+
+	block_window_fill();
+	if (download.next_request == 0) {
+		download.active = false;
+		k_mutex_unlock(&download_mutex);
+		return -EIO;
+	}
+	k_work_reschedule(&block_retry_work, K_MSEC(BLOCK_RETRY_TIMEOUT_MS));
+
+	k_mutex_unlock(&download_mutex);
+	return 0;
+}
+#endif /* CONFIG_COAP_UTILS_BLOCK_DOWNLOAD */
+
 void coap_init(int ip_family, struct sockaddr *addr)
 {
 	proto_family = ip_family;
@@ -80,6 +80,10 @@ struct transport_params_http {
 	bool ranged;
 	/** Ranged progress */
 	size_t ranged_progress;
+	/** Number of range requests currently in flight. */
+	uint32_t reqs_in_flight;
+	/** File offset of the next range request to send. */
+	size_t next_req_offset;
 	/** HTTP header */
 	struct {
 		/** Header length */
@@ -154,8 +158,6 @@ static int http_get_request_send(struct downloader *dl)
 
 	http = (struct transport_params_http *)dl->transport_internal;
 
-	http->header.has_end = false;
-
 	/* nRF91 series has a limitation of decoding ~2k of data at once when using TLS */
 	tls_force_range = (http->sock.proto == NET_IPPROTO_TLS_1_2 &&
 			   !dl->host_cfg.set_native_tls && IS_ENABLED(CONFIG_SOC_SERIES_NRF91));
@@ -169,7 +171,7 @@ static int http_get_request_send(struct downloader *dl)
 	}
 
 	if (dl->host_cfg.range_override) {
-		off = dl->progress + dl->host_cfg.range_override - 1;
+		off = http->next_req_offset + dl->host_cfg.range_override - 1;
 
 		if (dl->file_size) {
 			/* Don't request bytes past the end of file */
@@ -177,9 +179,8 @@ static int http_get_request_send(struct downloader *dl)
 		}
 
 		len = snprintf(dl->cfg.buf, dl->cfg.buf_size, HTTP_GET_RANGE, dl->file,
-			       dl->hostname, dl->progress, off);
+			       dl->hostname, http->next_req_offset, off);
 		http->ranged = true;
-		http->ranged_progress = 0;
 		LOG_DBG("Range request up to %d bytes", dl->host_cfg.range_override);
 		goto send;
 	} else if (dl->progress) {
@@ -210,6 +211,38 @@ send:
 		return err;
 	}
 
+	if (http->ranged) {
+		http->next_req_offset += dl->host_cfg.range_override;
+		http->reqs_in_flight++;
+	}
+
+	return 0;
+}
+
+/**
+ * @brief Keep up to pipeline_count range requests in flight on the connection.
+ *
+ * Responses are received in order on the connection, so fragments are still
+ * delivered to the application in order.
+ */
+static int http_pipeline_fill(struct downloader *dl)
+{
+	int err;
+	struct transport_params_http *http;
+	uint32_t max_in_flight;
+
+	http = (struct transport_params_http *)dl->transport_internal;
+	max_in_flight = MAX(1, http->cfg.pipeline_count);
+
+	/* The file size is known from the first response, request no bytes past it. */
+	while (http->reqs_in_flight < max_in_flight &&
+	       dl->file_size && http->next_req_offset < dl->file_size) {
+		err = http_get_request_send(dl);
+		if (err) {
+			return err;
+		}
+	}
+
 	return 0;
 }
 
@@ -527,6 +560,7 @@ static int dl_http_init(struct downloader *dl, struct downloader_host_cfg *dl_ho
 	if (!http->cfg_set) {
 		/* Set socket receive timeout to 30s by default. */
 		http->cfg.sock_recv_timeo_ms = 30 * MSEC_PER_SEC;
+		http->cfg.pipeline_count = CONFIG_DOWNLOADER_HTTP_PIPELINE_COUNT;
 	}
 
 	/* Reset all fields after the config. */
@@ -601,13 +635,19 @@ static int dl_http_close(struct downloader *dl)
 static int dl_http_download(struct downloader *dl)
 {
 	int ret, recv_len, data_len, expected_len;
+	size_t leftover = 0;
 	struct transport_params_http *http;
 
 	http = (struct transport_params_http *)dl->transport_internal;
 
 	if (http->new_data_req) {
-		/* Request next fragment */
+		/* Request first fragment */
 		dl->buf_offset = 0;
+		http->header.has_end = false;
+		http->header.status_code = 0;
+		http->ranged_progress = 0;
+		http->reqs_in_flight = 0;
+		http->next_req_offset = dl->progress;
 		ret = http_get_request_send(dl);
 		if (ret) {
 			LOG_DBG("data_req failed, err %d", ret);
@@ -616,6 +656,14 @@ static int dl_http_download(struct downloader *dl)
 		}
 
 		http->new_data_req = false;
+	} else if (http->ranged && dl->buf_offset == 0) {
+		/* The request buffer is free, top up the request pipeline. */
+		ret = http_pipeline_fill(dl);
+		if (ret) {
+			LOG_DBG("pipeline fill failed, err %d", ret);
+			/** Attempt reconnection. */
+			return -ECONNRESET;
+		}
 	}
 
 	__ASSERT(dl->buf_offset < dl->cfg.buf_size, "Buffer overflow");
@@ -661,6 +709,19 @@ static int dl_http_download(struct downloader *dl)
 		return recv_len > 0 ? 0 : -ECONNRESET; /* Fail if closed while expecting more */
 	}
 
+	if (http->ranged) {
+		/* With pipelined requests the buffer may also hold the start of the next
+		 * response; only consume what belongs to the current fragment.
+		 */
+		size_t frag_remaining = MIN(dl->host_cfg.range_override - http->ranged_progress,
+					    dl->file_size - dl->progress);
+
+		if ((size_t)data_len > frag_remaining) {
+			leftover = data_len - frag_remaining;
+			data_len = frag_remaining;
+		}
+	}
+
 	/* Accumulate progress */
 	dl->progress += data_len;
 	if (data_len) {
@@ -671,8 +732,13 @@ static int dl_http_download(struct downloader *dl)
 		if (http->ranged_progress < dl->host_cfg.range_override) {
 			/* Ranged query: read until a full fragment is received */
 		} else {
-			/* Ranged query: request next fragment */
-			http->new_data_req = true;
+			/* Ranged query: full fragment received, the next response
+			 * is parsed from the top.
+			 */
+			http->reqs_in_flight--;
+			http->ranged_progress = 0;
+			http->header.has_end = false;
+			http->header.status_code = 0;
 		}
 	}
 	if (dl->progress == dl->file_size) {
@@ -680,7 +746,12 @@ static int dl_http_download(struct downloader *dl)
 		dl->complete = true;
 		http->new_data_req = true;
 	}
-	dl->buf_offset = 0;
+
+	if (leftover) {
+		/* Keep the start of the next response in the buffer */
+		memmove(dl->cfg.buf, dl->cfg.buf + data_len, leftover);
+	}
+	dl->buf_offset = leftover;
 
 	if (dl->complete) {
 		return 0;
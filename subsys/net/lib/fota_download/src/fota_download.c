@@ -15,6 +15,10 @@
 
 #include "fota_download_util.h"
 
+#ifdef CONFIG_FOTA_DOWNLOAD_FRAGMENT_MAP
+#include "util/fota_download_fragmap.h"
+#endif
+
 #ifdef CONFIG_PARTITION_MANAGER_ENABLED
 #include <pm_config.h>
 #endif
@@ -226,6 +230,34 @@ static int downloader_callback(const struct downloader_evt *event)
 				goto error_and_close;
 			}
 
+#ifdef CONFIG_FOTA_DOWNLOAD_FRAGMENT_MAP
+			err = fota_download_fragmap_start(
+				dl_host_hash ^ dl_file_hash ^ dl_proxy_uri_hash, file_size);
+			if (err != 0) {
+				LOG_WRN("Fragment map unavailable, err: %d", err);
+			} else if (offset != 0 &&
+				   fota_download_fragmap_resume_offset(offset) != offset) {
+				/* The DFU target claims progress that the fragment map has
+				 * not confirmed written. The cached progress cannot be
+				 * trusted, so reset the target and restart from scratch.
+				 */
+				err = dfu_target_reset();
+				if (err != 0) {
+					LOG_ERR("Unable to reset DFU target, err: %d", err);
+					set_error_state(FOTA_DOWNLOAD_ERROR_CAUSE_DFU);
+					goto error_and_close;
+				}
+				err = dfu_target_init(img_type, 0, file_size,
+						      dfu_target_callback_handler);
+				if (err != 0) {
+					LOG_ERR("Failed to re-initialize target, err: %d", err);
+					set_error_state(FOTA_DOWNLOAD_ERROR_CAUSE_DFU);
+					goto error_and_close;
+				}
+				offset = 0;
+			}
+#endif /* CONFIG_FOTA_DOWNLOAD_FRAGMENT_MAP */
+
 			/* Is there a DFU already running? */
 			if (offset != 0) {
 				if (atomic_test_bit(&flags, FLAG_NEW_URI)) {
@@ -282,6 +314,12 @@ static int downloader_callback(const struct downloader_evt *event)
 			goto error_and_close;
 		}
 
+#ifdef CONFIG_FOTA_DOWNLOAD_FRAGMENT_MAP
+		if (dfu_target_offset_get(&offset) == 0) {
+			fota_download_fragmap_mark(offset);
+		}
+#endif
+
 		if (IS_ENABLED(CONFIG_FOTA_DOWNLOAD_PROGRESS_EVT)) {
 			err = downloaded_size_get(&offset);
 			if (err != 0) {
@@ -319,6 +357,10 @@ static int downloader_callback(const struct downloader_evt *event)
 		dl_file_hash = 0;
 		dl_proxy_uri_hash = 0;
 
+#ifdef CONFIG_FOTA_DOWNLOAD_FRAGMENT_MAP
+		fota_download_fragmap_clear();
+#endif
+
 		atomic_clear_bit(&flags, FLAG_DOWNLOADING);
 		atomic_set_bit(&flags, FLAG_STOPPED);
 		send_evt(FOTA_DOWNLOAD_EVT_FINISHED);
@@ -0,0 +1,146 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/settings/settings.h>
+#include <zephyr/sys/util.h>
+
+#include "fota_download_fragmap.h"
+
+LOG_MODULE_DECLARE(fota_download, CONFIG_FOTA_DOWNLOAD_LOG_LEVEL);
+
+#define FRAGMAP_REGION_SIZE CONFIG_FOTA_DOWNLOAD_FRAGMENT_MAP_REGION_SIZE
+#define FRAGMAP_MAX_REGIONS CONFIG_FOTA_DOWNLOAD_FRAGMENT_MAP_MAX_REGIONS
+
+#define FRAGMAP_SETTINGS_KEY "fota_dl/fragmap"
+
+/* Persisted as one settings record. */
+static struct {
+	/** Hash identifying the host and file the map belongs to. */
+	uint32_t id_hash;
+	/** Size of the file the map belongs to. */
+	uint32_t file_size;
+	/** One bit per region of FRAGMAP_REGION_SIZE bytes of the file. */
+	uint32_t bitmap[DIV_ROUND_UP(FRAGMAP_MAX_REGIONS, 32)];
+} fragmap;
+
+/** Number of regions persisted, to detect when a new region is completed. */
+static size_t regions_stored;
+static bool fragmap_loaded;
+
+static size_t regions_contiguous(void)
+{
+	size_t region = 0;
+
+	while (region < FRAGMAP_MAX_REGIONS &&
+	       (fragmap.bitmap[region / 32] & BIT(region % 32)) != 0) {
+		region++;
+	}
+
+	return region;
+}
+
+static int settings_set(const char *key, size_t len_rd, settings_read_cb read_cb, void *cb_arg)
+{
+	if (!strcmp(key, "fragmap")) {
+		ssize_t len = read_cb(cb_arg, &fragmap, sizeof(fragmap));
+
+		if (len != sizeof(fragmap)) {
+			LOG_WRN("Failed to read fragment map from storage");
+			memset(&fragmap, 0, sizeof(fragmap));
+		}
+	}
+
+	return 0;
+}
+
+SETTINGS_STATIC_HANDLER_DEFINE(fota_download_fragmap, "fota_dl", NULL, settings_set, NULL, NULL);
+
+int fota_download_fragmap_start(uint32_t id_hash, size_t file_size)
+{
+	int err;
+
+	if (!fragmap_loaded) {
+		err = settings_subsys_init();
+		if (err != 0) {
+			LOG_ERR("settings_subsys_init failed (err %d)", err);
+			return err;
+		}
+
+		err = settings_load_subtree("fota_dl");
+		if (err != 0) {
+			LOG_ERR("settings_load failed (err %d)", err);
+			return err;
+		}
+
+		fragmap_loaded = true;
+	}
+
+	if (fragmap.id_hash != id_hash || fragmap.file_size != file_size) {
+		LOG_DBG("Fragment map belongs to another file, resetting");
+		memset(&fragmap, 0, sizeof(fragmap));
+		fragmap.id_hash = id_hash;
+		fragmap.file_size = file_size;
+	}
+
+	regions_stored = regions_contiguous();
+
+	return 0;
+}
+
+void fota_download_fragmap_mark(size_t flushed_offset)
+{
+	int err;
+	size_t regions = MIN(flushed_offset / FRAGMAP_REGION_SIZE, FRAGMAP_MAX_REGIONS);
+
+	for (size_t region = 0; region < regions; region++) {
+		fragmap.bitmap[region / 32] |= BIT(region % 32);
+	}
+
+	if (regions > regions_stored) {
+		err = settings_save_one(FRAGMAP_SETTINGS_KEY, &fragmap, sizeof(fragmap));
+		if (err != 0) {
+			/* Failure is not critical, a resume just fetches a bit more. */
+			LOG_WRN("Unable to store fragment map: %d", err);
+			return;
+		}
+
+		regions_stored = regions;
+	}
+}
+
+size_t fota_download_fragmap_resume_offset(size_t offset)
+{
+	size_t valid = regions_contiguous() * FRAGMAP_REGION_SIZE;
+
+	if (valid == (size_t)FRAGMAP_MAX_REGIONS * FRAGMAP_REGION_SIZE) {
+		/* The whole tracked range is confirmed, trust offsets beyond it. */
+		return offset;
+	}
+
+	if (offset > valid) {
+		LOG_WRN("Resume offset %zu not confirmed by fragment map, limiting to %zu",
+			offset, valid);
+		return valid;
+	}
+
+	return offset;
+}
+
+void fota_download_fragmap_clear(void)
+{
+	int err;
+
+	memset(&fragmap, 0, sizeof(fragmap));
+	regions_stored = 0;
+
+	err = settings_delete(FRAGMAP_SETTINGS_KEY);
+	if (err != 0) {
+		LOG_WRN("Unable to delete fragment map: %d", err);
+	}
+}
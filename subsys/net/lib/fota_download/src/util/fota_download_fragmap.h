@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef FOTA_DOWNLOAD_FRAGMAP_H__
+#define FOTA_DOWNLOAD_FRAGMAP_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Start tracking download fragments for a file.
+ *
+ * Loads the persisted fragment map. If the stored map belongs to a different
+ * file or file size, the map is reset.
+ *
+ * @param id_hash Hash identifying the host and file being downloaded.
+ * @param file_size Size of the file being downloaded.
+ *
+ * @retval 0 If successful.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int fota_download_fragmap_start(uint32_t id_hash, size_t file_size);
+
+/** @brief Mark regions up to the given flushed offset as valid.
+ *
+ * The map is persisted when a new region is completed, so persistence cost is
+ * bounded to one settings write per region regardless of fragment size.
+ *
+ * @param flushed_offset Number of contiguous bytes confirmed written.
+ */
+void fota_download_fragmap_mark(size_t flushed_offset);
+
+/** @brief Limit a resume offset to regions confirmed valid.
+ *
+ * @param offset Resume offset reported by the DFU target.
+ *
+ * @return The offset, limited to the contiguous prefix of regions that the
+ *	   map has confirmed written. Regions beyond it are fetched again.
+ */
+size_t fota_download_fragmap_resume_offset(size_t offset);
+
+/** @brief Clear the fragment map and delete the persisted copy. */
+void fota_download_fragmap_clear(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* FOTA_DOWNLOAD_FRAGMAP_H__ */
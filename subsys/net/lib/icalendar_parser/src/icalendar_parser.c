@@ -340,7 +340,69 @@ static size_t parse_component(char *buf, struct ical_parser_evt *evt)
 	return ret;
 }
 
-static size_t parse_icalbody(char *buf,	icalendar_parser_callback_t callback)
+#if defined(CONFIG_ICAL_PARSER_EVENT_INDEX)
+/* Insert a parsed Event Component in the index, keeping the entries sorted by
+ * their DTSTART value. The date-time format of RFC 5545 orders correctly under
+ * string comparison within one time zone reference.
+ */
+static void event_index_add(struct icalendar_parser *ical,
+			    const struct ical_parser_evt *evt, size_t offset)
+{
+	size_t pos;
+
+	if (evt->id != ICAL_EVT_VEVENT || evt->error != ICAL_ERROR_NONE ||
+	    evt->ical_com.dtstart[0] == '\0') {
+		return;
+	}
+
+	if (ical->index_count == ARRAY_SIZE(ical->index)) {
+		LOG_WRN("Event index full, increase CONFIG_ICAL_PARSER_EVENT_INDEX_MAX");
+		return;
+	}
+
+	for (pos = 0; pos < ical->index_count; pos++) {
+		if (strcmp(evt->ical_com.dtstart, ical->index[pos].dtstart) < 0) {
+			break;
+		}
+	}
+
+	memmove(&ical->index[pos + 1], &ical->index[pos],
+		(ical->index_count - pos) * sizeof(ical->index[0]));
+
+	strcpy(ical->index[pos].dtstart, evt->ical_com.dtstart);
+	ical->index[pos].offset = offset;
+	ical->index_count++;
+}
+
+const struct ical_index_entry *ical_parser_index_find(
+	const struct icalendar_parser *ical, const char *after)
+{
+	size_t lo = 0;
+	size_t hi = ical->index_count;
+
+	if (after != NULL) {
+		/* Binary search for the first entry with DTSTART >= after. */
+		while (lo < hi) {
+			size_t mid = lo + (hi - lo) / 2;
+
+			if (strcmp(ical->index[mid].dtstart, after) < 0) {
+				lo = mid + 1;
+			} else {
+				hi = mid;
+			}
+		}
+	}
+
+	return (lo < ical->index_count) ? &ical->index[lo] : NULL;
+}
+
+size_t ical_parser_index_count(const struct icalendar_parser *ical)
+{
+	return ical->index_count;
+}
+#endif /* CONFIG_ICAL_PARSER_EVENT_INDEX */
+
+static size_t parse_icalbody(struct icalendar_parser *ical, char *buf)
 {
 	size_t parsed_bytes = 0, parsed_offset = 0;
 
@@ -348,10 +410,15 @@ static size_t parse_icalbody(char *buf,	icalendar_parser_callback_t callback)
 		struct ical_parser_evt evt;
 
 		parsed_bytes = parse_component(buf + parsed_offset, &evt);
-		parsed_offset += parsed_bytes;
 		if (parsed_bytes > 0) {
-			callback(&evt);
+#if defined(CONFIG_ICAL_PARSER_EVENT_INDEX)
+			event_index_add(ical, &evt,
+					ical->stream_base +
+					(&buf[parsed_offset] - ical->buf));
+#endif
+			ical->callback(&evt);
 		}
+		parsed_offset += parsed_bytes;
 	} while (parsed_bytes > 0);
 
 	return parsed_offset;
@@ -387,12 +454,15 @@ size_t ical_parser_parse(struct icalendar_parser *ical, const char *data, size_t
 
 	/* If we got a calendar property, start parsing calendar body. */
 	if (ical->icalobject_begin) {
-		parsed_offset += parse_icalbody(ical->buf + parsed_offset, ical->callback);
+		parsed_offset += parse_icalbody(ical, ical->buf + parsed_offset);
 	}
 
 	if (parsed_offset) {
 		ical->offset = ical->offset + len - parsed_offset;
 		memcpy(ical->buf, ical->buf + parsed_offset, ical->offset);
+#if defined(CONFIG_ICAL_PARSER_EVENT_INDEX)
+		ical->stream_base += parsed_offset;
+#endif
 	}
 
 	return parsed_offset;
@@ -407,6 +477,10 @@ int ical_parser_init(struct icalendar_parser *ical, icalendar_parser_callback_t
 	ical->callback = callback;
 	ical->icalobject_begin = false;
 	ical->offset = 0;
+#if defined(CONFIG_ICAL_PARSER_EVENT_INDEX)
+	ical->index_count = 0;
+	ical->stream_base = 0;
+#endif
 
 	return 0;
 }
@@ -96,6 +96,7 @@ static bool loading_settings;
 
 
 static void dfu_target_cb(enum dfu_target_evt_id evt);
+static void write_buffer_reset(void);
 static void start_pending_fota_download(struct k_work *work);
 static bool firmware_update_check_linked_instances(int instance_id, bool *reconnect);
 static int target_image_type_get(uint16_t instance);
@@ -639,6 +640,7 @@ static void init_firmware_variables(void)
 	percent_downloaded = 0;
 	bytes_downloaded = 0;
 	ongoing_obj_id = UNUSED_OBJ_ID;
+	write_buffer_reset();
 	ret = k_work_schedule(&pending_download_work, PENDING_DELAY);
 	if (ret < 0) {
 		for (int i = 0; i < FOTA_INSTANCE_COUNT; i++) {
@@ -695,6 +697,126 @@ static void dfu_target_cb(enum dfu_target_evt_id evt)
 	ARG_UNUSED(evt);
 }
 
+#if defined(CONFIG_LWM2M_CLIENT_UTILS_FIRMWARE_WRITE_BUFFER)
+struct write_buffer {
+	uint8_t data[CONFIG_LWM2M_CLIENT_UTILS_FIRMWARE_WRITE_BUFFER_SIZE];
+	size_t len;
+};
+
+static struct write_buffer write_buffers[2];
+static struct write_buffer *fill_buffer = &write_buffers[0];
+/* Owned by the flush work while non-NULL */
+static struct write_buffer *flush_buffer;
+static int write_buffer_error;
+/* Taken while a flush is in progress */
+static K_SEM_DEFINE(write_buffer_flush_sem, 1, 1);
+static void write_buffer_flush_fn(struct k_work *work);
+static K_WORK_DEFINE(write_buffer_flush_work, write_buffer_flush_fn);
+
+static void write_buffer_flush_fn(struct k_work *work)
+{
+	int ret;
+
+	ARG_UNUSED(work);
+
+	ret = dfu_target_write(flush_buffer->data, flush_buffer->len);
+	if (ret < 0) {
+		LOG_ERR("dfu_target_write error, err %d", ret);
+		write_buffer_error = ret;
+	}
+	flush_buffer->len = 0;
+	flush_buffer = NULL;
+	k_sem_give(&write_buffer_flush_sem);
+}
+
+static int write_buffer_rotate(void)
+{
+	int ret;
+
+	/* Wait for the previous flush to complete. This is the only point
+	 * where receiving a block waits for flash programming.
+	 */
+	k_sem_take(&write_buffer_flush_sem, K_FOREVER);
+	if (write_buffer_error) {
+		ret = write_buffer_error;
+		write_buffer_error = 0;
+		k_sem_give(&write_buffer_flush_sem);
+		return ret;
+	}
+	flush_buffer = fill_buffer;
+	fill_buffer = (fill_buffer == &write_buffers[0]) ? &write_buffers[1] :
+							   &write_buffers[0];
+	k_work_submit(&write_buffer_flush_work);
+	return 0;
+}
+
+static int firmware_target_write(const uint8_t *data, size_t len)
+{
+	size_t chunk;
+	int ret;
+
+	while (len > 0) {
+		chunk = MIN(len, sizeof(fill_buffer->data) - fill_buffer->len);
+		memcpy(&fill_buffer->data[fill_buffer->len], data, chunk);
+		fill_buffer->len += chunk;
+		data += chunk;
+		len -= chunk;
+
+		if (fill_buffer->len == sizeof(fill_buffer->data)) {
+			ret = write_buffer_rotate();
+			if (ret < 0) {
+				return ret;
+			}
+		}
+	}
+
+	return 0;
+}
+
+static int write_buffer_drain(void)
+{
+	int ret;
+
+	if (fill_buffer->len > 0) {
+		ret = write_buffer_rotate();
+		if (ret < 0) {
+			return ret;
+		}
+	}
+
+	/* Wait for the final flush to complete. */
+	k_sem_take(&write_buffer_flush_sem, K_FOREVER);
+	ret = write_buffer_error;
+	write_buffer_error = 0;
+	k_sem_give(&write_buffer_flush_sem);
+	return ret;
+}
+
+static void write_buffer_reset(void)
+{
+	k_sem_take(&write_buffer_flush_sem, K_FOREVER);
+	write_buffers[0].len = 0;
+	write_buffers[1].len = 0;
+	fill_buffer = &write_buffers[0];
+	write_buffer_error = 0;
+	k_sem_give(&write_buffer_flush_sem);
+}
+#else
+static int firmware_target_write(const uint8_t *data, size_t len)
+{
+	return dfu_target_write(data, len);
+}
+
+static int write_buffer_drain(void)
+{
+	return 0;
+}
+
+static void write_buffer_reset(void)
+{
+}
+#endif /* CONFIG_LWM2M_CLIENT_UTILS_FIRMWARE_WRITE_BUFFER */
+
 static bool is_duplicate_token(void)
 {
 	static uint8_t prev_token[COAP_TOKEN_MAX_LEN];
@@ -756,6 +878,7 @@ static int firmware_block_received_cb(uint16_t obj_inst_id, uint16_t res_id, uin
 
 		ongoing_obj_id = obj_inst_id;
 		client_acknowledge();
+		write_buffer_reset();
 
 		image_type = dfu_target_img_type(data, data_len);
 		if (image_type == DFU_TARGET_IMAGE_TYPE_NONE) {
@@ -836,7 +959,7 @@ static int firmware_block_received_cb(uint16_t obj_inst_id, uint16_t res_id, uin
 		return 0;
 	}
 
-	ret = dfu_target_write(data + skip, data_len - skip);
+	ret = firmware_target_write(data + skip, data_len - skip);
 	if (ret < 0) {
 		LOG_ERR("dfu_target_write error, err %d", ret);
 		goto cleanup;
@@ -846,6 +969,14 @@ static int firmware_block_received_cb(uint16_t obj_inst_id, uint16_t res_id, uin
 		/* Keep going */
 		return 0;
 	}
+
+	/* Commit any data still held in the aggregation buffers. */
+	ret = write_buffer_drain();
+	if (ret < 0) {
+		LOG_ERR("dfu_target_write error, err %d", ret);
+		goto cleanup;
+	}
+
 	/* Last write to flash should be flush write */
 	ret = dfu_target_done(true);
 	if (ret == 0 && IS_ENABLED(CONFIG_FOTA_CLIENT_AUTOSCHEDULE_UPDATE)) {
@@ -866,6 +997,7 @@ static int firmware_block_received_cb(uint16_t obj_inst_id, uint16_t res_id, uin
 
 cleanup:
 	if (ret < 0) {
+		write_buffer_reset();
 		if (dfu_target_reset() < 0) {
 			LOG_ERR("Failed to reset DFU target");
 		}
@@ -267,6 +267,137 @@ static void send_ack(struct mqtt_client *const mqtt_client, uint16_t message_id)
 	LOG_DBG("PUBACK sent for message ID %d", message_id);
 }
 
+#if defined(CONFIG_MQTT_HELPER_PUBLISH_BATCHING)
+struct batch_entry {
+	uint16_t message_id;
+	uint8_t qos;
+	uint8_t retain;
+	size_t topic_len;
+	size_t payload_len;
+	/* Start of the topic in batch_buf; the payload follows the topic. */
+	size_t offset;
+};
+
+static struct batch_entry batch_entries[CONFIG_MQTT_HELPER_PUBLISH_BATCH_MAX_COUNT];
+static uint8_t batch_buf[CONFIG_MQTT_HELPER_PUBLISH_BATCH_BUFFER_SIZE];
+static size_t batch_count;
+static size_t batch_used;
+static K_MUTEX_DEFINE(batch_mutex);
+
+static void batch_flush_work_fn(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	(void)mqtt_helper_publish_flush();
+}
+
+static K_WORK_DELAYABLE_DEFINE(batch_flush_work, batch_flush_work_fn);
+
+/* Drop all queued messages, used when the connection is closed. */
+static void batch_reset(void)
+{
+	(void)k_work_cancel_delayable(&batch_flush_work);
+	k_mutex_lock(&batch_mutex, K_FOREVER);
+	batch_count = 0;
+	batch_used = 0;
+	k_mutex_unlock(&batch_mutex);
+}
+
+int mqtt_helper_publish_flush(void)
+{
+	int err = 0;
+
+	(void)k_work_cancel_delayable(&batch_flush_work);
+
+	k_mutex_lock(&batch_mutex, K_FOREVER);
+	for (size_t i = 0; i < batch_count; i++) {
+		struct batch_entry *entry = &batch_entries[i];
+		struct mqtt_publish_param param = {
+			.message.topic.topic.utf8 = &batch_buf[entry->offset],
+			.message.topic.topic.size = entry->topic_len,
+			.message.topic.qos = entry->qos,
+			.message.payload.data = &batch_buf[entry->offset + entry->topic_len],
+			.message.payload.len = entry->payload_len,
+			.message_id = entry->message_id,
+			.retain_flag = entry->retain,
+		};
+		int ret = mqtt_helper_publish(&param);
+
+		if (ret && !err) {
+			err = ret;
+		}
+	}
+	batch_count = 0;
+	batch_used = 0;
+	k_mutex_unlock(&batch_mutex);
+
+	return err;
+}
+
+int mqtt_helper_publish_buffered(const struct mqtt_publish_param *param)
+{
+	int err;
+	size_t topic_len = param->message.topic.topic.size;
+	size_t payload_len = param->message.payload.len;
+	size_t needed = topic_len + payload_len;
+
+	if (param->message_id == 0) {
+		LOG_ERR("Invalid message ID");
+		return -EINVAL;
+	}
+
+	if (!mqtt_state_verify(MQTT_STATE_CONNECTED)) {
+		LOG_ERR("Library is in the wrong state (%s), %s required",
+			state_name_get(mqtt_state_get()),
+			state_name_get(MQTT_STATE_CONNECTED));
+
+		return -EOPNOTSUPP;
+	}
+
+	if (needed > sizeof(batch_buf)) {
+		LOG_ERR("Message too large for the batch buffer");
+		return -EMSGSIZE;
+	}
+
+	k_mutex_lock(&batch_mutex, K_FOREVER);
+	while ((batch_used + needed > sizeof(batch_buf)) ||
+	       (batch_count >= ARRAY_SIZE(batch_entries))) {
+		/* No room; send what is queued and start a new batch.
+		 * Another thread may refill the batch while the mutex is
+		 * released for the flush, so check the capacity again after
+		 * taking it back.
+		 */
+		k_mutex_unlock(&batch_mutex);
+		err = mqtt_helper_publish_flush();
+		if (err) {
+			return err;
+		}
+		k_mutex_lock(&batch_mutex, K_FOREVER);
+	}
+
+	struct batch_entry *entry = &batch_entries[batch_count];
+
+	entry->message_id = param->message_id;
+	entry->qos = param->message.topic.qos;
+	entry->retain = param->retain_flag;
+	entry->topic_len = topic_len;
+	entry->payload_len = payload_len;
+	entry->offset = batch_used;
+	memcpy(&batch_buf[batch_used], param->message.topic.topic.utf8, topic_len);
+	memcpy(&batch_buf[batch_used + topic_len], param->message.payload.data, payload_len);
+	batch_used += needed;
+	batch_count++;
+
+	if (batch_count == 1) {
+		(void)k_work_schedule(&batch_flush_work,
+				      K_MSEC(CONFIG_MQTT_HELPER_PUBLISH_BATCH_WINDOW_MS));
+	}
+	k_mutex_unlock(&batch_mutex);
+
+	return 0;
+}
+#endif /* CONFIG_MQTT_HELPER_PUBLISH_BATCHING */
+
 MQTT_HELPER_STATIC void on_publish(const struct mqtt_evt *mqtt_evt)
 {
 	int err;
@@ -330,6 +461,9 @@ MQTT_HELPER_STATIC void mqtt_evt_handler(struct mqtt_client *const mqtt_client,
 	case MQTT_EVT_DISCONNECT:
 		LOG_DBG("MQTT_EVT_DISCONNECT: result = %d", mqtt_evt->result);
 
+#if defined(CONFIG_MQTT_HELPER_PUBLISH_BATCHING)
+		batch_reset();
+#endif
 		mqtt_state_set(MQTT_STATE_DISCONNECTED);
 
 		if (current_cfg.cb.on_disconnect) {
@@ -654,6 +788,10 @@ int mqtt_helper_disconnect(void)
 		return -EOPNOTSUPP;
 	}
 
+#if defined(CONFIG_MQTT_HELPER_PUBLISH_BATCHING)
+	/* Send any queued publishes before closing the connection */
+	(void)mqtt_helper_publish_flush();
+#endif
 	mqtt_state_set(MQTT_STATE_DISCONNECTING);
 
 	err = mqtt_disconnect(&mqtt_client, NULL);
@@ -29,6 +29,9 @@
 #include "msg_encode_types.h"
 #include "msg_encode.h"
 #include "coap_codec.h"
+#if defined(CONFIG_NRF_CLOUD_COAP_MSG_ENVELOPE_CACHE)
+#include <zcbor_encode.h>
+#endif
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(coap_codec, CONFIG_NRF_CLOUD_COAP_LOG_LEVEL);
@@ -38,12 +41,117 @@ LOG_MODULE_REGISTER(coap_codec, CONFIG_NRF_CLOUD_COAP_LOG_LEVEL);
  */
 #define DEFAULT_MASK_ANGLE 5
 
+#if defined(CONFIG_NRF_CLOUD_COAP_MSG_ENVELOPE_CACHE)
+/* Longest appId for which the encoded envelope is cached */
+#define ENVELOPE_APP_ID_MAX_LEN 32
+
+/* CBOR map keys from nrf_cloud_coap_device_msg.cddl */
+#define MSG_KEY_APP_ID 1
+#define MSG_KEY_DATA 2
+#define MSG_KEY_TS 3
+
+/* Encoded map header, appId entry, and data key for the most recently used appId.
+ * These bytes are constant for a given appId, so repeated messages need only the
+ * variable data value and timestamp encoded after the cached envelope.
+ */
+static char envelope_app_id[ENVELOPE_APP_ID_MAX_LEN + 1];
+static uint8_t envelope[ENVELOPE_APP_ID_MAX_LEN + 8];
+static size_t envelope_len;
+
+static void envelope_update(const char *app_id)
+{
+	size_t app_id_len = strlen(app_id);
+
+	envelope_len = 0;
+	if (app_id_len > ENVELOPE_APP_ID_MAX_LEN) {
+		return;
+	}
+
+	/* Map header for the three entries appId, data, and ts. The generated encoder
+	 * produces an indefinite-length map, unless ZCBOR_CANONICAL is defined, in which
+	 * case the cached path always encodes all three entries, making the definite
+	 * length constant as well.
+	 */
+	envelope[0] = IS_ENABLED(CONFIG_ZCBOR_CANONICAL) ? 0xA3 : 0xBF;
+
+	ZCBOR_STATE_E(state, 0, envelope + 1, sizeof(envelope) - 1, 1);
+
+	if (!(zcbor_uint32_put(state, MSG_KEY_APP_ID) &&
+	      zcbor_tstr_encode_ptr(state, app_id, app_id_len) &&
+	      zcbor_uint32_put(state, MSG_KEY_DATA))) {
+		return;
+	}
+
+	envelope_len = 1 + (state->payload - (envelope + 1));
+	memcpy(envelope_app_id, app_id, app_id_len);
+	envelope_app_id[app_id_len] = '\0';
+}
+
+static int encode_message_cached(struct nrf_cloud_obj_coap_cbor *msg, uint8_t *buf, size_t *len)
+{
+	bool ok;
+	size_t used;
+
+	if ((envelope_len == 0) || (strcmp(envelope_app_id, msg->app_id) != 0) ||
+	    (*len <= envelope_len)) {
+		return -EAGAIN;
+	}
+
+	memcpy(buf, envelope, envelope_len);
+
+	ZCBOR_STATE_E(state, 0, buf + envelope_len, *len - envelope_len, 1);
+
+	switch (msg->type) {
+	case NRF_CLOUD_DATA_TYPE_STR:
+		ok = zcbor_tstr_encode_ptr(state, msg->str_val, strlen(msg->str_val));
+		break;
+	case NRF_CLOUD_DATA_TYPE_INT:
+		ok = zcbor_int32_put(state, msg->int_val);
+		break;
+	case NRF_CLOUD_DATA_TYPE_DOUBLE:
+		ok = zcbor_float64_put(state, msg->double_val);
+		break;
+	default:
+		/* PVT and unknown types take the full encoder */
+		return -EAGAIN;
+	}
+
+	ok = ok && zcbor_uint32_put(state, MSG_KEY_TS) &&
+	     zcbor_uint64_put(state, (uint64_t)msg->ts);
+	if (!ok) {
+		LOG_ERR("Error encoding message after cached envelope");
+		*len = 0;
+		return -EINVAL;
+	}
+
+	used = envelope_len + (state->payload - (buf + envelope_len));
+
+	if (!IS_ENABLED(CONFIG_ZCBOR_CANONICAL)) {
+		if (used >= *len) {
+			*len = 0;
+			return -EINVAL;
+		}
+		/* Break byte terminating the indefinite-length map in the envelope */
+		buf[used++] = 0xFF;
+	}
+
+	*len = used;
+	return 0;
+}
+#endif /* CONFIG_NRF_CLOUD_COAP_MSG_ENVELOPE_CACHE */
+
 static int encode_message(struct nrf_cloud_obj_coap_cbor *msg, uint8_t *buf, size_t *len,
 			  enum coap_content_format fmt)
 {
 	int err;
 
 	if (fmt == COAP_CONTENT_FORMAT_APP_CBOR) {
+#if defined(CONFIG_NRF_CLOUD_COAP_MSG_ENVELOPE_CACHE)
+		err = encode_message_cached(msg, buf, len);
+		if (err != -EAGAIN) {
+			return err;
+		}
+#endif
 		struct message_out input;
 		size_t out_len;
 
@@ -96,6 +204,9 @@ static int encode_message(struct nrf_cloud_obj_coap_cbor *msg, uint8_t *buf, siz
 			*len = 0;
 		} else {
 			*len = out_len;
+#if defined(CONFIG_NRF_CLOUD_COAP_MSG_ENVELOPE_CACHE)
+			envelope_update(msg->app_id);
+#endif
 		}
 	} else if (fmt == COAP_CONTENT_FORMAT_APP_JSON) {
 		struct nrf_cloud_data out;
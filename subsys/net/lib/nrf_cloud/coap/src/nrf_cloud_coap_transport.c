@@ -73,6 +73,65 @@ static K_MUTEX_DEFINE(internal_transfer_mut);
 
 static struct nrf_cloud_coap_client internal_cc = {0};
 
+#if defined(CONFIG_NRF_CLOUD_COAP_AUTO_PAUSE)
+static void auto_pause_work_fn(struct k_work *work);
+
+/* Delayable work that saves the DTLS CID session once the internal client has been
+ * idle; the session is transparently resumed by the next transfer.
+ */
+static K_WORK_DELAYABLE_DEFINE(auto_pause_work, auto_pause_work_fn);
+static bool auto_paused;
+
+static void auto_pause_work_fn(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	if (k_mutex_lock(&internal_transfer_mut, K_NO_WAIT)) {
+		/* A transfer is in progress; it reschedules this work when it completes */
+		return;
+	}
+	if (internal_cc.authenticated && !internal_cc.paused &&
+	    nrfc_dtls_cid_is_active(internal_cc.sock) &&
+	    (nrf_cloud_coap_transport_pause(&internal_cc) == 0)) {
+		auto_paused = true;
+		LOG_DBG("Connection idle; DTLS CID session saved");
+	}
+	k_mutex_unlock(&internal_transfer_mut);
+}
+
+/* Call with internal_transfer_mut locked */
+static int auto_pause_resume(void)
+{
+	int err;
+
+	(void)k_work_cancel_delayable(&auto_pause_work);
+	if (!auto_paused) {
+		return 0;
+	}
+	auto_paused = false;
+	err = nrf_cloud_coap_transport_resume(&internal_cc);
+	if (err) {
+		LOG_WRN("Failed to resume saved DTLS CID session: %d", err);
+	}
+	return err;
+}
+
+/* Call with internal_transfer_mut locked */
+static void auto_pause_schedule(void)
+{
+	if (internal_cc.authenticated && !internal_cc.paused) {
+		(void)k_work_reschedule(&auto_pause_work,
+					K_SECONDS(CONFIG_NRF_CLOUD_COAP_AUTO_PAUSE_IDLE_SEC));
+	}
+}
+
+static void auto_pause_reset(void)
+{
+	(void)k_work_cancel_delayable(&auto_pause_work);
+	auto_paused = false;
+}
+#endif /* CONFIG_NRF_CLOUD_COAP_AUTO_PAUSE */
+
 #if defined(CONFIG_NRF_CLOUD_COAP_LOG_LEVEL_DBG)
 static const char *const coap_method_str[] = {
 	NULL,		/* 0 */
@@ -163,6 +222,12 @@ static struct cc_xfer_data *xfer_data_init(struct nrf_cloud_coap_client *cc,
 
 bool nrf_cloud_coap_is_connected(void)
 {
+#if defined(CONFIG_NRF_CLOUD_COAP_AUTO_PAUSE)
+	/* An automatically paused connection is resumed by the next transfer */
+	if (internal_cc.authenticated && auto_paused) {
+		return true;
+	}
+#endif
 	return internal_cc.authenticated && !internal_cc.paused;
 }
 
@@ -378,6 +443,10 @@ int nrf_cloud_coap_connect(const char * const app_ver)
 
 	k_mutex_lock(&internal_transfer_mut, K_FOREVER);
 
+#if defined(CONFIG_NRF_CLOUD_COAP_AUTO_PAUSE)
+	/* Transport connect resumes a saved session itself when possible */
+	auto_pause_reset();
+#endif
 	err = nrf_cloud_coap_transport_connect(&internal_cc);
 	if (err < 0) {
 		goto exit;
@@ -412,6 +481,15 @@ int nrf_cloud_coap_pause(void)
 	int err = 0;
 
 	k_mutex_lock(&internal_transfer_mut, K_FOREVER);
+#if defined(CONFIG_NRF_CLOUD_COAP_AUTO_PAUSE)
+	(void)k_work_cancel_delayable(&auto_pause_work);
+	if (auto_paused) {
+		/* The session is already saved; hand ownership of the pause to the caller */
+		auto_paused = false;
+		k_mutex_unlock(&internal_transfer_mut);
+		return 0;
+	}
+#endif
 	err = nrf_cloud_coap_transport_pause(&internal_cc);
 	k_mutex_unlock(&internal_transfer_mut);
 
@@ -423,6 +501,9 @@ int nrf_cloud_coap_resume(void)
 	int err = 0;
 
 	k_mutex_lock(&internal_transfer_mut, K_FOREVER);
+#if defined(CONFIG_NRF_CLOUD_COAP_AUTO_PAUSE)
+	auto_pause_reset();
+#endif
 	err = nrf_cloud_coap_transport_resume(&internal_cc);
 	k_mutex_unlock(&internal_transfer_mut);
 
@@ -637,10 +718,20 @@ int nrf_cloud_coap_get(const char *resource, const char *query,
 	int err = 0;
 
 	k_mutex_lock(&internal_transfer_mut, K_FOREVER);
+#if defined(CONFIG_NRF_CLOUD_COAP_AUTO_PAUSE)
+	err = auto_pause_resume();
+	if (err) {
+		k_mutex_unlock(&internal_transfer_mut);
+		return err;
+	}
+#endif
 	void *xfer = xfer_data_init(&internal_cc, cb, user, &cb_sem);
 
 	err = client_transfer(COAP_METHOD_GET, resource, query,
 			      buf, len, fmt_out, fmt_in, true, reliable, xfer);
+#if defined(CONFIG_NRF_CLOUD_COAP_AUTO_PAUSE)
+	auto_pause_schedule();
+#endif
 	k_mutex_unlock(&internal_transfer_mut);
 
 	return err;
@@ -654,10 +745,20 @@ int nrf_cloud_coap_post(const char *resource, const char *query,
 	int err = 0;
 
 	k_mutex_lock(&internal_transfer_mut, K_FOREVER);
+#if defined(CONFIG_NRF_CLOUD_COAP_AUTO_PAUSE)
+	err = auto_pause_resume();
+	if (err) {
+		k_mutex_unlock(&internal_transfer_mut);
+		return err;
+	}
+#endif
 	void *xfer = xfer_data_init(&internal_cc, cb, user, &cb_sem);
 
 	err = client_transfer(COAP_METHOD_POST, resource, query,
 			      buf, len, fmt, fmt, false, reliable, xfer);
+#if defined(CONFIG_NRF_CLOUD_COAP_AUTO_PAUSE)
+	auto_pause_schedule();
+#endif
 	k_mutex_unlock(&internal_transfer_mut);
 
 	return err;
@@ -671,10 +772,20 @@ int nrf_cloud_coap_put(const char *resource, const char *query,
 	int err = 0;
 
 	k_mutex_lock(&internal_transfer_mut, K_FOREVER);
+#if defined(CONFIG_NRF_CLOUD_COAP_AUTO_PAUSE)
+	err = auto_pause_resume();
+	if (err) {
+		k_mutex_unlock(&internal_transfer_mut);
+		return err;
+	}
+#endif
 	void *xfer = xfer_data_init(&internal_cc, cb, user, &cb_sem);
 
 	err = client_transfer(COAP_METHOD_PUT, resource, query,
 			      buf, len, fmt, fmt, false, reliable, xfer);
+#if defined(CONFIG_NRF_CLOUD_COAP_AUTO_PAUSE)
+	auto_pause_schedule();
+#endif
 	k_mutex_unlock(&internal_transfer_mut);
 
 	return err;
@@ -688,10 +799,20 @@ int nrf_cloud_coap_delete(const char *resource, const char *query,
 	int err = 0;
 
 	k_mutex_lock(&internal_transfer_mut, K_FOREVER);
+#if defined(CONFIG_NRF_CLOUD_COAP_AUTO_PAUSE)
+	err = auto_pause_resume();
+	if (err) {
+		k_mutex_unlock(&internal_transfer_mut);
+		return err;
+	}
+#endif
 	void *xfer = xfer_data_init(&internal_cc, cb, user, &cb_sem);
 
 	err = client_transfer(COAP_METHOD_DELETE, resource, query,
 			      buf, len, fmt, fmt, false, reliable, xfer);
+#if defined(CONFIG_NRF_CLOUD_COAP_AUTO_PAUSE)
+	auto_pause_schedule();
+#endif
 	k_mutex_unlock(&internal_transfer_mut);
 
 	return err;
@@ -706,10 +827,20 @@ int nrf_cloud_coap_fetch(const char *resource, const char *query,
 	int err = 0;
 
 	k_mutex_lock(&internal_transfer_mut, K_FOREVER);
+#if defined(CONFIG_NRF_CLOUD_COAP_AUTO_PAUSE)
+	err = auto_pause_resume();
+	if (err) {
+		k_mutex_unlock(&internal_transfer_mut);
+		return err;
+	}
+#endif
 	void *xfer = xfer_data_init(&internal_cc, cb, user, &cb_sem);
 
 	err = client_transfer(COAP_METHOD_FETCH, resource, query,
 			      buf, len, fmt_out, fmt_in, true, reliable, xfer);
+#if defined(CONFIG_NRF_CLOUD_COAP_AUTO_PAUSE)
+	auto_pause_schedule();
+#endif
 	k_mutex_unlock(&internal_transfer_mut);
 
 	return err;
@@ -723,10 +854,20 @@ int nrf_cloud_coap_patch(const char *resource, const char *query,
 	int err = 0;
 
 	k_mutex_lock(&internal_transfer_mut, K_FOREVER);
+#if defined(CONFIG_NRF_CLOUD_COAP_AUTO_PAUSE)
+	err = auto_pause_resume();
+	if (err) {
+		k_mutex_unlock(&internal_transfer_mut);
+		return err;
+	}
+#endif
 	void *xfer = xfer_data_init(&internal_cc, cb, user, &cb_sem);
 
 	err = client_transfer(COAP_METHOD_PATCH, resource, query,
 			      buf, len, fmt, fmt, false, reliable, xfer);
+#if defined(CONFIG_NRF_CLOUD_COAP_AUTO_PAUSE)
+	auto_pause_schedule();
+#endif
 	k_mutex_unlock(&internal_transfer_mut);
 
 	return err;
@@ -761,6 +902,9 @@ int nrf_cloud_coap_disconnect(void)
 	int err = 0;
 
 	k_mutex_lock(&internal_transfer_mut, K_FOREVER);
+#if defined(CONFIG_NRF_CLOUD_COAP_AUTO_PAUSE)
+	auto_pause_reset();
+#endif
 	err = nrf_cloud_coap_transport_disconnect(&internal_cc);
 	k_mutex_unlock(&internal_transfer_mut);
 
@@ -101,10 +101,26 @@ static pgps_event_handler_t evt_handler;
 static uint8_t *write_buf;
 
 #if defined(CONFIG_PM_PARTITION_REGION_PGPS_EXTERNAL)
-static off_t prediction_cache_flash_offset = UINT32_MAX;
-static uint8_t prediction_cache[PGPS_PREDICTION_STORAGE_SIZE];
+/* Two cache entries so that reading the next prediction (for example when the expiration
+ * timer fires and the next prediction is injected) does not evict the current one.
+ */
+#define PREDICTION_CACHE_ENTRIES 2
+
+struct prediction_cache_entry {
+	off_t flash_offset;
+	uint32_t last_used;
+	uint8_t data[PGPS_PREDICTION_STORAGE_SIZE];
+};
+
+static struct prediction_cache_entry prediction_cache[PREDICTION_CACHE_ENTRIES] = {
+	[0 ... (PREDICTION_CACHE_ENTRIES - 1)] = { .flash_offset = UINT32_MAX },
+};
+static uint32_t prediction_cache_use_count;
 #endif
 
+/* Number of bytes needed from the start of a prediction to determine its time */
+#define PREDICTION_TIME_READ_SIZE offsetof(struct nrf_cloud_pgps_prediction, ephemerii)
+
 static uint8_t prediction_buf[PGPS_PREDICTION_STORAGE_SIZE];
 static volatile bool accept_packets;
 static volatile bool loading_in_progress;
@@ -126,7 +142,11 @@ K_TIMER_DEFINE(prediction_timer, prediction_timer_handler, NULL);
 static void discard_prediction_buffer(void)
 {
 #if defined(CONFIG_PM_PARTITION_REGION_PGPS_EXTERNAL)
-	prediction_cache_flash_offset = UINT32_MAX;
+	for (int i = 0; i < PREDICTION_CACHE_ENTRIES; i++) {
+		prediction_cache[i].flash_offset = UINT32_MAX;
+		prediction_cache[i].last_used = 0;
+	}
+	prediction_cache_use_count = 0;
 #endif
 }
 
@@ -149,25 +169,39 @@ static int get_prediction_block(int pnum)
 static struct nrf_cloud_pgps_prediction *get_cached_prediction(off_t off)
 {
 #if defined(CONFIG_PM_PARTITION_REGION_PGPS_EXTERNAL)
-	/* Check if the cached prediction is the one we want; if not, read it now */
-	if (prediction_cache_flash_offset != off) {
-		int err;
-
-		/* Subtract fa_off from off to convert from flash device address space
-		 * to partition address space.
-		 */
-		err = flash_area_read(prediction_flash_area, off - prediction_flash_area->fa_off,
-				      prediction_cache, sizeof(prediction_cache));
+	struct prediction_cache_entry *entry = &prediction_cache[0];
+	int err;
 
-		if (err) {
-			LOG_ERR("Error %d reading prediction from flash offset 0x%lx", err, off);
-			return NULL;
+	/* Check if a cached prediction is the one we want; if not, read it into the
+	 * least recently used entry.
+	 */
+	for (int i = 0; i < PREDICTION_CACHE_ENTRIES; i++) {
+		if (prediction_cache[i].flash_offset == off) {
+			prediction_cache[i].last_used = ++prediction_cache_use_count;
+			return (struct nrf_cloud_pgps_prediction *)prediction_cache[i].data;
+		}
+		if (prediction_cache[i].last_used < entry->last_used) {
+			entry = &prediction_cache[i];
 		}
-		prediction_cache_flash_offset = off;
-		LOG_DBG("Caching offset 0x%X", (uint32_t)(off - prediction_flash_area->fa_off));
 	}
 
-	return (struct nrf_cloud_pgps_prediction *)prediction_cache;
+	/* Subtract fa_off from off to convert from flash device address space
+	 * to partition address space.
+	 */
+	err = flash_area_read(prediction_flash_area, off - prediction_flash_area->fa_off,
+			      entry->data, sizeof(entry->data));
+
+	if (err) {
+		LOG_ERR("Error %d reading prediction from flash offset 0x%lx", err, off);
+		entry->flash_offset = UINT32_MAX;
+		entry->last_used = 0;
+		return NULL;
+	}
+	entry->flash_offset = off;
+	entry->last_used = ++prediction_cache_use_count;
+	LOG_DBG("Caching offset 0x%X", (uint32_t)(off - prediction_flash_area->fa_off));
+
+	return (struct nrf_cloud_pgps_prediction *)entry->data;
 #else
 	/* The parameter off is really the address in built-in flash for the prediction */
 	return (struct nrf_cloud_pgps_prediction *)off;
@@ -192,6 +226,40 @@ static struct nrf_cloud_pgps_prediction *get_prediction_slot(int slot, off_t *fl
 	return get_cached_prediction(off);
 }
 
+/**
+ * @brief Access only the start of the prediction in the requested storage slot, which is
+ * sufficient to determine its time signature.  When using external flash, this avoids
+ * reading the whole prediction and does not go through the prediction cache; buf receives
+ * the first PREDICTION_TIME_READ_SIZE bytes.  When using internal flash, buf is unused and
+ * a direct pointer to the prediction in flash is returned.
+ */
+static struct nrf_cloud_pgps_prediction *get_prediction_slot_time(int slot, off_t *flash_off,
+								  uint8_t *buf)
+{
+	off_t off = storage_addr + slot * PGPS_PREDICTION_STORAGE_SIZE;
+
+	if (flash_off) {
+		*flash_off = off;
+	}
+
+#if defined(CONFIG_PM_PARTITION_REGION_PGPS_EXTERNAL)
+	int err;
+
+	err = flash_area_read(prediction_flash_area, off - prediction_flash_area->fa_off,
+			      buf, PREDICTION_TIME_READ_SIZE);
+	if (err) {
+		LOG_ERR("Error %d reading prediction time from flash offset 0x%lx", err, off);
+		return NULL;
+	}
+
+	return (struct nrf_cloud_pgps_prediction *)buf;
+#else
+	ARG_UNUSED(buf);
+	/* The offset is really the address in built-in flash for the prediction */
+	return (struct nrf_cloud_pgps_prediction *)off;
+#endif
+}
+
 static int determine_prediction_num(struct nrf_cloud_pgps_header *header,
 				    struct nrf_cloud_pgps_prediction *p)
 {
@@ -315,9 +383,13 @@ static int validate_stored_predictions(uint16_t *first_bad_day, uint32_t *first_
 
 	npgps_reset_block_pool();
 
-	/* build catalog of predictions by block */
+	/* build catalog of predictions by block; only the start of each prediction is
+	 * needed here, so read just enough to determine its time signature
+	 */
 	for (i = 0; i < count; i++) {
-		pred = (struct nrf_cloud_pgps_prediction *)get_prediction_slot(i, &off);
+		uint8_t pred_start[PREDICTION_TIME_READ_SIZE];
+
+		pred = get_prediction_slot_time(i, &off, pred_start);
 		if (pred == NULL) {
 			LOG_ERR("Prediction at idx:%d not accessible", i);
 			continue;
@@ -109,7 +109,11 @@ static struct nct {
 	uint16_t message_id;
 	uint8_t rx_buf[CONFIG_NRF_CLOUD_MQTT_MESSAGE_BUFFER_LEN];
 	uint8_t tx_buf[CONFIG_NRF_CLOUD_MQTT_MESSAGE_BUFFER_LEN];
+#if defined(CONFIG_NRF_CLOUD_MQTT_PAYLOAD_BUFFER_DYNAMIC)
+	uint8_t *payload_buf;
+#else
 	uint8_t payload_buf[CONFIG_NRF_CLOUD_MQTT_PAYLOAD_BUFFER_LEN + 1];
+#endif
 } nct;
 
 #define CC_RX_LIST_CNT 4
@@ -600,12 +604,20 @@ static void nrf_cloud_fota_cb_handler(const struct nrf_cloud_fota_evt *const evt
 
 static int publish_get_payload(struct mqtt_client *client, size_t length)
 {
-	if (length > (sizeof(nct.payload_buf) - 1)) {
-		LOG_ERR("Length specified:%zd larger than payload_buf:%zd", length,
-			sizeof(nct.payload_buf));
+	if (length > CONFIG_NRF_CLOUD_MQTT_PAYLOAD_BUFFER_LEN) {
+		LOG_ERR("Length specified:%zd larger than payload_buf:%d", length,
+			CONFIG_NRF_CLOUD_MQTT_PAYLOAD_BUFFER_LEN);
 		return -EMSGSIZE;
 	}
 
+#if defined(CONFIG_NRF_CLOUD_MQTT_PAYLOAD_BUFFER_DYNAMIC)
+	nct.payload_buf = nrf_cloud_malloc(length + 1);
+	if (nct.payload_buf == NULL) {
+		LOG_ERR("Failed to allocate %zd bytes for payload", length + 1);
+		return -ENOMEM;
+	}
+#endif
+
 	int ret = mqtt_readall_publish_payload(client, nct.payload_buf, length);
 
 	/* Ensure buffer is always NULL-terminated */
@@ -614,6 +626,14 @@ static int publish_get_payload(struct mqtt_client *client, size_t length)
 	return ret;
 }
 
+static void publish_payload_free(void)
+{
+#if defined(CONFIG_NRF_CLOUD_MQTT_PAYLOAD_BUFFER_DYNAMIC)
+	nrf_cloud_free(nct.payload_buf);
+	nct.payload_buf = NULL;
+#endif
+}
+
 static int translate_mqtt_connack_result(const int mqtt_result)
 {
 	switch (mqtt_result) {
@@ -804,6 +824,11 @@ static void nct_mqtt_evt_handler(struct mqtt_client *const mqtt_client,
 			LOG_ERR("nct_input: failed %d", err);
 		}
 	}
+
+	/* The payload has been consumed by the event handlers. */
+	if (_mqtt_evt->type == MQTT_EVT_PUBLISH) {
+		publish_payload_free();
+	}
 }
 
 int nct_initialize(const struct nrf_cloud_init_param *param)
@@ -78,7 +78,14 @@ LOG_MODULE_REGISTER(nrf_provisioning_http, CONFIG_NRF_PROVISIONING_LOG_LEVEL);
 #define HDR_ACCEPT_ALL (HTTP_HDR_ACCEPT HDR_TYPE_ALL CRLF)
 
 #define PRV_CONTENT_TYPE_HDR (CONTENT_TYPE HDR_TYPE_ALL CRLF)
+#if defined(CONFIG_NRF_PROVISIONING_HTTP_PERSISTENT_CONNECTION)
+/* Keep the TLS connection open between requests; the REST client connection
+ * pool reuses it for the result upload and subsequent provisioning rounds.
+ */
+#define PRV_CONNECTION_HDR "Connection: keep-alive" CRLF
+#else
 #define PRV_CONNECTION_HDR "Connection: close" CRLF
+#endif
 
 #define ZEPHYR_VER STRINGIFY(KERNEL_VERSION_MAJOR) "." STRINGIFY(KERNEL_VERSION_MINOR) " (" \
 	STRINGIFY(BUILD_VERSION) " " CONFIG_BOARD ")"
@@ -23,6 +23,130 @@ LOG_MODULE_REGISTER(rest_client, CONFIG_REST_CLIENT_LOG_LEVEL);
 
 #define HTTP_PROTOCOL "HTTP/1.1"
 
+#if defined(CONFIG_REST_CLIENT_CONNECTION_POOL)
+#define POOL_HOSTNAME_MAX_LEN 64
+#define POOL_IDLE_TIME_MS (CONFIG_REST_CLIENT_CONNECTION_POOL_IDLE_TIME_SECONDS * MSEC_PER_SEC)
+
+struct pool_entry {
+	char host[POOL_HOSTNAME_MAX_LEN + 1];
+	uint16_t port;
+	sec_tag_t sec_tag;
+	int fd;
+	int64_t last_used;
+};
+
+static struct pool_entry conn_pool[CONFIG_REST_CLIENT_CONNECTION_POOL_SIZE] = {
+	[0 ... (CONFIG_REST_CLIENT_CONNECTION_POOL_SIZE - 1)] = { .fd = -1 },
+};
+static K_MUTEX_DEFINE(conn_pool_mutex);
+
+static void rest_client_pool_idle_work_fn(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(pool_idle_work, rest_client_pool_idle_work_fn);
+
+static void rest_client_pool_idle_work_fn(struct k_work *work)
+{
+	int64_t now = k_uptime_get();
+	int64_t next_check_ms = -1;
+
+	ARG_UNUSED(work);
+
+	k_mutex_lock(&conn_pool_mutex, K_FOREVER);
+	for (int i = 0; i < ARRAY_SIZE(conn_pool); i++) {
+		int64_t idle_ms;
+
+		if (conn_pool[i].fd < 0) {
+			continue;
+		}
+		idle_ms = now - conn_pool[i].last_used;
+		if (idle_ms >= POOL_IDLE_TIME_MS) {
+			LOG_DBG("Closing idle pooled connection to %s", conn_pool[i].host);
+			(void)zsock_close(conn_pool[i].fd);
+			conn_pool[i].fd = -1;
+		} else if ((next_check_ms < 0) || ((POOL_IDLE_TIME_MS - idle_ms) < next_check_ms)) {
+			next_check_ms = POOL_IDLE_TIME_MS - idle_ms;
+		}
+	}
+	if (next_check_ms >= 0) {
+		(void)k_work_reschedule(&pool_idle_work, K_MSEC(next_check_ms));
+	}
+	k_mutex_unlock(&conn_pool_mutex);
+}
+
+/* Take a pooled socket for the given endpoint, or return -1 if none is available. */
+static int rest_client_pool_socket_take(const char *host, uint16_t port, sec_tag_t sec_tag)
+{
+	int fd = -1;
+
+	k_mutex_lock(&conn_pool_mutex, K_FOREVER);
+	for (int i = 0; i < ARRAY_SIZE(conn_pool); i++) {
+		if ((conn_pool[i].fd >= 0) &&
+		    (conn_pool[i].port == port) &&
+		    (conn_pool[i].sec_tag == sec_tag) &&
+		    (strcmp(conn_pool[i].host, host) == 0)) {
+			fd = conn_pool[i].fd;
+			conn_pool[i].fd = -1;
+			break;
+		}
+	}
+	k_mutex_unlock(&conn_pool_mutex);
+
+	return fd;
+}
+
+/* Store a socket in the pool, evicting the least recently used entry if needed.
+ * Returns false if the socket cannot be pooled, in which case the caller closes it.
+ */
+static bool rest_client_pool_socket_give(const char *host, uint16_t port, sec_tag_t sec_tag,
+					 int fd)
+{
+	struct pool_entry *entry = NULL;
+
+	if (strlen(host) > POOL_HOSTNAME_MAX_LEN) {
+		return false;
+	}
+
+	k_mutex_lock(&conn_pool_mutex, K_FOREVER);
+	for (int i = 0; i < ARRAY_SIZE(conn_pool); i++) {
+		if (conn_pool[i].fd < 0) {
+			entry = &conn_pool[i];
+			break;
+		}
+		if ((entry == NULL) || (conn_pool[i].last_used < entry->last_used)) {
+			entry = &conn_pool[i];
+		}
+	}
+	if (entry->fd >= 0) {
+		LOG_DBG("Evicting pooled connection to %s", entry->host);
+		(void)zsock_close(entry->fd);
+	}
+	strcpy(entry->host, host);
+	entry->port = port;
+	entry->sec_tag = sec_tag;
+	entry->fd = fd;
+	entry->last_used = k_uptime_get();
+	(void)k_work_schedule(&pool_idle_work, K_MSEC(POOL_IDLE_TIME_MS));
+	k_mutex_unlock(&conn_pool_mutex);
+
+	return true;
+}
+#endif /* CONFIG_REST_CLIENT_CONNECTION_POOL */
+
+void rest_client_pool_close_all(void)
+{
+#if defined(CONFIG_REST_CLIENT_CONNECTION_POOL)
+	(void)k_work_cancel_delayable(&pool_idle_work);
+
+	k_mutex_lock(&conn_pool_mutex, K_FOREVER);
+	for (int i = 0; i < ARRAY_SIZE(conn_pool); i++) {
+		if (conn_pool[i].fd >= 0) {
+			(void)zsock_close(conn_pool[i].fd);
+			conn_pool[i].fd = -1;
+		}
+	}
+	k_mutex_unlock(&conn_pool_mutex);
+#endif
+}
+
 static int rest_client_http_response_cb(struct http_response *rsp,
 					enum http_final_call final_data,
 					void *user_data)
@@ -419,7 +543,33 @@ int rest_client_request(struct rest_client_req_context *req_ctx,
 		}
 	}
 
+#if defined(CONFIG_REST_CLIENT_CONNECTION_POOL)
+	bool pooled = false;
+
+	if ((req_ctx->connect_socket == REST_CLIENT_SCKT_CONNECT) && !req_ctx->keep_alive) {
+		req_ctx->connect_socket = rest_client_pool_socket_take(req_ctx->host,
+								       req_ctx->port,
+								       req_ctx->sec_tag);
+		pooled = (req_ctx->connect_socket >= 0);
+		if (pooled) {
+			LOG_DBG("Reusing pooled connection to %s", req_ctx->host);
+		}
+	}
+#endif
+
 	ret = rest_client_do_api_call(&http_req, req_ctx, resp_ctx);
+#if defined(CONFIG_REST_CLIENT_CONNECTION_POOL)
+	if (ret && pooled) {
+		/* The server may have closed the pooled connection in the meantime;
+		 * retry once with a fresh connection.
+		 */
+		LOG_DBG("Pooled connection failed (%d), retrying with a new connection", ret);
+		(void)zsock_close(req_ctx->connect_socket);
+		req_ctx->connect_socket = REST_CLIENT_SCKT_CONNECT;
+		pooled = false;
+		ret = rest_client_do_api_call(&http_req, req_ctx, resp_ctx);
+	}
+#endif
 	if (ret) {
 		LOG_ERR("rest_client_do_api_call() failed, err %d", ret);
 		goto clean_up;
@@ -439,6 +589,16 @@ int rest_client_request(struct rest_client_req_context *req_ctx,
 
 clean_up:
 	if (req_ctx->connect_socket != REST_CLIENT_SCKT_CONNECT) {
+#if defined(CONFIG_REST_CLIENT_CONNECTION_POOL)
+		if (!ret && !req_ctx->keep_alive &&
+		    rest_client_pool_socket_give(req_ctx->host, req_ctx->port, req_ctx->sec_tag,
+						 req_ctx->connect_socket)) {
+			LOG_DBG("Socket with id: %d stored in the connection pool",
+				req_ctx->connect_socket);
+			req_ctx->connect_socket = REST_CLIENT_SCKT_CONNECT;
+			return ret;
+		}
+#endif
 		/* Socket was not closed yet: */
 		rest_client_close_connection(req_ctx, resp_ctx);
 	}
@@ -0,0 +1,271 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+
+#include <net/tls_session_ticket_store.h>
+
+#if defined(CONFIG_TLS_SESSION_TICKET_STORE_SETTINGS)
+#include <zephyr/settings/settings.h>
+#endif
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(tls_session_ticket_store, CONFIG_TLS_CREDENTIALS_LOG_LEVEL);
+
+#define TICKET_SETTINGS_KEY "tls_ticket"
+
+/* Persisted part of a store entry. */
+struct ticket_data {
+	sec_tag_t sec_tag;
+	char hostname[CONFIG_TLS_SESSION_TICKET_STORE_HOSTNAME_MAX_LEN];
+	size_t ticket_len;
+	uint8_t ticket[CONFIG_TLS_SESSION_TICKET_STORE_TICKET_MAX_SIZE];
+};
+
+struct ticket_entry {
+	bool valid;
+	/* Uptime of the last save or load, used for least-recently-used eviction. */
+	int64_t last_used;
+	struct ticket_data data;
+};
+
+static struct ticket_entry entries[CONFIG_TLS_SESSION_TICKET_STORE_ENTRY_COUNT];
+
+/* A mutex for protecting access to the entries array. */
+static K_MUTEX_DEFINE(entry_lock);
+
+static struct ticket_entry *entry_get(sec_tag_t sec_tag, const char *hostname)
+{
+	for (int i = 0; i < ARRAY_SIZE(entries); i++) {
+		if (entries[i].valid && entries[i].data.sec_tag == sec_tag &&
+		    strcmp(entries[i].data.hostname, hostname) == 0) {
+			return &entries[i];
+		}
+	}
+
+	return NULL;
+}
+
+static struct ticket_entry *entry_allocate(void)
+{
+	struct ticket_entry *oldest = &entries[0];
+
+	for (int i = 0; i < ARRAY_SIZE(entries); i++) {
+		if (!entries[i].valid) {
+			return &entries[i];
+		}
+
+		if (entries[i].last_used < oldest->last_used) {
+			oldest = &entries[i];
+		}
+	}
+
+	LOG_DBG("Evicting ticket for sec_tag %d, hostname %s", oldest->data.sec_tag,
+		oldest->data.hostname);
+
+	return oldest;
+}
+
+#if defined(CONFIG_TLS_SESSION_TICKET_STORE_SETTINGS)
+
+static int entry_settings_save(struct ticket_entry *entry)
+{
+	char key[sizeof(TICKET_SETTINGS_KEY) + 10];
+
+	snprintf(key, sizeof(key), TICKET_SETTINGS_KEY "/%d", (int)ARRAY_INDEX(entries, entry));
+
+	return settings_save_one(key, &entry->data,
+				 offsetof(struct ticket_data, ticket) + entry->data.ticket_len);
+}
+
+static int entry_settings_delete(struct ticket_entry *entry)
+{
+	char key[sizeof(TICKET_SETTINGS_KEY) + 10];
+
+	snprintf(key, sizeof(key), TICKET_SETTINGS_KEY "/%d", (int)ARRAY_INDEX(entries, entry));
+
+	return settings_delete(key);
+}
+
+static int ticket_settings_set(const char *name, size_t len, settings_read_cb read_cb,
+			       void *cb_arg)
+{
+	struct ticket_entry *entry;
+	unsigned long index;
+	char *end;
+	ssize_t read_len;
+
+	index = strtoul(name, &end, 10);
+	if ((end == name) || (*end != '\0') || (index >= ARRAY_SIZE(entries))) {
+		LOG_WRN("Unknown ticket store key: %s", name);
+		return -ENOENT;
+	}
+
+	entry = &entries[index];
+
+	if ((len < offsetof(struct ticket_data, ticket)) || (len > sizeof(entry->data))) {
+		LOG_WRN("Invalid persisted ticket size: %d", (int)len);
+		return -EINVAL;
+	}
+
+	read_len = read_cb(cb_arg, &entry->data, len);
+	if (read_len < 0) {
+		return read_len;
+	}
+
+	entry->data.ticket_len = len - offsetof(struct ticket_data, ticket);
+	entry->last_used = 0;
+	entry->valid = true;
+
+	return 0;
+}
+
+SETTINGS_STATIC_HANDLER_DEFINE(tls_session_ticket_store, TICKET_SETTINGS_KEY, NULL,
+			       ticket_settings_set, NULL, NULL);
+
+#else
+
+static int entry_settings_save(struct ticket_entry *entry)
+{
+	ARG_UNUSED(entry);
+
+	return 0;
+}
+
+static int entry_settings_delete(struct ticket_entry *entry)
+{
+	ARG_UNUSED(entry);
+
+	return 0;
+}
+
+#endif /* CONFIG_TLS_SESSION_TICKET_STORE_SETTINGS */
+
+int tls_session_ticket_store_save(sec_tag_t sec_tag, const char *hostname, const void *ticket,
+				  size_t ticket_len)
+{
+	struct ticket_entry *entry;
+	int err;
+
+	if ((hostname == NULL) || (ticket == NULL) || (ticket_len == 0)) {
+		return -EINVAL;
+	}
+
+	if ((ticket_len > CONFIG_TLS_SESSION_TICKET_STORE_TICKET_MAX_SIZE) ||
+	    (strlen(hostname) >= CONFIG_TLS_SESSION_TICKET_STORE_HOSTNAME_MAX_LEN)) {
+		return -EFBIG;
+	}
+
+	k_mutex_lock(&entry_lock, K_FOREVER);
+
+	entry = entry_get(sec_tag, hostname);
+	if (entry == NULL) {
+		entry = entry_allocate();
+	}
+
+	entry->data.sec_tag = sec_tag;
+	strcpy(entry->data.hostname, hostname);
+	memcpy(entry->data.ticket, ticket, ticket_len);
+	entry->data.ticket_len = ticket_len;
+	entry->last_used = k_uptime_get();
+	entry->valid = true;
+
+	err = entry_settings_save(entry);
+	if (err) {
+		LOG_WRN("Failed to persist ticket: %d", err);
+		err = 0;
+	}
+
+	k_mutex_unlock(&entry_lock);
+
+	return err;
+}
+
+int tls_session_ticket_store_load(sec_tag_t sec_tag, const char *hostname, void *ticket,
+				  size_t *ticket_len)
+{
+	struct ticket_entry *entry;
+	int err = 0;
+
+	if ((hostname == NULL) || (ticket == NULL) || (ticket_len == NULL)) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&entry_lock, K_FOREVER);
+
+	entry = entry_get(sec_tag, hostname);
+	if (entry == NULL) {
+		err = -ENOENT;
+		goto exit;
+	}
+
+	if (entry->data.ticket_len > *ticket_len) {
+		err = -EFBIG;
+		goto exit;
+	}
+
+	*ticket_len = entry->data.ticket_len;
+	memcpy(ticket, entry->data.ticket, entry->data.ticket_len);
+
+	entry->last_used = k_uptime_get();
+
+exit:
+	k_mutex_unlock(&entry_lock);
+
+	return err;
+}
+
+int tls_session_ticket_store_delete(sec_tag_t sec_tag, const char *hostname)
+{
+	struct ticket_entry *entry;
+	int err = 0;
+
+	if (hostname == NULL) {
+		return -EINVAL;
+	}
+
+	k_mutex_lock(&entry_lock, K_FOREVER);
+
+	entry = entry_get(sec_tag, hostname);
+	if (entry == NULL) {
+		err = -ENOENT;
+		goto exit;
+	}
+
+	entry->valid = false;
+
+	err = entry_settings_delete(entry);
+	if (err) {
+		LOG_WRN("Failed to delete persisted ticket: %d", err);
+		err = 0;
+	}
+
+exit:
+	k_mutex_unlock(&entry_lock);
+
+	return err;
+}
+
+int tls_session_ticket_store_clear(void)
+{
+	k_mutex_lock(&entry_lock, K_FOREVER);
+
+	for (int i = 0; i < ARRAY_SIZE(entries); i++) {
+		if (entries[i].valid) {
+			entries[i].valid = false;
+			(void)entry_settings_delete(&entries[i]);
+		}
+	}
+
+	k_mutex_unlock(&entry_lock);
+
+	return 0;
+}
@@ -63,19 +63,34 @@ enum wifi_enterprise_cert_sec_tags {
 
 int wifi_prov_get_info(struct net_buf_simple *info)
 {
-	int rc;
-	Info prov_info = Info_init_zero;
-	pb_ostream_t ostream;
+	/* The Info message content is fixed, so it is encoded once and the
+	 * cached encoding is served to every reader.
+	 */
+	static uint8_t info_cache[INFO_MSG_MAX_LENGTH];
+	static size_t info_cache_len;
 
-	prov_info.version = PROV_SVC_VER;
-	ostream = pb_ostream_from_buffer(info->data, info->size);
+	if (info_cache_len == 0) {
+		int rc;
+		Info prov_info = Info_init_zero;
+		pb_ostream_t ostream;
 
-	rc = pb_encode(&ostream, Info_fields, &prov_info);
-	if (rc == false) {
-		return -EIO;
+		prov_info.version = PROV_SVC_VER;
+		ostream = pb_ostream_from_buffer(info_cache, sizeof(info_cache));
+
+		rc = pb_encode(&ostream, Info_fields, &prov_info);
+		if (rc == false) {
+			return -EIO;
+		}
+
+		info_cache_len = ostream.bytes_written;
+	}
+
+	if (info->size < info_cache_len) {
+		return -EMSGSIZE;
 	}
 
-	info->len = ostream.bytes_written;
+	memcpy(info->data, info_cache, info_cache_len);
+	info->len = info_cache_len;
 	return 0;
 }
 
@@ -612,51 +627,72 @@ static void handle_wifi_scan_result(struct net_mgmt_event_callback *cb)
 	wifi_prov_send_result(&scan_result_stream);
 }
 
-/* Callback for connect result. */
-static void handle_wifi_connect_result(struct net_mgmt_event_callback *cb)
+/* Send a connection state Result message. The encoding of each state is
+ * constant, so it is produced once and the cached encoding is reused for
+ * every subsequent connection attempt.
+ */
+static void send_state_update(ConnectionState conn_state)
 {
-	int rc;
-	const struct wifi_status *status =
-		(const struct wifi_status *) cb->info;
-	Result state_update = Result_init_zero;
-	pb_ostream_t ostream;
+	static struct {
+		ConnectionState conn_state;
+		size_t len;
+		uint8_t buf[RESULT_MSG_MAX_LENGTH];
+	} cache[5];
+	static size_t cache_count;
+	struct net_buf_simple state_stream;
+	size_t i;
+
+	for (i = 0; i < cache_count; i++) {
+		if (cache[i].conn_state == conn_state) {
+			break;
+		}
+	}
 
-	NET_BUF_SIMPLE_DEFINE(state_stream, RESULT_MSG_MAX_LENGTH);
-	ConnectionState success_state_sequence[] = {ConnectionState_AUTHENTICATION,
-						ConnectionState_ASSOCIATION,
-						ConnectionState_OBTAINING_IP,
-						ConnectionState_CONNECTED};
+	if (i == cache_count) {
+		int rc;
+		Result state_update = Result_init_zero;
+		pb_ostream_t ostream;
+
+		if (cache_count == ARRAY_SIZE(cache)) {
+			LOG_ERR("State result cache full");
+			return;
+		}
 
-	if (status->status != 0) {
 		state_update.has_scan_record = false;
 		state_update.has_state = true;
-		state_update.state = ConnectionState_CONNECTION_FAILED;
-		ostream = pb_ostream_from_buffer(state_stream.data, state_stream.size);
+		state_update.state = conn_state;
+		ostream = pb_ostream_from_buffer(cache[i].buf, sizeof(cache[i].buf));
 
 		rc = pb_encode(&ostream, Result_fields, &state_update);
-
 		if (!rc) {
 			LOG_ERR("Encoding failed: %s.", PB_GET_ERROR(&ostream));
 			return;
 		}
-		state_stream.len = ostream.bytes_written;
-		wifi_prov_send_result(&state_stream);
+
+		cache[i].conn_state = conn_state;
+		cache[i].len = ostream.bytes_written;
+		cache_count++;
+	}
+
+	net_buf_simple_init_with_data(&state_stream, cache[i].buf, cache[i].len);
+	wifi_prov_send_result(&state_stream);
+}
+
+/* Callback for connect result. */
+static void handle_wifi_connect_result(struct net_mgmt_event_callback *cb)
+{
+	const struct wifi_status *status =
+		(const struct wifi_status *) cb->info;
+	ConnectionState success_state_sequence[] = {ConnectionState_AUTHENTICATION,
+						ConnectionState_ASSOCIATION,
+						ConnectionState_OBTAINING_IP,
+						ConnectionState_CONNECTED};
+
+	if (status->status != 0) {
+		send_state_update(ConnectionState_CONNECTION_FAILED);
 	} else {
 		for (int i = 0; i < ARRAY_SIZE(success_state_sequence); i++) {
-			/* Reset it before reuse of net_buf_simple. */
-			net_buf_simple_reset(&state_stream);
-			state_update.has_scan_record = false;
-			state_update.has_state = true;
-			state_update.state = success_state_sequence[i];
-			ostream = pb_ostream_from_buffer(state_stream.data, state_stream.size);
-
-			rc = pb_encode(&ostream, Result_fields, &state_update);
-			if (!rc) {
-				LOG_ERR("Encoding failed: %s.", PB_GET_ERROR(&ostream));
-				return;
-			}
-			state_stream.len = ostream.bytes_written;
-			wifi_prov_send_result(&state_stream);
+			send_state_update(success_state_sequence[i]);
 		}
 		if (config_buf.header.ssid_len) {
 			if (!save_config_to_ram) {
@@ -76,6 +76,22 @@ static void ncm_work_handler(struct k_work *work)
 	k_work_reschedule(&ncm_work, K_MSEC(NET_CORE_CHECK_INTERVAL_MSEC));
 }
 
+#ifdef CONFIG_NCM_CPU_LOAD
+int ncm_net_core_cpu_load_get(uint8_t *load_percent)
+{
+	uint32_t gpmem;
+
+	if (load_percent == NULL) {
+		return -EINVAL;
+	}
+
+	gpmem = nrfx_ipc_gpmem_get(IPC_MEM_CNT_IDX);
+	*load_percent = (uint8_t)((gpmem & LOAD_MSK) >> LOAD_POS);
+
+	return 0;
+}
+#endif
+
 __weak void ncm_net_core_event_handler(enum ncm_event_type event, uint32_t reset_reas)
 {
 	switch (event) {
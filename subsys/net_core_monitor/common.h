@@ -14,7 +14,9 @@ extern "C" {
 #define CNT_POS      (0UL)                  /* Position of Counter field. */
 #define CNT_MSK      (0xFFFF << CNT_POS)    /* Bit mask of Counter field. */
 #define FLAGS_POS    (16UL)                 /* Position of Flags field. */
-#define FLAGS_MSK    (0xFFFF << FLAGS_POS)  /* Bit mask of Flags field. */
+#define FLAGS_MSK    (0xFF << FLAGS_POS)    /* Bit mask of Flags field. */
+#define LOAD_POS     (24UL)                 /* Position of CPU load field. */
+#define LOAD_MSK     (0xFF << LOAD_POS)     /* Bit mask of CPU load field. */
 #define FLAGS_RESET  BIT(0)                 /* Reset bit. */
 #define CNT_INIT_VAL (0x0055)               /* Initialization value for counter. */
 
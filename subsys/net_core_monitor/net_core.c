@@ -11,6 +11,10 @@
 #include <hal/nrf_reset.h>
 #include "common.h"
 
+#ifdef CONFIG_NCM_CPU_LOAD
+#include <debug/cpu_load.h>
+#endif
+
 #include <zephyr/logging/log.h>
 
 LOG_MODULE_REGISTER(net_core_monitor, CONFIG_NET_CORE_MONITOR_LOG_LEVEL);
@@ -32,6 +36,19 @@ static void ncm_work_handler(struct k_work *work)
 
 	live_cnt++;
 	gpmem = (gpmem & (~CNT_MSK)) | (live_cnt << CNT_POS);
+
+#ifdef CONFIG_NCM_CPU_LOAD
+	int load = cpu_load_get();
+
+	if (load >= 0) {
+		/* Scale from 0.001 % units to whole percent. */
+		gpmem = (gpmem & (~LOAD_MSK)) | (((uint32_t)(load / 1000)) << LOAD_POS);
+	}
+
+	/* Reset so that every feeding interval reports a fresh window. */
+	cpu_load_reset();
+#endif
+
 	APP_IPC_GPMEM[IPC_MEM_CNT_IDX] = gpmem;
 
 	k_work_reschedule(&ncm_work, K_MSEC(CONFIG_NCM_FEEDING_INTERVAL_MSEC));
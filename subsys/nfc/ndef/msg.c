@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
  */
 
+#include <string.h>
 #include <nfc/ndef/msg.h>
 #include <zephyr/sys/byteorder.h>
 #include <zephyr/sys/util.h>
@@ -73,6 +74,81 @@ int nfc_ndef_msg_encode(struct nfc_ndef_msg_desc const *ndef_msg_desc, uint8_t *
 	return 0;
 }
 
+int nfc_ndef_msg_frags_encode(struct nfc_ndef_msg_desc const *ndef_msg_desc,
+			      uint8_t *aux_buffer, uint32_t *aux_len,
+			      struct nfc_ndef_frag *frag_list, uint32_t *frag_count,
+			      uint32_t *msg_len)
+{
+	uint32_t aux_used = 0;
+	uint32_t frags_used = 0;
+	uint32_t sum_of_len = 0;
+
+	if (!ndef_msg_desc || !aux_buffer || !aux_len || !frag_list ||
+	    !frag_count || !msg_len) {
+		return -EINVAL;
+	}
+
+	struct nfc_ndef_record_desc const **pp_record_rec_desc = ndef_msg_desc->record;
+
+	if (!ndef_msg_desc->record) {
+		return -EINVAL;
+	}
+
+	for (uint32_t i = 0; i < ndef_msg_desc->record_count; i++) {
+		enum nfc_ndef_record_location record_location;
+		uint32_t temp_aux_len = *aux_len - aux_used;
+		uint32_t temp_frag_count = *frag_count - frags_used;
+		uint32_t temp_len;
+		int err;
+
+		record_location = record_location_get(i, ndef_msg_desc->record_count);
+
+		err = nfc_ndef_record_frags_encode(*pp_record_rec_desc, record_location,
+						   &aux_buffer[aux_used], &temp_aux_len,
+						   &frag_list[frags_used], &temp_frag_count,
+						   &temp_len);
+		if (err) {
+			return err;
+		}
+
+		aux_used += temp_aux_len;
+		frags_used += temp_frag_count;
+		sum_of_len += temp_len;
+
+		/* next record */
+		pp_record_rec_desc++;
+	}
+
+	*aux_len = aux_used;
+	*frag_count = frags_used;
+	*msg_len = sum_of_len;
+
+	return 0;
+}
+
+int nfc_ndef_msg_frags_copy(const struct nfc_ndef_frag *frag_list, uint32_t frag_count,
+			    uint8_t *msg_buffer, uint32_t *msg_len)
+{
+	uint32_t pos = 0;
+
+	if (!frag_list || !msg_buffer || !msg_len) {
+		return -EINVAL;
+	}
+
+	for (uint32_t i = 0; i < frag_count; i++) {
+		if ((pos + frag_list[i].length) > *msg_len) {
+			return -ENOSR;
+		}
+
+		memcpy(&msg_buffer[pos], frag_list[i].data, frag_list[i].length);
+		pos += frag_list[i].length;
+	}
+
+	*msg_len = pos;
+
+	return 0;
+}
+
 void nfc_ndef_msg_clear(struct nfc_ndef_msg_desc *msg)
 {
 	msg->record_count = 0;
@@ -28,6 +28,55 @@ static uint32_t record_header_size_calc(struct nfc_ndef_record_desc const *ndef_
 	return len;
 }
 
+static int record_header_encode(struct nfc_ndef_record_desc const *ndef_record_desc,
+				enum nfc_ndef_record_location const record_location,
+				uint8_t *record_buffer, uint32_t record_len,
+				uint8_t **payload_len_field)
+{
+	uint8_t *flags; /* use as pointer to TNF + flags field */
+
+	/* verify location range */
+	if (record_location & (~NDEF_RECORD_LOCATION_MASK)) {
+		return -EINVAL;
+	}
+	/* verify if there is enough available memory */
+	if (record_header_size_calc(ndef_record_desc) > record_len) {
+		return -ENOSR;
+	}
+
+	flags = record_buffer;
+	record_buffer++;
+
+	/* set location bits and clear other bits in 1st byte. */
+	*flags = record_location;
+	*flags |= ndef_record_desc->tnf;
+
+	/* TYPE LENGTH */
+	*record_buffer = ndef_record_desc->type_length;
+	record_buffer++;
+	/* use always long record and remember payload len field memory
+	 * offset.
+	 */
+	*payload_len_field = record_buffer;
+	record_buffer += NDEF_RECORD_PAYLOAD_LEN_LONG_SIZE;
+	/* ID LENGTH - option */
+	if (ndef_record_desc->id_length > 0) {
+		*record_buffer = ndef_record_desc->id_length;
+		record_buffer++;
+		/* IL flag */
+		*flags |= NDEF_RECORD_IL_MASK;
+	}
+	/* TYPE */
+	memcpy(record_buffer, ndef_record_desc->type, ndef_record_desc->type_length);
+	record_buffer += ndef_record_desc->type_length;
+	/* ID */
+	if (ndef_record_desc->id_length > 0) {
+		memcpy(record_buffer, ndef_record_desc->id, ndef_record_desc->id_length);
+	}
+
+	return 0;
+}
+
 int nfc_ndef_record_encode(struct nfc_ndef_record_desc const *ndef_record_desc,
 			   enum nfc_ndef_record_location const record_location,
 			   uint8_t *record_buffer, uint32_t *record_len)
@@ -43,47 +92,16 @@ int nfc_ndef_record_encode(struct nfc_ndef_record_desc const *ndef_record_desc,
 	uint32_t record_header_len = record_header_size_calc(ndef_record_desc);
 
 	if (record_buffer) {
-		uint8_t *flags; /* use as pointer to TNF + flags field */
+		int err;
 
-		/* verify location range */
-		if (record_location & (~NDEF_RECORD_LOCATION_MASK)) {
-			return -EINVAL;
-		}
-		/* verify if there is enough available memory */
-		if (record_header_len > *record_len) {
-			return -ENOSR;
+		err = record_header_encode(ndef_record_desc, record_location,
+					   record_buffer, *record_len, &payload_len);
+		if (err) {
+			return err;
 		}
 
-		flags = record_buffer;
-		record_buffer++;
-
-		/* set location bits and clear other bits in 1st byte. */
-		*flags = record_location;
-		*flags |= ndef_record_desc->tnf;
+		record_buffer += record_header_len;
 
-		/* TYPE LENGTH */
-		*record_buffer = ndef_record_desc->type_length;
-		record_buffer++;
-		/* use always long record and remember payload len field memory
-		 * offset.
-		 */
-		payload_len = record_buffer;
-		record_buffer += NDEF_RECORD_PAYLOAD_LEN_LONG_SIZE;
-		/* ID LENGTH - option */
-		if (ndef_record_desc->id_length > 0) {
-			*record_buffer = ndef_record_desc->id_length;
-			record_buffer++;
-			/* IL flag */
-			*flags |= NDEF_RECORD_IL_MASK;
-		}
-		/* TYPE */
-		memcpy(record_buffer, ndef_record_desc->type, ndef_record_desc->type_length);
-		record_buffer += ndef_record_desc->type_length;
-		/* ID */
-		if (ndef_record_desc->id_length > 0) {
-			memcpy(record_buffer, ndef_record_desc->id, ndef_record_desc->id_length);
-			record_buffer += ndef_record_desc->id_length;
-		}
 		/* count how much memory is left in record buffer for payload
 		 * field.
 		 */
@@ -115,6 +133,90 @@ int nfc_ndef_record_encode(struct nfc_ndef_record_desc const *ndef_record_desc,
 	return 0;
 }
 
+int nfc_ndef_record_frags_encode(struct nfc_ndef_record_desc const *ndef_record_desc,
+				 enum nfc_ndef_record_location const record_location,
+				 uint8_t *aux_buffer, uint32_t *aux_len,
+				 struct nfc_ndef_frag *frag_list, uint32_t *frag_count,
+				 uint32_t *record_len)
+{
+	/* Use as pointer to payload length field. */
+	uint8_t *payload_len = NULL;
+	uint32_t record_payload_len;
+	uint32_t frags_used = 1;
+	int err;
+
+	if (!ndef_record_desc || !aux_buffer || !aux_len || !frag_list ||
+	    !frag_count || !record_len) {
+		return -EINVAL;
+	}
+
+	/* count record length without payload */
+	uint32_t record_header_len = record_header_size_calc(ndef_record_desc);
+
+	if (*frag_count < 1) {
+		return -ENOSR;
+	}
+
+	err = record_header_encode(ndef_record_desc, record_location,
+				   aux_buffer, *aux_len, &payload_len);
+	if (err) {
+		return err;
+	}
+
+	frag_list[0].data = aux_buffer;
+	frag_list[0].length = record_header_len;
+
+	/* PAYLOAD */
+	if (ndef_record_desc->tnf == TNF_EMPTY) {
+		record_payload_len = 0;
+	} else if (ndef_record_desc->payload_constructor ==
+		   (payload_constructor_t)nfc_ndef_bin_payload_memcopy) {
+		/* Binary payloads are referenced in place instead of being
+		 * copied to the auxiliary buffer.
+		 */
+		struct nfc_ndef_bin_payload_desc *payload_desc =
+			ndef_record_desc->payload_descriptor;
+
+		record_payload_len = payload_desc->payload_length;
+
+		if (record_payload_len > 0) {
+			if (*frag_count < 2) {
+				return -ENOSR;
+			}
+
+			frag_list[1].data = payload_desc->payload;
+			frag_list[1].length = record_payload_len;
+			frags_used = 2;
+		}
+	} else if (ndef_record_desc->payload_constructor) {
+		/* Constructed payloads are built into the auxiliary buffer,
+		 * directly after the record header, and emitted as part of
+		 * the header fragment.
+		 */
+		record_payload_len = *aux_len - record_header_len;
+
+		err = ndef_record_desc->payload_constructor(ndef_record_desc->payload_descriptor,
+							    &aux_buffer[record_header_len],
+							    &record_payload_len);
+		if (err) {
+			return err;
+		}
+
+		frag_list[0].length += record_payload_len;
+	} else {
+		return -EINVAL;
+	}
+
+	/* PAYLOAD LENGTH */
+	*(uint32_t *)payload_len = sys_cpu_to_be32(record_payload_len);
+
+	*aux_len = frag_list[0].length;
+	*frag_count = frags_used;
+	*record_len = record_header_len + record_payload_len;
+
+	return 0;
+}
+
 int nfc_ndef_bin_payload_memcopy(struct nfc_ndef_bin_payload_desc *payload_descriptor,
 				 uint8_t *buffer, uint32_t *len)
 {
@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+#include <nfc/t4t/ndef_update.h>
+
+/* The emulated NDEF file buffer is owned by the Type 4 Tag library once it
+ * is registered with nfc_t4t_ndef_rwpayload_set(). The buffer is swapped
+ * only while no reader is in the field, so a reader session always
+ * operates on a single, consistent snapshot of the tag content.
+ */
+static struct {
+	uint8_t *buf[2];
+	uint32_t buf_size;
+	/* Index of the buffer currently emulated by the Type 4 Tag library.
+	 * Modified only by the swap winner, see swap_apply().
+	 */
+	uint8_t front;
+	atomic_t commit_pending;
+	atomic_t in_field;
+	bool initialized;
+} update_ctx;
+
+/* Swap in the back buffer if a commit is pending. May be called both from
+ * the thread committing an update and from the Type 4 Tag library callback
+ * (interrupt context). The atomic test-and-clear ensures that exactly one
+ * of the racing contexts performs the swap.
+ */
+static int swap_apply(void)
+{
+	int err = 0;
+
+	if (atomic_cas(&update_ctx.commit_pending, 1, 0)) {
+		uint8_t back = update_ctx.front ^ 1;
+		unsigned int key = irq_lock();
+
+		/* A field on event may have been delivered after the caller
+		 * decided to swap. The field events arrive in interrupt
+		 * context, so the state is stable under the interrupt lock:
+		 * if a reader is in the field by now, re-arm the commit and
+		 * defer the swap to the field off event.
+		 */
+		if (atomic_get(&update_ctx.in_field)) {
+			atomic_set(&update_ctx.commit_pending, 1);
+			irq_unlock(key);
+
+			return 0;
+		}
+
+		err = nfc_t4t_ndef_rwpayload_set(update_ctx.buf[back],
+						 update_ctx.buf_size);
+		if (!err) {
+			update_ctx.front = back;
+		}
+
+		irq_unlock(key);
+	}
+
+	return err;
+}
+
+int nfc_t4t_ndef_update_init(uint8_t *buf_a, uint8_t *buf_b, uint32_t buf_size)
+{
+	int err;
+
+	if (!buf_a || !buf_b || (buf_a == buf_b) || !buf_size) {
+		return -EINVAL;
+	}
+
+	err = nfc_t4t_ndef_rwpayload_set(buf_a, buf_size);
+	if (err) {
+		return err;
+	}
+
+	update_ctx.buf[0] = buf_a;
+	update_ctx.buf[1] = buf_b;
+	update_ctx.buf_size = buf_size;
+	update_ctx.front = 0;
+	atomic_set(&update_ctx.commit_pending, 0);
+	atomic_set(&update_ctx.in_field, 0);
+	update_ctx.initialized = true;
+
+	return 0;
+}
+
+uint8_t *nfc_t4t_ndef_update_buf_get(void)
+{
+	if (!update_ctx.initialized ||
+	    atomic_get(&update_ctx.commit_pending)) {
+		return NULL;
+	}
+
+	return update_ctx.buf[update_ctx.front ^ 1];
+}
+
+int nfc_t4t_ndef_update_commit(void)
+{
+	if (!update_ctx.initialized) {
+		return -EACCES;
+	}
+
+	atomic_set(&update_ctx.commit_pending, 1);
+
+	/* Defer the swap to the field off event if a reader is in the
+	 * field. A field on event racing with this check is caught by the
+	 * re-check under the interrupt lock in swap_apply().
+	 */
+	if (atomic_get(&update_ctx.in_field)) {
+		return 0;
+	}
+
+	return swap_apply();
+}
+
+void nfc_t4t_ndef_update_event_forward(nfc_t4t_event_t event)
+{
+	if (!update_ctx.initialized) {
+		return;
+	}
+
+	switch (event) {
+	case NFC_T4T_EVENT_FIELD_ON:
+		atomic_set(&update_ctx.in_field, 1);
+		break;
+
+	case NFC_T4T_EVENT_FIELD_OFF:
+		atomic_set(&update_ctx.in_field, 0);
+		(void)swap_apply();
+		break;
+
+	default:
+		break;
+	}
+}
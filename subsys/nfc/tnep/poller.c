@@ -39,6 +39,15 @@ enum tnep_poller_state {
 	TNEP_POLLER_STATE_UPDATING
 };
 
+struct tnep_stream {
+	struct nfc_ndef_record_desc record;
+	struct nfc_ndef_bin_payload_desc payload;
+	const uint8_t *data;
+	size_t len;
+	size_t offset;
+	bool active;
+};
+
 struct tnep_poller {
 	struct k_work_delayable tnep_work;
 	const struct nfc_tnep_buf *rx;
@@ -47,6 +56,7 @@ struct tnep_poller {
 	const struct nfc_ndef_tnep_rec_svc_param *active_svc;
 	const struct nfc_tnep_poller_cb *cb;
 	const struct nfc_tnep_poller_ndef_api *api;
+	struct tnep_stream stream;
 	sys_slist_t callback_list;
 	int64_t last_time;
 	enum tnep_poller_state state;
@@ -296,6 +306,63 @@ static void tnep_delay_handler(struct k_work *work)
 	}
 }
 
+static int stream_chunk_write(void)
+{
+	int err;
+	size_t len = 0;
+	size_t msg_size;
+	size_t header_len;
+	size_t chunk;
+
+	NFC_NDEF_MSG_DEF(stream_msg, TNEP_SELECT_MSG_RECORD_CNT);
+
+	/* The NDEF Message with a chunk must fit in the Tx buffer and in
+	 * the Maximum NDEF Message size of the selected service.
+	 */
+	msg_size = tnep.tx->size;
+	if (tnep.type == NFC_TNEP_TAG_TYPE_T4T) {
+		msg_size = nfc_t4t_ndef_file_msg_size_get(msg_size);
+	}
+
+	msg_size = MIN(msg_size, tnep.active_svc->max_size);
+
+	/* Chunk record header: TNF-flags, Type Length, Payload Length and
+	 * Type field. The record carries no ID field.
+	 */
+	header_len = 2 + NDEF_RECORD_PAYLOAD_LEN_LONG_SIZE +
+		     tnep.stream.record.type_length;
+	if (msg_size <= header_len) {
+		LOG_ERR("No space left for stream data in the NDEF Message");
+		return -ENOMEM;
+	}
+
+	chunk = MIN(msg_size - header_len,
+		    tnep.stream.len - tnep.stream.offset);
+
+	tnep.stream.payload.payload = &tnep.stream.data[tnep.stream.offset];
+	tnep.stream.payload.payload_length = chunk;
+
+	nfc_ndef_msg_clear(&NFC_NDEF_MSG(stream_msg));
+	err = nfc_ndef_msg_record_add(&NFC_NDEF_MSG(stream_msg),
+				      &tnep.stream.record);
+	if (err) {
+		LOG_ERR("Stream chunk record cannot be added to the NDEF message");
+		return err;
+	}
+
+	err = tnep_tag_update_prepare(&NFC_NDEF_MSG(stream_msg), &len);
+	if (err) {
+		LOG_ERR("TNEP NDEF Update prepare error");
+		return err;
+	}
+
+	tnep.stream.offset += chunk;
+	tnep.state = TNEP_POLLER_STATE_UPDATING;
+
+	/* Call API to send Update Request. */
+	return tnep.api->ndef_update(tnep.tx->data, len);
+}
+
 static int on_ndef_read_cb(struct nfc_tnep_poller_msg *poller_msg, bool timeout)
 {
 	switch (tnep.state) {
@@ -312,6 +379,29 @@ static int on_ndef_read_cb(struct nfc_tnep_poller_msg *poller_msg, bool timeout)
 		break;
 
 	case TNEP_POLLER_STATE_UPDATING:
+		/* Pipeline the next stream chunk without going through the
+		 * application. The application is notified once, after the
+		 * whole stream is written or on the first failure.
+		 */
+		if (tnep.stream.active) {
+			if (!timeout &&
+			    (poller_msg->status == NFC_TNEP_STATUS_SUCCESS) &&
+			    (tnep.stream.offset < tnep.stream.len)) {
+				int err;
+
+				err = stream_chunk_write();
+				if (!err) {
+					return 0;
+				}
+
+				tnep.stream.active = false;
+
+				return err;
+			}
+
+			tnep.stream.active = false;
+		}
+
 		svc_sent_notify(tnep.active_svc, poller_msg,
 				timeout);
 
@@ -454,6 +544,7 @@ int nfc_tnep_poller_svc_select(const struct nfc_tnep_buf *svc_buf,
 	}
 
 	tnep.state = TNEP_POLLER_STATE_SELECTING;
+	tnep.stream.active = false;
 
 	/* If service is currently selected do not select it twice. */
 	if (svc == tnep.active_svc) {
@@ -534,6 +625,7 @@ int nfc_tnep_poller_svc_deselect(void)
 	}
 
 	tnep.state = TNEP_POLLER_STATE_DESELECTING;
+	tnep.stream.active = false;
 
 	/* Call API to send Update Request. */
 	return tnep.api->ndef_update(tnep.tx->data, len);
@@ -590,6 +682,7 @@ int nfc_tnep_poller_svc_write(const struct nfc_ndef_msg_desc *msg,
 
 	tnep.rx = resp_buf;
 	tnep.state = TNEP_POLLER_STATE_UPDATING;
+	tnep.stream.active = false;
 
 	err = tnep_tag_update_prepare(msg, &len);
 	if (err) {
@@ -601,6 +694,47 @@ int nfc_tnep_poller_svc_write(const struct nfc_ndef_msg_desc *msg,
 	return tnep.api->ndef_update(tnep.tx->data, len);
 }
 
+int nfc_tnep_poller_svc_stream_write(const struct nfc_tnep_poller_stream *stream,
+				     const struct nfc_tnep_buf *resp_buf)
+{
+	if (!stream || !resp_buf) {
+		return -EINVAL;
+	}
+
+	if (!stream->data || (stream->len < 1)) {
+		LOG_ERR("No stream data provided");
+		return -EINVAL;
+	}
+
+	if (!resp_buf->data || (resp_buf->size < 1)) {
+		LOG_ERR("Invalid response buffer provided");
+		return -EINVAL;
+	}
+
+	if (!tnep.active_svc) {
+		LOG_ERR("No service is selected");
+		return -EACCES;
+	}
+
+	tnep.rx = resp_buf;
+
+	tnep.stream.record.tnf = stream->tnf;
+	tnep.stream.record.id_length = 0;
+	tnep.stream.record.id = NULL;
+	tnep.stream.record.type_length = stream->type_length;
+	tnep.stream.record.type = stream->type;
+	tnep.stream.record.payload_constructor =
+		(payload_constructor_t)nfc_ndef_bin_payload_memcopy;
+	tnep.stream.record.payload_descriptor = &tnep.stream.payload;
+
+	tnep.stream.data = stream->data;
+	tnep.stream.len = stream->len;
+	tnep.stream.offset = 0;
+	tnep.stream.active = true;
+
+	return stream_chunk_write();
+}
+
 int nfc_tnep_poller_on_ndef_read(const uint8_t *data, size_t len)
 {
 	int err;
@@ -36,23 +36,95 @@ LOG_MODULE_REGISTER(nrf_compress_lzma, CONFIG_NRF_COMPRESS_LOG_LEVEL);
 	"CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA1 or CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2"
 #endif
 
-#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_STATIC)
-static uint16_t lzma_probs[MAX_LZMA_PROB_SIZE];
+#ifdef CONFIG_NRF_COMPRESS_CLEANUP
+/* Replacement for memset(p, 0, sizeof(*p) that does not get
+ * optimized out.
+ */
+static void like_mbedtls_zeroize(void *p, size_t n)
+{
+	volatile unsigned char *v = (unsigned char *)p;
+
+	for (size_t i = 0; i < n; i++) {
+		v[i] = 0;
+	}
+}
 #endif
 
-#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC) && defined(CONFIG_NRF_COMPRESS_CLEANUP)
-static size_t malloc_probs_size = 0;
+#if !defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
+
+/* Decompression context for one stream. Several streams can be decompressed interleaved, each
+ * identified by the inst pointer given to the init function.
+ */
+struct lzma_instance {
+	/** Per-instance probability array allocator; the callbacks recover the instance from it. */
+	ISzAlloc probs_allocator;
+
+#ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
+	CLzma2Dec lzma_decoder;
+#else
+	CLzmaDec lzma_decoder;
 #endif
 
+#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_STATIC)
+	uint16_t lzma_probs[MAX_LZMA_PROB_SIZE];
+#if CONFIG_NRF_COMPRESS_MEMORY_ALIGNMENT > 1
+	uint8_t __aligned(CONFIG_NRF_COMPRESS_MEMORY_ALIGNMENT) lzma_dict[MAX_LZMA_DICT_SIZE];
+#else
+	uint8_t lzma_dict[MAX_LZMA_DICT_SIZE];
+#endif
+#else
+#ifdef CONFIG_NRF_COMPRESS_CLEANUP
+	size_t malloc_probs_size;
+#endif
+	uint8_t *lzma_dict;
+#endif
+
+	size_t lzma_output_limit;
+	bool allocated_probs;
+
+	/** Identifier given by the user on init, used to look the instance up. */
+	void *user_inst;
+	bool in_use;
+};
+
+static struct lzma_instance instances[CONFIG_NRF_COMPRESS_LZMA_INSTANCE_COUNT];
+
+/**
+ * @brief Find the instance associated with a user identifier, optionally claiming a free slot.
+ */
+static struct lzma_instance *instance_get(void *inst, bool claim)
+{
+	struct lzma_instance *free_slot = NULL;
+
+	for (int i = 0; i < ARRAY_SIZE(instances); i++) {
+		if (instances[i].in_use && instances[i].user_inst == inst) {
+			return &instances[i];
+		} else if (!instances[i].in_use && free_slot == NULL) {
+			free_slot = &instances[i];
+		}
+	}
+
+	if (claim && free_slot != NULL) {
+		free_slot->in_use = true;
+		free_slot->user_inst = inst;
+		return free_slot;
+	}
+
+	return NULL;
+}
+
 static void *lzma_probs_alloc(ISzAllocPtr p, size_t size)
 {
+	struct lzma_instance *instance =
+		CONTAINER_OF((ISzAlloc *)p, struct lzma_instance, probs_allocator);
+
 #if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_STATIC)
-	if (size > sizeof(lzma_probs)) {
+	if (size > sizeof(instance->lzma_probs)) {
 		LOG_ERR("Compress library tried to allocate too large a buffer (0x%x)", size);
 		return NULL;
 	}
 
-	return lzma_probs;
+	return instance->lzma_probs;
 #else
 	void *buffer = malloc(size);
 
@@ -60,7 +132,7 @@ static void *lzma_probs_alloc(ISzAllocPtr p, size_t size)
 		LOG_ERR("Failed to allocate nRF compression library buffer (0x%x)", size);
 #ifdef CONFIG_NRF_COMPRESS_CLEANUP
 	} else {
-		malloc_probs_size = size;
+		instance->malloc_probs_size = size;
 #endif
 	}
 
@@ -68,20 +140,323 @@ static void *lzma_probs_alloc(ISzAllocPtr p, size_t size)
 #endif
 }
 
+static void lzma_probs_free(ISzAllocPtr p, void *address)
+{
+	struct lzma_instance *instance =
+		CONTAINER_OF((ISzAlloc *)p, struct lzma_instance, probs_allocator);
+
+#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC)
 #ifdef CONFIG_NRF_COMPRESS_CLEANUP
-/* Replacement for memset(p, 0, sizeof(*p) that does not get
- * optimized out.
- */
-static void like_mbedtls_zeroize(void *p, size_t n)
+	if (address == NULL) {
+		return;
+	}
+
+	if (instance->malloc_probs_size > 0) {
+		like_mbedtls_zeroize(address, instance->malloc_probs_size);
+		instance->malloc_probs_size = 0;
+	}
+
+#endif
+	free(address);
+#else
+#ifdef CONFIG_NRF_COMPRESS_CLEANUP
+	like_mbedtls_zeroize(instance->lzma_probs, sizeof(instance->lzma_probs));
+#else
+	ARG_UNUSED(instance);
+#endif
+#endif
+}
+
+static int lzma_reset(void *inst, size_t decompressed_size);
+
+static int lzma_init(void *inst, size_t decompressed_size)
 {
-	volatile unsigned char *v = (unsigned char *)p;
+	int rc = 0;
+	struct lzma_instance *instance = instance_get(inst, true);
 
-	for (size_t i = 0; i < n; i++) {
-		v[i] = 0;
+	if (instance == NULL) {
+		LOG_ERR("No free LZMA decompression instance");
+		return -EBUSY;
+	}
+
+	instance->probs_allocator.Alloc = lzma_probs_alloc;
+	instance->probs_allocator.Free = lzma_probs_free;
+
+#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC)
+	if (instance->lzma_dict != NULL) {
+		/* Already allocated */
+		lzma_reset(inst, decompressed_size);
+
+		return rc;
+	}
+
+#if CONFIG_NRF_COMPRESS_MEMORY_ALIGNMENT > 1
+	instance->lzma_dict = (uint8_t *)aligned_alloc(CONFIG_NRF_COMPRESS_MEMORY_ALIGNMENT,
+						       MAX_LZMA_DICT_SIZE);
+#else
+	instance->lzma_dict = (uint8_t *)malloc(MAX_LZMA_DICT_SIZE);
+#endif
+
+	if (instance->lzma_dict == NULL) {
+		instance->in_use = false;
+		rc = -ENOMEM;
+		return rc;
+	}
+#endif
+
+	instance->lzma_output_limit = decompressed_size != 0 ? decompressed_size : SIZE_MAX;
+
+	return rc;
+}
+
+static int lzma_deinit(void *inst)
+{
+	int rc;
+	struct lzma_instance *instance = instance_get(inst, false);
+
+	if (instance == NULL) {
+		return -EINVAL;
+	}
+
+#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC)
+	if (instance->lzma_dict != NULL) {
+#ifdef CONFIG_NRF_COMPRESS_CLEANUP
+		memset(instance->lzma_dict, 0x00, MAX_LZMA_DICT_SIZE);
+#endif
+
+		free(instance->lzma_dict);
+		instance->lzma_dict = NULL;
+	}
+#endif
+	rc = lzma_reset(inst, 0);
+
+	instance->in_use = false;
+
+	return rc;
+}
+
+static int lzma_reset(void *inst, size_t decompressed_size)
+{
+	struct lzma_instance *instance = instance_get(inst, false);
+
+	if (instance == NULL) {
+		return -EINVAL;
+	}
+
+	if (instance->allocated_probs) {
+		instance->allocated_probs = false;
+
+#ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
+		Lzma2Dec_FreeProbs(&instance->lzma_decoder, &instance->probs_allocator);
+		instance->lzma_decoder.decoder.dicPos = 0;
+#else
+		LzmaDec_FreeProbs(&instance->lzma_decoder, &instance->probs_allocator);
+		instance->lzma_decoder.dicPos = 0;
+#endif
+	}
+
+	instance->lzma_output_limit = decompressed_size != 0 ? decompressed_size : SIZE_MAX;
+
+	return 0;
+}
+
+static size_t lzma_bytes_needed(void *inst)
+{
+	struct lzma_instance *instance = instance_get(inst, false);
+
+	if (instance == NULL) {
+		return 0;
+	}
+
+#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC)
+	if (instance->lzma_dict == NULL) {
+		return 0;
+	}
+#endif
+
+#ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
+	return (instance->allocated_probs ? CONFIG_NRF_COMPRESS_CHUNK_SIZE : LZMA2_HEADER_SIZE);
+#else
+	return (instance->allocated_probs ? CONFIG_NRF_COMPRESS_CHUNK_SIZE : LZMA_PROPS_SIZE);
+#endif
+}
+
+static int lzma_decompress(void *inst, const uint8_t *input, size_t input_size, bool last_part,
+			   uint32_t *offset, uint8_t **output, size_t *output_size)
+{
+	int rc;
+	ELzmaStatus status;
+	size_t chunk_size = input_size;
+	ELzmaFinishMode finish_mode = LZMA_FINISH_ANY;
+	SizeT dic_limit = MAX_LZMA_DICT_SIZE;
+	struct lzma_instance *instance = instance_get(inst, false);
+
+	if (instance == NULL) {
+		return -EINVAL;
+	}
+
+#ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2 /* For convenience */
+	SizeT *dic_pos = &instance->lzma_decoder.decoder.dicPos;
+#else
+	SizeT *dic_pos = &instance->lzma_decoder.dicPos;
+#endif
+	SizeT curr_dic_pos = *dic_pos;
+
+#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC)
+	if (instance->lzma_dict == NULL) {
+		return -ESRCH;
+	}
+#endif
+
+	if (input == NULL || input_size == 0 || offset == NULL || output == NULL ||
+	    output_size == NULL) {
+		return -EINVAL;
+	}
+
+	*output = NULL;
+	*output_size = 0;
+
+	if (!instance->allocated_probs) {
+#ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
+		rc = Lzma2Dec_AllocateProbs(&instance->lzma_decoder, input[0],
+					    &instance->probs_allocator);
+#else
+		rc = LzmaDec_AllocateProbs(&instance->lzma_decoder, input, LZMA_PROPS_SIZE,
+					   &instance->probs_allocator);
+#endif
+
+		if (rc) {
+			return -EINVAL;
+		}
+
+#ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
+		if (instance->lzma_decoder.decoder.prop.dicSize > MAX_LZMA_DICT_SIZE) {
+#else
+		if (instance->lzma_decoder.prop.dicSize > MAX_LZMA_DICT_SIZE) {
+#endif
+#ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
+			Lzma2Dec_FreeProbs(&instance->lzma_decoder, &instance->probs_allocator);
+#else
+			LzmaDec_FreeProbs(&instance->lzma_decoder, &instance->probs_allocator);
+#endif
+			return -EINVAL;
+		}
+
+		instance->allocated_probs = true;
+#ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
+		*offset = LZMA2_HEADER_SIZE;
+#else
+		/* Header and account for uncompressed size */
+		*offset = LZMA_PROPS_SIZE + sizeof(uint64_t);
+#endif
+
+#ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
+		instance->lzma_decoder.decoder.dic = instance->lzma_dict;
+		instance->lzma_decoder.decoder.dicBufSize = MAX_LZMA_DICT_SIZE;
+		Lzma2Dec_Init(&instance->lzma_decoder);
+#else
+		instance->lzma_decoder.dic = instance->lzma_dict;
+		instance->lzma_decoder.dicBufSize = MAX_LZMA_DICT_SIZE;
+		LzmaDec_Init(&instance->lzma_decoder);
+#endif
+
+		return 0;
+	}
+
+	if (MAX_LZMA_DICT_SIZE - curr_dic_pos >= instance->lzma_output_limit) {
+		/* Limit the output size because we are reaching
+		 * the limit of expected decompressed data size.
+		 */
+		finish_mode = LZMA_FINISH_END;
+		dic_limit = instance->lzma_output_limit + curr_dic_pos;
+	}
+
+#ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
+	rc = Lzma2Dec_DecodeToDic(&instance->lzma_decoder, dic_limit,
+				  input, &chunk_size, finish_mode, &status);
+#else
+	rc = LzmaDec_DecodeToDic(&instance->lzma_decoder, dic_limit,
+				 input, &chunk_size, finish_mode, &status);
+#endif
+
+	if (rc || chunk_size == 0) {
+		return -EINVAL;
 	}
+
+	*offset = chunk_size;
+	instance->lzma_output_limit -= (*dic_pos - curr_dic_pos);
+
+	if (last_part && status == LZMA_STATUS_FINISHED_WITH_MARK &&
+	    *offset < input_size) {
+		/* If last block, ensure offset matches complete file size */
+		*offset = input_size;
+	}
+
+	if (last_part && *offset == input_size) {
+		/* Check status of decompression on end of input stream.
+		 * We accept LZMA_STATUS_NEEDS_MORE_INPUT if we reached
+		 * the output limit (and only then) because we don't enforce that
+		 * end-of-stream marker needs to be present in the compressed data.
+		 */
+		if (status != LZMA_STATUS_MAYBE_FINISHED_WITHOUT_MARK
+		 && status != LZMA_STATUS_FINISHED_WITH_MARK
+		 && (status != LZMA_STATUS_NEEDS_MORE_INPUT &&
+		     instance->lzma_output_limit == 0)) {
+			return -EINVAL;
+		}
+	}
+
+	if (*dic_pos >= MAX_LZMA_DICT_SIZE || last_part) {
+#ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
+		*output = instance->lzma_decoder.decoder.dic;
+#else
+		*output = instance->lzma_decoder.dic;
+#endif
+		*output_size = *dic_pos;
+		*dic_pos = 0;
+	}
+
+	return rc;
 }
+
+#else /* CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY */
+
+/* The external dictionary interface of the bundled LZMA library is global, so this build
+ * supports a single decompression instance.
+ */
+
+#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_STATIC)
+static uint16_t lzma_probs[MAX_LZMA_PROB_SIZE];
+#endif
+
+#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC) && defined(CONFIG_NRF_COMPRESS_CLEANUP)
+static size_t malloc_probs_size = 0;
 #endif
 
+static void *lzma_probs_alloc(ISzAllocPtr p, size_t size)
+{
+#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_STATIC)
+	if (size > sizeof(lzma_probs)) {
+		LOG_ERR("Compress library tried to allocate too large a buffer (0x%x)", size);
+		return NULL;
+	}
+
+	return lzma_probs;
+#else
+	void *buffer = malloc(size);
+
+	if (buffer == NULL) {
+		LOG_ERR("Failed to allocate nRF compression library buffer (0x%x)", size);
+#ifdef CONFIG_NRF_COMPRESS_CLEANUP
+	} else {
+		malloc_probs_size = size;
+#endif
+	}
+
+	return buffer;
+#endif
+}
+
 static void lzma_probs_free(ISzAllocPtr p, void *address)
 {
 #if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC)
@@ -109,17 +484,6 @@ const static ISzAlloc lzma_probs_allocator = {
 	.Free = lzma_probs_free,
 };
 
-#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_STATIC) \
-	&& !defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
-#if CONFIG_NRF_COMPRESS_MEMORY_ALIGNMENT > 1
-static uint8_t __aligned(CONFIG_NRF_COMPRESS_MEMORY_ALIGNMENT) lzma_dict[MAX_LZMA_DICT_SIZE];
-#else
-static uint8_t lzma_dict[MAX_LZMA_DICT_SIZE];
-#endif
-#elif defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC) \
-	&& !defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
-static uint8_t *lzma_dict = NULL;
-#else
 /**
  * @brief Pointer to external dictionary interface,
  * set on module initialization function and held as context variable.
@@ -147,7 +511,6 @@ typedef struct dict_cache_t {
 
 static dict_cache cache;
 #endif
-#endif
 
 static size_t lzma_output_limit = SIZE_MAX;
 static bool allocated_probs = false;
@@ -208,7 +571,6 @@ static int synchronize_cache(const DictHandle *handle)
 /**
  * @brief Check the instance of lzma_codec during API calls.
  */
-#if defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
 static int check_inst(void *inst)
 {
 	if (inst != CONTAINER_OF(ext_dict, lzma_codec, dict_if)) {
@@ -217,9 +579,6 @@ static int check_inst(void *inst)
 
 	return 0;
 }
-#else
-#define check_inst(...) 0
-#endif
 
 static int lzma_reset(void *inst, size_t decompressed_size);
 
@@ -227,7 +586,6 @@ static int lzma_init(void *inst, size_t decompressed_size)
 {
 	int rc = 0;
 
-#if defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
 	if (inst == NULL || ext_dict != NULL) {
 		return -EINVAL;
 	}
@@ -237,30 +595,6 @@ static int lzma_init(void *inst, size_t decompressed_size)
 	    || ext_dict->write == NULL || ext_dict->read == NULL) {
 		return -EINVAL;
 	}
-#else
-	ARG_UNUSED(inst);
-#endif
-
-#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC) \
-	&& !defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
-	if (lzma_dict != NULL) {
-		/* Already allocated */
-		lzma_reset(inst, decompressed_size);
-
-		return rc;
-	}
-
-#if CONFIG_NRF_COMPRESS_MEMORY_ALIGNMENT > 1
-	lzma_dict = (uint8_t *)aligned_alloc(CONFIG_NRF_COMPRESS_MEMORY_ALIGNMENT,
-					     MAX_LZMA_DICT_SIZE);
-#else
-	lzma_dict = (uint8_t *)malloc(MAX_LZMA_DICT_SIZE);
-#endif
-
-	if (lzma_dict == NULL) {
-		rc = -ENOMEM;
-	}
-#endif
 
 	lzma_output_limit = decompressed_size != 0 ? decompressed_size : SIZE_MAX;
 
@@ -275,22 +609,9 @@ static int lzma_deinit(void *inst)
 		return rc;
 	}
 
-#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC) \
-	&& !defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
-	if (lzma_dict != NULL) {
-#ifdef CONFIG_NRF_COMPRESS_CLEANUP
-		memset(lzma_dict, 0x00, MAX_LZMA_DICT_SIZE);
-#endif
-
-		free(lzma_dict);
-		lzma_dict = NULL;
-	}
-#endif
 	rc = lzma_reset(inst, 0);
 
-#if defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
 	ext_dict = NULL;
-#endif
 
 	return rc;
 }
@@ -309,25 +630,21 @@ static int lzma_reset(void *inst, size_t decompressed_size)
 #ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
 		Lzma2Dec_FreeProbs(&lzma_decoder, &lzma_probs_allocator);
 
-#ifdef CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY
 		if (lzma_decoder.decoder.dicHandle->isOpened) {
 			rc = LzmaDictionaryClose(lzma_decoder.decoder.dicHandle);
 			if (rc != 0) {
 				rc = -EIO;
 			}
 		}
-#endif
 		lzma_decoder.decoder.dicPos = 0;
 #else
 		LzmaDec_FreeProbs(&lzma_decoder, &lzma_probs_allocator);
-#ifdef CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY
 		if (lzma_decoder.dicHandle->isOpened) {
 			rc = LzmaDictionaryClose(lzma_decoder.decoder.dicHandle);
 			if (rc != 0) {
 				rc = -EIO;
 			}
 		}
-#endif
 		lzma_decoder.dicPos = 0;
 #endif
 	}
@@ -345,13 +662,6 @@ static size_t lzma_bytes_needed(void *inst)
 		return arg_check_rc;
 	}
 
-#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC) \
-	&& !defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
-	if (lzma_dict == NULL) {
-		return 0;
-	}
-#endif
-
 #ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
 	return (allocated_probs ? CONFIG_NRF_COMPRESS_CHUNK_SIZE : LZMA2_HEADER_SIZE);
 #else
@@ -359,140 +669,6 @@ static size_t lzma_bytes_needed(void *inst)
 #endif
 }
 
-#if !defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
-static int lzma_decompress(void *inst, const uint8_t *input, size_t input_size, bool last_part,
-			   uint32_t *offset, uint8_t **output, size_t *output_size)
-{
-	int rc;
-	ELzmaStatus status;
-	size_t chunk_size = input_size;
-	ELzmaFinishMode finish_mode = LZMA_FINISH_ANY;
-	SizeT dic_limit = MAX_LZMA_DICT_SIZE;
-
-#ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2 /* For convenience */
-	SizeT *dic_pos = &lzma_decoder.decoder.dicPos;
-#else
-	SizeT *dic_pos =  &lzma_decoder.dicPos;
-#endif
-	SizeT curr_dic_pos = *dic_pos;
-
-	ARG_UNUSED(inst);
-
-#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC)
-	if (lzma_dict == NULL) {
-		return -ESRCH;
-	}
-#endif
-
-	if (input == NULL || input_size == 0 || offset == NULL || output == NULL ||
-	    output_size == NULL) {
-		return -EINVAL;
-	}
-
-	*output = NULL;
-	*output_size = 0;
-
-	if (!allocated_probs) {
-#ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
-		rc = Lzma2Dec_AllocateProbs(&lzma_decoder, input[0], &lzma_probs_allocator);
-#else
-		rc = LzmaDec_AllocateProbs(&lzma_decoder, input, LZMA_PROPS_SIZE,
-					   &lzma_probs_allocator);
-#endif
-
-		if (rc) {
-			return -EINVAL;
-		}
-
-#ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
-		if (lzma_decoder.decoder.prop.dicSize > MAX_LZMA_DICT_SIZE) {
-#else
-		if (lzma_decoder.prop.dicSize > MAX_LZMA_DICT_SIZE) {
-#endif
-#ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
-			Lzma2Dec_FreeProbs(&lzma_decoder, &lzma_probs_allocator);
-#else
-			LzmaDec_FreeProbs(&lzma_decoder, &lzma_probs_allocator);
-#endif
-			return -EINVAL;
-		}
-
-		allocated_probs = true;
-#ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
-		*offset = LZMA2_HEADER_SIZE;
-#else
-		/* Header and account for uncompressed size */
-		*offset = LZMA_PROPS_SIZE + sizeof(uint64_t);
-#endif
-
-#ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
-		lzma_decoder.decoder.dic = lzma_dict;
-		lzma_decoder.decoder.dicBufSize = MAX_LZMA_DICT_SIZE;
-		Lzma2Dec_Init(&lzma_decoder);
-#else
-		lzma_decoder.dic = lzma_dict;
-		lzma_decoder.dicBufSize = MAX_LZMA_DICT_SIZE;
-		LzmaDec_Init(&lzma_decoder);
-#endif
-
-		return 0;
-	}
-
-	if (MAX_LZMA_DICT_SIZE - curr_dic_pos >= lzma_output_limit) {
-		/* Limit the output size because we are reaching
-		 * the limit of expected decompressed data size.
-		 */
-		finish_mode = LZMA_FINISH_END;
-		dic_limit = lzma_output_limit + curr_dic_pos;
-	}
-
-#ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
-	rc = Lzma2Dec_DecodeToDic(&lzma_decoder, dic_limit,
-				  input, &chunk_size, finish_mode, &status);
-#else
-	rc = LzmaDec_DecodeToDic(&lzma_decoder, dic_limit,
-				 input, &chunk_size, finish_mode, &status);
-#endif
-
-	if (rc || chunk_size == 0) {
-		return -EINVAL;
-	}
-
-	*offset = chunk_size;
-	lzma_output_limit -= (*dic_pos - curr_dic_pos);
-
-	if (last_part && status == LZMA_STATUS_FINISHED_WITH_MARK &&
-	    *offset < input_size) {
-		/* If last block, ensure offset matches complete file size */
-		*offset = input_size;
-	}
-
-	if (last_part && *offset == input_size) {
-		/* Check status of decompression on end of input stream.
-		 * We accept LZMA_STATUS_NEEDS_MORE_INPUT if we reached
-		 * the output limit (and only then) because we don't enforce that
-		 * end-of-stream marker needs to be present in the compressed data.
-		 */
-		if (status != LZMA_STATUS_MAYBE_FINISHED_WITHOUT_MARK
-		 && status != LZMA_STATUS_FINISHED_WITH_MARK
-		 && (status != LZMA_STATUS_NEEDS_MORE_INPUT && lzma_output_limit == 0)) {
-			return -EINVAL;
-		}
-	}
-
-	if (*dic_pos >= MAX_LZMA_DICT_SIZE || last_part) {
-#ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
-		*output = lzma_decoder.decoder.dic;
-#else
-		*output = lzma_decoder.dic;
-#endif
-		*output_size = *dic_pos;
-		*dic_pos = 0;
-	}
-
-	return rc;
-}
-#else
 static int lzma_decompress(void *inst, const uint8_t *input, size_t input_size, bool last_part,
 			   uint32_t *offset, uint8_t **output, size_t *output_size)
 {
@@ -782,7 +958,8 @@ SRes LzmaDictionaryClose(DictHandle *handle)
 
 	return rc;
 }
-#endif
+
+#endif /* CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY */
 
 NRF_COMPRESS_IMPLEMENTATION_DEFINE(lzma, NRF_COMPRESS_TYPE_LZMA, lzma_init, lzma_deinit,
 				   lzma_reset, NULL, lzma_bytes_needed, lzma_decompress);
@@ -0,0 +1,197 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/logging/log.h>
+#include <nrf_compress/lzma_dict_flash.h>
+
+LOG_MODULE_REGISTER(nrf_compress_lzma_dict_flash, CONFIG_NRF_COMPRESS_LOG_LEVEL);
+
+#define SECTOR_SIZE CONFIG_NRF_COMPRESS_LZMA_DICT_FLASH_SECTOR_SIZE
+
+/* No sector is currently staged */
+#define SECTOR_NONE UINT32_MAX
+
+static const struct flash_area *dict_fa;
+static uint8_t dict_fa_id;
+static bool dict_fa_id_set;
+static bool dict_open;
+static size_t dict_size_open;
+
+/* RAM staging buffer holding one erase sector of dictionary data */
+static uint8_t sector_buf[SECTOR_SIZE];
+static uint32_t staged_sector = SECTOR_NONE;
+static bool staged_dirty;
+
+/* Write the staged sector through to flash (erase then program) */
+static int staged_sector_flush(void)
+{
+	int rc;
+	off_t offset = (off_t)staged_sector * SECTOR_SIZE;
+
+	if (staged_sector == SECTOR_NONE || !staged_dirty) {
+		return 0;
+	}
+
+	rc = flash_area_erase(dict_fa, offset, SECTOR_SIZE);
+	if (rc) {
+		LOG_ERR("Failed to erase dictionary sector %u (%d)", staged_sector, rc);
+		return rc;
+	}
+
+	rc = flash_area_write(dict_fa, offset, sector_buf, SECTOR_SIZE);
+	if (rc) {
+		LOG_ERR("Failed to program dictionary sector %u (%d)", staged_sector, rc);
+		return rc;
+	}
+
+	staged_dirty = false;
+
+	return 0;
+}
+
+/* Make the given sector the staged one, flushing and loading as needed */
+static int staged_sector_load(uint32_t sector)
+{
+	int rc;
+
+	if (sector == staged_sector) {
+		return 0;
+	}
+
+	rc = staged_sector_flush();
+	if (rc) {
+		return rc;
+	}
+
+	rc = flash_area_read(dict_fa, (off_t)sector * SECTOR_SIZE, sector_buf, SECTOR_SIZE);
+	if (rc) {
+		LOG_ERR("Failed to read dictionary sector %u (%d)", sector, rc);
+		return rc;
+	}
+
+	staged_sector = sector;
+	staged_dirty = false;
+
+	return 0;
+}
+
+int nrf_compress_lzma_dict_flash_area_set(uint8_t fa_id)
+{
+	if (dict_open) {
+		return -EBUSY;
+	}
+
+	dict_fa_id = fa_id;
+	dict_fa_id_set = true;
+
+	return 0;
+}
+
+int nrf_compress_lzma_dict_flash_open(size_t dict_size, size_t *buff_size)
+{
+	int rc;
+
+	if (dict_open || !dict_fa_id_set) {
+		return -EFAULT;
+	}
+
+	rc = flash_area_open(dict_fa_id, &dict_fa);
+	if (rc) {
+		LOG_ERR("Failed to open dictionary flash area %u (%d)", dict_fa_id, rc);
+		return rc;
+	}
+
+	*buff_size = dict_fa->fa_size;
+
+	if (dict_fa->fa_size < dict_size) {
+		LOG_ERR("Dictionary flash area too small: %zu < %zu", (size_t)dict_fa->fa_size,
+			dict_size);
+		flash_area_close(dict_fa);
+		dict_fa = NULL;
+		return -ENOMEM;
+	}
+
+	dict_size_open = dict_size;
+	staged_sector = SECTOR_NONE;
+	staged_dirty = false;
+	dict_open = true;
+
+	return 0;
+}
+
+int nrf_compress_lzma_dict_flash_close(void)
+{
+	if (!dict_open) {
+		return -EFAULT;
+	}
+
+#ifdef CONFIG_NRF_COMPRESS_CLEANUP
+	memset(sector_buf, 0x00, sizeof(sector_buf));
+#endif
+
+	staged_sector = SECTOR_NONE;
+	staged_dirty = false;
+	flash_area_close(dict_fa);
+	dict_fa = NULL;
+	dict_open = false;
+
+	return 0;
+}
+
+size_t nrf_compress_lzma_dict_flash_write(size_t pos, const uint8_t *data, size_t len)
+{
+	size_t written = 0;
+
+	if (!dict_open || pos + len > dict_size_open) {
+		return 0;
+	}
+
+	while (written < len) {
+		uint32_t sector = (pos + written) / SECTOR_SIZE;
+		size_t sector_off = (pos + written) % SECTOR_SIZE;
+		size_t chunk = MIN(len - written, SECTOR_SIZE - sector_off);
+
+		if (staged_sector_load(sector)) {
+			return written;
+		}
+
+		memcpy(&sector_buf[sector_off], &data[written], chunk);
+		staged_dirty = true;
+		written += chunk;
+	}
+
+	return written;
+}
+
+size_t nrf_compress_lzma_dict_flash_read(size_t pos, uint8_t *data, size_t len)
+{
+	size_t num_read = 0;
+
+	if (!dict_open || pos + len > dict_size_open) {
+		return 0;
+	}
+
+	while (num_read < len) {
+		uint32_t sector = (pos + num_read) / SECTOR_SIZE;
+		size_t sector_off = (pos + num_read) % SECTOR_SIZE;
+		size_t chunk = MIN(len - num_read, SECTOR_SIZE - sector_off);
+
+		if (sector == staged_sector) {
+			/* Serve not yet flushed data from the staging buffer */
+			memcpy(&data[num_read], &sector_buf[sector_off], chunk);
+		} else if (flash_area_read(dict_fa, (off_t)(pos + num_read), &data[num_read],
+					   chunk)) {
+			return num_read;
+		}
+
+		num_read += chunk;
+	}
+
+	return num_read;
+}
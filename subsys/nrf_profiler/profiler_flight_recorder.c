@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/sys/time_units.h>
+#include <nrf_profiler_flight_recorder.h>
+
+#include "profiler_flight_recorder.h"
+
+#define SNAPSHOT_AREA		FIXED_PARTITION_ID(nrf_profiler_snapshot)
+#define SNAPSHOT_MAGIC		0x464F5250 /* "PROF" */
+#define SNAPSHOT_VERSION	1
+
+/* The snapshot image consists of the header followed by the raw circular
+ * buffer contents. Events are stored in the profiler wire format, each
+ * preceded by a single byte with the event length. The oldest event starts
+ * at the tail index and the data wraps around at buf_size.
+ */
+struct snapshot_header {
+	uint32_t magic;
+	uint32_t version;
+	uint32_t buf_size;
+	uint32_t head;
+	uint32_t tail;
+	uint32_t cycles_per_sec;
+	uint32_t reserved[2];
+};
+
+static uint8_t event_buf[CONFIG_NRF_PROFILER_NORDIC_FLIGHT_RECORDER_BUF_SIZE] __aligned(4);
+static size_t head;
+static size_t tail;
+static struct k_spinlock lock;
+
+static size_t buf_space(void)
+{
+	return (tail + sizeof(event_buf) - head - 1) % sizeof(event_buf);
+}
+
+static void drop_oldest(void)
+{
+	uint8_t event_len = event_buf[tail];
+
+	tail = (tail + sizeof(uint8_t) + event_len) % sizeof(event_buf);
+}
+
+static void buf_put(const uint8_t *data, size_t len)
+{
+	size_t tail_room = sizeof(event_buf) - head;
+
+	if (len <= tail_room) {
+		memcpy(&event_buf[head], data, len);
+	} else {
+		memcpy(&event_buf[head], data, tail_room);
+		memcpy(&event_buf[0], &data[tail_room], len - tail_room);
+	}
+	head = (head + len) % sizeof(event_buf);
+}
+
+void nrf_profiler_flight_recorder_append(struct log_event_buf *buf, uint8_t type_id)
+{
+	size_t event_len = buf->payload - buf->payload_start;
+	uint8_t len_byte = (uint8_t)event_len;
+
+	__ASSERT_NO_MSG(event_len <= UINT8_MAX);
+
+	buf->payload_start[0] = type_id;
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	while (buf_space() < sizeof(len_byte) + event_len) {
+		drop_oldest();
+	}
+	buf_put(&len_byte, sizeof(len_byte));
+	buf_put(buf->payload_start, event_len);
+
+	k_spin_unlock(&lock, key);
+}
+
+int nrf_profiler_flight_recorder_snapshot(void)
+{
+	const struct flash_area *fa;
+	struct snapshot_header header = {
+		.magic = SNAPSHOT_MAGIC,
+		.version = SNAPSHOT_VERSION,
+		.buf_size = sizeof(event_buf),
+		.cycles_per_sec = sys_clock_hw_cycles_per_sec(),
+	};
+	int err;
+
+	err = flash_area_open(SNAPSHOT_AREA, &fa);
+	if (err) {
+		return err;
+	}
+
+	if (fa->fa_size < sizeof(header) + sizeof(event_buf)) {
+		flash_area_close(fa);
+		return -ENOMEM;
+	}
+
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	header.head = head;
+	header.tail = tail;
+
+	err = flash_area_erase(fa, 0, fa->fa_size);
+	if (!err) {
+		err = flash_area_write(fa, 0, &header, sizeof(header));
+	}
+	if (!err) {
+		err = flash_area_write(fa, sizeof(header), event_buf, sizeof(event_buf));
+	}
+
+	k_spin_unlock(&lock, key);
+	flash_area_close(fa);
+
+	return err;
+}
+
+static int snapshot_header_read(const struct flash_area *fa, struct snapshot_header *header)
+{
+	int err;
+
+	err = flash_area_read(fa, 0, header, sizeof(*header));
+	if (err) {
+		return err;
+	}
+
+	if ((header->magic != SNAPSHOT_MAGIC) || (header->version != SNAPSHOT_VERSION) ||
+	    (header->buf_size > fa->fa_size - sizeof(*header))) {
+		return -ENOENT;
+	}
+
+	return 0;
+}
+
+ssize_t nrf_profiler_flight_recorder_snapshot_size_get(void)
+{
+	const struct flash_area *fa;
+	struct snapshot_header header;
+	int err;
+
+	err = flash_area_open(SNAPSHOT_AREA, &fa);
+	if (err) {
+		return err;
+	}
+
+	err = snapshot_header_read(fa, &header);
+	flash_area_close(fa);
+	if (err) {
+		return err;
+	}
+
+	return sizeof(header) + header.buf_size;
+}
+
+int nrf_profiler_flight_recorder_snapshot_read(size_t off, void *data, size_t len)
+{
+	const struct flash_area *fa;
+	struct snapshot_header header;
+	int err;
+
+	err = flash_area_open(SNAPSHOT_AREA, &fa);
+	if (err) {
+		return err;
+	}
+
+	err = snapshot_header_read(fa, &header);
+	if (!err) {
+		if (off + len > sizeof(header) + header.buf_size) {
+			err = -EINVAL;
+		} else {
+			err = flash_area_read(fa, off, data, len);
+		}
+	}
+	flash_area_close(fa);
+
+	return err;
+}
+
+int nrf_profiler_flight_recorder_snapshot_erase(void)
+{
+	const struct flash_area *fa;
+	int err;
+
+	err = flash_area_open(SNAPSHOT_AREA, &fa);
+	if (err) {
+		return err;
+	}
+
+	err = flash_area_erase(fa, 0, fa->fa_size);
+	flash_area_close(fa);
+
+	return err;
+}
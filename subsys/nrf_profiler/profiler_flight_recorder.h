@@ -0,0 +1,17 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _PROFILER_FLIGHT_RECORDER_H_
+#define _PROFILER_FLIGHT_RECORDER_H_
+
+#include <nrf_profiler.h>
+
+/* Append an event from the Nordic nrf_profiler backend to the circular
+ * event buffer. The event data uses the profiler wire format.
+ */
+void nrf_profiler_flight_recorder_append(struct log_event_buf *buf, uint8_t type_id);
+
+#endif /* _PROFILER_FLIGHT_RECORDER_H_ */
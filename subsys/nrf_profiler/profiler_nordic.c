@@ -15,6 +15,8 @@
 #include <string.h>
 #include <nrfx.h>
 
+#include "profiler_flight_recorder.h"
+
 
 enum state {
 	STATE_DISABLED,
@@ -158,6 +160,15 @@ static int send_system_configuration(void)
 		return err;
 	}
 
+	if (IS_ENABLED(CONFIG_NRF_PROFILER_NORDIC_DELTA_TIMESTAMPS)) {
+		static const char * const ts_format_param = "timestamp_format,delta_varint\n";
+
+		err = send_info_data(ts_format_param, strlen(ts_format_param));
+		if (err) {
+			return err;
+		}
+	}
+
 	err = send_info_data(sys_config_stop, strlen(sys_config_stop));
 
 	return err;
@@ -397,6 +408,53 @@ void nrf_profiler_log_add_mem_address(struct log_event_buf *buf,
 	nrf_profiler_log_encode_uint32(buf, (uint32_t)mem_address);
 }
 
+#if defined(CONFIG_NRF_PROFILER_NORDIC_DELTA_TIMESTAMPS)
+/* Timestamp of the last event sent over RTT. Protected by the spinlock
+ * serializing nrf_profiler_RTT_send calls.
+ */
+static uint32_t last_timestamp;
+
+static size_t varint_encode(uint32_t value, uint8_t *out)
+{
+	size_t len = 0;
+
+	do {
+		out[len] = value & 0x7F;
+		value >>= 7;
+		if (value > 0) {
+			out[len] |= 0x80;
+		}
+		len++;
+	} while (value > 0);
+
+	return len;
+}
+
+static bool nrf_profiler_RTT_send(struct log_event_buf *buf, uint8_t type_id)
+{
+	uint8_t out[CONFIG_NRF_PROFILER_CUSTOM_EVENT_BUF_LEN + 1];
+	uint32_t timestamp = sys_get_le32(&buf->payload_start[sizeof(uint8_t)]);
+	size_t args_len = buf->payload - buf->payload_start
+			  - sizeof(uint8_t) - sizeof(uint32_t);
+	size_t data_len;
+
+	out[0] = type_id;
+	data_len = sizeof(uint8_t) + varint_encode(timestamp - last_timestamp, &out[1]);
+	memcpy(&out[data_len], &buf->payload_start[sizeof(uint8_t) + sizeof(uint32_t)],
+	       args_len);
+	data_len += args_len;
+
+	size_t num_bytes_send = SEGGER_RTT_WriteNoLock(
+			CONFIG_NRF_PROFILER_NORDIC_RTT_CHANNEL_DATA,
+			out, data_len);
+	if (num_bytes_send != data_len) {
+		return false;
+	}
+
+	last_timestamp = timestamp;
+	return true;
+}
+#else
 static bool nrf_profiler_RTT_send(struct log_event_buf *buf, uint8_t type_id)
 {
 	buf->payload_start[0] = type_id;
@@ -407,6 +465,7 @@ static bool nrf_profiler_RTT_send(struct log_event_buf *buf, uint8_t type_id)
 			buf->payload_start, data_len);
 	return (num_bytes_send == data_len);
 }
+#endif /* CONFIG_NRF_PROFILER_NORDIC_DELTA_TIMESTAMPS */
 
 static void nrf_profiler_fatal_error(void)
 {
@@ -426,9 +485,14 @@ void nrf_profiler_log_send(struct log_event_buf *buf, uint16_t event_type_id)
 {
 	__ASSERT_NO_MSG(event_type_id <= UINT8_MAX);
 
-	if (atomic_get(&nrf_profiler_state) == STATE_ACTIVE) {
-		uint8_t type_id = event_type_id & UINT8_MAX;
+	uint8_t type_id = event_type_id & UINT8_MAX;
 
+	if (IS_ENABLED(CONFIG_NRF_PROFILER_NORDIC_FLIGHT_RECORDER)) {
+		/* Record the event even if streaming to the host is not active. */
+		nrf_profiler_flight_recorder_append(buf, type_id);
+	}
+
+	if (atomic_get(&nrf_profiler_state) == STATE_ACTIVE) {
 		k_spinlock_key_t key = k_spin_lock(&lock);
 
 		if (!nrf_profiler_RTT_send(buf, type_id)) {
@@ -42,10 +42,38 @@ struct nrf_rpc_os_msg {
 
 typedef void (*nrf_rpc_os_work_t)(const uint8_t *data, size_t len);
 
+/** @brief High-priority packet filter.
+ *
+ * The filter is called for every incoming packet passed to the local
+ * thread pool. It may run in the transport receive context, so it must
+ * only inspect the packet and return quickly.
+ *
+ * @param[in] data Incoming packet.
+ * @param[in] len Packet length.
+ *
+ * @retval True if the packet must be serviced by the high-priority
+ *         thread pool. Otherwise, false.
+ */
+typedef bool (*nrf_rpc_os_prio_filter_t)(const uint8_t *data, size_t len);
+
 int nrf_rpc_os_init(nrf_rpc_os_work_t callback);
 
 void nrf_rpc_os_thread_pool_send(const uint8_t *data, size_t len);
 
+#if defined(CONFIG_NRF_RPC_HIGH_PRIO_POOL)
+/** @brief Set the filter routing incoming packets to the high-priority
+ *         thread pool.
+ *
+ * Packets accepted by the filter are queued to a separate thread pool
+ * running at CONFIG_NRF_RPC_HIGH_PRIO_THREAD_PRIORITY, so they are not
+ * blocked behind long-running commands serviced by the default thread
+ * pool. Setting a NULL filter routes all packets to the default pool.
+ *
+ * @param[in] filter Filter function, or NULL.
+ */
+void nrf_rpc_os_high_prio_filter_set(nrf_rpc_os_prio_filter_t filter);
+#endif /* CONFIG_NRF_RPC_HIGH_PRIO_POOL */
+
 static inline int nrf_rpc_os_event_init(struct nrf_rpc_os_event *event)
 {
 	return k_sem_init(&event->sem, 0, 1);
@@ -156,10 +156,9 @@ static int init(const struct nrf_rpc_tr *transport, nrf_rpc_tr_receive_handler_t
 	return 0;
 }
 
-static int send(const struct nrf_rpc_tr *transport, const uint8_t *data, size_t length)
+/* Waits until the endpoint is bonded and ready for transmission. */
+static int endpoint_ready_wait(struct nrf_rpc_ipc *ipc_config)
 {
-	int err;
-	struct nrf_rpc_ipc *ipc_config = transport->ctx;
 	struct nrf_rpc_ipc_endpoint *endpoint = &ipc_config->endpoint;
 
 	switch (ipc_config->state) {
@@ -181,9 +180,39 @@ static int send(const struct nrf_rpc_tr *transport, const uint8_t *data, size_t
 		return -NRF_EPIPE;
 	}
 
+	return 0;
+}
+
+static int send(const struct nrf_rpc_tr *transport, const uint8_t *data, size_t length)
+{
+	int err;
+	struct nrf_rpc_ipc *ipc_config = transport->ctx;
+	struct nrf_rpc_ipc_endpoint *endpoint = &ipc_config->endpoint;
+
+	err = endpoint_ready_wait(ipc_config);
+	if (err) {
+		return err;
+	}
+
 	LOG_DBG("Sending %u bytes", length);
 	DUMP_LIMITED_DBG(data, length, "Data: ");
 
+	if (IS_ENABLED(CONFIG_NRF_RPC_IPC_SERVICE_NO_COPY)) {
+		/* The packet already resides in the backend shared memory,
+		 * so only the buffer ownership is passed to the backend.
+		 */
+		err = ipc_service_send_nocopy(&endpoint->ept, data, length);
+		if (err < 0) {
+			LOG_ERR("ipc_service_send_nocopy returned err: %d", err);
+			ipc_service_drop_tx_buffer(&endpoint->ept, (void *)data);
+		} else if (err > 0) {
+			LOG_DBG("Sent %u bytes", err);
+			err = 0;
+		}
+
+		return translate_error(err);
+	}
+
 	err = ipc_service_send(&endpoint->ept, data, length);
 	if (err < 0) {
 		LOG_ERR("ipc_service_send returned err: %d", err);
@@ -202,6 +231,27 @@ static void *tx_buf_alloc(const struct nrf_rpc_tr *transport, size_t *size)
 	void *data = NULL;
 	struct nrf_rpc_ipc *ipc_config = transport->ctx;
 
+	if (IS_ENABLED(CONFIG_NRF_RPC_IPC_SERVICE_NO_COPY)) {
+		uint32_t len = *size;
+
+		/* The buffer is claimed directly from the backend shared
+		 * memory, which requires a bonded endpoint.
+		 */
+		if (endpoint_ready_wait(ipc_config)) {
+			goto error;
+		}
+
+		if (ipc_service_get_tx_buffer(&ipc_config->endpoint.ept, &data,
+					      &len, K_FOREVER)) {
+			LOG_ERR("Failed to get Tx buffer from the IPC backend.");
+			goto error;
+		}
+
+		*size = len;
+
+		return data;
+	}
+
 	if (ipc_config->state == NRF_RPC_IPC_STATE_UNINITIALIZED) {
 		LOG_ERR("nRF RPC transport is not initialized");
 		goto error;
@@ -231,6 +281,11 @@ static void tx_buf_free(const struct nrf_rpc_tr *transport, void *buf)
 		return;
 	}
 
+	if (IS_ENABLED(CONFIG_NRF_RPC_IPC_SERVICE_NO_COPY)) {
+		ipc_service_drop_tx_buffer(&ipc_config->endpoint.ept, buf);
+		return;
+	}
+
 	k_free(buf);
 }
 
@@ -8,8 +8,11 @@
 #include <nrf_rpc_log.h>
 
 #include "nrf_rpc_os.h"
+#include <nrf_latency_probe.h>
 #include <zephyr/sys/math_extras.h>
 
+NRF_LATENCY_PROBE_DEFINE(nrf_rpc_response_wait);
+
 /* Maximum number of remote thread that this implementation allows. */
 #define MAX_REMOTE_THREADS 255
 
@@ -39,6 +42,19 @@ static K_THREAD_STACK_ARRAY_DEFINE(pool_stacks,
 
 static struct k_thread pool_threads[CONFIG_NRF_RPC_THREAD_POOL_SIZE];
 
+#if defined(CONFIG_NRF_RPC_HIGH_PRIO_POOL)
+static nrf_rpc_os_prio_filter_t high_prio_filter;
+
+static struct pool_start_msg high_prio_start_msg_buf[2];
+static struct k_msgq high_prio_start_msg;
+
+static K_THREAD_STACK_ARRAY_DEFINE(high_prio_stacks,
+	CONFIG_NRF_RPC_HIGH_PRIO_THREAD_POOL_SIZE,
+	CONFIG_NRF_RPC_THREAD_STACK_SIZE);
+
+static struct k_thread high_prio_threads[CONFIG_NRF_RPC_HIGH_PRIO_THREAD_POOL_SIZE];
+#endif /* CONFIG_NRF_RPC_HIGH_PRIO_POOL */
+
 BUILD_ASSERT(CONFIG_NRF_RPC_CMD_CTX_POOL_SIZE > 0,
 	     "CONFIG_NRF_RPC_CMD_CTX_POOL_SIZE must be greaten than zero");
 BUILD_ASSERT(CONFIG_NRF_RPC_CMD_CTX_POOL_SIZE <= 8 * sizeof(atomic_val_t),
@@ -48,10 +64,11 @@ BUILD_ASSERT(sizeof(uint32_t) == sizeof(atomic_val_t),
 
 static void thread_pool_entry(void *p1, void *p2, void *p3)
 {
+	struct k_msgq *msgq = p1;
 	struct pool_start_msg msg;
 
 	do {
-		k_msgq_get(&pool_start_msg, &msg, K_FOREVER);
+		k_msgq_get(msgq, &msg, K_FOREVER);
 		thread_pool_callback(msg.data, msg.len);
 	} while (1);
 }
@@ -81,20 +98,50 @@ int nrf_rpc_os_init(nrf_rpc_os_work_t callback)
 		k_thread_create(&pool_threads[i], pool_stacks[i],
 			K_THREAD_STACK_SIZEOF(pool_stacks[i]),
 			thread_pool_entry,
-			NULL, NULL, NULL,
+			&pool_start_msg, NULL, NULL,
 			CONFIG_NRF_RPC_THREAD_PRIORITY, 0, K_NO_WAIT);
 		k_thread_name_set(&pool_threads[i], "rpc");
 	}
 
+#if defined(CONFIG_NRF_RPC_HIGH_PRIO_POOL)
+	k_msgq_init(&high_prio_start_msg, (char *)high_prio_start_msg_buf,
+		    sizeof(struct pool_start_msg),
+		    ARRAY_SIZE(high_prio_start_msg_buf));
+
+	for (i = 0; i < CONFIG_NRF_RPC_HIGH_PRIO_THREAD_POOL_SIZE; i++) {
+		k_thread_create(&high_prio_threads[i], high_prio_stacks[i],
+			K_THREAD_STACK_SIZEOF(high_prio_stacks[i]),
+			thread_pool_entry,
+			&high_prio_start_msg, NULL, NULL,
+			CONFIG_NRF_RPC_HIGH_PRIO_THREAD_PRIORITY, 0, K_NO_WAIT);
+		k_thread_name_set(&high_prio_threads[i], "rpc_hp");
+	}
+#endif /* CONFIG_NRF_RPC_HIGH_PRIO_POOL */
+
 	return 0;
 }
 
+#if defined(CONFIG_NRF_RPC_HIGH_PRIO_POOL)
+void nrf_rpc_os_high_prio_filter_set(nrf_rpc_os_prio_filter_t filter)
+{
+	high_prio_filter = filter;
+}
+#endif /* CONFIG_NRF_RPC_HIGH_PRIO_POOL */
+
 void nrf_rpc_os_thread_pool_send(const uint8_t *data, size_t len)
 {
 	struct pool_start_msg msg;
 
 	msg.data = data;
 	msg.len = len;
+
+#if defined(CONFIG_NRF_RPC_HIGH_PRIO_POOL)
+	if (high_prio_filter && high_prio_filter(data, len)) {
+		k_msgq_put(&high_prio_start_msg, &msg, K_FOREVER);
+		return;
+	}
+#endif /* CONFIG_NRF_RPC_HIGH_PRIO_POOL */
+
 	k_msgq_put(&pool_start_msg, &msg, K_FOREVER);
 }
 
@@ -109,12 +156,15 @@ void nrf_rpc_os_msg_set(struct nrf_rpc_os_msg *msg, const uint8_t *data,
 void nrf_rpc_os_msg_get(struct nrf_rpc_os_msg *msg, struct nrf_rpc_os_mutex *mutex,
 			const uint8_t **data, size_t *len)
 {
+	NRF_LATENCY_PROBE_BEGIN(nrf_rpc_response_wait);
+
 	int rc = k_condvar_wait(&msg->event, &mutex->mutex,
 				CONFIG_NRF_RPC_RESPONSE_TIMEOUT == -1
 					? K_FOREVER
 					: K_MSEC(CONFIG_NRF_RPC_RESPONSE_TIMEOUT));
 
 	if (rc == 0) {
+		NRF_LATENCY_PROBE_END(nrf_rpc_response_wait);
 		*data = msg->data;
 		*len = msg->len;
 	} else {
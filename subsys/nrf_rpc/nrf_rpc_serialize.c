@@ -34,11 +34,6 @@ void nrf_rpc_encoder_invalid(struct nrf_rpc_cbor_ctx *ctx)
 	zcbor_error(ctx->zs, ZCBOR_ERR_UNKNOWN);
 }
 
-bool nrf_rpc_decode_valid(const struct nrf_rpc_cbor_ctx *ctx)
-{
-	return !is_decoder_invalid(ctx);
-}
-
 static void check_final_decode_valid(const struct nrf_rpc_group *group,
 				     const struct nrf_rpc_cbor_ctx *ctx)
 {
@@ -48,41 +43,6 @@ static void check_final_decode_valid(const struct nrf_rpc_group *group,
 	}
 }
 
-void nrf_rpc_encode_null(struct nrf_rpc_cbor_ctx *ctx)
-{
-	zcbor_nil_put(ctx->zs, NULL);
-}
-
-void nrf_rpc_encode_undefined(struct nrf_rpc_cbor_ctx *ctx)
-{
-	zcbor_undefined_put(ctx->zs, NULL);
-}
-
-void nrf_rpc_encode_bool(struct nrf_rpc_cbor_ctx *ctx, bool value)
-{
-	zcbor_bool_put(ctx->zs, value);
-}
-
-void nrf_rpc_encode_uint(struct nrf_rpc_cbor_ctx *ctx, uint32_t value)
-{
-	zcbor_uint32_put(ctx->zs, value);
-}
-
-void nrf_rpc_encode_int(struct nrf_rpc_cbor_ctx *ctx, int32_t value)
-{
-	zcbor_int32_put(ctx->zs, value);
-}
-
-void nrf_rpc_encode_uint64(struct nrf_rpc_cbor_ctx *ctx, uint64_t value)
-{
-	zcbor_uint64_put(ctx->zs, value);
-}
-
-void nrf_rpc_encode_int64(struct nrf_rpc_cbor_ctx *ctx, int64_t value)
-{
-	zcbor_int64_put(ctx->zs, value);
-}
-
 void nrf_rpc_encode_str(struct nrf_rpc_cbor_ctx *ctx, const char *value, int len)
 {
 	if (!value) {
@@ -124,11 +84,6 @@ void nrf_rpc_encode_callback(struct nrf_rpc_cbor_ctx *ctx, void *callback)
 	}
 }
 
-void nrf_rpc_decode_skip(struct nrf_rpc_cbor_ctx *ctx)
-{
-	zcbor_any_skip(ctx->zs, NULL);
-}
-
 bool nrf_rpc_decode_is_null(struct nrf_rpc_cbor_ctx *ctx)
 {
 	if (is_encoder_invalid(ctx)) {
@@ -170,61 +125,6 @@ bool nrf_rpc_decode_is_undefined(struct nrf_rpc_cbor_ctx *ctx)
 	return false;
 }
 
-bool nrf_rpc_decode_bool(struct nrf_rpc_cbor_ctx *ctx)
-{
-	bool result;
-
-	if (zcbor_bool_decode(ctx->zs, &result)) {
-		return result;
-	}
-
-	return false;
-}
-
-uint32_t nrf_rpc_decode_uint(struct nrf_rpc_cbor_ctx *ctx)
-{
-	uint32_t result;
-
-	if (zcbor_uint32_decode(ctx->zs, &result)) {
-		return result;
-	}
-
-	return 0;
-}
-
-int32_t nrf_rpc_decode_int(struct nrf_rpc_cbor_ctx *ctx)
-{
-	int32_t result;
-
-	if (zcbor_int32_decode(ctx->zs, &result)) {
-		return result;
-	}
-
-	return 0;
-}
-
-uint64_t nrf_rpc_decode_uint64(struct nrf_rpc_cbor_ctx *ctx)
-{
-	uint64_t result;
-
-	if (zcbor_uint64_decode(ctx->zs, &result)) {
-		return result;
-	}
-
-	return 0;
-}
-
-int64_t nrf_rpc_decode_int64(struct nrf_rpc_cbor_ctx *ctx)
-{
-	int64_t result;
-
-	if (zcbor_int64_decode(ctx->zs, &result)) {
-		return result;
-	}
-
-	return 0;
-}
-
 void *nrf_rpc_decode_buffer(struct nrf_rpc_cbor_ctx *ctx, void *buffer, size_t buffer_size)
 {
 	struct zcbor_string zst = {0};
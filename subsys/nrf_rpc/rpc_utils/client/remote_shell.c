@@ -76,3 +76,80 @@ char *nrf_rpc_invoke_remote_shell_cmd(size_t argc, char *argv[])
 
 	return allocate_buffer_and_decode_str(&ctx, RPC_UTIL_DEV_INFO_INVOKE_SHELL_CMD);
 }
+
+int nrf_rpc_remote_shell_cmd_exec(size_t argc, char *argv[], size_t *output_len)
+{
+	struct nrf_rpc_cbor_ctx ctx;
+	size_t cmd_buffer_size = get_cmd_len(argc, argv);
+	char *cmd_buffer = k_malloc(cmd_buffer_size);
+	size_t len;
+	int rc;
+
+	if (!cmd_buffer) {
+		nrf_rpc_err(-ENOMEM, NRF_RPC_ERR_SRC_SEND, &rpc_utils_group,
+			    RPC_UTIL_REMOTE_SHELL_EXEC, NRF_RPC_PACKET_TYPE_CMD);
+		return -ENOMEM;
+	}
+
+	size_t cmd_len = create_cmd_line(cmd_buffer, cmd_buffer_size, argc, argv);
+
+	if (!cmd_len) {
+		nrf_rpc_err(-ENOMEM, NRF_RPC_ERR_SRC_SEND, &rpc_utils_group,
+			    RPC_UTIL_REMOTE_SHELL_EXEC, NRF_RPC_PACKET_TYPE_CMD);
+		k_free(cmd_buffer);
+		return -ENOMEM;
+	}
+
+	NRF_RPC_CBOR_ALLOC(&rpc_utils_group, ctx, 3 + cmd_len);
+
+	nrf_rpc_encode_str(&ctx, cmd_buffer, cmd_len);
+
+	nrf_rpc_cbor_cmd_rsp_no_err(&rpc_utils_group, RPC_UTIL_REMOTE_SHELL_EXEC, &ctx);
+
+	rc = nrf_rpc_decode_int(&ctx);
+	len = nrf_rpc_decode_uint(&ctx);
+
+	if (!nrf_rpc_decoding_done_and_check(&rpc_utils_group, &ctx)) {
+		nrf_rpc_err(-EBADMSG, NRF_RPC_ERR_SRC_RECV, &rpc_utils_group,
+			    RPC_UTIL_REMOTE_SHELL_EXEC, NRF_RPC_PACKET_TYPE_RSP);
+		k_free(cmd_buffer);
+		return -EBADMSG;
+	}
+
+	if (output_len) {
+		*output_len = len;
+	}
+
+	k_free(cmd_buffer);
+
+	return rc;
+}
+
+int nrf_rpc_remote_shell_output_read(size_t offset, void *buffer, size_t buffer_size)
+{
+	struct nrf_rpc_cbor_ctx ctx;
+	const void *ptr;
+	size_t chunk_size = 0;
+
+	NRF_RPC_CBOR_ALLOC(&rpc_utils_group, ctx, 10);
+
+	nrf_rpc_encode_uint(&ctx, offset);
+	nrf_rpc_encode_uint(&ctx, buffer_size);
+
+	nrf_rpc_cbor_cmd_rsp_no_err(&rpc_utils_group, RPC_UTIL_REMOTE_SHELL_OUTPUT_READ, &ctx);
+
+	ptr = nrf_rpc_decode_buffer_ptr_and_size(&ctx, &chunk_size);
+
+	if (ptr) {
+		chunk_size = MIN(chunk_size, buffer_size);
+		memcpy(buffer, ptr, chunk_size);
+	}
+
+	if (!nrf_rpc_decoding_done_and_check(&rpc_utils_group, &ctx) || !ptr) {
+		nrf_rpc_err(-EBADMSG, NRF_RPC_ERR_SRC_RECV, &rpc_utils_group,
+			    RPC_UTIL_REMOTE_SHELL_OUTPUT_READ, NRF_RPC_PACKET_TYPE_RSP);
+		return -EBADMSG;
+	}
+
+	return chunk_size;
+}
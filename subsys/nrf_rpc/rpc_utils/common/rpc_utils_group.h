@@ -23,6 +23,8 @@ enum rpc_utils_cmd_server {
 	RPC_UTIL_RRAM_WEAR_TEST = 6,
 	RPC_UTIL_RRAM_WEAR_TEST_GET_PARTITION_COUNT = 7,
 	RPC_UTIL_RRAM_WEAR_TEST_GET_PARTITION = 8,
+	RPC_UTIL_REMOTE_SHELL_EXEC = 9,
+	RPC_UTIL_REMOTE_SHELL_OUTPUT_READ = 10,
 };
 
 #endif /* RPC_UTILS_GROUP_H_ */
@@ -67,3 +67,82 @@ exit:
 
 NRF_RPC_CBOR_CMD_DECODER(rpc_utils_group, remote_shell_cmd, RPC_UTIL_DEV_INFO_INVOKE_SHELL_CMD,
 			 remote_shell_cmd, NULL);
+
+static void remote_shell_exec(const struct nrf_rpc_group *group, struct nrf_rpc_cbor_ctx *ctx,
+			      void *handler_data)
+{
+	struct nrf_rpc_cbor_ctx rsp_ctx;
+	char *cmd_buffer = NULL;
+	const void *ptr;
+	size_t len = 0;
+	int rc = -ENOMEM;
+
+	ptr = nrf_rpc_decode_str_ptr_and_len(ctx, &len);
+
+	if (ptr) {
+		cmd_buffer = k_malloc(len + 1);
+		if (cmd_buffer) {
+			memcpy(cmd_buffer, ptr, len);
+			cmd_buffer[len] = '\0';
+		}
+	}
+
+	if (!nrf_rpc_decoding_done_and_check(group, ctx)) {
+		nrf_rpc_err(-EBADMSG, NRF_RPC_ERR_SRC_RECV, group, RPC_UTIL_REMOTE_SHELL_EXEC,
+			    NRF_RPC_PACKET_TYPE_CMD);
+		k_free(cmd_buffer);
+		return;
+	}
+
+	len = 0;
+	if (ptr && cmd_buffer) {
+		rc = shell_exec(cmd_buffer);
+		(void)shell_get_output(&len);
+	}
+
+	NRF_RPC_CBOR_ALLOC(group, rsp_ctx, 12);
+
+	nrf_rpc_encode_int(&rsp_ctx, rc);
+	nrf_rpc_encode_uint(&rsp_ctx, len);
+	nrf_rpc_cbor_rsp_no_err(group, &rsp_ctx);
+
+	k_free(cmd_buffer);
+}
+
+NRF_RPC_CBOR_CMD_DECODER(rpc_utils_group, remote_shell_exec, RPC_UTIL_REMOTE_SHELL_EXEC,
+			 remote_shell_exec, NULL);
+
+static void remote_shell_output_read(const struct nrf_rpc_group *group,
+				     struct nrf_rpc_cbor_ctx *ctx, void *handler_data)
+{
+	struct nrf_rpc_cbor_ctx rsp_ctx;
+	const char *output;
+	size_t output_len;
+	size_t offset;
+	size_t chunk_size;
+
+	offset = nrf_rpc_decode_uint(ctx);
+	chunk_size = nrf_rpc_decode_uint(ctx);
+
+	if (!nrf_rpc_decoding_done_and_check(group, ctx)) {
+		nrf_rpc_err(-EBADMSG, NRF_RPC_ERR_SRC_RECV, group,
+			    RPC_UTIL_REMOTE_SHELL_OUTPUT_READ, NRF_RPC_PACKET_TYPE_CMD);
+		return;
+	}
+
+	output = shell_get_output(&output_len);
+
+	if (offset >= output_len) {
+		chunk_size = 0;
+	} else {
+		chunk_size = MIN(chunk_size, output_len - offset);
+	}
+
+	NRF_RPC_CBOR_ALLOC(group, rsp_ctx, 5 + chunk_size);
+
+	nrf_rpc_encode_buffer(&rsp_ctx, output + offset, chunk_size);
+	nrf_rpc_cbor_rsp_no_err(group, &rsp_ctx);
+}
+
+NRF_RPC_CBOR_CMD_DECODER(rpc_utils_group, remote_shell_output_read,
+			 RPC_UTIL_REMOTE_SHELL_OUTPUT_READ, remote_shell_output_read, NULL);
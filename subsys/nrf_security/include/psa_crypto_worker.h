@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef PSA_CRYPTO_WORKER_H
+#define PSA_CRYPTO_WORKER_H
+
+/**
+ * @file psa_crypto_worker.h
+ *
+ * Optional executor that runs PSA crypto operations on dedicated low-priority
+ * worker threads, enabled with CONFIG_PSA_CRYPTO_WORKER.
+ *
+ * Long-running operations, typically public-key operations, can be submitted
+ * to the workers so they do not stall latency-sensitive threads, while short
+ * operations such as hashing are still called inline through the regular PSA
+ * Crypto API. The PSA Crypto core is protected by its internal mutexes, so
+ * inline and worker operations may run concurrently.
+ */
+
+#include <psa/crypto.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @brief Operation to run on a worker thread.
+ *
+ * The operation typically wraps one or more PSA Crypto API calls with its
+ * inputs and outputs carried in @p context.
+ *
+ * @param[in] context User context given to @ref psa_crypto_worker_submit.
+ *
+ * @return Status of the operation, passed on to the completion callback.
+ */
+typedef psa_status_t (*psa_crypto_worker_op_t)(void *context);
+
+/**
+ * @brief Completion callback for a submitted operation.
+ *
+ * The callback is invoked from the worker thread once the operation returns.
+ *
+ * @param[in] status  Status returned by the operation.
+ * @param[in] context User context given to @ref psa_crypto_worker_submit.
+ */
+typedef void (*psa_crypto_worker_callback_t)(psa_status_t status, void *context);
+
+/**
+ * @brief Submit an operation to run on a worker thread.
+ *
+ * The call does not block. Operations are run in submission order across
+ * the worker threads.
+ *
+ * @param[in] op       Operation to run.
+ * @param[in] callback Completion callback. Can be NULL if no completion
+ *                     notification is needed.
+ * @param[in] context  User context passed to the operation and the callback.
+ *                     Must stay valid until the callback is invoked.
+ *
+ * @retval 0       If the operation was queued.
+ * @retval -EINVAL If op is NULL.
+ * @retval -ENOMEM If all operation slots are in use.
+ */
+int psa_crypto_worker_submit(psa_crypto_worker_op_t op, psa_crypto_worker_callback_t callback,
+			     void *context);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PSA_CRYPTO_WORKER_H */
@@ -65,6 +65,25 @@ void cracen_acquire(void);
  */
 void cracen_release(void);
 
+/**
+ * @brief Keep CRACEN powered across a sequence of operations.
+ *
+ * Takes an extra user reference on the CRACEN peripheral so that it is not
+ * powered off between back-to-back operations, for example when verifying
+ * several image signatures during a multi-image DFU. This skips the repeated
+ * power-up work (interrupt setup and, on CRACEN Lite, the TRNG threshold
+ * reconfiguration) between the operations. Every call must be balanced with a
+ * call to @ref cracen_power_unhold.
+ */
+void cracen_power_hold(void);
+
+/**
+ * @brief Drop the reference taken by @ref cracen_power_hold.
+ *
+ * CRACEN is powered off when no other operation is using it.
+ */
+void cracen_power_unhold(void);
+
 /**
  * @}
  */
@@ -122,6 +122,16 @@ void cracen_release(void)
 	nrf_security_mutex_unlock(cracen_mutex);
 }
 
+void cracen_power_hold(void)
+{
+	cracen_acquire();
+}
+
+void cracen_power_unhold(void)
+{
+	cracen_release();
+}
+
 #define CRACEN_NOT_INITIALIZED 0x207467
 #define CRACEN_INITIALIZED     0x657311
 
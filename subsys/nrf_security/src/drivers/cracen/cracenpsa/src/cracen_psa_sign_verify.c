@@ -25,26 +25,44 @@
 #define CRACEN_EXTRACT_PUBKEY  (1)
 #define CRACEN_EXTRACT_PRIVKEY (0)
 
+/* Cycle count probes for tracking the crypto cost of the signature
+ * operations. Not available in the TF-M build, which has no access to the
+ * Zephyr latency probe registry.
+ */
+#if defined(CONFIG_NRF_LATENCY_PROBE) && !defined(__NRF_TFM__)
+#include <nrf_latency_probe.h>
+NRF_LATENCY_PROBE_DEFINE(cracen_sign);
+NRF_LATENCY_PROBE_DEFINE(cracen_verify);
+#define SIGN_VERIFY_PROBE_TIMESTAMP()	       NRF_LATENCY_PROBE_TIMESTAMP()
+#define SIGN_VERIFY_PROBE_RECORD(pname, start) NRF_LATENCY_PROBE_RECORD(pname, start)
+#else
+#define SIGN_VERIFY_PROBE_TIMESTAMP()	       0
+#define SIGN_VERIFY_PROBE_RECORD(pname, start) ((void)(start))
+#endif
+
 psa_status_t cracen_sign_message(const psa_key_attributes_t *attributes, const uint8_t *key_buffer,
 				 size_t key_buffer_size, psa_algorithm_t alg, const uint8_t *input,
 				 size_t input_length, uint8_t *signature, size_t signature_size,
 				 size_t *signature_length)
 {
+	psa_status_t status = PSA_ERROR_NOT_SUPPORTED;
+	uint32_t start = SIGN_VERIFY_PROBE_TIMESTAMP();
+
 	if (IS_ENABLED(PSA_NEED_CRACEN_ASYMMETRIC_SIGNATURE_ANY_ECC) &&
 	    PSA_KEY_TYPE_IS_ECC(psa_get_key_type(attributes))) {
-		return cracen_signature_ecc_sign(
+		status = cracen_signature_ecc_sign(
 			CRACEN_IS_MESSAGE, attributes, key_buffer, key_buffer_size, alg,
 			input, input_length, signature, signature_size, signature_length);
-	}
-
-	if (IS_ENABLED(PSA_NEED_CRACEN_ASYMMETRIC_SIGNATURE_ANY_RSA) &&
-	    PSA_KEY_TYPE_IS_RSA(psa_get_key_type(attributes))) {
-		return cracen_signature_rsa_sign(
+	} else if (IS_ENABLED(PSA_NEED_CRACEN_ASYMMETRIC_SIGNATURE_ANY_RSA) &&
+		   PSA_KEY_TYPE_IS_RSA(psa_get_key_type(attributes))) {
+		status = cracen_signature_rsa_sign(
 			CRACEN_IS_MESSAGE, attributes, key_buffer, key_buffer_size, alg,
 			input, input_length, signature, signature_size, signature_length);
 	}
 
-	return PSA_ERROR_NOT_SUPPORTED;
+	SIGN_VERIFY_PROBE_RECORD(cracen_sign, start);
+
+	return status;
 }
 
 psa_status_t cracen_sign_hash(const psa_key_attributes_t *attributes, const uint8_t *key_buffer,
@@ -52,21 +70,24 @@ psa_status_t cracen_sign_hash(const psa_key_attributes_t *attributes, const uint
 			      size_t hash_length, uint8_t *signature, size_t signature_size,
 			      size_t *signature_length)
 {
+	psa_status_t status = PSA_ERROR_NOT_SUPPORTED;
+	uint32_t start = SIGN_VERIFY_PROBE_TIMESTAMP();
+
 	if (IS_ENABLED(PSA_NEED_CRACEN_ASYMMETRIC_SIGNATURE_ANY_ECC) &&
 	    PSA_KEY_TYPE_IS_ECC(psa_get_key_type(attributes))) {
-		return cracen_signature_ecc_sign(
+		status = cracen_signature_ecc_sign(
 			CRACEN_IS_HASH, attributes, key_buffer, key_buffer_size, alg, hash,
 			hash_length, signature, signature_size, signature_length);
-	}
-
-	if (IS_ENABLED(PSA_NEED_CRACEN_ASYMMETRIC_SIGNATURE_ANY_RSA) &&
-	    PSA_KEY_TYPE_IS_RSA(psa_get_key_type(attributes))) {
-		return cracen_signature_rsa_sign(
+	} else if (IS_ENABLED(PSA_NEED_CRACEN_ASYMMETRIC_SIGNATURE_ANY_RSA) &&
+		   PSA_KEY_TYPE_IS_RSA(psa_get_key_type(attributes))) {
+		status = cracen_signature_rsa_sign(
 			CRACEN_IS_HASH, attributes, key_buffer, key_buffer_size, alg, hash,
 			hash_length, signature, signature_size, signature_length);
 	}
 
-	return PSA_ERROR_NOT_SUPPORTED;
+	SIGN_VERIFY_PROBE_RECORD(cracen_sign, start);
+
+	return status;
 }
 
 psa_status_t cracen_verify_message(const psa_key_attributes_t *attributes,
@@ -74,21 +95,24 @@ psa_status_t cracen_verify_message(const psa_key_attributes_t *attributes,
 				   psa_algorithm_t alg, const uint8_t *input, size_t input_length,
 				   const uint8_t *signature, size_t signature_length)
 {
+	psa_status_t status = PSA_ERROR_NOT_SUPPORTED;
+	uint32_t start = SIGN_VERIFY_PROBE_TIMESTAMP();
+
 	if (IS_ENABLED(PSA_NEED_CRACEN_ASYMMETRIC_SIGNATURE_ANY_ECC) &&
 	    PSA_KEY_TYPE_IS_ECC(psa_get_key_type(attributes))) {
-		return cracen_signature_ecc_verify(
+		status = cracen_signature_ecc_verify(
 			CRACEN_IS_MESSAGE, attributes, key_buffer, key_buffer_size, alg,
 			input, input_length, signature, signature_length);
-	}
-
-	if (IS_ENABLED(PSA_NEED_CRACEN_ASYMMETRIC_SIGNATURE_ANY_RSA) &&
-	    PSA_KEY_TYPE_IS_RSA(psa_get_key_type(attributes))) {
-		return cracen_signature_rsa_verify(
+	} else if (IS_ENABLED(PSA_NEED_CRACEN_ASYMMETRIC_SIGNATURE_ANY_RSA) &&
+		   PSA_KEY_TYPE_IS_RSA(psa_get_key_type(attributes))) {
+		status = cracen_signature_rsa_verify(
 			CRACEN_IS_MESSAGE, attributes, key_buffer, key_buffer_size, alg,
 			input, input_length, signature, signature_length);
 	}
 
-	return PSA_ERROR_NOT_SUPPORTED;
+	SIGN_VERIFY_PROBE_RECORD(cracen_verify, start);
+
+	return status;
 }
 
 psa_status_t cracen_verify_hash(const psa_key_attributes_t *attributes, const uint8_t *key_buffer,
@@ -96,19 +120,22 @@ psa_status_t cracen_verify_hash(const psa_key_attributes_t *attributes, const ui
 				size_t hash_length, const uint8_t *signature,
 				size_t signature_length)
 {
+	psa_status_t status = PSA_ERROR_NOT_SUPPORTED;
+	uint32_t start = SIGN_VERIFY_PROBE_TIMESTAMP();
+
 	if (IS_ENABLED(PSA_NEED_CRACEN_ASYMMETRIC_SIGNATURE_ANY_ECC) &&
 	    PSA_KEY_TYPE_IS_ECC(psa_get_key_type(attributes))) {
-		return cracen_signature_ecc_verify(CRACEN_IS_HASH, attributes, key_buffer,
-						   key_buffer_size, alg, hash, hash_length,
-						   signature, signature_length);
+		status = cracen_signature_ecc_verify(CRACEN_IS_HASH, attributes, key_buffer,
+						     key_buffer_size, alg, hash, hash_length,
+						     signature, signature_length);
+	} else if (IS_ENABLED(PSA_NEED_CRACEN_ASYMMETRIC_SIGNATURE_ANY_RSA) &&
+		   PSA_KEY_TYPE_IS_RSA(psa_get_key_type(attributes))) {
+		status = cracen_signature_rsa_verify(CRACEN_IS_HASH, attributes, key_buffer,
+						     key_buffer_size, alg, hash, hash_length,
+						     signature, signature_length);
 	}
 
-	if (IS_ENABLED(PSA_NEED_CRACEN_ASYMMETRIC_SIGNATURE_ANY_RSA) &&
-	    PSA_KEY_TYPE_IS_RSA(psa_get_key_type(attributes))) {
-		return cracen_signature_rsa_verify(CRACEN_IS_HASH, attributes, key_buffer,
-						   key_buffer_size, alg, hash, hash_length,
-						   signature, signature_length);
-	}
+	SIGN_VERIFY_PROBE_RECORD(cracen_verify, start);
 
-	return PSA_ERROR_NOT_SUPPORTED;
+	return status;
 }
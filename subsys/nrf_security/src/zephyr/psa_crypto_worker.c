@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/init.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+
+#include <psa_crypto_worker.h>
+
+/* Queued operation. The slots are taken from a static pool so that submission
+ * never allocates.
+ */
+struct psa_crypto_worker_item {
+	void *fifo_reserved;
+	psa_crypto_worker_op_t op;
+	psa_crypto_worker_callback_t callback;
+	void *context;
+	atomic_t in_use;
+};
+
+static struct psa_crypto_worker_item items[CONFIG_PSA_CRYPTO_WORKER_QUEUE_SIZE];
+
+static K_FIFO_DEFINE(worker_fifo);
+
+static K_THREAD_STACK_ARRAY_DEFINE(worker_stacks, CONFIG_PSA_CRYPTO_WORKER_THREAD_COUNT,
+				   CONFIG_PSA_CRYPTO_WORKER_STACK_SIZE);
+static struct k_thread worker_threads[CONFIG_PSA_CRYPTO_WORKER_THREAD_COUNT];
+
+int psa_crypto_worker_submit(psa_crypto_worker_op_t op, psa_crypto_worker_callback_t callback,
+			     void *context)
+{
+	struct psa_crypto_worker_item *item = NULL;
+
+	if (op == NULL) {
+		return -EINVAL;
+	}
+
+	for (size_t i = 0; i < ARRAY_SIZE(items); i++) {
+		if (atomic_cas(&items[i].in_use, 0, 1)) {
+			item = &items[i];
+			break;
+		}
+	}
+
+	if (item == NULL) {
+		return -ENOMEM;
+	}
+
+	item->op = op;
+	item->callback = callback;
+	item->context = context;
+
+	k_fifo_put(&worker_fifo, item);
+
+	return 0;
+}
+
+static void psa_crypto_worker_thread(void *p1, void *p2, void *p3)
+{
+	ARG_UNUSED(p1);
+	ARG_UNUSED(p2);
+	ARG_UNUSED(p3);
+
+	while (true) {
+		struct psa_crypto_worker_item *item = k_fifo_get(&worker_fifo, K_FOREVER);
+		psa_crypto_worker_op_t op = item->op;
+		psa_crypto_worker_callback_t callback = item->callback;
+		void *context = item->context;
+		psa_status_t status;
+
+		/* Release the slot before the callback so that the callback can
+		 * submit a follow-up operation.
+		 */
+		atomic_clear(&item->in_use);
+
+		status = op(context);
+
+		if (callback != NULL) {
+			callback(status, context);
+		}
+	}
+}
+
+static int psa_crypto_worker_init(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(worker_threads); i++) {
+		k_thread_create(&worker_threads[i], worker_stacks[i],
+				K_THREAD_STACK_SIZEOF(worker_stacks[i]), psa_crypto_worker_thread,
+				NULL, NULL, NULL, CONFIG_PSA_CRYPTO_WORKER_PRIORITY, 0, K_NO_WAIT);
+		k_thread_name_set(&worker_threads[i], "psa_crypto_worker");
+	}
+
+	return 0;
+}
+
+SYS_INIT(psa_crypto_worker_init, POST_KERNEL, CONFIG_KERNEL_INIT_PRIORITY_DEFAULT);
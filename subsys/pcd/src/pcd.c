@@ -217,14 +217,20 @@ static int network_core_pcd_cmdset(uint32_t cmd, const void *src_addr, size_t le
 		return 0;
 	}
 
-	do {
-		/* Wait for 1 second to avoid issue where network core
-		 * is unable to write to shared RAM.
-		 */
-		k_busy_wait(1 * USEC_PER_SEC);
+	/* Wait for 1 second to avoid issue where network core
+	 * is unable to write to shared RAM.
+	 */
+	k_busy_wait(1 * USEC_PER_SEC);
+	command_status = pcd_fw_copy_status_get();
 
+	while (command_status == initial_command_status) {
+		/* Poll completion at a finer granularity after the initial
+		 * wait so that the update phase does not round up to whole
+		 * seconds.
+		 */
+		k_busy_wait(10 * USEC_PER_MSEC);
 		command_status = pcd_fw_copy_status_get();
-	} while (command_status == initial_command_status);
+	}
 
 	if (command_status == PCD_STATUS_FAILED) {
 		LOG_ERR("Network core update failed");
@@ -25,11 +25,14 @@ extern "C" {
  *
  * Setting's name entries start from ZMS_NAMECNT_ID + 1.
  * The entry with ID == ZMS_NAMECNT_ID is used to store the largest name ID in use.
+ * The entry with ID == ZMS_NAME_INDEX_ID optionally stores the persisted name
+ * lookup index (an array of name hash and name ID pairs).
  *
  * Deleted records will not be found, only the last record will be read.
  */
 #define ZMS_NAMECNT_ID     0x80000000
 #define ZMS_NAME_ID_OFFSET 0x40000000
+#define ZMS_NAME_INDEX_ID  (ZMS_NAMECNT_ID - 1)
 
 struct settings_zms {
 	struct settings_store cf_store;
@@ -45,6 +48,9 @@ struct settings_zms {
 	uint32_t cache_next;
 	uint32_t cache_total;
 	bool loaded;
+#if CONFIG_SETTINGS_ZMS_PERSISTED_INDEX
+	bool index_valid;
+#endif
 #endif
 };
 
@@ -107,6 +107,76 @@ static uint32_t settings_zms_cache_match(struct settings_zms *cf, const char *na
 
 	return ZMS_NAMECNT_ID;
 }
+
+#if CONFIG_SETTINGS_ZMS_PERSISTED_INDEX
+static void settings_zms_index_update(struct settings_zms *cf)
+{
+	ssize_t rc;
+
+	if (!cf->loaded || SETTINGS_ZMS_CACHE_OVFL(cf)) {
+		/* The cache no longer covers all settings, so the persisted
+		 * index cannot be maintained either.
+		 */
+		if (cf->index_valid) {
+			(void)zms_delete(&cf->cf_zms, ZMS_NAME_INDEX_ID);
+			cf->index_valid = false;
+		}
+		return;
+	}
+
+	rc = zms_write(&cf->cf_zms, ZMS_NAME_INDEX_ID, cf->cache,
+		       cf->cache_total * sizeof(cf->cache[0]));
+	cf->index_valid = (rc >= 0);
+}
+
+static int settings_zms_load_indexed(struct settings_zms *cf, const struct settings_load_arg *arg)
+{
+	struct settings_zms_read_fn_arg read_fn_arg;
+	char name[SETTINGS_FULL_NAME_LEN];
+	ssize_t rc1, rc2;
+	uint32_t valid = 0;
+	int ret;
+
+	for (uint32_t i = 0; i < cf->cache_total; i++) {
+		uint32_t name_id = cf->cache[i].name_id;
+
+		rc1 = zms_read(&cf->cf_zms, name_id, &name, sizeof(name));
+		rc2 = zms_get_data_length(&cf->cf_zms, name_id + ZMS_NAME_ID_OFFSET);
+
+		if ((rc1 <= 0) || (rc2 <= 0)) {
+			/* Stale index entry: the settings item was deleted or
+			 * its storing was interrupted. Clean any leftovers and
+			 * drop the entry from the index.
+			 */
+			zms_delete(&cf->cf_zms, name_id);
+			zms_delete(&cf->cf_zms, name_id + ZMS_NAME_ID_OFFSET);
+			continue;
+		}
+
+		/* Found a name, this might not include a trailing \0 */
+		name[rc1] = '\0';
+		read_fn_arg.fs = &cf->cf_zms;
+		read_fn_arg.id = name_id + ZMS_NAME_ID_OFFSET;
+
+		cf->cache[valid].name_hash = cf->cache[i].name_hash;
+		cf->cache[valid++].name_id = name_id;
+
+		ret = settings_call_set_handler(name, rc2, settings_zms_read_fn, &read_fn_arg,
+						(void *)arg);
+		if (ret) {
+			return ret;
+		}
+	}
+
+	if (valid != cf->cache_total) {
+		cf->cache_total = valid;
+		cf->cache_next = valid % CONFIG_SETTINGS_ZMS_NAME_CACHE_SIZE;
+		settings_zms_index_update(cf);
+	}
+
+	return 0;
+}
+#endif /* CONFIG_SETTINGS_ZMS_PERSISTED_INDEX */
 #endif /* CONFIG_SETTINGS_ZMS_NAME_CACHE */
 
 static int settings_zms_load(struct settings_store *cs, const struct settings_load_arg *arg)
@@ -121,6 +191,15 @@ static int settings_zms_load(struct settings_store *cs, const struct settings_lo
 #if CONFIG_SETTINGS_ZMS_NAME_CACHE
 	uint32_t cached = 0;
 
+#if CONFIG_SETTINGS_ZMS_PERSISTED_INDEX
+	/* With a valid persisted index, only the settings that actually exist
+	 * need to be visited.
+	 */
+	if (cf->index_valid) {
+		return settings_zms_load_indexed(cf, arg);
+	}
+#endif
+
 	cf->loaded = false;
 #endif
 
@@ -194,6 +273,13 @@ static int settings_zms_load(struct settings_store *cs, const struct settings_lo
 			break;
 		}
 	}
+
+#if CONFIG_SETTINGS_ZMS_PERSISTED_INDEX
+	if (ret == 0) {
+		settings_zms_index_update(cf);
+	}
+#endif
+
 	return ret;
 }
 
@@ -317,6 +403,22 @@ found:
 		}
 	}
 
+#if CONFIG_SETTINGS_ZMS_NAME_CACHE
+	if (!name_in_cache) {
+		settings_zms_cache_add(cf, name, write_name_id);
+		if (cf->loaded && !SETTINGS_ZMS_CACHE_OVFL(cf)) {
+			cf->cache_total++;
+		}
+#if CONFIG_SETTINGS_ZMS_PERSISTED_INDEX
+		/* Update the index before the entry itself. A dangling index
+		 * entry is cleaned during load, while an entry missing from the
+		 * index would never be visited again.
+		 */
+		settings_zms_index_update(cf);
+#endif
+	}
+#endif
+
 	/* write the value */
 	rc = zms_write(&cf->cf_zms, write_name_id + ZMS_NAME_ID_OFFSET, value, val_len);
 	if (rc < 0) {
@@ -332,15 +434,6 @@ found:
 		}
 	}
 
-#if CONFIG_SETTINGS_ZMS_NAME_CACHE
-	if (!name_in_cache) {
-		settings_zms_cache_add(cf, name, write_name_id);
-		if (cf->loaded && !SETTINGS_ZMS_CACHE_OVFL(cf)) {
-			cf->cache_total++;
-		}
-	}
-#endif
-
 	return 0;
 }
 
@@ -367,6 +460,19 @@ int settings_zms_backend_init(struct settings_zms *cf)
 		cf->last_name_id = last_name_id;
 	}
 
+#if CONFIG_SETTINGS_ZMS_PERSISTED_INDEX
+	rc = zms_read(&cf->cf_zms, ZMS_NAME_INDEX_ID, cf->cache, sizeof(cf->cache));
+	if ((rc > 0) && (rc <= sizeof(cf->cache)) && ((rc % sizeof(cf->cache[0])) == 0)) {
+		cf->cache_total = rc / sizeof(cf->cache[0]);
+		cf->cache_next = cf->cache_total % CONFIG_SETTINGS_ZMS_NAME_CACHE_SIZE;
+		cf->loaded = true;
+		cf->index_valid = true;
+	} else if (rc > 0) {
+		/* Unusable index, e.g. the configured cache size was reduced. */
+		(void)zms_delete(&cf->cf_zms, ZMS_NAME_INDEX_ID);
+	}
+#endif
+
 	LOG_DBG("Initialized");
 	return 0;
 }
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
  */
 
+#include <zephyr/kernel.h>
 #include <zephyr/sys/util.h>
 #include <zephyr/logging/log.h>
 #include <mbedtls/platform_util.h>
@@ -47,6 +48,138 @@ typedef struct stored_object {
 	uint8_t data[AEAD_MAX_BUF_SIZE];
 } stored_object;
 
+#if defined(CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_READ_CACHE)
+/* Plaintext cache of decrypted objects. Entries are filled on the first
+ * successful read of an object and invalidated whenever it is written or
+ * removed, so frequently read assets are decrypted only once per boot.
+ */
+struct cache_entry {
+	psa_storage_uid_t uid; /* INVALID_UID when the entry is free */
+	const char *prefix;
+	size_t data_size;
+	uint32_t last_used;
+	uint8_t data[STORAGE_MAX_ASSET_SIZE];
+};
+
+static struct cache_entry cache[CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_READ_CACHE_ENTRIES];
+static uint32_t cache_use_counter;
+static K_MUTEX_DEFINE(cache_mutex);
+
+/* Expects the cache mutex to be locked. */
+static struct cache_entry *cache_find(const psa_storage_uid_t uid, const char *prefix)
+{
+	for (int i = 0; i < ARRAY_SIZE(cache); i++) {
+		if (cache[i].uid == uid && strcmp(cache[i].prefix, prefix) == 0) {
+			return &cache[i];
+		}
+	}
+
+	return NULL;
+}
+
+static bool cache_get(const psa_storage_uid_t uid, const char *prefix, size_t data_offset,
+		      size_t data_length, void *p_data, size_t *p_data_length,
+		      psa_status_t *status)
+{
+	struct cache_entry *entry;
+	size_t out_length;
+
+	k_mutex_lock(&cache_mutex, K_FOREVER);
+
+	entry = cache_find(uid, prefix);
+	if (entry == NULL) {
+		k_mutex_unlock(&cache_mutex);
+		return false;
+	}
+
+	entry->last_used = ++cache_use_counter;
+	out_length = entry->data_size;
+
+	if (data_offset > out_length) {
+		*p_data_length = 0;
+		*status = PSA_ERROR_INVALID_ARGUMENT;
+		k_mutex_unlock(&cache_mutex);
+		return true;
+	}
+
+	if ((data_offset + data_length) > out_length) {
+		out_length -= data_offset;
+	} else {
+		out_length = data_length;
+	}
+
+	memcpy(p_data, entry->data + data_offset, out_length);
+	*p_data_length = out_length;
+	*status = PSA_SUCCESS;
+
+	k_mutex_unlock(&cache_mutex);
+	return true;
+}
+
+static void cache_put(const psa_storage_uid_t uid, const char *prefix, const uint8_t *data,
+		      size_t data_size)
+{
+	struct cache_entry *entry;
+
+	k_mutex_lock(&cache_mutex, K_FOREVER);
+
+	entry = cache_find(uid, prefix);
+	if (entry == NULL) {
+		/* Take a free entry, or evict the least recently used one. */
+		entry = &cache[0];
+		for (int i = 0; i < ARRAY_SIZE(cache); i++) {
+			if (cache[i].uid == INVALID_UID) {
+				entry = &cache[i];
+				break;
+			}
+			if (cache[i].last_used < entry->last_used) {
+				entry = &cache[i];
+			}
+		}
+		mbedtls_platform_zeroize(entry->data, sizeof(entry->data));
+	}
+
+	entry->uid = uid;
+	entry->prefix = prefix;
+	entry->data_size = data_size;
+	entry->last_used = ++cache_use_counter;
+	memcpy(entry->data, data, data_size);
+
+	k_mutex_unlock(&cache_mutex);
+}
+
+static void cache_invalidate(const psa_storage_uid_t uid, const char *prefix)
+{
+	struct cache_entry *entry;
+
+	k_mutex_lock(&cache_mutex, K_FOREVER);
+
+	entry = cache_find(uid, prefix);
+	if (entry != NULL) {
+		mbedtls_platform_zeroize(entry, sizeof(*entry));
+		entry->uid = INVALID_UID;
+	}
+
+	k_mutex_unlock(&cache_mutex);
+}
+#else
+static inline bool cache_get(const psa_storage_uid_t uid, const char *prefix, size_t data_offset,
+			     size_t data_length, void *p_data, size_t *p_data_length,
+			     psa_status_t *status)
+{
+	return false;
+}
+
+static inline void cache_put(const psa_storage_uid_t uid, const char *prefix, const uint8_t *data,
+			     size_t data_size)
+{
+}
+
+static inline void cache_invalidate(const psa_storage_uid_t uid, const char *prefix)
+{
+}
+#endif /* CONFIG_TRUSTED_STORAGE_BACKEND_AEAD_READ_CACHE */
+
 psa_status_t trusted_get_info(const psa_storage_uid_t uid, const char *prefix,
 			      struct psa_storage_info_t *p_info)
 {
@@ -92,6 +225,10 @@ psa_status_t trusted_get(const psa_storage_uid_t uid, const char *prefix, size_t
 		return PSA_ERROR_INVALID_ARGUMENT;
 	}
 
+	if (cache_get(uid, prefix, data_offset, data_length, p_data, p_data_length, &status)) {
+		return status;
+	}
+
 	/* Get AEAD key */
 	status = trusted_storage_get_key(uid, key_buf, AEAD_KEY_SIZE);
 	if (status != PSA_SUCCESS) {
@@ -115,6 +252,8 @@ psa_status_t trusted_get(const psa_storage_uid_t uid, const char *prefix, size_t
 		goto clean_up;
 	}
 
+	cache_put(uid, prefix, object_data.data, out_length);
+
 	if (data_offset > out_length) {
 		*p_data_length = 0;
 		status = PSA_ERROR_INVALID_ARGUMENT;
@@ -172,6 +311,11 @@ psa_status_t trusted_set(const psa_storage_uid_t uid, const char *prefix, size_t
 		return PSA_ERROR_NOT_PERMITTED;
 	}
 
+	/* The stored object is about to change, or to be removed if writing
+	 * it fails. Either way the cached copy is stale.
+	 */
+	cache_invalidate(uid, prefix);
+
 	/* Get AEAD key */
 	status = trusted_storage_get_key(uid, key_buf, AEAD_KEY_SIZE);
 	if (status != PSA_SUCCESS) {
@@ -238,6 +382,8 @@ psa_status_t trusted_remove(const psa_storage_uid_t uid, const char *prefix)
 		return PSA_ERROR_NOT_PERMITTED;
 	}
 
+	cache_invalidate(uid, prefix);
+
 	return storage_remove_object(uid, prefix);
 }
 
@@ -445,8 +445,19 @@ static inline void on_rx_ready(const struct device *dev, struct uart_async_adapt
 	bool notify_now = false;
 
 	LOG_DBG("%s: Enter (%s)", __func__, dev->name);
-	if (data->rx.timeout != SYS_FOREVER_US) {
-		k_timer_start(&data->rx.timeout_timer, K_USEC(data->rx.timeout), K_NO_WAIT);
+	if ((data->rx.timeout != SYS_FOREVER_US) && (data->rx.timeout > 0)) {
+		/* Arm the timeout timer lazily. Restarting the timer on every
+		 * interrupt dominates the reception cost at high baud rates,
+		 * so only the reception timestamp is updated here and the
+		 * expiry handler re-arms the timer if new data arrived after
+		 * it was started. A zero timeout needs no timer as the data
+		 * is notified directly from the interrupt handler.
+		 */
+		data->rx.last_rx_ticks = k_uptime_ticks();
+		if (k_timer_remaining_ticks(&data->rx.timeout_timer) == 0) {
+			k_timer_start(&data->rx.timeout_timer, K_USEC(data->rx.timeout),
+				      K_NO_WAIT);
+		}
 	}
 	do {
 		k_spinlock_key_t key = k_spin_lock(&(data->lock));
@@ -585,6 +596,17 @@ static void tx_timeout(struct k_timer *timer)
 static void rx_timeout(struct k_timer *timer)
 {
 	const struct device *dev = k_timer_user_data_get(timer);
+	struct uart_async_adapter_data *data = access_dev_data(dev);
+	int64_t elapsed_ticks = k_uptime_ticks() - data->rx.last_rx_ticks;
+	int64_t timeout_ticks = k_us_to_ticks_ceil64(data->rx.timeout);
+
+	if (elapsed_ticks < timeout_ticks) {
+		/* Data was received after the timer was armed - measure the
+		 * timeout from the last reception.
+		 */
+		k_timer_start(timer, K_TICKS(timeout_ticks - elapsed_ticks), K_NO_WAIT);
+		return;
+	}
 
 	notify_rx_buffer(dev);
 }
@@ -0,0 +1,28 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef IPC_THROUGHPUT_PROTOCOL_H__
+#define IPC_THROUGHPUT_PROTOCOL_H__
+
+#include <stdint.h>
+
+/* First byte of every message sent to the remote. */
+enum ipc_throughput_msg_type {
+	IPC_THROUGHPUT_MSG_DATA = 1,
+	IPC_THROUGHPUT_MSG_REPORT_REQUEST = 2,
+};
+
+/* Sent by the remote in response to a report request. Counters cover everything received since
+ * the previous report request.
+ */
+struct ipc_throughput_report {
+	uint32_t rx_messages;
+	uint32_t rx_bytes;
+	/* CPU cycles spent in the receive callback, in remote core cycles. */
+	uint32_t busy_cycles;
+};
+
+#endif /* IPC_THROUGHPUT_PROTOCOL_H__ */
@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <zephyr/ztest.h>
+#include <zephyr/ipc/ipc_service.h>
+
+#include "ipc_throughput_protocol.h"
+
+#define IPC_TIMEOUT_MS	    5000
+#define MESSAGES_PER_BATCH  1000
+
+const struct device *const ipc0_instance = DEVICE_DT_GET(DT_NODELABEL(ipc0));
+
+static struct ipc_throughput_report report;
+
+K_SEM_DEFINE(endpoint_bound_sem, 0, 1);
+K_SEM_DEFINE(report_ready_sem, 0, 1);
+
+static void prepare_test_data(uint8_t *test_data, size_t len)
+{
+	test_data[0] = IPC_THROUGHPUT_MSG_DATA;
+	for (int i = 1; i < len; i++) {
+		test_data[i] = i;
+	}
+}
+
+static void ep_bound_callback(void *priv)
+{
+	k_sem_give(&endpoint_bound_sem);
+}
+
+static void ep_unbound_callback(void *priv)
+{
+	TC_PRINT("IPC endpoint unbounded\n");
+}
+
+static void ep_recv_callback(const void *data, size_t len, void *priv)
+{
+	if (len == sizeof(report)) {
+		memcpy(&report, data, sizeof(report));
+		k_sem_give(&report_ready_sem);
+	} else {
+		TC_PRINT("Unexpected message of %u bytes from the remote\n", len);
+	}
+}
+
+static void ep_error_callback(const char *message, void *priv)
+{
+	TC_PRINT("IPC data error: %s\n", message);
+}
+
+static struct ipc_ept_cfg test_ep_cfg = {
+	.name = "ep0",
+	.cb = {
+		.bound = ep_bound_callback,
+		.unbound = ep_unbound_callback,
+		.received = ep_recv_callback,
+		.error = ep_error_callback,
+	},
+};
+
+static void configure_ipc(struct ipc_ept *endpoint)
+{
+	int ret;
+
+	ret = ipc_service_open_instance(ipc0_instance);
+	zassert_false((ret < 0) && (ret != -EALREADY), "IPC instance open failed\n");
+	TC_PRINT("Instance opened\n");
+
+	ret = ipc_service_register_endpoint(ipc0_instance, endpoint, &test_ep_cfg);
+	zassert_ok(ret, "IPC endpoint register failed\n");
+	TC_PRINT("Endpoint registered\n");
+
+	TC_PRINT("Waiting for binding\n");
+	ret = k_sem_take(&endpoint_bound_sem, K_MSEC(IPC_TIMEOUT_MS));
+	zassert_ok(ret, "IPC timeout occurred while waiting for endpoint bound\n");
+	TC_PRINT("Binding done\n");
+
+	k_msleep(10);
+}
+
+/* Send a message, yielding while the backend is out of buffer space. Returns the number of
+ * retries needed, which indicates how often the sender saturated the transport.
+ */
+static uint32_t send_with_backpressure(struct ipc_ept *endpoint, const void *data, size_t len)
+{
+	int ret;
+	uint32_t busy_retries = 0;
+
+	while (true) {
+		ret = ipc_service_send(endpoint, data, len);
+		if (ret >= 0) {
+			return busy_retries;
+		}
+
+		zassert_true(ret == -EBUSY || ret == -ENOMEM || ret == -ENOBUFS,
+			     "Failed to send message over IPC: %d\n", ret);
+
+		busy_retries++;
+		k_yield();
+	}
+}
+
+static void test_ipc_throughput(struct ipc_ept *endpoint, size_t test_message_len)
+{
+	uint32_t busy_retries = 0;
+	uint8_t report_request = IPC_THROUGHPUT_MSG_REPORT_REQUEST;
+	uint8_t *test_data = (uint8_t *)k_malloc(test_message_len);
+
+	prepare_test_data(test_data, test_message_len);
+
+	uint32_t start_cycles = k_cycle_get_32();
+
+	for (uint32_t i = 0; i < MESSAGES_PER_BATCH; i++) {
+		busy_retries += send_with_backpressure(endpoint, test_data, test_message_len);
+	}
+
+	(void)send_with_backpressure(endpoint, &report_request, sizeof(report_request));
+	zassert_ok(k_sem_take(&report_ready_sem, K_MSEC(IPC_TIMEOUT_MS)),
+		   "IPC report receive timeout\n");
+
+	uint32_t elapsed_cycles = k_cycle_get_32() - start_cycles;
+	uint64_t elapsed_us = k_cyc_to_us_floor64(elapsed_cycles);
+
+	zassert_equal(report.rx_messages, MESSAGES_PER_BATCH,
+		      "Remote received %u of %u messages\n", report.rx_messages,
+		      MESSAGES_PER_BATCH);
+	zassert_equal(report.rx_bytes, (uint32_t)MESSAGES_PER_BATCH * test_message_len,
+		      "Remote received %u bytes\n", report.rx_bytes);
+
+	TC_PRINT("Results for %u messages of %u bytes:\n", MESSAGES_PER_BATCH, test_message_len);
+	TC_PRINT("  message rate [msg/s]: %llu\n",
+		 (uint64_t)MESSAGES_PER_BATCH * USEC_PER_SEC / elapsed_us);
+	TC_PRINT("  throughput [kB/s]: %llu\n",
+		 (uint64_t)report.rx_bytes * USEC_PER_SEC / elapsed_us / 1024);
+	TC_PRINT("  app core [cycles/msg]: %u\n", elapsed_cycles / MESSAGES_PER_BATCH);
+	TC_PRINT("  remote core rx callback [cycles/msg]: %u\n",
+		 report.busy_cycles / MESSAGES_PER_BATCH);
+	TC_PRINT("  busy retries: %u\n", busy_retries);
+
+	k_free(test_data);
+}
+
+ZTEST(ipc_throughput, test_ipc_throughput_app_rad)
+{
+	struct ipc_ept test_endpoint;
+
+	configure_ipc(&test_endpoint);
+
+	test_ipc_throughput(&test_endpoint, 16);
+	test_ipc_throughput(&test_endpoint, 32);
+	test_ipc_throughput(&test_endpoint, 64);
+	test_ipc_throughput(&test_endpoint, 128);
+#if defined(CONFIG_IPC_SERVICE_BACKEND_ICBMSG)
+	test_ipc_throughput(&test_endpoint, 256);
+	test_ipc_throughput(&test_endpoint, 512);
+#endif
+}
+
+void *test_setup(void)
+{
+	TC_PRINT("Hello\n");
+	k_msleep(100);
+
+	return NULL;
+}
+
+ZTEST_SUITE(ipc_throughput, NULL, test_setup, NULL, NULL, NULL);
@@ -0,0 +1,201 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(latency_gpio_loopback, LOG_LEVEL_INF);
+
+#include <zephyr/kernel.h>
+#include <zephyr/drivers/gpio.h>
+#include <helpers/nrfx_gppi.h>
+#include <nrfx_timer.h>
+#include <nrfx_gpiote.h>
+#include <gpiote_nrfx.h>
+#include <stdlib.h>
+
+/* Number of stimulus edges measured for one report. */
+#define SAMPLE_COUNT 1000
+
+/* Time to wait for the response after each stimulus edge. */
+#define RESPONSE_TIMEOUT K_MSEC(100)
+
+#define CAPTURE_INPUT_PIN NRF_DT_GPIOS_TO_PSEL(DT_PATH(zephyr_user), capture_gpios)
+
+static const struct gpio_dt_spec stimulus = GPIO_DT_SPEC_GET(DT_PATH(zephyr_user), stimulus_gpios);
+
+static nrfx_timer_t timer_instance = NRFX_TIMER_INSTANCE(DT_REG_ADDR(DT_NODELABEL(tst_timer)));
+
+static K_SEM_DEFINE(response_sem, 0, 1);
+
+/* Latency samples in timer ticks. */
+static uint32_t isr_samples[SAMPLE_COUNT];
+static uint32_t thread_samples[SAMPLE_COUNT];
+
+static void timer_handler(nrf_timer_event_t event, void *p_context)
+{
+	ARG_UNUSED(event);
+	ARG_UNUSED(p_context);
+}
+
+static void capture_pin_handler(nrfx_gpiote_pin_t pin, nrfx_gpiote_trigger_t trigger,
+				void *context)
+{
+	ARG_UNUSED(pin);
+	ARG_UNUSED(trigger);
+	ARG_UNUSED(context);
+
+	/* The stimulus edge itself is timestamped on CC0 by the (D)PPI connection with no CPU
+	 * involvement. Timestamp the interrupt handler entry on CC1.
+	 */
+	(void)nrfx_timer_capture(&timer_instance, NRF_TIMER_CC_CHANNEL1);
+
+	k_sem_give(&response_sem);
+}
+
+static int compare_samples(const void *a, const void *b)
+{
+	uint32_t sample_a = *(const uint32_t *)a;
+	uint32_t sample_b = *(const uint32_t *)b;
+
+	return (sample_a > sample_b) - (sample_a < sample_b);
+}
+
+static uint32_t percentile(const uint32_t *samples, uint32_t percent)
+{
+	return samples[(SAMPLE_COUNT - 1) * percent / 100];
+}
+
+static void report(const char *name, uint32_t *samples, uint32_t ticks_per_us)
+{
+	static const uint8_t percentiles[] = {50, 90, 99};
+
+	qsort(samples, SAMPLE_COUNT, sizeof(samples[0]), compare_samples);
+
+	LOG_INF("%s latency over %u samples:", name, SAMPLE_COUNT);
+	LOG_INF("  min: %u.%02u us", samples[0] / ticks_per_us,
+		(samples[0] % ticks_per_us) * 100 / ticks_per_us);
+	for (size_t i = 0; i < ARRAY_SIZE(percentiles); i++) {
+		uint32_t ticks = percentile(samples, percentiles[i]);
+
+		LOG_INF("  p%u: %u.%02u us", percentiles[i], ticks / ticks_per_us,
+			(ticks % ticks_per_us) * 100 / ticks_per_us);
+	}
+	LOG_INF("  max: %u.%02u us", samples[SAMPLE_COUNT - 1] / ticks_per_us,
+		(samples[SAMPLE_COUNT - 1] % ticks_per_us) * 100 / ticks_per_us);
+}
+
+int main(void)
+{
+	int ret;
+	uint32_t base_frequency = NRFX_TIMER_BASE_FREQUENCY_GET(&timer_instance);
+	uint32_t ticks_per_us = base_frequency / USEC_PER_SEC;
+
+	LOG_INF("GPIO loopback latency benchmark on %s", CONFIG_BOARD_TARGET);
+	LOG_INF("Timer base frequency: %u Hz", base_frequency);
+	LOG_INF("===================================================================");
+
+	ret = gpio_pin_configure_dt(&stimulus, GPIO_OUTPUT_INACTIVE);
+	if (ret != 0) {
+		LOG_ERR("gpio_pin_configure_dt(), err: %d", ret);
+		return -1;
+	}
+
+	/* Configure GPIOTE on the capture pin. */
+	uint8_t gpiote_channel;
+	nrfx_gpiote_t gpiote_instance =
+		GPIOTE_NRFX_INST_BY_NODE(NRF_DT_GPIOTE_NODE(DT_PATH(zephyr_user), capture_gpios));
+
+	ret = nrfx_gpiote_channel_alloc(&gpiote_instance, &gpiote_channel);
+	if (ret != 0) {
+		LOG_ERR("nrfx_gpiote_channel_alloc(), err: %d", ret);
+		return -1;
+	}
+
+	nrfx_gpiote_trigger_config_t trigger_cfg = {
+		.p_in_channel = &gpiote_channel,
+		.trigger = NRFX_GPIOTE_TRIGGER_TOGGLE,
+	};
+
+	nrfx_gpiote_handler_config_t handler_cfg = {
+		.handler = capture_pin_handler,
+	};
+
+	nrf_gpio_pin_pull_t pull_cfg = NRFX_GPIOTE_DEFAULT_PULL_CONFIG;
+
+	nrfx_gpiote_input_pin_config_t gpiote_cfg = {
+		.p_pull_config = &pull_cfg,
+		.p_trigger_config = &trigger_cfg,
+		.p_handler_config = &handler_cfg,
+	};
+
+	ret = nrfx_gpiote_input_configure(&gpiote_instance, CAPTURE_INPUT_PIN, &gpiote_cfg);
+	if (ret != 0) {
+		LOG_ERR("nrfx_gpiote_input_configure(), err: %d", ret);
+		return -1;
+	}
+
+	nrfx_gpiote_trigger_enable(&gpiote_instance, CAPTURE_INPUT_PIN, true);
+
+	/* Configure Timer as a free running timestamp source. */
+	nrfx_timer_config_t timer_config = NRFX_TIMER_DEFAULT_CONFIG(base_frequency);
+
+	timer_config.bit_width = NRF_TIMER_BIT_WIDTH_32;
+	timer_config.mode = NRF_TIMER_MODE_TIMER;
+
+	ret = nrfx_timer_init(&timer_instance, &timer_config, timer_handler);
+	if (ret != 0) {
+		LOG_ERR("nrfx_timer_init(), err: %d", ret);
+		return -1;
+	}
+
+	nrfx_timer_enable(&timer_instance);
+
+	/* Configure GPPI from GPIOTE to the Timer CAPTURE0 task. */
+	nrfx_gppi_handle_t gppi_handle;
+	uint32_t eep = nrfx_gpiote_in_event_address_get(&gpiote_instance, CAPTURE_INPUT_PIN);
+	uint32_t tep = nrfx_timer_task_address_get(&timer_instance, NRF_TIMER_TASK_CAPTURE0);
+
+	ret = nrfx_gppi_conn_alloc(eep, tep, &gppi_handle);
+	if (ret != 0) {
+		LOG_ERR("GPPI channel allocation failed, err: %d", ret);
+		return -1;
+	}
+	nrfx_gppi_conn_enable(gppi_handle);
+
+	for (uint32_t i = 0; i < SAMPLE_COUNT; i++) {
+		ret = gpio_pin_toggle_dt(&stimulus);
+		if (ret != 0) {
+			LOG_ERR("gpio_pin_toggle_dt(), err: %d", ret);
+			return -1;
+		}
+
+		ret = k_sem_take(&response_sem, RESPONSE_TIMEOUT);
+		if (ret != 0) {
+			LOG_ERR("No response to stimulus edge %u, check the wire connection", i);
+			LOG_INF("Test failed");
+			return -1;
+		}
+
+		/* Timestamp the responding thread on CC2. */
+		uint32_t stimulus_ticks = nrfx_timer_capture_get(&timer_instance,
+								 NRF_TIMER_CC_CHANNEL0);
+		uint32_t isr_ticks = nrfx_timer_capture_get(&timer_instance,
+							    NRF_TIMER_CC_CHANNEL1);
+		uint32_t thread_ticks = nrfx_timer_capture(&timer_instance,
+							   NRF_TIMER_CC_CHANNEL2);
+
+		isr_samples[i] = isr_ticks - stimulus_ticks;
+		thread_samples[i] = thread_ticks - stimulus_ticks;
+
+		k_msleep(1);
+	}
+
+	report("Stimulus edge to interrupt handler", isr_samples, ticks_per_us);
+	report("Stimulus edge to responding thread", thread_samples, ticks_per_us);
+
+	LOG_INF("Latency benchmark finished");
+
+	return 0;
+}
@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2026, Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/settings/settings.h>
+#include <zephyr/storage/flash_map.h>
+#include <zephyr/storage/stream_flash.h>
+#include <zephyr/drivers/flash.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+/* Number of settings writes in the commit rate benchmark. Writing this many entries over a
+ * small set of keys forces the settings backend to garbage collect, so the tail latencies
+ * include the garbage collection stalls.
+ */
+#define SETTINGS_OPS	   400
+/* Number of distinct settings keys the writes are spread over. */
+#define SETTINGS_KEY_COUNT 16
+
+#define STREAM_CHUNK_SIZE 256
+#define STREAM_TOTAL_SIZE (16 * 1024)
+
+/* Settings entry sizes in bytes, skewed towards the small entries that dominate real
+ * configuration data.
+ */
+static const uint8_t entry_sizes[] = {8, 8, 12, 16, 16, 24, 32, 64, 128};
+
+static uint32_t latency_samples[SETTINGS_OPS];
+static uint8_t entry_data[128];
+static uint8_t stream_buf[STREAM_CHUNK_SIZE];
+static uint8_t chunk_data[STREAM_CHUNK_SIZE];
+
+static int compare_samples(const void *a, const void *b)
+{
+	uint32_t sample_a = *(const uint32_t *)a;
+	uint32_t sample_b = *(const uint32_t *)b;
+
+	return (sample_a > sample_b) - (sample_a < sample_b);
+}
+
+static void report_latencies(const char *name, uint32_t *samples, uint32_t count)
+{
+	static const uint8_t percentiles[] = {50, 90, 99};
+
+	qsort(samples, count, sizeof(samples[0]), compare_samples);
+
+	TC_PRINT("%s latency over %u operations:\n", name, count);
+	TC_PRINT("  min: %llu us\n", k_cyc_to_us_floor64(samples[0]));
+	for (size_t i = 0; i < ARRAY_SIZE(percentiles); i++) {
+		TC_PRINT("  p%u: %llu us\n", percentiles[i],
+			 k_cyc_to_us_floor64(samples[(count - 1) * percentiles[i] / 100]));
+	}
+	TC_PRINT("  max: %llu us\n", k_cyc_to_us_floor64(samples[count - 1]));
+}
+
+/* The benchmarks in this suite run in declaration order. The stream_flash benchmark erases
+ * the storage partition that the settings backend mounted, so it must stay last.
+ */
+ZTEST(storage_io, test_1_settings_commit_rate)
+{
+	int ret;
+	char key[32];
+	uint32_t total_bytes = 0;
+	uint64_t total_us;
+	uint32_t start_cycles;
+
+	ret = settings_subsys_init();
+	zassert_ok(ret, "settings_subsys_init() failed, err: %d\n", ret);
+
+	for (size_t i = 0; i < sizeof(entry_data); i++) {
+		entry_data[i] = i;
+	}
+
+	start_cycles = k_cycle_get_32();
+
+	for (uint32_t i = 0; i < SETTINGS_OPS; i++) {
+		size_t entry_size = entry_sizes[i % ARRAY_SIZE(entry_sizes)];
+		uint32_t op_start = k_cycle_get_32();
+
+		snprintf(key, sizeof(key), "bench/e%u", i % SETTINGS_KEY_COUNT);
+		/* Vary the value so that the backend cannot skip the write as a duplicate. */
+		entry_data[0] = (uint8_t)i;
+
+		ret = settings_save_one(key, entry_data, entry_size);
+		zassert_ok(ret, "settings_save_one() failed, err: %d\n", ret);
+
+		latency_samples[i] = k_cycle_get_32() - op_start;
+		total_bytes += entry_size;
+	}
+
+	total_us = k_cyc_to_us_floor64(k_cycle_get_32() - start_cycles);
+
+	TC_PRINT("Settings commit rate over %u writes (%u bytes of values):\n", SETTINGS_OPS,
+		 total_bytes);
+	TC_PRINT("  rate [ops/s]: %llu\n", (uint64_t)SETTINGS_OPS * USEC_PER_SEC / total_us);
+	report_latencies("Settings write", latency_samples, SETTINGS_OPS);
+}
+
+ZTEST(storage_io, test_2_stream_flash_throughput)
+{
+	int ret;
+	const struct flash_area *fa;
+	struct stream_flash_ctx stream;
+	uint32_t chunk_count = STREAM_TOTAL_SIZE / STREAM_CHUNK_SIZE;
+	uint64_t total_us;
+	uint32_t start_cycles;
+
+	ret = flash_area_open(FIXED_PARTITION_ID(storage_partition), &fa);
+	zassert_ok(ret, "flash_area_open() failed, err: %d\n", ret);
+	zassert_true(fa->fa_size >= STREAM_TOTAL_SIZE, "Storage partition too small\n");
+
+	ret = flash_area_erase(fa, 0, STREAM_TOTAL_SIZE);
+	zassert_ok(ret, "flash_area_erase() failed, err: %d\n", ret);
+
+	ret = stream_flash_init(&stream, flash_area_get_device(fa), stream_buf,
+				sizeof(stream_buf), fa->fa_off, STREAM_TOTAL_SIZE, NULL);
+	zassert_ok(ret, "stream_flash_init() failed, err: %d\n", ret);
+
+	for (size_t i = 0; i < sizeof(chunk_data); i++) {
+		chunk_data[i] = i;
+	}
+
+	start_cycles = k_cycle_get_32();
+
+	for (uint32_t i = 0; i < chunk_count; i++) {
+		uint32_t op_start = k_cycle_get_32();
+
+		ret = stream_flash_buffered_write(&stream, chunk_data, STREAM_CHUNK_SIZE,
+						  i == (chunk_count - 1));
+		zassert_ok(ret, "stream_flash_buffered_write() failed, err: %d\n", ret);
+
+		latency_samples[i] = k_cycle_get_32() - op_start;
+	}
+
+	total_us = k_cyc_to_us_floor64(k_cycle_get_32() - start_cycles);
+
+	TC_PRINT("Stream flash throughput over %u bytes in %u byte chunks:\n", STREAM_TOTAL_SIZE,
+		 STREAM_CHUNK_SIZE);
+	TC_PRINT("  throughput [kB/s]: %llu\n",
+		 (uint64_t)STREAM_TOTAL_SIZE * USEC_PER_SEC / total_us / 1024);
+	report_latencies("Chunk write", latency_samples, chunk_count);
+
+	flash_area_close(fa);
+}
+
+void *suite_setup(void)
+{
+	TC_PRINT("Storage I/O benchmark on %s\n", CONFIG_BOARD_TARGET);
+	TC_PRINT("===================================================================\n");
+
+	return NULL;
+}
+
+ZTEST_SUITE(storage_io, NULL, suite_setup, NULL, NULL, NULL);
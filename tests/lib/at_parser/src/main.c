@@ -2190,4 +2190,84 @@ ZTEST(at_parser, test_at_parser_cmd_next)
 	zassert_equal(num, 6);
 }
 
+ZTEST(at_parser, test_at_parser_seek_unread_subparams)
+{
+	int ret;
+	struct at_parser parser;
+	char buffer[32];
+	uint32_t buffer_len;
+	int32_t num;
+
+	/* Subparameters before the requested index are skipped without being read.
+	 * Commas inside quoted strings and arrays do not delimit subparameters.
+	 */
+	const char *str1 = "+NOTIF: 1,\"76C1,X\",\"0102,DA04\",(1,2),7\r\n";
+
+	ret = at_parser_init(&parser, str1);
+	zassert_ok(ret);
+
+	ret = at_parser_num_get(&parser, 5, &num);
+	zassert_ok(ret);
+	zassert_equal(num, 7);
+
+	/* Seeking backwards rewinds the parser and seeks from the beginning. */
+	buffer_len = sizeof(buffer);
+	ret = at_parser_string_get(&parser, 2, buffer, &buffer_len);
+	zassert_ok(ret);
+	zassert_equal(strlen("76C1,X"), buffer_len);
+	zassert_mem_equal("76C1,X", buffer, buffer_len);
+
+	/* Empty subparameters before the requested index. */
+	const char *str2 = "+TEST: ,,,1\r\n";
+
+	ret = at_parser_init(&parser, str2);
+	zassert_ok(ret);
+
+	ret = at_parser_num_get(&parser, 4, &num);
+	zassert_ok(ret);
+	zassert_equal(num, 1);
+
+	const char *str3 = "+CPSMS: 1,,,\"10101111\",\"01101100\"\r\n";
+
+	ret = at_parser_init(&parser, str3);
+	zassert_ok(ret);
+
+	buffer_len = sizeof(buffer);
+	ret = at_parser_string_get(&parser, 5, buffer, &buffer_len);
+	zassert_ok(ret);
+	zassert_equal(strlen("01101100"), buffer_len);
+	zassert_mem_equal("01101100", buffer, buffer_len);
+
+	/* A trailing comma means that the last subparameter is empty, with and
+	 * without a line ending.
+	 */
+	const char *str4 = "+NOTIF: 1,2,";
+
+	ret = at_parser_init(&parser, str4);
+	zassert_ok(ret);
+
+	ret = at_parser_num_get(&parser, 3, &num);
+	zassert_equal(ret, -ENODATA);
+
+	const char *str5 = "+NOTIF: 1,2,\r\n";
+
+	ret = at_parser_init(&parser, str5);
+	zassert_ok(ret);
+
+	ret = at_parser_num_get(&parser, 3, &num);
+	zassert_equal(ret, -ENODATA);
+
+	/* Seeking past the last subparameter. */
+	const char *str6 = "+NOTIF: 1,2";
+
+	ret = at_parser_init(&parser, str6);
+	zassert_ok(ret);
+
+	ret = at_parser_num_get(&parser, 3, &num);
+	zassert_equal(ret, -EIO);
+
+	ret = at_parser_num_get(&parser, 10, &num);
+	zassert_equal(ret, -EIO);
+}
+
 ZTEST_SUITE(at_parser, NULL, NULL, NULL, NULL, NULL);
@@ -42,6 +42,65 @@ ZTEST(suite_contin_array, test_simp_arr_loop)
 	}
 }
 
+ZTEST(suite_contin_array, test_simp_arr_slice)
+{
+	const uint32_t NUM_ITERATIONS = 200;
+	const size_t SLICE_SIZE = 97; /* Test with random "uneven" value */
+	const size_t const_arr_size = ARRAY_SIZE(test_arr);
+	char splice_buf[SLICE_SIZE];
+	char contin_arr[SLICE_SIZE];
+	void const *slice;
+	int ret;
+
+	uint32_t slice_pos = 0;
+	uint32_t finite_pos = 0;
+
+	for (int i = 0; i < NUM_ITERATIONS; i++) {
+		ret = contin_array_slice_get(test_arr, const_arr_size, SLICE_SIZE, splice_buf,
+					     &slice_pos, &slice);
+		zassert_equal(ret, 0, "contin_array_slice_get did not return zero");
+
+		/* The copying variant serves as the reference */
+		ret = contin_array_create(contin_arr, SLICE_SIZE, test_arr, const_arr_size,
+					  &finite_pos);
+		zassert_equal(ret, 0, "contin_array_create did not return zero");
+
+		zassert_mem_equal(slice, contin_arr, SLICE_SIZE,
+				  "Slice does not match the copied reference");
+		zassert_equal(slice_pos, finite_pos, "Positions have diverged");
+
+		/* Only slices straddling the wrap-around may use the splice buffer */
+		if (slice == splice_buf) {
+			zassert_true(slice_pos < SLICE_SIZE, "Contiguous slice was copied");
+		}
+	}
+}
+
+ZTEST(suite_contin_array, test_simp_arr_slice_illegal_args)
+{
+	const size_t const_arr_size = ARRAY_SIZE(test_arr);
+	char splice_buf[16];
+	void const *slice;
+
+	uint32_t slice_pos = 0;
+
+	zassert_equal(contin_array_slice_get(NULL, const_arr_size, sizeof(splice_buf), splice_buf,
+					     &slice_pos, &slice),
+		      -ENXIO, "Wrong code returned");
+	zassert_equal(contin_array_slice_get(test_arr, const_arr_size, sizeof(splice_buf), NULL,
+					     &slice_pos, &slice),
+		      -ENXIO, "Wrong code returned");
+	zassert_equal(contin_array_slice_get(test_arr, 0, sizeof(splice_buf), splice_buf,
+					     &slice_pos, &slice),
+		      -EPERM, "Wrong code returned");
+	zassert_equal(contin_array_slice_get(test_arr, const_arr_size, 0, splice_buf, &slice_pos,
+					     &slice),
+		      -EPERM, "Wrong code returned");
+	zassert_equal(contin_array_slice_get(test_arr, const_arr_size, const_arr_size + 1,
+					     splice_buf, &slice_pos, &slice),
+		      -EINVAL, "Wrong code returned");
+}
+
 /* Test with const array size being shorter than contin array size */
 ZTEST(suite_contin_array, test_simp_arr_loop_short)
 {
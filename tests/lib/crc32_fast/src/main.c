@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <zephyr/sys/crc.h>
+#include <string.h>
+
+#include <crc32_fast.h>
+
+#define TEST_DATA_LEN 1024
+
+static uint8_t test_data[TEST_DATA_LEN];
+
+static void *setup(void)
+{
+	uint32_t seed = 0x12345678;
+
+	/* Deterministic pseudo-random test data. */
+	for (size_t i = 0; i < sizeof(test_data); i++) {
+		seed = seed * 1103515245 + 12345;
+		test_data[i] = seed >> 16;
+	}
+
+	return NULL;
+}
+
+/* Known CRC-32 check value of the string "123456789". */
+ZTEST(crc32_fast, test_crc32_fast_check_value)
+{
+	const uint8_t check[] = "123456789";
+
+	zassert_equal(crc32_fast(check, strlen("123456789")), 0xCBF43926);
+}
+
+/* An empty buffer must not change the CRC. */
+ZTEST(crc32_fast, test_crc32_fast_empty)
+{
+	zassert_equal(crc32_fast(test_data, 0), crc32_ieee(test_data, 0));
+	zassert_equal(crc32_fast_update(0, test_data, 0), 0);
+	zassert_equal(crc32_fast_update(0xDEADBEEF, test_data, 0), 0xDEADBEEF);
+}
+
+/* The slice-by-8 implementation aligns its input and handles leading and
+ * trailing bytes separately, so compare against the byte-at-a-time
+ * implementation for every start alignment and for lengths around the
+ * eight-byte block size.
+ */
+ZTEST(crc32_fast, test_crc32_fast_unaligned)
+{
+	for (size_t offset = 0; offset < 8; offset++) {
+		for (size_t len = 0; len <= 64; len++) {
+			zassert_equal(crc32_fast(&test_data[offset], len),
+				      crc32_ieee(&test_data[offset], len),
+				      "offset %u len %u", offset, len);
+		}
+	}
+}
+
+/* Chaining the CRC over multiple blocks must give the same result as one
+ * pass over the whole buffer, for any split point.
+ */
+ZTEST(crc32_fast, test_crc32_fast_multi_block)
+{
+	uint32_t expected = crc32_ieee(test_data, sizeof(test_data));
+
+	for (size_t split = 0; split <= sizeof(test_data); split += 37) {
+		uint32_t crc = crc32_fast_update(0, test_data, split);
+
+		crc = crc32_fast_update(crc, &test_data[split], sizeof(test_data) - split);
+		zassert_equal(crc, expected, "split %u", split);
+	}
+
+	/* Both implementations must be chainable with each other. */
+	uint32_t crc = crc32_ieee_update(0, test_data, 100);
+
+	crc = crc32_fast_update(crc, &test_data[100], sizeof(test_data) - 100);
+	zassert_equal(crc, expected);
+
+	crc = crc32_fast_update(0, test_data, 100);
+	crc = crc32_ieee_update(crc, &test_data[100], sizeof(test_data) - 100);
+	zassert_equal(crc, expected);
+}
+
+ZTEST_SUITE(crc32_fast, NULL, setup, NULL, NULL, NULL);
@@ -231,4 +231,132 @@ ZTEST(suite_data_fifo, test_data_fifo_data_put_size_zero)
 	zassert_equal(ret, -EINVAL, "block_lock did not return -EINVAL");
 }
 
+static uint32_t ext_release_num_called;
+static void *ext_release_last_data;
+
+static void ext_release_cb(void *data, void *user_data)
+{
+	ext_release_num_called++;
+	ext_release_last_data = data;
+	zassert_equal_ptr(user_data, &ext_release_num_called, "wrong user_data in release cb");
+}
+
+ZTEST(suite_data_fifo, test_data_fifo_ext_block)
+{
+	DATA_FIFO_DEFINE(data_fifo, 10, 128);
+
+	int ret;
+	uint8_t ext_buffer[256] = {0xa1, 0xa2, 0xa3};
+
+	ext_release_num_called = 0;
+	ext_release_last_data = NULL;
+
+	ret = data_fifo_init(&data_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	ret = data_fifo_ext_block_put(&data_fifo, ext_buffer, sizeof(ext_buffer), ext_release_cb,
+				      &ext_release_num_called);
+	zassert_equal(ret, 0, "ext_block_put did not return 0");
+
+	internal_test_remaining_elements(&data_fifo, 1, 1, __LINE__);
+
+	/* Second reader takes an extra reference */
+	ret = data_fifo_ext_block_ref(&data_fifo, ext_buffer);
+	zassert_equal(ret, 0, "ext_block_ref did not return 0");
+
+	uint8_t *data_ptr;
+	size_t data_size;
+
+	ret = data_fifo_pointer_last_filled_get(&data_fifo, (void **)&data_ptr, &data_size,
+						K_NO_WAIT);
+	zassert_equal(ret, 0, "last_filled_get did not return 0");
+	zassert_equal_ptr(data_ptr, ext_buffer, "did not get pointer to external buffer");
+	zassert_equal(data_size, sizeof(ext_buffer), "wrong size for external block");
+
+	data_fifo_block_free(&data_fifo, data_ptr);
+	zassert_equal(ext_release_num_called, 0, "release cb called with reference held");
+
+	data_fifo_block_free(&data_fifo, data_ptr);
+	zassert_equal(ext_release_num_called, 1, "release cb not called on last free");
+	zassert_equal_ptr(ext_release_last_data, ext_buffer, "wrong data in release cb");
+
+	internal_test_remaining_elements(&data_fifo, 0, 0, __LINE__);
+}
+
+ZTEST(suite_data_fifo, test_data_fifo_ext_block_invalid)
+{
+	DATA_FIFO_DEFINE(data_fifo, 10, 128);
+
+	int ret;
+	uint8_t ext_buffer[16];
+
+	ret = data_fifo_init(&data_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	ret = data_fifo_ext_block_put(&data_fifo, NULL, sizeof(ext_buffer), NULL, NULL);
+	zassert_equal(ret, -EINVAL, "ext_block_put did not return -EINVAL for NULL data");
+
+	ret = data_fifo_ext_block_put(&data_fifo, ext_buffer, 0, NULL, NULL);
+	zassert_equal(ret, -EINVAL, "ext_block_put did not return -EINVAL for zero size");
+
+	ret = data_fifo_ext_block_ref(&data_fifo, ext_buffer);
+	zassert_equal(ret, -ENODEV, "ext_block_ref did not return -ENODEV");
+}
+
+ZTEST(suite_data_fifo, test_data_fifo_spsc)
+{
+	DATA_FIFO_SPSC_DEFINE(data_fifo, 4, 64);
+
+	int ret;
+	uint8_t *data_ptr;
+	size_t data_size;
+
+	ret = data_fifo_init(&data_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	/* Fetching from an empty SPSC FIFO must fail */
+	ret = data_fifo_pointer_last_filled_get(&data_fifo, (void **)&data_ptr, &data_size,
+						K_NO_WAIT);
+	zassert_equal(ret, -ENOMSG, "last_filled_get did not return -ENOMSG");
+
+	for (uint32_t i = 0; i < 4; i++) {
+		ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr, K_NO_WAIT);
+		zassert_equal(ret, 0, "first_vacant_get did not return 0");
+		data_ptr[0] = i;
+
+		ret = data_fifo_block_lock(&data_fifo, (void **)&data_ptr, 1);
+		zassert_equal(ret, 0, "block_lock did not return 0");
+
+		internal_test_remaining_elements(&data_fifo, i + 1, i + 1, __LINE__);
+	}
+
+	/* Ring is full */
+	ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr, K_NO_WAIT);
+	zassert_equal(ret, -ENOMEM, "first_vacant_get did not return -ENOMEM when full");
+
+	for (uint32_t i = 0; i < 4; i++) {
+		ret = data_fifo_pointer_last_filled_get(&data_fifo, (void **)&data_ptr, &data_size,
+							K_NO_WAIT);
+		zassert_equal(ret, 0, "last_filled_get did not return 0");
+		zassert_equal(data_size, 1, "wrong size for SPSC block");
+		zassert_equal(data_ptr[0], i, "blocks fetched out of order");
+
+		data_fifo_block_free(&data_fifo, data_ptr);
+	}
+
+	internal_test_remaining_elements(&data_fifo, 0, 0, __LINE__);
+
+	/* Index wrap-around: reuse the ring after a full cycle */
+	ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr, K_NO_WAIT);
+	zassert_equal(ret, 0, "first_vacant_get did not return 0 after wrap");
+
+	ret = data_fifo_block_lock(&data_fifo, (void **)&data_ptr, 1);
+	zassert_equal(ret, 0, "block_lock did not return 0 after wrap");
+
+	ret = data_fifo_empty(&data_fifo);
+	zassert_equal(ret, 0, "empty did not return 0");
+
+	internal_test_remaining_elements(&data_fifo, 0, 0, __LINE__);
+}
+
 ZTEST_SUITE(suite_data_fifo, NULL, NULL, NULL, NULL, NULL);
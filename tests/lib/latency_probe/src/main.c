@@ -0,0 +1,85 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <nrf_latency_probe.h>
+
+NRF_LATENCY_PROBE_DEFINE(test_probe);
+NRF_LATENCY_PROBE_DECLARE(test_probe);
+
+static struct nrf_latency_probe *probe = &_nrf_latency_probe_test_probe;
+
+static void before_fn(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	nrf_latency_probe_reset(probe);
+}
+
+ZTEST(suite_latency_probe, test_record_buckets)
+{
+	nrf_latency_probe_record(probe, 0);
+	nrf_latency_probe_record(probe, 1);
+	nrf_latency_probe_record(probe, 2);
+	nrf_latency_probe_record(probe, 3);
+	nrf_latency_probe_record(probe, UINT32_MAX);
+
+	zassert_equal(atomic_get(&probe->count), 5);
+	zassert_equal(atomic_get(&probe->max_cycles), (atomic_val_t)UINT32_MAX);
+	/* Bucket 0 holds zero-cycle samples, bucket n holds [2^(n-1), 2^n). */
+	zassert_equal(atomic_get(&probe->buckets[0]), 1);
+	zassert_equal(atomic_get(&probe->buckets[1]), 1);
+	zassert_equal(atomic_get(&probe->buckets[2]), 2);
+	zassert_equal(atomic_get(&probe->buckets[32]), 1);
+}
+
+ZTEST(suite_latency_probe, test_begin_end)
+{
+	NRF_LATENCY_PROBE_BEGIN(test_probe);
+	k_busy_wait(10);
+	NRF_LATENCY_PROBE_END(test_probe);
+
+	zassert_equal(atomic_get(&probe->count), 1);
+	zassert_true(atomic_get(&probe->max_cycles) > 0);
+}
+
+ZTEST(suite_latency_probe, test_timestamp_record)
+{
+	uint32_t start = NRF_LATENCY_PROBE_TIMESTAMP();
+
+	k_busy_wait(10);
+	NRF_LATENCY_PROBE_RECORD(test_probe, start);
+
+	zassert_equal(atomic_get(&probe->count), 1);
+}
+
+ZTEST(suite_latency_probe, test_reset)
+{
+	nrf_latency_probe_record(probe, 100);
+	nrf_latency_probe_reset(probe);
+
+	zassert_equal(atomic_get(&probe->count), 0);
+	zassert_equal(atomic_get(&probe->max_cycles), 0);
+	for (size_t i = 0; i < NRF_LATENCY_PROBE_BUCKET_COUNT; i++) {
+		zassert_equal(atomic_get(&probe->buckets[i]), 0);
+	}
+}
+
+ZTEST(suite_latency_probe, test_iteration)
+{
+	bool found = false;
+
+	STRUCT_SECTION_FOREACH(nrf_latency_probe, p) {
+		if (strcmp(p->name, "test_probe") == 0) {
+			found = true;
+		}
+	}
+
+	zassert_true(found);
+}
+
+ZTEST_SUITE(suite_latency_probe, NULL, NULL, before_fn, NULL, NULL);
@@ -127,4 +127,74 @@ ZTEST(suite_pcm_mix, test_mono_into_stereo_r)
 	verify_array_eq(sample_a, sample_r, ARRAY_SIZE(sample_r));
 }
 
+void verify_array_eq_32(int32_t *p1, int32_t *p2, uint32_t elements)
+{
+	while (elements--) {
+		ZEQ(*p1++, *p2++);
+	}
+}
+
+ZTEST(suite_pcm_mix, test_mix_32_various_legal)
+{
+	int ret;
+	int32_t sample_a[] = { 12, 1, 2, 3, -4, 2000000, -2000000 };
+	int32_t sample_b[] = { 12, 1, 2, -3, -4, 2000000, -2000000 };
+	int32_t sample_r[] = { 24, 2, 4, 0, -8, 4000000, -4000000 };
+
+	ret = pcm_mix_32(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b),
+			 B_MONO_INTO_A_MONO);
+	ZEQ(ret, 0);
+
+	verify_array_eq_32(sample_a, sample_r, ARRAY_SIZE(sample_r));
+}
+
+ZTEST(suite_pcm_mix, test_mix_32_saturation)
+{
+	int ret;
+	int32_t sample_a[] = { INT32_MAX, INT32_MIN, INT32_MAX - 1 };
+	int32_t sample_b[] = { 1, -1, -2 };
+	int32_t sample_r[] = { INT32_MAX, INT32_MIN, INT32_MAX - 3 };
+
+	ret = pcm_mix_32(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b),
+			 B_MONO_INTO_A_MONO);
+	ZEQ(ret, 0);
+
+	verify_array_eq_32(sample_a, sample_r, ARRAY_SIZE(sample_r));
+}
+
+ZTEST(suite_pcm_mix, test_mix_32_mono_into_stereo_lr)
+{
+	int ret;
+	int32_t sample_a[] = { 10, 10, 10, 10 };
+	int32_t sample_b[] = { -5, 5 };
+	int32_t sample_r[] = { 5, 5, 15, 15 };
+
+	ret = pcm_mix_32(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b),
+			 B_MONO_INTO_A_STEREO_LR);
+	ZEQ(ret, 0);
+
+	verify_array_eq_32(sample_a, sample_r, ARRAY_SIZE(sample_r));
+}
+
+ZTEST(suite_pcm_mix, test_mix_32_mono_into_stereo_l_r)
+{
+	int ret;
+	int32_t sample_a[] = { 10, 10, 10, 10 };
+	int32_t sample_b[] = { -5, 5 };
+	int32_t sample_r_l[] = { 5, 10, 15, 10 };
+	int32_t sample_r_r[] = { 5, 5, 15, 15 };
+
+	ret = pcm_mix_32(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b),
+			 B_MONO_INTO_A_STEREO_L);
+	ZEQ(ret, 0);
+
+	verify_array_eq_32(sample_a, sample_r_l, ARRAY_SIZE(sample_r_l));
+
+	ret = pcm_mix_32(sample_a, sizeof(sample_a), sample_b, sizeof(sample_b),
+			 B_MONO_INTO_A_STEREO_R);
+	ZEQ(ret, 0);
+
+	verify_array_eq_32(sample_a, sample_r_r, ARRAY_SIZE(sample_r_r));
+}
+
 ZTEST_SUITE(suite_pcm_mix, NULL, NULL, NULL, NULL, NULL);
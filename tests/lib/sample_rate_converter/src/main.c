@@ -1152,4 +1152,82 @@ ZTEST(suite_sample_rate_converter, test_invalid_process_output_buf_too_small)
 		      "Sample rate conversion process did not fail when output buffer is to small");
 }
 
+#if defined(CONFIG_SAMPLE_RATE_CONVERTER_RATIONAL) &&                                              \
+	defined(CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16)
+ZTEST(suite_sample_rate_converter, test_valid_process_rational_44k1_to_48k)
+{
+	int ret;
+
+	uint32_t input_sample_rate = 44100;
+	uint32_t output_sample_rate = 48000;
+
+	/* 441 input samples is exactly three 147-sample steps, giving 480 output samples */
+	uint16_t input_samples[441];
+	size_t num_samples = ARRAY_SIZE(input_samples);
+	size_t expected_output_samples = 480;
+	uint16_t output_samples[480];
+
+	enum sample_rate_converter_filter filter = SAMPLE_RATE_FILTER_TEST;
+	size_t output_written;
+
+	for (int i = 0; i < num_samples; i++) {
+		input_samples[i] = 1000;
+	}
+
+	ret = sample_rate_converter_process(
+		&conv_ctx, filter, input_samples, num_samples * sizeof(uint16_t), input_sample_rate,
+		output_samples, expected_output_samples * sizeof(uint16_t), &output_written,
+		output_sample_rate);
+
+	zassert_equal(ret, 0, "Sample rate conversion process failed");
+	zassert_equal(output_written, expected_output_samples * sizeof(uint16_t),
+		      "Number of bytes written not as expected: %d", output_written);
+
+	/* The first outputs are affected by the zero filter history, after that a constant
+	 * signal must stay constant within rounding of the interpolation kernels.
+	 */
+	for (int i = 8; i < expected_output_samples; i++) {
+		zassert_within((int16_t)output_samples[i], 1000, 4,
+			       "Output sample %d has unexpected value %d", i,
+			       (int16_t)output_samples[i]);
+	}
+}
+
+ZTEST(suite_sample_rate_converter, test_valid_process_rational_48k_to_44k1)
+{
+	int ret;
+
+	uint32_t input_sample_rate = 48000;
+	uint32_t output_sample_rate = 44100;
+
+	/* 480 input samples is exactly 147 160-sample steps, giving 441 output samples */
+	uint16_t input_samples[480];
+	size_t num_samples = ARRAY_SIZE(input_samples);
+	size_t expected_output_samples = 441;
+	uint16_t output_samples[441];
+
+	enum sample_rate_converter_filter filter = SAMPLE_RATE_FILTER_TEST;
+	size_t output_written;
+
+	for (int i = 0; i < num_samples; i++) {
+		input_samples[i] = 1000;
+	}
+
+	ret = sample_rate_converter_process(
+		&conv_ctx, filter, input_samples, num_samples * sizeof(uint16_t), input_sample_rate,
+		output_samples, expected_output_samples * sizeof(uint16_t), &output_written,
+		output_sample_rate);
+
+	zassert_equal(ret, 0, "Sample rate conversion process failed");
+	zassert_equal(output_written, expected_output_samples * sizeof(uint16_t),
+		      "Number of bytes written not as expected: %d", output_written);
+
+	for (int i = 8; i < expected_output_samples; i++) {
+		zassert_within((int16_t)output_samples[i], 1000, 4,
+			       "Output sample %d has unexpected value %d", i,
+			       (int16_t)output_samples[i]);
+	}
+}
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_RATIONAL && CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16 */
+
 ZTEST_SUITE(suite_sample_rate_converter, NULL, NULL, test_setup, NULL, NULL);
@@ -6,6 +6,10 @@
 
 #include <zephyr/ztest.h>
 #include <sfloat.h>
+#include <math.h>
+
+/* Helper macro for getting absolute value. */
+#define ABS(a) ((a < 0) ? (-a) : (a))
 
 ZTEST_SUITE(sfloat_suite, NULL, NULL, NULL, NULL, NULL);
 
@@ -112,3 +116,74 @@ ZTEST(sfloat_suite, test_sfloat_from_float)
 			i, (double)in_float, res.val, out_sfloat.val);
 	}
 }
+
+ZTEST(sfloat_suite, test_sfloat_to_float)
+{
+	float res;
+	struct {
+		struct sfloat in_sfloat;
+		float out_float;
+	} test_vector[] = {
+		{{0x0000}, 0.0}, /* 10^(0) * 0 = 0.000000 */
+		{{0xA2A6}, 0.000678}, /* 10^(-6) * 678 = 0.000678 */
+		{{0xAD5A}, -0.000678}, /* - 10^(-6) * 678 = -0.000678 */
+		{{0xC1DB}, 0.0475}, /* 10^(-4) * 475 = 0.047500 */
+		{{0xCE25}, -0.0475}, /* - 10^(-4) * 475 = -0.047500 */
+		{{0xE113}, 2.75}, /* 10^(-2) * 275 = 2.750000 */
+		{{0xEEED}, -2.75}, /* - 10^(-2) * 275 = -2.750000 */
+		{{0x0187}, 391.0}, /* 10^(0) * 391 = 391.000000 */
+		{{0x0E79}, -391.0}, /* - 10^(0) * 391 = -391.000000 */
+		{{0x11FB}, 5070.0}, /* 10^(1) * 507 = 5070.000000 */
+		{{0x1E05}, -5070.0}, /* - 10^(1) * 507 = -5070.000000 */
+		{{0x43B7}, 9510000.0}, /* 10^(4) * 951 = 9510000.000000 */
+		{{0x4C49}, -9510000.0}, /* - 10^(4) * 951 = -9510000.000000 */
+		{{0x77FF}, 20470000000.0}, /* 10^(7) * 2047 = 20470000000.000000 */
+		{{0x7800}, -20480000000.0}, /* - 10^(7) * 2048 = -20480000000.000000 */
+		{{0x8001}, 0.00000001}, /* 10^(-8) * 1 = 0.00000001 */
+		{{0x8FFF}, -0.00000001}, /* - 10^(-8) * 1 = -0.00000001 */
+	};
+
+	for (size_t i = 0; i < ARRAY_SIZE(test_vector); i++) {
+		struct sfloat in_sfloat = test_vector[i].in_sfloat;
+		float out_float = test_vector[i].out_float;
+
+		res = sfloat_to_float(in_sfloat);
+		zassert_true((res >= (out_float - ABS(out_float) * 0.0001f)) &&
+			     (res <= (out_float + ABS(out_float) * 0.0001f)),
+			"comparison failed for the sample[%d] equal to 0x%04X: %f != %f",
+			i, in_sfloat.val, (double)res, (double)out_float);
+	}
+
+	/* Special values */
+	res = sfloat_to_float((struct sfloat){SFLOAT_POS_INFINITY});
+	zassert_true(res > 0 && isinf(res), "positive infinity was not decoded");
+
+	res = sfloat_to_float((struct sfloat){SFLOAT_NEG_INFINITY});
+	zassert_true(res < 0 && isinf(res), "negative infinity was not decoded");
+
+	zassert_true(isnan(sfloat_to_float((struct sfloat){SFLOAT_NAN})), "NaN was not decoded");
+	zassert_true(isnan(sfloat_to_float((struct sfloat){SFLOAT_NRES})), "NRES was not decoded");
+	zassert_true(isnan(sfloat_to_float((struct sfloat){SFLOAT_RESERVED})),
+		     "Reserved was not decoded");
+}
+
+ZTEST(sfloat_suite, test_sfloat_array_round_trip)
+{
+	float in_floats[] = {0.0, 0.000678, -0.0475, 2.75, 391.0, -5070.0, 9510000.0};
+	struct sfloat sfloats[ARRAY_SIZE(in_floats)];
+	float out_floats[ARRAY_SIZE(in_floats)];
+
+	sfloat_from_float_array(sfloats, in_floats, ARRAY_SIZE(in_floats));
+	sfloat_to_float_array(out_floats, sfloats, ARRAY_SIZE(out_floats));
+
+	for (size_t i = 0; i < ARRAY_SIZE(in_floats); i++) {
+		struct sfloat ref = sfloat_from_float(in_floats[i]);
+
+		zassert_equal(sfloats[i].val, ref.val,
+			"array conversion diverged from the scalar conversion for sample[%d]", i);
+		zassert_true((out_floats[i] >= (in_floats[i] - ABS(in_floats[i]) * 0.0001f)) &&
+			     (out_floats[i] <= (in_floats[i] + ABS(in_floats[i]) * 0.0001f)),
+			"round trip failed for the sample[%d] equal to %f: %f",
+			i, (double)in_floats[i], (double)out_floats[i]);
+	}
+}
@@ -0,0 +1,403 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+#include <unity.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/device.h>
+#include <modem/sms.h>
+#include <modem/at_monitor.h>
+#include <modem/lte_lc.h>
+#include <mock_nrf_modem_at.h>
+#include <nrf_errno.h>
+
+#include "cmock_nrf_modem_at.h"
+
+
+static struct sms_data test_sms_data = {0};
+static struct sms_deliver_header test_sms_header = {0};
+static int test_handle;
+static bool sms_callback_called_occurred;
+static bool sms_callback_called_expected;
+
+static void sms_callback(struct sms_data *const data, void *context);
+
+/* at_monitor_dispatch() is implemented in at_monitor library and
+ * we'll call it directly to fake received SMS message
+ */
+extern void at_monitor_dispatch(const char *at_notif);
+
+/* sms_ack_resp_handler() is implemented in SMS library and
+ * we'll call it directly to fake response to AT+CNMA=1.
+ */
+extern void sms_ack_resp_handler(const char *resp);
+
+/* The two segments of a 291 character concatenated message, taken from the SMS
+ * library test suite. The PDUs are assembled with the concatenation reference
+ * number as a parameter so that distinct messages with identical content can be
+ * received, which is needed for the context eviction and timeout tests.
+ * The reference number does not affect the packed user data.
+ */
+#define MSG291_PART1_CMT(ref_hex) \
+	"+CMT: \"+1234567890\",22\r\n" \
+	"0791534874894310440A912143658709000012201232054480A0050003" ref_hex "0201" \
+	"62B219AD66BBE172B0986C46ABD96EB81C2C269BD16AB61B2E078BC966B49AED86CBC162B219AD66BBE1" \
+	"72B0986C46ABD96EB81C2C269BD16AB61B2E078BC966B49AED86CBC162B219AD66BBE172B0986C46ABD9" \
+	"6EB81C2C269BD16AB61B2E078BC966B49AED86CBC162B219AD66BBE172B0986C46ABD96EB81C2C269BD1" \
+	"6AB61B2E078BC966\r\n"
+
+#define MSG291_PART2_CMT(ref_hex) \
+	"+CMT: \"+1234567890\",22\r\n" \
+	"0791534874894320440A912143658709000012201232054480910500" "03" ref_hex "0202" \
+	"6835DB0D9783C564335ACD76C3E56031D98C56B3DD7039584C36A3D56C375C0E1693CD6835DB0D9783C5" \
+	"64335ACD76C3E56031D98C56B3DD7039584C36A3D56C375C0E1693CD6835DB0D9783C564335ACD76C3E5" \
+	"6031D98C56B3DD7039584C36A3D56C375C0E1693CD6835DB0D9783C564335ACD76C3E56031\r\n"
+
+#define MSG291_PART1_TEXT \
+	"1234567890123456789012345678901234567890123456789012345678901234567890123456789012" \
+	"34567890123456789012345678901234567890123456789012345678901234567890123"
+
+#define MSG291_PART2_TEXT \
+	"45678901234567890123456789012345678901234567890123456789012345678901234567890123456" \
+	"7890123456789012345678901234567890123456789012345678901"
+
+static void helper_sms_data_clear(void)
+{
+	memset(&test_sms_data, 0, sizeof(test_sms_data));
+
+	test_sms_data.type = SMS_TYPE_DELIVER;
+	memset(test_sms_data.payload, 0, sizeof(test_sms_data.payload));
+
+	memset(&test_sms_header, 0, sizeof(test_sms_header));
+}
+
+void setUp(void)
+{
+	mock_nrf_modem_at_Init();
+
+	helper_sms_data_clear();
+	test_handle = 0;
+	sms_callback_called_occurred = false;
+	sms_callback_called_expected = false;
+}
+
+void tearDown(void)
+{
+	TEST_ASSERT_EQUAL(sms_callback_called_expected, sms_callback_called_occurred);
+
+	mock_nrf_modem_at_Verify();
+}
+
+static void sms_reg_helper(void)
+{
+	char resp[] = "+CNMI: 0,0,0,0,1\r\n";
+
+	__cmock_nrf_modem_at_cmd_ExpectAndReturn(NULL, 0, "AT+CNMI?", 0);
+	__cmock_nrf_modem_at_cmd_IgnoreArg_buf();
+	__cmock_nrf_modem_at_cmd_IgnoreArg_len();
+	__cmock_nrf_modem_at_cmd_ReturnArrayThruPtr_buf(resp, sizeof(resp));
+
+#if defined(CONFIG_SMS_STATUS_REPORT)
+	__mock_nrf_modem_at_printf_ExpectAndReturn("AT+CNMI=3,2,0,1", 0);
+#else
+	__mock_nrf_modem_at_printf_ExpectAndReturn("AT+CNMI=3,2,0,0", 0);
+#endif
+	test_handle = sms_register_listener(sms_callback, NULL);
+	TEST_ASSERT_EQUAL(0, test_handle);
+}
+
+static void sms_unreg_helper(void)
+{
+	__mock_nrf_modem_at_printf_ExpectAndReturn("AT+CNMI=0,0,0,0", 0);
+
+	sms_unregister_listener(test_handle);
+	test_handle = -1;
+}
+
+/* Receive one segment of a concatenated message. Each segment is acknowledged
+ * separately regardless of whether it completes the message.
+ */
+static void segment_recv_helper(const char *cmt)
+{
+	__cmock_nrf_modem_at_cmd_async_ExpectAndReturn(sms_ack_resp_handler, "AT+CNMA=1", 0);
+	at_monitor_dispatch(cmt);
+	k_sleep(K_MSEC(1));
+}
+
+/* Expected header of the complete 291 character message. The header fields are
+ * taken from the first segment.
+ */
+static void msg291_header_helper(uint16_t ref_number)
+{
+	strcpy(test_sms_header.originating_address.address_str, "1234567890");
+	test_sms_header.originating_address.length = 10;
+	test_sms_header.originating_address.type = 0x91;
+	test_sms_header.time.year = 21;
+	test_sms_header.time.month = 2;
+	test_sms_header.time.day = 21;
+	test_sms_header.time.hour = 23;
+	test_sms_header.time.minute = 50;
+	test_sms_header.time.second = 44;
+	test_sms_header.time.timezone = 8;
+
+	test_sms_header.concatenated.present = true;
+	test_sms_header.concatenated.total_msgs = 2;
+	test_sms_header.concatenated.ref_number = ref_number;
+	test_sms_header.concatenated.seq_number = 1;
+}
+
+/* Expected payload of the complete 291 character message. */
+static void msg291_payload_helper(void)
+{
+	strcpy(test_sms_data.payload, MSG291_PART1_TEXT);
+	strcat(test_sms_data.payload, MSG291_PART2_TEXT);
+	test_sms_data.payload_len = 291;
+}
+
+/********* SMS REASSEMBLY TESTS ***********************/
+
+/**
+ * Receive a concatenated SMS with segments arriving in order.
+ * The first segment must not be notified on its own, and a duplicate of it
+ * must not disturb the reassembly. A single callback with the concatenated
+ * payload and the header of the first segment is expected once the last
+ * segment arrives.
+ */
+void test_reassembly_in_order_with_duplicate(void)
+{
+	sms_reg_helper();
+
+	msg291_header_helper(126);
+	msg291_payload_helper();
+
+	/* Part 1: stored, no notification. */
+	segment_recv_helper(MSG291_PART1_CMT("7E"));
+	TEST_ASSERT_FALSE(sms_callback_called_occurred);
+
+	/* Duplicate of part 1: overwrites its own slot, no notification. */
+	segment_recv_helper(MSG291_PART1_CMT("7E"));
+	TEST_ASSERT_FALSE(sms_callback_called_occurred);
+
+	/* Part 2: completes the message. */
+	sms_callback_called_expected = true;
+	segment_recv_helper(MSG291_PART2_CMT("7E"));
+	TEST_ASSERT_TRUE(sms_callback_called_occurred);
+
+	sms_unreg_helper();
+}
+
+/**
+ * Receive a concatenated SMS with 755 characters in 5 segments arriving out of
+ * order. The complete message must be notified once with the segments
+ * concatenated in sequence order and with the header of the first segment,
+ * even though the first segment is not the first to arrive.
+ */
+void test_reassembly_out_of_order(void)
+{
+	sms_reg_helper();
+
+	strcpy(test_sms_header.originating_address.address_str, "1234567890");
+	test_sms_header.originating_address.length = 10;
+	test_sms_header.originating_address.type = 0x91;
+	test_sms_header.time.year = 21;
+	test_sms_header.time.month = 2;
+	test_sms_header.time.day = 22;
+	test_sms_header.time.hour = 8;
+	test_sms_header.time.minute = 56;
+	/* Timestamp of segment 1, not of the segments received before it. */
+	test_sms_header.time.second = 5;
+	test_sms_header.time.timezone = 8;
+
+	test_sms_header.concatenated.present = true;
+	test_sms_header.concatenated.total_msgs = 5;
+	test_sms_header.concatenated.ref_number = 128;
+	test_sms_header.concatenated.seq_number = 1;
+
+	/* Segments 1-5 in sequence order. */
+	strcpy(test_sms_data.payload,
+		"abcdefghijklmnopqrstuvwxyz "
+		"abcdefghijklmnopqrstuvwxyz "
+		"abcdefghijklmnopqrstuvwxyz "
+		"abcdefghijklmnopqrstuvwxyz "
+		"abcdefghijklmnopqrstuvwxyz "
+		"abcdefghijklmnopqr");
+	strcat(test_sms_data.payload,
+		"stuvwxyz abcdefghijklmnopqrstuvwxyz "
+		"abcdefghijklmnopqrstuvwxyz "
+		"abcdefghijklmnopqrstuvwxyz "
+		"abcdefghijklmnopqrstuvwxyz "
+		"abcdefghijklmnopqrstuvwxyz abcdefghi");
+	strcat(test_sms_data.payload,
+		"jklmnopqrstuvwxyz abcdefghijklmnopqrstuvwxyz "
+		"abcdefghijklmnopqrstuvwxyz "
+		"abcdefghijklmnopqrstuvwxyz "
+		"abcdefghijklmnopqrstuvwxyz "
+		"abcdefghijklmnopqrstuvwxyz ");
+	strcat(test_sms_data.payload,
+		"abcdefghijklmnopqrstuvwxyz "
+		"abcdefghijklmnopqrstuvwxyz "
+		"abcdefghijklmnopqrstuvwxyz "
+		"abcdefghijklmnopqrstuvwxyz "
+		"abcdefghijklmnopqrstuvwxyz "
+		"abcdefghijklmnopqr");
+	strcat(test_sms_data.payload,
+		"stuvwxyz abcdefghijklmnopqrstuvwxyz "
+		"abcdefghijklmnopqrstuvwxyz "
+		"abcdefghijklmnopqrstuvwxyz "
+		"abcdefghijklmnopqrstuvwxyz "
+		"abcdefghijklmnopqrstuvwxyz");
+	test_sms_data.payload_len = 755;
+
+	/* Part 4 */
+	segment_recv_helper("+CMT: \"1234567890\",159\r\n"
+		"0791534874894370440A912143658709000012202280656080A0050003800504C2E231B96C3EA3D3EA35BBED7EC3E3F239BD6EBFE3F37A50583C2697CD67745ABD66B7DD6F785C3EA7D7ED777C5E0F0A8BC7E4B2F98C4EABD7ECB6FB0D8FCBE7F4BAFD8ECFEB4161F1985C369FD169F59ADD76BFE171F99C5EB7DFF1793D282C1E93CBE6333AAD5EB3DBEE373C2E9FD3EBF63B3EAF0785C56372D97C46A7D56B76DBFD86C7E5\r\n");
+	TEST_ASSERT_FALSE(sms_callback_called_occurred);
+
+	/* Part 2 */
+	segment_recv_helper("+CMT: \"1234567890\",159\r\n"
+		"0791534874894370440A912143658709000012202280656080A0050003800502E6F4BAFD8ECFEB4161F1985C369FD169F59ADD76BFE171F99C5EB7DFF1793D282C1E93CBE6333AAD5EB3DBEE373C2E9FD3EBF63B3EAF0785C56372D97C46A7D56B76DBFD86C7E5737ADD7EC7E7F5A0B0784C2E9BCFE8B47ACD6EBBDFF0B87C4EAFDBEFF8BC1E14168FC965F3199D56AFD96DF71B1E97CFE975FB1D9FD783C2E231B96C3EA3D3\r\n");
+	TEST_ASSERT_FALSE(sms_callback_called_occurred);
+
+	/* Part 5 */
+	segment_recv_helper("+CMT: \"1234567890\",151\r\n"
+		"0791534874894310440A91214365870900001220228065608096050003800505E6F4BAFD8ECFEB4161F1985C369FD169F59ADD76BFE171F99C5EB7DFF1793D282C1E93CBE6333AAD5EB3DBEE373C2E9FD3EBF63B3EAF0785C56372D97C46A7D56B76DBFD86C7E5737ADD7EC7E7F5A0B0784C2E9BCFE8B47ACD6EBBDFF0B87C4EAFDBEFF8BC1E14168FC965F3199D56AFD96DF71B1E97CFE975FB1D9FD703\r\n");
+	TEST_ASSERT_FALSE(sms_callback_called_occurred);
+
+	/* Part 1 */
+	segment_recv_helper("+CMT: \"1234567890\",159\r\n"
+		"0791534874894310440A912143658709000012202280655080A0050003800501C2E231B96C3EA3D3EA35BBED7EC3E3F239BD6EBFE3F37A50583C2697CD67745ABD66B7DD6F785C3EA7D7ED777C5E0F0A8BC7E4B2F98C4EABD7ECB6FB0D8FCBE7F4BAFD8ECFEB4161F1985C369FD169F59ADD76BFE171F99C5EB7DFF1793D282C1E93CBE6333AAD5EB3DBEE373C2E9FD3EBF63B3EAF0785C56372D97C46A7D56B76DBFD86C7E5\r\n");
+	TEST_ASSERT_FALSE(sms_callback_called_occurred);
+
+	/* Part 3 completes the message. */
+	sms_callback_called_expected = true;
+	segment_recv_helper("+CMT: \"1234567890\",159\r\n"
+		"0791534874894310440A912143658709000012202280656080A0050003800503D46B76DBFD86C7E5737ADD7EC7E7F5A0B0784C2E9BCFE8B47ACD6EBBDFF0B87C4EAFDBEFF8BC1E14168FC965F3199D56AFD96DF71B1E97CFE975FB1D9FD783C2E231B96C3EA3D3EA35BBED7EC3E3F239BD6EBFE3F37A50583C2697CD67745ABD66B7DD6F785C3EA7D7ED777C5E0F0A8BC7E4B2F98C4EABD7ECB6FB0D8FCBE7F4BAFD8ECFEB41\r\n");
+	TEST_ASSERT_TRUE(sms_callback_called_occurred);
+
+	sms_unreg_helper();
+}
+
+/**
+ * Receive first segments of more concatenated messages than there are
+ * reassembly contexts (CONFIG_SMS_REASSEMBLY_CTX_COUNT=2). The context holding
+ * the oldest message must be evicted for the newest message, so the two newer
+ * messages complete while the evicted one does not, even when its remaining
+ * segment arrives.
+ */
+void test_reassembly_ctx_eviction(void)
+{
+	sms_reg_helper();
+
+	/* First segments of messages A (ref 161), B (ref 162) and C (ref 163).
+	 * C takes the context of A, which is the oldest.
+	 */
+	segment_recv_helper(MSG291_PART1_CMT("A1"));
+	segment_recv_helper(MSG291_PART1_CMT("A2"));
+	segment_recv_helper(MSG291_PART1_CMT("A3"));
+	TEST_ASSERT_FALSE(sms_callback_called_occurred);
+
+	/* C and B complete normally. */
+	msg291_payload_helper();
+	msg291_header_helper(163);
+	sms_callback_called_expected = true;
+	segment_recv_helper(MSG291_PART2_CMT("A3"));
+	TEST_ASSERT_TRUE(sms_callback_called_occurred);
+
+	msg291_header_helper(162);
+	sms_callback_called_occurred = false;
+	segment_recv_helper(MSG291_PART2_CMT("A2"));
+	TEST_ASSERT_TRUE(sms_callback_called_occurred);
+
+	/* A was evicted, so its second segment starts a new incomplete message
+	 * instead of completing one.
+	 */
+	sms_callback_called_occurred = false;
+	segment_recv_helper(MSG291_PART2_CMT("A1"));
+	TEST_ASSERT_FALSE(sms_callback_called_occurred);
+
+	sms_unreg_helper();
+}
+
+/**
+ * Receive the second segment of a concatenated message only after the
+ * reassembly timeout (CONFIG_SMS_REASSEMBLY_TIMEOUT_SEC=2) has passed.
+ * The expired first segment must have been dropped, so no complete message is
+ * notified.
+ */
+void test_reassembly_timeout(void)
+{
+	sms_reg_helper();
+
+	segment_recv_helper(MSG291_PART1_CMT("B1"));
+	TEST_ASSERT_FALSE(sms_callback_called_occurred);
+
+	k_sleep(K_SECONDS(3));
+
+	segment_recv_helper(MSG291_PART2_CMT("B1"));
+	TEST_ASSERT_FALSE(sms_callback_called_occurred);
+
+	sms_unreg_helper();
+}
+
+static void sms_callback(struct sms_data *const data, void *context)
+{
+	TEST_ASSERT_EQUAL(sms_callback_called_expected, true);
+
+	sms_callback_called_occurred = true;
+	TEST_ASSERT_EQUAL(test_sms_data.type, data->type);
+
+	TEST_ASSERT_EQUAL_STRING(test_sms_data.payload, data->payload);
+	TEST_ASSERT_EQUAL(test_sms_data.payload_len, data->payload_len);
+
+	struct sms_deliver_header *sms_header = &data->header.deliver;
+
+	TEST_ASSERT_EQUAL_STRING(test_sms_header.originating_address.address_str,
+		sms_header->originating_address.address_str);
+	TEST_ASSERT_EQUAL(test_sms_header.originating_address.length,
+		sms_header->originating_address.length);
+	TEST_ASSERT_EQUAL(test_sms_header.originating_address.type,
+		sms_header->originating_address.type);
+
+	TEST_ASSERT_EQUAL(test_sms_header.time.year, sms_header->time.year);
+	TEST_ASSERT_EQUAL(test_sms_header.time.month, sms_header->time.month);
+	TEST_ASSERT_EQUAL(test_sms_header.time.day, sms_header->time.day);
+	TEST_ASSERT_EQUAL(test_sms_header.time.hour, sms_header->time.hour);
+	TEST_ASSERT_EQUAL(test_sms_header.time.minute, sms_header->time.minute);
+	TEST_ASSERT_EQUAL(test_sms_header.time.second, sms_header->time.second);
+	TEST_ASSERT_EQUAL(test_sms_header.time.timezone, sms_header->time.timezone);
+
+	TEST_ASSERT_EQUAL(test_sms_header.concatenated.present, sms_header->concatenated.present);
+	TEST_ASSERT_EQUAL(test_sms_header.concatenated.ref_number,
+		sms_header->concatenated.ref_number);
+	TEST_ASSERT_EQUAL(test_sms_header.concatenated.seq_number,
+		sms_header->concatenated.seq_number);
+	TEST_ASSERT_EQUAL(test_sms_header.concatenated.total_msgs,
+		sms_header->concatenated.total_msgs);
+}
+
+/* This is needed because AT Monitor library is initialized in SYS_INIT. */
+static int sms_test_sys_init(void)
+{
+	__cmock_nrf_modem_at_notif_handler_set_ExpectAnyArgsAndReturn(0);
+
+	return 0;
+}
+
+/* It is required to be added to each test. That is because unity's
+ * main may return nonzero, while zephyr's main currently must
+ * return 0 in all cases (other values are reserved).
+ */
+extern int unity_main(void);
+
+int main(void)
+{
+	(void)unity_main();
+
+	return 0;
+}
+
+SYS_INIT(sms_test_sys_init, POST_KERNEL, 0);
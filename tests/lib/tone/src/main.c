@@ -340,5 +340,99 @@ ZTEST(suite_tone_gen_size, test_tone_gen_size_illegal_args)
 		-EPERM, "Err code returned");
 }
 
+ZTEST(suite_tone_bank, test_tone_bank_gen_valid)
+{
+	struct tone_oscillator osc[2];
+	int16_t pcm[480] = {0};
+
+	zassert_equal(tone_osc_init(&osc[0], 480, 48000, 0.4), 0, "Err code returned");
+	zassert_equal(tone_osc_init(&osc[1], 960, 48000, 0.4), 0, "Err code returned");
+
+	/* Generate in two calls to verify that the phase is kept between buffers */
+	zassert_equal(tone_bank_gen(pcm, ARRAY_SIZE(pcm) / 2, osc, ARRAY_SIZE(osc)), 0,
+		      "Err code returned");
+	zassert_equal(tone_bank_gen(&pcm[ARRAY_SIZE(pcm) / 2], ARRAY_SIZE(pcm) / 2, osc,
+				    ARRAY_SIZE(osc)),
+		      0, "Err code returned");
+
+	/* The buffer holds whole periods of both tones, so the samples should sum
+	 * to approximately zero
+	 */
+	int32_t sum = tone_sum_16(pcm, sizeof(pcm));
+
+	zassert_true(abs(sum) < (int32_t)ARRAY_SIZE(pcm), "The sum of samples is not close to zero");
+
+	/* The mixed amplitude should stay within the combined oscillator amplitude */
+	for (size_t i = 0; i < ARRAY_SIZE(pcm); i++) {
+		zassert_true(abs(pcm[i]) <= (int16_t)(0.8 * INT16_MAX) + 1,
+			     "Sample exceeds combined amplitude");
+	}
+}
+
+ZTEST(suite_tone_bank, test_tone_envelope_apply_valid)
+{
+	int16_t pcm[100];
+
+	for (size_t i = 0; i < ARRAY_SIZE(pcm); i++) {
+		pcm[i] = INT16_MAX / 2;
+	}
+
+	zassert_equal(tone_envelope_apply(pcm, ARRAY_SIZE(pcm), 1, 0), 0, "Err code returned");
+
+	zassert_equal(pcm[0], INT16_MAX / 2, "First sample not at full gain");
+	zassert_true(pcm[ARRAY_SIZE(pcm) - 1] < (INT16_MAX / 2) / (int16_t)ARRAY_SIZE(pcm),
+		     "Last sample not faded out");
+
+	for (size_t i = 1; i < ARRAY_SIZE(pcm); i++) {
+		zassert_true(pcm[i] <= pcm[i - 1], "Envelope is not monotonically decreasing");
+	}
+}
+
+ZTEST(suite_tone_bank, test_tone_bank_illegal_args)
+{
+	struct tone_oscillator osc;
+	int16_t pcm[10] = {0};
+
+	/* NULL ptr */
+	zassert_equal(tone_osc_init(NULL, 480, 48000, 1), -ENXIO, "Wrong code returned");
+	/* freq too low */
+	zassert_equal(tone_osc_init(&osc, 10, 48000, 1), -EINVAL, "Wrong code returned");
+	/* freq too high */
+	zassert_equal(tone_osc_init(&osc, 10001, 48000, 1), -EINVAL, "Wrong code returned");
+	/* smpl_freq 0 */
+	zassert_equal(tone_osc_init(&osc, 480, 0, 1), -EINVAL, "Wrong code returned");
+	/* 0 Amplitude */
+	zassert_equal(tone_osc_init(&osc, 480, 48000, 0), -EPERM, "Wrong code returned");
+	/* Amplitude too high */
+	zassert_equal(tone_osc_init(&osc, 480, 48000, 1.1), -EPERM, "Wrong code returned");
+
+	zassert_equal(tone_osc_init(&osc, 480, 48000, 1), 0, "Err code returned");
+
+	/* NULL ptr */
+	zassert_equal(tone_bank_gen(NULL, ARRAY_SIZE(pcm), &osc, 1), -ENXIO,
+		      "Wrong code returned");
+	/* NULL ptr */
+	zassert_equal(tone_bank_gen(pcm, ARRAY_SIZE(pcm), NULL, 1), -ENXIO,
+		      "Wrong code returned");
+	/* 0 samples */
+	zassert_equal(tone_bank_gen(pcm, 0, &osc, 1), -EINVAL, "Wrong code returned");
+	/* 0 oscillators */
+	zassert_equal(tone_bank_gen(pcm, ARRAY_SIZE(pcm), &osc, 0), -EINVAL,
+		      "Wrong code returned");
+
+	/* NULL ptr */
+	zassert_equal(tone_envelope_apply(NULL, ARRAY_SIZE(pcm), 1, 0), -ENXIO,
+		      "Wrong code returned");
+	/* 0 samples */
+	zassert_equal(tone_envelope_apply(pcm, 0, 1, 0), -EINVAL, "Wrong code returned");
+	/* Gain too high */
+	zassert_equal(tone_envelope_apply(pcm, ARRAY_SIZE(pcm), 1.1, 0), -EPERM,
+		      "Wrong code returned");
+	/* Negative gain */
+	zassert_equal(tone_envelope_apply(pcm, ARRAY_SIZE(pcm), 1, -0.1), -EPERM,
+		      "Wrong code returned");
+}
+
 ZTEST_SUITE(suite_tone, NULL, NULL, NULL, NULL, NULL);
 ZTEST_SUITE(suite_tone_gen_size, NULL, NULL, NULL, NULL, NULL);
+ZTEST_SUITE(suite_tone_bank, NULL, NULL, NULL, NULL, NULL);
@@ -1007,6 +1007,44 @@ ZTEST(suite_audio_module_bad_param, test_open_bad_thread)
 		      -ECANCELED, ret);
 }
 
+ZTEST(suite_audio_module_bad_param, test_open_bad_fused)
+{
+	int ret;
+	char *inst_name = "TEST open";
+	struct audio_module_functions test_functions = {
+		.open = NULL,
+		.close = NULL,
+		.configuration_set = test_config_set_function,
+		.configuration_get = test_config_get_function,
+		.start = NULL,
+		.stop = NULL,
+		.data_process = test_data_process_function};
+	struct audio_module_description test_description_fused = {
+		.name = "Module 1", .type = AUDIO_MODULE_TYPE_INPUT, .functions = &test_functions};
+	struct audio_module_parameters test_params_fused = {.description =
+								    &test_description_fused};
+	struct audio_module_handle test_handle = {0};
+
+	/* A fused module generates no data of its own, so an input module
+	 * cannot be opened in fused mode.
+	 */
+	ret = audio_module_open(&test_params_fused, config, inst_name,
+				(struct audio_module_context *)&context, &test_handle);
+	zassert_equal(ret, -ECANCELED, "Open function did not return -ECANCELED (%d): ret %d",
+		      -ECANCELED, ret);
+
+	/* A fused module takes its input by direct function call, so it cannot
+	 * have an RX FIFO.
+	 */
+	test_description_fused.type = AUDIO_MODULE_TYPE_IN_OUT;
+	test_params_fused.thread.msg_rx = &mod_fifo_rx;
+
+	ret = audio_module_open(&test_params_fused, config, inst_name,
+				(struct audio_module_context *)&context, &test_handle);
+	zassert_equal(ret, -ECANCELED, "Open function did not return -ECANCELED (%d): ret %d",
+		      -ECANCELED, ret);
+}
+
 ZTEST(suite_audio_module_bad_param, test_open_bad_description)
 {
 	int ret;
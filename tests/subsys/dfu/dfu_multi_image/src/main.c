@@ -264,6 +264,57 @@ ZTEST(dfu_multi_image_test, test_two_image_package_small_chunk)
 		   "DFU failed");
 }
 
+static const uint8_t hashed_image_package[] = {
+	0x3a, 0x00, 0xa1, 0x63, 0x69, 0x6d, 0x67, 0x81, 0xa3, 0x62, 0x69, 0x64, 0x00,
+	0x64, 0x73, 0x69, 0x7a, 0x65, 0x0f, 0x66, 0x73, 0x68, 0x61, 0x32, 0x35, 0x36,
+	0x58, 0x20, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a,
+	0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+	0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x69, 0x6d, 0x61, 0x67, 0x65,
+	0x20, 0x30, 0x20, 0x63, 0x6f, 0x6e, 0x74, 0x65, 0x6e, 0x74
+};
+
+static const struct expected hashed_image_package_expected = {
+	.images = { EXPECTED_IMAGE(0, "image 0 content") },
+	.image_count = 1,
+	.header_size = 60,
+};
+
+ZTEST(dfu_multi_image_test, test_image_hash)
+{
+	uint8_t buffer[128];
+	const uint8_t *hash = NULL;
+	uint8_t expected_hash[DFU_MULTI_IMAGE_HASH_SIZE];
+
+	for (size_t i = 0; i < sizeof(expected_hash); i++) {
+		expected_hash[i] = i;
+	}
+
+	zassert_ok(comparison_test(hashed_image_package, sizeof(hashed_image_package),
+				   &hashed_image_package_expected, buffer, sizeof(buffer), 100),
+		   "DFU failed");
+
+	zassert_ok(dfu_multi_image_hash_get(0, &hash), "Image hash not found");
+	zassert_not_null(hash, "Null image hash");
+	zassert_ok(memcmp(hash, expected_hash, sizeof(expected_hash)),
+		   "Unexpected image hash");
+
+	zassert_equal(dfu_multi_image_hash_get(1, &hash), -ENOENT,
+		      "Hash reported for image not included in the package");
+}
+
+ZTEST(dfu_multi_image_test, test_image_hash_absent)
+{
+	uint8_t buffer[128];
+	const uint8_t *hash = NULL;
+
+	zassert_ok(comparison_test(two_image_package, sizeof(two_image_package),
+				   &two_image_package_expected, buffer, sizeof(buffer), 100),
+		   "DFU failed");
+
+	zassert_equal(dfu_multi_image_hash_get(0, &hash), -ENOENT,
+		      "Hash reported for package built without hashes");
+}
+
 ZTEST(dfu_multi_image_test, test_too_small_buffer)
 {
 	int err;
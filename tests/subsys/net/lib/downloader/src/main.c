@@ -216,6 +216,11 @@ struct downloader_transport_http_cfg dl_http_cfg = {
 	.sock_recv_timeo_ms = 60000,
 };
 
+struct downloader_transport_http_cfg dl_http_cfg_pipeline = {
+	.sock_recv_timeo_ms = 60000,
+	.pipeline_count = 2,
+};
+
 DEFINE_FFF_GLOBALS;
 
 FAKE_VALUE_FUNC(int, z_impl_zsock_setsockopt, int, int, int, const void *, net_socklen_t);
@@ -860,6 +865,36 @@ static ssize_t z_impl_zsock_recvfrom_https_partial_content(
 	return 0;
 }
 
+static ssize_t z_impl_zsock_recvfrom_https_partial_content_pipelined(
+	int sock, void *buf, size_t max_len, int flags, struct net_sockaddr *src_addr,
+	net_socklen_t *addrlen)
+{
+	TEST_ASSERT_EQUAL(FD, sock);
+	TEST_ASSERT(sizeof(dl_buf) >= max_len);
+
+	switch (z_impl_zsock_recvfrom_fake.call_count) {
+	case 1:
+		/* With pipelined requests the second response follows the first fragment
+		 * immediately; deliver the end of the first fragment and the start of the
+		 * second response header in one chunk.
+		 */
+		memcpy(buf, HTTPS_HDR_OK_PARTIAL_CONTENT_1, strlen(HTTPS_HDR_OK_PARTIAL_CONTENT_1));
+		memset((char *)buf + strlen(HTTPS_HDR_OK_PARTIAL_CONTENT_1), 23, 32);
+		memcpy((char *)buf + strlen(HTTPS_HDR_OK_PARTIAL_CONTENT_1) + 32,
+		       HTTPS_HDR_OK_PARTIAL_CONTENT_HDR_2_1,
+		       strlen(HTTPS_HDR_OK_PARTIAL_CONTENT_HDR_2_1));
+		return strlen(HTTPS_HDR_OK_PARTIAL_CONTENT_1) + 32 +
+		       strlen(HTTPS_HDR_OK_PARTIAL_CONTENT_HDR_2_1);
+	case 2:
+		memcpy(buf, HTTPS_HDR_OK_PARTIAL_CONTENT_HDR_2_2,
+		       strlen(HTTPS_HDR_OK_PARTIAL_CONTENT_HDR_2_2));
+		memset((char *)buf + strlen(HTTPS_HDR_OK_PARTIAL_CONTENT_HDR_2_2), 23, 32);
+		return strlen(HTTPS_HDR_OK_PARTIAL_CONTENT_HDR_2_2) + 32;
+	}
+
+	return 0;
+}
+
 static ssize_t z_impl_zsock_recvfrom_https_partial_content_partial_2nd_header(
 	int sock, void *buf, size_t max_len, int flags, struct net_sockaddr *src_addr,
 	net_socklen_t *addrlen)
@@ -1457,6 +1492,34 @@ void test_downloader_get_https_partial_content(void)
 	dl_wait_for_event(DOWNLOADER_EVT_DEINITIALIZED, K_SECONDS(1));
 }
 
+void test_downloader_get_https_partial_content_pipelined(void)
+{
+	int err;
+	struct downloader_evt evt;
+
+	err = downloader_init(&dl, &dl_cfg);
+	TEST_ASSERT_EQUAL(0, err);
+
+	err = downloader_transport_http_set_config(&dl, &dl_http_cfg_pipeline);
+	TEST_ASSERT_EQUAL(0, err);
+
+	zsock_getaddrinfo_fake.custom_fake = zsock_getaddrinfo_server_ok;
+	zsock_freeaddrinfo_fake.custom_fake = zsock_freeaddrinfo_server_ipv6;
+	z_impl_zsock_socket_fake.custom_fake = z_impl_zsock_socket_https_ipv6_ok;
+	z_impl_zsock_connect_fake.custom_fake = z_impl_zsock_connect_ipv6_ok;
+	z_impl_zsock_setsockopt_fake.custom_fake = z_impl_zsock_setsockopt_https_ok;
+	z_impl_zsock_sendto_fake.custom_fake = z_impl_zsock_sendto_ok;
+	z_impl_zsock_recvfrom_fake.custom_fake = z_impl_zsock_recvfrom_https_partial_content_pipelined;
+
+	err = downloader_get(&dl, &dl_host_conf_w_sec_tags_range_override_32, HTTPS_URL, 0);
+	TEST_ASSERT_EQUAL(0, err);
+
+	evt = dl_wait_for_event(DOWNLOADER_EVT_DONE, K_SECONDS(3));
+
+	downloader_deinit(&dl);
+	dl_wait_for_event(DOWNLOADER_EVT_DEINITIALIZED, K_SECONDS(1));
+}
+
 void test_downloader_get_https_partial_content_partial_2nd_header(void)
 {
 	int err;